@@ -74,7 +74,43 @@ HEADERS += ./Grammar.h \
     $$PWD/StopExecuteDialog.h \
     $$PWD/LoadException.h \
     $$PWD/SaveException.h \
-    $$PWD/ErrorDialog.h
+    $$PWD/ErrorDialog.h \
+    $$PWD/CompilerOptions.h \
+    $$PWD/InstructionFuser.h \
+    $$PWD/JitEmitter.h \
+    $$PWD/JitRuntime.h \
+    $$PWD/JitFunction.h \
+    $$PWD/JitCompiler.h \
+    $$PWD/CommandLine.h \
+    $$PWD/CppTranspiler.h \
+    $$PWD/IrInstruction.h \
+    $$PWD/IrBlock.h \
+    $$PWD/IrFunction.h \
+    $$PWD/IrModule.h \
+    $$PWD/IrBuilder.h \
+    $$PWD/IrVerifier.h \
+    $$PWD/IrPass.h \
+    $$PWD/IrPassManager.h \
+    $$PWD/IrConstantPropagation.h \
+    $$PWD/IrDeadCodeElimination.h \
+    $$PWD/LoopInvariantHoister.h \
+    $$PWD/FunctionInliner.h \
+    $$PWD/TailCallEliminator.h \
+    $$PWD/PurityAnalysis.h \
+    $$PWD/MemoCache.h \
+    $$PWD/PartialEvaluator.h \
+    $$PWD/StrengthReducer.h \
+    $$PWD/IntegerTypeInference.h \
+    $$PWD/NumericPolicy.h \
+    $$PWD/ControlFlowSimplifier.h \
+    $$PWD/ExpressionInterner.h \
+    $$PWD/AtomTable.h \
+    $$PWD/ProgramCache.h \
+    $$PWD/IncrementalCache.h \
+    $$PWD/DiagnosticsEngine.h \
+    $$PWD/ModuleLoader.h \
+    $$PWD/CompilationDump.h \
+    $$PWD/Builtins.h
 SOURCES += ./main.cpp \
     ./Grammar.cpp \
     ./LabelStack.cpp \
@@ -133,7 +169,40 @@ SOURCES += ./main.cpp \
     $$PWD/StopExecuteDialog.cpp \
     $$PWD/LoadException.cpp \
     $$PWD/SaveException.cpp \
-    $$PWD/ErrorDialog.cpp
+    $$PWD/ErrorDialog.cpp \
+    $$PWD/InstructionFuser.cpp \
+    $$PWD/JitEmitter.cpp \
+    $$PWD/JitRuntime.cpp \
+    $$PWD/JitFunction.cpp \
+    $$PWD/JitCompiler.cpp \
+    $$PWD/CommandLine.cpp \
+    $$PWD/CppTranspiler.cpp \
+    $$PWD/IrInstruction.cpp \
+    $$PWD/IrBlock.cpp \
+    $$PWD/IrFunction.cpp \
+    $$PWD/IrModule.cpp \
+    $$PWD/IrBuilder.cpp \
+    $$PWD/IrVerifier.cpp \
+    $$PWD/IrPassManager.cpp \
+    $$PWD/IrConstantPropagation.cpp \
+    $$PWD/IrDeadCodeElimination.cpp \
+    $$PWD/LoopInvariantHoister.cpp \
+    $$PWD/FunctionInliner.cpp \
+    $$PWD/TailCallEliminator.cpp \
+    $$PWD/PurityAnalysis.cpp \
+    $$PWD/MemoCache.cpp \
+    $$PWD/PartialEvaluator.cpp \
+    $$PWD/StrengthReducer.cpp \
+    $$PWD/IntegerTypeInference.cpp \
+    $$PWD/ControlFlowSimplifier.cpp \
+    $$PWD/ExpressionInterner.cpp \
+    $$PWD/AtomTable.cpp \
+    $$PWD/ProgramCache.cpp \
+    $$PWD/IncrementalCache.cpp \
+    $$PWD/DiagnosticsEngine.cpp \
+    $$PWD/ModuleLoader.cpp \
+    $$PWD/CompilationDump.cpp \
+    $$PWD/Builtins.cpp
 
 RESOURCES += \
     $$PWD/Resources.qrc
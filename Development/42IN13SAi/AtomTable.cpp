@@ -0,0 +1,30 @@
+#include "AtomTable.h"
+
+std::mutex AtomTable::mutex;
+std::unordered_map<std::string, Atom> AtomTable::atoms = { { "", 0 } };
+std::vector<std::string> AtomTable::texts = { "" };
+
+Atom AtomTable::Intern(const std::string& text)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	auto atom = atoms.find(text);
+	if (atom != atoms.end())
+		return atom->second;
+
+	Atom newAtom = (Atom)texts.size();
+	atoms[text] = newAtom;
+	texts.push_back(text);
+	return newAtom;
+}
+
+std::string AtomTable::GetText(Atom atom)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return atom < texts.size() ? texts[atom] : "";
+}
+
+int AtomTable::Size()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return (int)texts.size();
+}
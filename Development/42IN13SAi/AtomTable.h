@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// The number of a name in the AtomTable, two names are the same when their atoms are
+typedef uint32_t Atom;
+
+// Every identifier, variable and function name of the program gets a number
+// once, when the tokenizer reads it:
+//
+//   var total = 0;        total -> 1
+//   total = total + i;    total -> 1, i -> 2
+//   prnt(square(total));  square -> 3
+//
+// The tokens, the name nodes, the symbols and the subroutines keep the atom
+// next to their text, so the symbol tables and the VirtualMachine compare an
+// integer instead of a string. The text is only needed for the messages and
+// the output. Atom 0 is the empty name. The table is shared by every compile
+// and only grows, an atom stays valid as long as the program runs.
+class AtomTable
+{
+public:
+	static Atom Intern(const std::string& text);
+	static std::string GetText(Atom atom);
+	static int Size();
+
+private:
+	static std::mutex mutex;
+	static std::unordered_map<std::string, Atom> atoms;
+	static std::vector<std::string> texts;
+};
@@ -0,0 +1,4005 @@
+func Main()
+[
+	var t = 0;
+	t = t + 0 * 2 + sqr(0);
+	t = t + 1 * 2 + sqr(1);
+	t = t + 2 * 2 + sqr(2);
+	t = t + 3 * 2 + sqr(3);
+	t = t + 4 * 2 + sqr(4);
+	t = t + 5 * 2 + sqr(5);
+	t = t + 6 * 2 + sqr(6);
+	t = t + 7 * 2 + sqr(0);
+	t = t + 8 * 2 + sqr(1);
+	t = t + 9 * 2 + sqr(2);
+	t = t + 10 * 2 + sqr(3);
+	t = t + 11 * 2 + sqr(4);
+	t = t + 12 * 2 + sqr(5);
+	t = t + 13 * 2 + sqr(6);
+	t = t + 14 * 2 + sqr(0);
+	t = t + 15 * 2 + sqr(1);
+	t = t + 16 * 2 + sqr(2);
+	t = t + 17 * 2 + sqr(3);
+	t = t + 18 * 2 + sqr(4);
+	t = t + 19 * 2 + sqr(5);
+	t = t + 20 * 2 + sqr(6);
+	t = t + 21 * 2 + sqr(0);
+	t = t + 22 * 2 + sqr(1);
+	t = t + 23 * 2 + sqr(2);
+	t = t + 24 * 2 + sqr(3);
+	t = t + 25 * 2 + sqr(4);
+	t = t + 26 * 2 + sqr(5);
+	t = t + 27 * 2 + sqr(6);
+	t = t + 28 * 2 + sqr(0);
+	t = t + 29 * 2 + sqr(1);
+	t = t + 30 * 2 + sqr(2);
+	t = t + 31 * 2 + sqr(3);
+	t = t + 32 * 2 + sqr(4);
+	t = t + 33 * 2 + sqr(5);
+	t = t + 34 * 2 + sqr(6);
+	t = t + 35 * 2 + sqr(0);
+	t = t + 36 * 2 + sqr(1);
+	t = t + 37 * 2 + sqr(2);
+	t = t + 38 * 2 + sqr(3);
+	t = t + 39 * 2 + sqr(4);
+	t = t + 40 * 2 + sqr(5);
+	t = t + 41 * 2 + sqr(6);
+	t = t + 42 * 2 + sqr(0);
+	t = t + 43 * 2 + sqr(1);
+	t = t + 44 * 2 + sqr(2);
+	t = t + 45 * 2 + sqr(3);
+	t = t + 46 * 2 + sqr(4);
+	t = t + 47 * 2 + sqr(5);
+	t = t + 48 * 2 + sqr(6);
+	t = t + 49 * 2 + sqr(0);
+	t = t + 50 * 2 + sqr(1);
+	t = t + 51 * 2 + sqr(2);
+	t = t + 52 * 2 + sqr(3);
+	t = t + 53 * 2 + sqr(4);
+	t = t + 54 * 2 + sqr(5);
+	t = t + 55 * 2 + sqr(6);
+	t = t + 56 * 2 + sqr(0);
+	t = t + 57 * 2 + sqr(1);
+	t = t + 58 * 2 + sqr(2);
+	t = t + 59 * 2 + sqr(3);
+	t = t + 60 * 2 + sqr(4);
+	t = t + 61 * 2 + sqr(5);
+	t = t + 62 * 2 + sqr(6);
+	t = t + 63 * 2 + sqr(0);
+	t = t + 64 * 2 + sqr(1);
+	t = t + 65 * 2 + sqr(2);
+	t = t + 66 * 2 + sqr(3);
+	t = t + 67 * 2 + sqr(4);
+	t = t + 68 * 2 + sqr(5);
+	t = t + 69 * 2 + sqr(6);
+	t = t + 70 * 2 + sqr(0);
+	t = t + 71 * 2 + sqr(1);
+	t = t + 72 * 2 + sqr(2);
+	t = t + 73 * 2 + sqr(3);
+	t = t + 74 * 2 + sqr(4);
+	t = t + 75 * 2 + sqr(5);
+	t = t + 76 * 2 + sqr(6);
+	t = t + 77 * 2 + sqr(0);
+	t = t + 78 * 2 + sqr(1);
+	t = t + 79 * 2 + sqr(2);
+	t = t + 80 * 2 + sqr(3);
+	t = t + 81 * 2 + sqr(4);
+	t = t + 82 * 2 + sqr(5);
+	t = t + 83 * 2 + sqr(6);
+	t = t + 84 * 2 + sqr(0);
+	t = t + 85 * 2 + sqr(1);
+	t = t + 86 * 2 + sqr(2);
+	t = t + 87 * 2 + sqr(3);
+	t = t + 88 * 2 + sqr(4);
+	t = t + 89 * 2 + sqr(5);
+	t = t + 90 * 2 + sqr(6);
+	t = t + 91 * 2 + sqr(0);
+	t = t + 92 * 2 + sqr(1);
+	t = t + 93 * 2 + sqr(2);
+	t = t + 94 * 2 + sqr(3);
+	t = t + 95 * 2 + sqr(4);
+	t = t + 96 * 2 + sqr(5);
+	t = t + 97 * 2 + sqr(6);
+	t = t + 98 * 2 + sqr(0);
+	t = t + 99 * 2 + sqr(1);
+	t = t + 100 * 2 + sqr(2);
+	t = t + 101 * 2 + sqr(3);
+	t = t + 102 * 2 + sqr(4);
+	t = t + 103 * 2 + sqr(5);
+	t = t + 104 * 2 + sqr(6);
+	t = t + 105 * 2 + sqr(0);
+	t = t + 106 * 2 + sqr(1);
+	t = t + 107 * 2 + sqr(2);
+	t = t + 108 * 2 + sqr(3);
+	t = t + 109 * 2 + sqr(4);
+	t = t + 110 * 2 + sqr(5);
+	t = t + 111 * 2 + sqr(6);
+	t = t + 112 * 2 + sqr(0);
+	t = t + 113 * 2 + sqr(1);
+	t = t + 114 * 2 + sqr(2);
+	t = t + 115 * 2 + sqr(3);
+	t = t + 116 * 2 + sqr(4);
+	t = t + 117 * 2 + sqr(5);
+	t = t + 118 * 2 + sqr(6);
+	t = t + 119 * 2 + sqr(0);
+	t = t + 120 * 2 + sqr(1);
+	t = t + 121 * 2 + sqr(2);
+	t = t + 122 * 2 + sqr(3);
+	t = t + 123 * 2 + sqr(4);
+	t = t + 124 * 2 + sqr(5);
+	t = t + 125 * 2 + sqr(6);
+	t = t + 126 * 2 + sqr(0);
+	t = t + 127 * 2 + sqr(1);
+	t = t + 128 * 2 + sqr(2);
+	t = t + 129 * 2 + sqr(3);
+	t = t + 130 * 2 + sqr(4);
+	t = t + 131 * 2 + sqr(5);
+	t = t + 132 * 2 + sqr(6);
+	t = t + 133 * 2 + sqr(0);
+	t = t + 134 * 2 + sqr(1);
+	t = t + 135 * 2 + sqr(2);
+	t = t + 136 * 2 + sqr(3);
+	t = t + 137 * 2 + sqr(4);
+	t = t + 138 * 2 + sqr(5);
+	t = t + 139 * 2 + sqr(6);
+	t = t + 140 * 2 + sqr(0);
+	t = t + 141 * 2 + sqr(1);
+	t = t + 142 * 2 + sqr(2);
+	t = t + 143 * 2 + sqr(3);
+	t = t + 144 * 2 + sqr(4);
+	t = t + 145 * 2 + sqr(5);
+	t = t + 146 * 2 + sqr(6);
+	t = t + 147 * 2 + sqr(0);
+	t = t + 148 * 2 + sqr(1);
+	t = t + 149 * 2 + sqr(2);
+	t = t + 150 * 2 + sqr(3);
+	t = t + 151 * 2 + sqr(4);
+	t = t + 152 * 2 + sqr(5);
+	t = t + 153 * 2 + sqr(6);
+	t = t + 154 * 2 + sqr(0);
+	t = t + 155 * 2 + sqr(1);
+	t = t + 156 * 2 + sqr(2);
+	t = t + 157 * 2 + sqr(3);
+	t = t + 158 * 2 + sqr(4);
+	t = t + 159 * 2 + sqr(5);
+	t = t + 160 * 2 + sqr(6);
+	t = t + 161 * 2 + sqr(0);
+	t = t + 162 * 2 + sqr(1);
+	t = t + 163 * 2 + sqr(2);
+	t = t + 164 * 2 + sqr(3);
+	t = t + 165 * 2 + sqr(4);
+	t = t + 166 * 2 + sqr(5);
+	t = t + 167 * 2 + sqr(6);
+	t = t + 168 * 2 + sqr(0);
+	t = t + 169 * 2 + sqr(1);
+	t = t + 170 * 2 + sqr(2);
+	t = t + 171 * 2 + sqr(3);
+	t = t + 172 * 2 + sqr(4);
+	t = t + 173 * 2 + sqr(5);
+	t = t + 174 * 2 + sqr(6);
+	t = t + 175 * 2 + sqr(0);
+	t = t + 176 * 2 + sqr(1);
+	t = t + 177 * 2 + sqr(2);
+	t = t + 178 * 2 + sqr(3);
+	t = t + 179 * 2 + sqr(4);
+	t = t + 180 * 2 + sqr(5);
+	t = t + 181 * 2 + sqr(6);
+	t = t + 182 * 2 + sqr(0);
+	t = t + 183 * 2 + sqr(1);
+	t = t + 184 * 2 + sqr(2);
+	t = t + 185 * 2 + sqr(3);
+	t = t + 186 * 2 + sqr(4);
+	t = t + 187 * 2 + sqr(5);
+	t = t + 188 * 2 + sqr(6);
+	t = t + 189 * 2 + sqr(0);
+	t = t + 190 * 2 + sqr(1);
+	t = t + 191 * 2 + sqr(2);
+	t = t + 192 * 2 + sqr(3);
+	t = t + 193 * 2 + sqr(4);
+	t = t + 194 * 2 + sqr(5);
+	t = t + 195 * 2 + sqr(6);
+	t = t + 196 * 2 + sqr(0);
+	t = t + 197 * 2 + sqr(1);
+	t = t + 198 * 2 + sqr(2);
+	t = t + 199 * 2 + sqr(3);
+	t = t + 200 * 2 + sqr(4);
+	t = t + 201 * 2 + sqr(5);
+	t = t + 202 * 2 + sqr(6);
+	t = t + 203 * 2 + sqr(0);
+	t = t + 204 * 2 + sqr(1);
+	t = t + 205 * 2 + sqr(2);
+	t = t + 206 * 2 + sqr(3);
+	t = t + 207 * 2 + sqr(4);
+	t = t + 208 * 2 + sqr(5);
+	t = t + 209 * 2 + sqr(6);
+	t = t + 210 * 2 + sqr(0);
+	t = t + 211 * 2 + sqr(1);
+	t = t + 212 * 2 + sqr(2);
+	t = t + 213 * 2 + sqr(3);
+	t = t + 214 * 2 + sqr(4);
+	t = t + 215 * 2 + sqr(5);
+	t = t + 216 * 2 + sqr(6);
+	t = t + 217 * 2 + sqr(0);
+	t = t + 218 * 2 + sqr(1);
+	t = t + 219 * 2 + sqr(2);
+	t = t + 220 * 2 + sqr(3);
+	t = t + 221 * 2 + sqr(4);
+	t = t + 222 * 2 + sqr(5);
+	t = t + 223 * 2 + sqr(6);
+	t = t + 224 * 2 + sqr(0);
+	t = t + 225 * 2 + sqr(1);
+	t = t + 226 * 2 + sqr(2);
+	t = t + 227 * 2 + sqr(3);
+	t = t + 228 * 2 + sqr(4);
+	t = t + 229 * 2 + sqr(5);
+	t = t + 230 * 2 + sqr(6);
+	t = t + 231 * 2 + sqr(0);
+	t = t + 232 * 2 + sqr(1);
+	t = t + 233 * 2 + sqr(2);
+	t = t + 234 * 2 + sqr(3);
+	t = t + 235 * 2 + sqr(4);
+	t = t + 236 * 2 + sqr(5);
+	t = t + 237 * 2 + sqr(6);
+	t = t + 238 * 2 + sqr(0);
+	t = t + 239 * 2 + sqr(1);
+	t = t + 240 * 2 + sqr(2);
+	t = t + 241 * 2 + sqr(3);
+	t = t + 242 * 2 + sqr(4);
+	t = t + 243 * 2 + sqr(5);
+	t = t + 244 * 2 + sqr(6);
+	t = t + 245 * 2 + sqr(0);
+	t = t + 246 * 2 + sqr(1);
+	t = t + 247 * 2 + sqr(2);
+	t = t + 248 * 2 + sqr(3);
+	t = t + 249 * 2 + sqr(4);
+	t = t + 250 * 2 + sqr(5);
+	t = t + 251 * 2 + sqr(6);
+	t = t + 252 * 2 + sqr(0);
+	t = t + 253 * 2 + sqr(1);
+	t = t + 254 * 2 + sqr(2);
+	t = t + 255 * 2 + sqr(3);
+	t = t + 256 * 2 + sqr(4);
+	t = t + 257 * 2 + sqr(5);
+	t = t + 258 * 2 + sqr(6);
+	t = t + 259 * 2 + sqr(0);
+	t = t + 260 * 2 + sqr(1);
+	t = t + 261 * 2 + sqr(2);
+	t = t + 262 * 2 + sqr(3);
+	t = t + 263 * 2 + sqr(4);
+	t = t + 264 * 2 + sqr(5);
+	t = t + 265 * 2 + sqr(6);
+	t = t + 266 * 2 + sqr(0);
+	t = t + 267 * 2 + sqr(1);
+	t = t + 268 * 2 + sqr(2);
+	t = t + 269 * 2 + sqr(3);
+	t = t + 270 * 2 + sqr(4);
+	t = t + 271 * 2 + sqr(5);
+	t = t + 272 * 2 + sqr(6);
+	t = t + 273 * 2 + sqr(0);
+	t = t + 274 * 2 + sqr(1);
+	t = t + 275 * 2 + sqr(2);
+	t = t + 276 * 2 + sqr(3);
+	t = t + 277 * 2 + sqr(4);
+	t = t + 278 * 2 + sqr(5);
+	t = t + 279 * 2 + sqr(6);
+	t = t + 280 * 2 + sqr(0);
+	t = t + 281 * 2 + sqr(1);
+	t = t + 282 * 2 + sqr(2);
+	t = t + 283 * 2 + sqr(3);
+	t = t + 284 * 2 + sqr(4);
+	t = t + 285 * 2 + sqr(5);
+	t = t + 286 * 2 + sqr(6);
+	t = t + 287 * 2 + sqr(0);
+	t = t + 288 * 2 + sqr(1);
+	t = t + 289 * 2 + sqr(2);
+	t = t + 290 * 2 + sqr(3);
+	t = t + 291 * 2 + sqr(4);
+	t = t + 292 * 2 + sqr(5);
+	t = t + 293 * 2 + sqr(6);
+	t = t + 294 * 2 + sqr(0);
+	t = t + 295 * 2 + sqr(1);
+	t = t + 296 * 2 + sqr(2);
+	t = t + 297 * 2 + sqr(3);
+	t = t + 298 * 2 + sqr(4);
+	t = t + 299 * 2 + sqr(5);
+	t = t + 300 * 2 + sqr(6);
+	t = t + 301 * 2 + sqr(0);
+	t = t + 302 * 2 + sqr(1);
+	t = t + 303 * 2 + sqr(2);
+	t = t + 304 * 2 + sqr(3);
+	t = t + 305 * 2 + sqr(4);
+	t = t + 306 * 2 + sqr(5);
+	t = t + 307 * 2 + sqr(6);
+	t = t + 308 * 2 + sqr(0);
+	t = t + 309 * 2 + sqr(1);
+	t = t + 310 * 2 + sqr(2);
+	t = t + 311 * 2 + sqr(3);
+	t = t + 312 * 2 + sqr(4);
+	t = t + 313 * 2 + sqr(5);
+	t = t + 314 * 2 + sqr(6);
+	t = t + 315 * 2 + sqr(0);
+	t = t + 316 * 2 + sqr(1);
+	t = t + 317 * 2 + sqr(2);
+	t = t + 318 * 2 + sqr(3);
+	t = t + 319 * 2 + sqr(4);
+	t = t + 320 * 2 + sqr(5);
+	t = t + 321 * 2 + sqr(6);
+	t = t + 322 * 2 + sqr(0);
+	t = t + 323 * 2 + sqr(1);
+	t = t + 324 * 2 + sqr(2);
+	t = t + 325 * 2 + sqr(3);
+	t = t + 326 * 2 + sqr(4);
+	t = t + 327 * 2 + sqr(5);
+	t = t + 328 * 2 + sqr(6);
+	t = t + 329 * 2 + sqr(0);
+	t = t + 330 * 2 + sqr(1);
+	t = t + 331 * 2 + sqr(2);
+	t = t + 332 * 2 + sqr(3);
+	t = t + 333 * 2 + sqr(4);
+	t = t + 334 * 2 + sqr(5);
+	t = t + 335 * 2 + sqr(6);
+	t = t + 336 * 2 + sqr(0);
+	t = t + 337 * 2 + sqr(1);
+	t = t + 338 * 2 + sqr(2);
+	t = t + 339 * 2 + sqr(3);
+	t = t + 340 * 2 + sqr(4);
+	t = t + 341 * 2 + sqr(5);
+	t = t + 342 * 2 + sqr(6);
+	t = t + 343 * 2 + sqr(0);
+	t = t + 344 * 2 + sqr(1);
+	t = t + 345 * 2 + sqr(2);
+	t = t + 346 * 2 + sqr(3);
+	t = t + 347 * 2 + sqr(4);
+	t = t + 348 * 2 + sqr(5);
+	t = t + 349 * 2 + sqr(6);
+	t = t + 350 * 2 + sqr(0);
+	t = t + 351 * 2 + sqr(1);
+	t = t + 352 * 2 + sqr(2);
+	t = t + 353 * 2 + sqr(3);
+	t = t + 354 * 2 + sqr(4);
+	t = t + 355 * 2 + sqr(5);
+	t = t + 356 * 2 + sqr(6);
+	t = t + 357 * 2 + sqr(0);
+	t = t + 358 * 2 + sqr(1);
+	t = t + 359 * 2 + sqr(2);
+	t = t + 360 * 2 + sqr(3);
+	t = t + 361 * 2 + sqr(4);
+	t = t + 362 * 2 + sqr(5);
+	t = t + 363 * 2 + sqr(6);
+	t = t + 364 * 2 + sqr(0);
+	t = t + 365 * 2 + sqr(1);
+	t = t + 366 * 2 + sqr(2);
+	t = t + 367 * 2 + sqr(3);
+	t = t + 368 * 2 + sqr(4);
+	t = t + 369 * 2 + sqr(5);
+	t = t + 370 * 2 + sqr(6);
+	t = t + 371 * 2 + sqr(0);
+	t = t + 372 * 2 + sqr(1);
+	t = t + 373 * 2 + sqr(2);
+	t = t + 374 * 2 + sqr(3);
+	t = t + 375 * 2 + sqr(4);
+	t = t + 376 * 2 + sqr(5);
+	t = t + 377 * 2 + sqr(6);
+	t = t + 378 * 2 + sqr(0);
+	t = t + 379 * 2 + sqr(1);
+	t = t + 380 * 2 + sqr(2);
+	t = t + 381 * 2 + sqr(3);
+	t = t + 382 * 2 + sqr(4);
+	t = t + 383 * 2 + sqr(5);
+	t = t + 384 * 2 + sqr(6);
+	t = t + 385 * 2 + sqr(0);
+	t = t + 386 * 2 + sqr(1);
+	t = t + 387 * 2 + sqr(2);
+	t = t + 388 * 2 + sqr(3);
+	t = t + 389 * 2 + sqr(4);
+	t = t + 390 * 2 + sqr(5);
+	t = t + 391 * 2 + sqr(6);
+	t = t + 392 * 2 + sqr(0);
+	t = t + 393 * 2 + sqr(1);
+	t = t + 394 * 2 + sqr(2);
+	t = t + 395 * 2 + sqr(3);
+	t = t + 396 * 2 + sqr(4);
+	t = t + 397 * 2 + sqr(5);
+	t = t + 398 * 2 + sqr(6);
+	t = t + 399 * 2 + sqr(0);
+	t = t + 400 * 2 + sqr(1);
+	t = t + 401 * 2 + sqr(2);
+	t = t + 402 * 2 + sqr(3);
+	t = t + 403 * 2 + sqr(4);
+	t = t + 404 * 2 + sqr(5);
+	t = t + 405 * 2 + sqr(6);
+	t = t + 406 * 2 + sqr(0);
+	t = t + 407 * 2 + sqr(1);
+	t = t + 408 * 2 + sqr(2);
+	t = t + 409 * 2 + sqr(3);
+	t = t + 410 * 2 + sqr(4);
+	t = t + 411 * 2 + sqr(5);
+	t = t + 412 * 2 + sqr(6);
+	t = t + 413 * 2 + sqr(0);
+	t = t + 414 * 2 + sqr(1);
+	t = t + 415 * 2 + sqr(2);
+	t = t + 416 * 2 + sqr(3);
+	t = t + 417 * 2 + sqr(4);
+	t = t + 418 * 2 + sqr(5);
+	t = t + 419 * 2 + sqr(6);
+	t = t + 420 * 2 + sqr(0);
+	t = t + 421 * 2 + sqr(1);
+	t = t + 422 * 2 + sqr(2);
+	t = t + 423 * 2 + sqr(3);
+	t = t + 424 * 2 + sqr(4);
+	t = t + 425 * 2 + sqr(5);
+	t = t + 426 * 2 + sqr(6);
+	t = t + 427 * 2 + sqr(0);
+	t = t + 428 * 2 + sqr(1);
+	t = t + 429 * 2 + sqr(2);
+	t = t + 430 * 2 + sqr(3);
+	t = t + 431 * 2 + sqr(4);
+	t = t + 432 * 2 + sqr(5);
+	t = t + 433 * 2 + sqr(6);
+	t = t + 434 * 2 + sqr(0);
+	t = t + 435 * 2 + sqr(1);
+	t = t + 436 * 2 + sqr(2);
+	t = t + 437 * 2 + sqr(3);
+	t = t + 438 * 2 + sqr(4);
+	t = t + 439 * 2 + sqr(5);
+	t = t + 440 * 2 + sqr(6);
+	t = t + 441 * 2 + sqr(0);
+	t = t + 442 * 2 + sqr(1);
+	t = t + 443 * 2 + sqr(2);
+	t = t + 444 * 2 + sqr(3);
+	t = t + 445 * 2 + sqr(4);
+	t = t + 446 * 2 + sqr(5);
+	t = t + 447 * 2 + sqr(6);
+	t = t + 448 * 2 + sqr(0);
+	t = t + 449 * 2 + sqr(1);
+	t = t + 450 * 2 + sqr(2);
+	t = t + 451 * 2 + sqr(3);
+	t = t + 452 * 2 + sqr(4);
+	t = t + 453 * 2 + sqr(5);
+	t = t + 454 * 2 + sqr(6);
+	t = t + 455 * 2 + sqr(0);
+	t = t + 456 * 2 + sqr(1);
+	t = t + 457 * 2 + sqr(2);
+	t = t + 458 * 2 + sqr(3);
+	t = t + 459 * 2 + sqr(4);
+	t = t + 460 * 2 + sqr(5);
+	t = t + 461 * 2 + sqr(6);
+	t = t + 462 * 2 + sqr(0);
+	t = t + 463 * 2 + sqr(1);
+	t = t + 464 * 2 + sqr(2);
+	t = t + 465 * 2 + sqr(3);
+	t = t + 466 * 2 + sqr(4);
+	t = t + 467 * 2 + sqr(5);
+	t = t + 468 * 2 + sqr(6);
+	t = t + 469 * 2 + sqr(0);
+	t = t + 470 * 2 + sqr(1);
+	t = t + 471 * 2 + sqr(2);
+	t = t + 472 * 2 + sqr(3);
+	t = t + 473 * 2 + sqr(4);
+	t = t + 474 * 2 + sqr(5);
+	t = t + 475 * 2 + sqr(6);
+	t = t + 476 * 2 + sqr(0);
+	t = t + 477 * 2 + sqr(1);
+	t = t + 478 * 2 + sqr(2);
+	t = t + 479 * 2 + sqr(3);
+	t = t + 480 * 2 + sqr(4);
+	t = t + 481 * 2 + sqr(5);
+	t = t + 482 * 2 + sqr(6);
+	t = t + 483 * 2 + sqr(0);
+	t = t + 484 * 2 + sqr(1);
+	t = t + 485 * 2 + sqr(2);
+	t = t + 486 * 2 + sqr(3);
+	t = t + 487 * 2 + sqr(4);
+	t = t + 488 * 2 + sqr(5);
+	t = t + 489 * 2 + sqr(6);
+	t = t + 490 * 2 + sqr(0);
+	t = t + 491 * 2 + sqr(1);
+	t = t + 492 * 2 + sqr(2);
+	t = t + 493 * 2 + sqr(3);
+	t = t + 494 * 2 + sqr(4);
+	t = t + 495 * 2 + sqr(5);
+	t = t + 496 * 2 + sqr(6);
+	t = t + 497 * 2 + sqr(0);
+	t = t + 498 * 2 + sqr(1);
+	t = t + 499 * 2 + sqr(2);
+	t = t + 500 * 2 + sqr(3);
+	t = t + 501 * 2 + sqr(4);
+	t = t + 502 * 2 + sqr(5);
+	t = t + 503 * 2 + sqr(6);
+	t = t + 504 * 2 + sqr(0);
+	t = t + 505 * 2 + sqr(1);
+	t = t + 506 * 2 + sqr(2);
+	t = t + 507 * 2 + sqr(3);
+	t = t + 508 * 2 + sqr(4);
+	t = t + 509 * 2 + sqr(5);
+	t = t + 510 * 2 + sqr(6);
+	t = t + 511 * 2 + sqr(0);
+	t = t + 512 * 2 + sqr(1);
+	t = t + 513 * 2 + sqr(2);
+	t = t + 514 * 2 + sqr(3);
+	t = t + 515 * 2 + sqr(4);
+	t = t + 516 * 2 + sqr(5);
+	t = t + 517 * 2 + sqr(6);
+	t = t + 518 * 2 + sqr(0);
+	t = t + 519 * 2 + sqr(1);
+	t = t + 520 * 2 + sqr(2);
+	t = t + 521 * 2 + sqr(3);
+	t = t + 522 * 2 + sqr(4);
+	t = t + 523 * 2 + sqr(5);
+	t = t + 524 * 2 + sqr(6);
+	t = t + 525 * 2 + sqr(0);
+	t = t + 526 * 2 + sqr(1);
+	t = t + 527 * 2 + sqr(2);
+	t = t + 528 * 2 + sqr(3);
+	t = t + 529 * 2 + sqr(4);
+	t = t + 530 * 2 + sqr(5);
+	t = t + 531 * 2 + sqr(6);
+	t = t + 532 * 2 + sqr(0);
+	t = t + 533 * 2 + sqr(1);
+	t = t + 534 * 2 + sqr(2);
+	t = t + 535 * 2 + sqr(3);
+	t = t + 536 * 2 + sqr(4);
+	t = t + 537 * 2 + sqr(5);
+	t = t + 538 * 2 + sqr(6);
+	t = t + 539 * 2 + sqr(0);
+	t = t + 540 * 2 + sqr(1);
+	t = t + 541 * 2 + sqr(2);
+	t = t + 542 * 2 + sqr(3);
+	t = t + 543 * 2 + sqr(4);
+	t = t + 544 * 2 + sqr(5);
+	t = t + 545 * 2 + sqr(6);
+	t = t + 546 * 2 + sqr(0);
+	t = t + 547 * 2 + sqr(1);
+	t = t + 548 * 2 + sqr(2);
+	t = t + 549 * 2 + sqr(3);
+	t = t + 550 * 2 + sqr(4);
+	t = t + 551 * 2 + sqr(5);
+	t = t + 552 * 2 + sqr(6);
+	t = t + 553 * 2 + sqr(0);
+	t = t + 554 * 2 + sqr(1);
+	t = t + 555 * 2 + sqr(2);
+	t = t + 556 * 2 + sqr(3);
+	t = t + 557 * 2 + sqr(4);
+	t = t + 558 * 2 + sqr(5);
+	t = t + 559 * 2 + sqr(6);
+	t = t + 560 * 2 + sqr(0);
+	t = t + 561 * 2 + sqr(1);
+	t = t + 562 * 2 + sqr(2);
+	t = t + 563 * 2 + sqr(3);
+	t = t + 564 * 2 + sqr(4);
+	t = t + 565 * 2 + sqr(5);
+	t = t + 566 * 2 + sqr(6);
+	t = t + 567 * 2 + sqr(0);
+	t = t + 568 * 2 + sqr(1);
+	t = t + 569 * 2 + sqr(2);
+	t = t + 570 * 2 + sqr(3);
+	t = t + 571 * 2 + sqr(4);
+	t = t + 572 * 2 + sqr(5);
+	t = t + 573 * 2 + sqr(6);
+	t = t + 574 * 2 + sqr(0);
+	t = t + 575 * 2 + sqr(1);
+	t = t + 576 * 2 + sqr(2);
+	t = t + 577 * 2 + sqr(3);
+	t = t + 578 * 2 + sqr(4);
+	t = t + 579 * 2 + sqr(5);
+	t = t + 580 * 2 + sqr(6);
+	t = t + 581 * 2 + sqr(0);
+	t = t + 582 * 2 + sqr(1);
+	t = t + 583 * 2 + sqr(2);
+	t = t + 584 * 2 + sqr(3);
+	t = t + 585 * 2 + sqr(4);
+	t = t + 586 * 2 + sqr(5);
+	t = t + 587 * 2 + sqr(6);
+	t = t + 588 * 2 + sqr(0);
+	t = t + 589 * 2 + sqr(1);
+	t = t + 590 * 2 + sqr(2);
+	t = t + 591 * 2 + sqr(3);
+	t = t + 592 * 2 + sqr(4);
+	t = t + 593 * 2 + sqr(5);
+	t = t + 594 * 2 + sqr(6);
+	t = t + 595 * 2 + sqr(0);
+	t = t + 596 * 2 + sqr(1);
+	t = t + 597 * 2 + sqr(2);
+	t = t + 598 * 2 + sqr(3);
+	t = t + 599 * 2 + sqr(4);
+	t = t + 600 * 2 + sqr(5);
+	t = t + 601 * 2 + sqr(6);
+	t = t + 602 * 2 + sqr(0);
+	t = t + 603 * 2 + sqr(1);
+	t = t + 604 * 2 + sqr(2);
+	t = t + 605 * 2 + sqr(3);
+	t = t + 606 * 2 + sqr(4);
+	t = t + 607 * 2 + sqr(5);
+	t = t + 608 * 2 + sqr(6);
+	t = t + 609 * 2 + sqr(0);
+	t = t + 610 * 2 + sqr(1);
+	t = t + 611 * 2 + sqr(2);
+	t = t + 612 * 2 + sqr(3);
+	t = t + 613 * 2 + sqr(4);
+	t = t + 614 * 2 + sqr(5);
+	t = t + 615 * 2 + sqr(6);
+	t = t + 616 * 2 + sqr(0);
+	t = t + 617 * 2 + sqr(1);
+	t = t + 618 * 2 + sqr(2);
+	t = t + 619 * 2 + sqr(3);
+	t = t + 620 * 2 + sqr(4);
+	t = t + 621 * 2 + sqr(5);
+	t = t + 622 * 2 + sqr(6);
+	t = t + 623 * 2 + sqr(0);
+	t = t + 624 * 2 + sqr(1);
+	t = t + 625 * 2 + sqr(2);
+	t = t + 626 * 2 + sqr(3);
+	t = t + 627 * 2 + sqr(4);
+	t = t + 628 * 2 + sqr(5);
+	t = t + 629 * 2 + sqr(6);
+	t = t + 630 * 2 + sqr(0);
+	t = t + 631 * 2 + sqr(1);
+	t = t + 632 * 2 + sqr(2);
+	t = t + 633 * 2 + sqr(3);
+	t = t + 634 * 2 + sqr(4);
+	t = t + 635 * 2 + sqr(5);
+	t = t + 636 * 2 + sqr(6);
+	t = t + 637 * 2 + sqr(0);
+	t = t + 638 * 2 + sqr(1);
+	t = t + 639 * 2 + sqr(2);
+	t = t + 640 * 2 + sqr(3);
+	t = t + 641 * 2 + sqr(4);
+	t = t + 642 * 2 + sqr(5);
+	t = t + 643 * 2 + sqr(6);
+	t = t + 644 * 2 + sqr(0);
+	t = t + 645 * 2 + sqr(1);
+	t = t + 646 * 2 + sqr(2);
+	t = t + 647 * 2 + sqr(3);
+	t = t + 648 * 2 + sqr(4);
+	t = t + 649 * 2 + sqr(5);
+	t = t + 650 * 2 + sqr(6);
+	t = t + 651 * 2 + sqr(0);
+	t = t + 652 * 2 + sqr(1);
+	t = t + 653 * 2 + sqr(2);
+	t = t + 654 * 2 + sqr(3);
+	t = t + 655 * 2 + sqr(4);
+	t = t + 656 * 2 + sqr(5);
+	t = t + 657 * 2 + sqr(6);
+	t = t + 658 * 2 + sqr(0);
+	t = t + 659 * 2 + sqr(1);
+	t = t + 660 * 2 + sqr(2);
+	t = t + 661 * 2 + sqr(3);
+	t = t + 662 * 2 + sqr(4);
+	t = t + 663 * 2 + sqr(5);
+	t = t + 664 * 2 + sqr(6);
+	t = t + 665 * 2 + sqr(0);
+	t = t + 666 * 2 + sqr(1);
+	t = t + 667 * 2 + sqr(2);
+	t = t + 668 * 2 + sqr(3);
+	t = t + 669 * 2 + sqr(4);
+	t = t + 670 * 2 + sqr(5);
+	t = t + 671 * 2 + sqr(6);
+	t = t + 672 * 2 + sqr(0);
+	t = t + 673 * 2 + sqr(1);
+	t = t + 674 * 2 + sqr(2);
+	t = t + 675 * 2 + sqr(3);
+	t = t + 676 * 2 + sqr(4);
+	t = t + 677 * 2 + sqr(5);
+	t = t + 678 * 2 + sqr(6);
+	t = t + 679 * 2 + sqr(0);
+	t = t + 680 * 2 + sqr(1);
+	t = t + 681 * 2 + sqr(2);
+	t = t + 682 * 2 + sqr(3);
+	t = t + 683 * 2 + sqr(4);
+	t = t + 684 * 2 + sqr(5);
+	t = t + 685 * 2 + sqr(6);
+	t = t + 686 * 2 + sqr(0);
+	t = t + 687 * 2 + sqr(1);
+	t = t + 688 * 2 + sqr(2);
+	t = t + 689 * 2 + sqr(3);
+	t = t + 690 * 2 + sqr(4);
+	t = t + 691 * 2 + sqr(5);
+	t = t + 692 * 2 + sqr(6);
+	t = t + 693 * 2 + sqr(0);
+	t = t + 694 * 2 + sqr(1);
+	t = t + 695 * 2 + sqr(2);
+	t = t + 696 * 2 + sqr(3);
+	t = t + 697 * 2 + sqr(4);
+	t = t + 698 * 2 + sqr(5);
+	t = t + 699 * 2 + sqr(6);
+	t = t + 700 * 2 + sqr(0);
+	t = t + 701 * 2 + sqr(1);
+	t = t + 702 * 2 + sqr(2);
+	t = t + 703 * 2 + sqr(3);
+	t = t + 704 * 2 + sqr(4);
+	t = t + 705 * 2 + sqr(5);
+	t = t + 706 * 2 + sqr(6);
+	t = t + 707 * 2 + sqr(0);
+	t = t + 708 * 2 + sqr(1);
+	t = t + 709 * 2 + sqr(2);
+	t = t + 710 * 2 + sqr(3);
+	t = t + 711 * 2 + sqr(4);
+	t = t + 712 * 2 + sqr(5);
+	t = t + 713 * 2 + sqr(6);
+	t = t + 714 * 2 + sqr(0);
+	t = t + 715 * 2 + sqr(1);
+	t = t + 716 * 2 + sqr(2);
+	t = t + 717 * 2 + sqr(3);
+	t = t + 718 * 2 + sqr(4);
+	t = t + 719 * 2 + sqr(5);
+	t = t + 720 * 2 + sqr(6);
+	t = t + 721 * 2 + sqr(0);
+	t = t + 722 * 2 + sqr(1);
+	t = t + 723 * 2 + sqr(2);
+	t = t + 724 * 2 + sqr(3);
+	t = t + 725 * 2 + sqr(4);
+	t = t + 726 * 2 + sqr(5);
+	t = t + 727 * 2 + sqr(6);
+	t = t + 728 * 2 + sqr(0);
+	t = t + 729 * 2 + sqr(1);
+	t = t + 730 * 2 + sqr(2);
+	t = t + 731 * 2 + sqr(3);
+	t = t + 732 * 2 + sqr(4);
+	t = t + 733 * 2 + sqr(5);
+	t = t + 734 * 2 + sqr(6);
+	t = t + 735 * 2 + sqr(0);
+	t = t + 736 * 2 + sqr(1);
+	t = t + 737 * 2 + sqr(2);
+	t = t + 738 * 2 + sqr(3);
+	t = t + 739 * 2 + sqr(4);
+	t = t + 740 * 2 + sqr(5);
+	t = t + 741 * 2 + sqr(6);
+	t = t + 742 * 2 + sqr(0);
+	t = t + 743 * 2 + sqr(1);
+	t = t + 744 * 2 + sqr(2);
+	t = t + 745 * 2 + sqr(3);
+	t = t + 746 * 2 + sqr(4);
+	t = t + 747 * 2 + sqr(5);
+	t = t + 748 * 2 + sqr(6);
+	t = t + 749 * 2 + sqr(0);
+	t = t + 750 * 2 + sqr(1);
+	t = t + 751 * 2 + sqr(2);
+	t = t + 752 * 2 + sqr(3);
+	t = t + 753 * 2 + sqr(4);
+	t = t + 754 * 2 + sqr(5);
+	t = t + 755 * 2 + sqr(6);
+	t = t + 756 * 2 + sqr(0);
+	t = t + 757 * 2 + sqr(1);
+	t = t + 758 * 2 + sqr(2);
+	t = t + 759 * 2 + sqr(3);
+	t = t + 760 * 2 + sqr(4);
+	t = t + 761 * 2 + sqr(5);
+	t = t + 762 * 2 + sqr(6);
+	t = t + 763 * 2 + sqr(0);
+	t = t + 764 * 2 + sqr(1);
+	t = t + 765 * 2 + sqr(2);
+	t = t + 766 * 2 + sqr(3);
+	t = t + 767 * 2 + sqr(4);
+	t = t + 768 * 2 + sqr(5);
+	t = t + 769 * 2 + sqr(6);
+	t = t + 770 * 2 + sqr(0);
+	t = t + 771 * 2 + sqr(1);
+	t = t + 772 * 2 + sqr(2);
+	t = t + 773 * 2 + sqr(3);
+	t = t + 774 * 2 + sqr(4);
+	t = t + 775 * 2 + sqr(5);
+	t = t + 776 * 2 + sqr(6);
+	t = t + 777 * 2 + sqr(0);
+	t = t + 778 * 2 + sqr(1);
+	t = t + 779 * 2 + sqr(2);
+	t = t + 780 * 2 + sqr(3);
+	t = t + 781 * 2 + sqr(4);
+	t = t + 782 * 2 + sqr(5);
+	t = t + 783 * 2 + sqr(6);
+	t = t + 784 * 2 + sqr(0);
+	t = t + 785 * 2 + sqr(1);
+	t = t + 786 * 2 + sqr(2);
+	t = t + 787 * 2 + sqr(3);
+	t = t + 788 * 2 + sqr(4);
+	t = t + 789 * 2 + sqr(5);
+	t = t + 790 * 2 + sqr(6);
+	t = t + 791 * 2 + sqr(0);
+	t = t + 792 * 2 + sqr(1);
+	t = t + 793 * 2 + sqr(2);
+	t = t + 794 * 2 + sqr(3);
+	t = t + 795 * 2 + sqr(4);
+	t = t + 796 * 2 + sqr(5);
+	t = t + 797 * 2 + sqr(6);
+	t = t + 798 * 2 + sqr(0);
+	t = t + 799 * 2 + sqr(1);
+	t = t + 800 * 2 + sqr(2);
+	t = t + 801 * 2 + sqr(3);
+	t = t + 802 * 2 + sqr(4);
+	t = t + 803 * 2 + sqr(5);
+	t = t + 804 * 2 + sqr(6);
+	t = t + 805 * 2 + sqr(0);
+	t = t + 806 * 2 + sqr(1);
+	t = t + 807 * 2 + sqr(2);
+	t = t + 808 * 2 + sqr(3);
+	t = t + 809 * 2 + sqr(4);
+	t = t + 810 * 2 + sqr(5);
+	t = t + 811 * 2 + sqr(6);
+	t = t + 812 * 2 + sqr(0);
+	t = t + 813 * 2 + sqr(1);
+	t = t + 814 * 2 + sqr(2);
+	t = t + 815 * 2 + sqr(3);
+	t = t + 816 * 2 + sqr(4);
+	t = t + 817 * 2 + sqr(5);
+	t = t + 818 * 2 + sqr(6);
+	t = t + 819 * 2 + sqr(0);
+	t = t + 820 * 2 + sqr(1);
+	t = t + 821 * 2 + sqr(2);
+	t = t + 822 * 2 + sqr(3);
+	t = t + 823 * 2 + sqr(4);
+	t = t + 824 * 2 + sqr(5);
+	t = t + 825 * 2 + sqr(6);
+	t = t + 826 * 2 + sqr(0);
+	t = t + 827 * 2 + sqr(1);
+	t = t + 828 * 2 + sqr(2);
+	t = t + 829 * 2 + sqr(3);
+	t = t + 830 * 2 + sqr(4);
+	t = t + 831 * 2 + sqr(5);
+	t = t + 832 * 2 + sqr(6);
+	t = t + 833 * 2 + sqr(0);
+	t = t + 834 * 2 + sqr(1);
+	t = t + 835 * 2 + sqr(2);
+	t = t + 836 * 2 + sqr(3);
+	t = t + 837 * 2 + sqr(4);
+	t = t + 838 * 2 + sqr(5);
+	t = t + 839 * 2 + sqr(6);
+	t = t + 840 * 2 + sqr(0);
+	t = t + 841 * 2 + sqr(1);
+	t = t + 842 * 2 + sqr(2);
+	t = t + 843 * 2 + sqr(3);
+	t = t + 844 * 2 + sqr(4);
+	t = t + 845 * 2 + sqr(5);
+	t = t + 846 * 2 + sqr(6);
+	t = t + 847 * 2 + sqr(0);
+	t = t + 848 * 2 + sqr(1);
+	t = t + 849 * 2 + sqr(2);
+	t = t + 850 * 2 + sqr(3);
+	t = t + 851 * 2 + sqr(4);
+	t = t + 852 * 2 + sqr(5);
+	t = t + 853 * 2 + sqr(6);
+	t = t + 854 * 2 + sqr(0);
+	t = t + 855 * 2 + sqr(1);
+	t = t + 856 * 2 + sqr(2);
+	t = t + 857 * 2 + sqr(3);
+	t = t + 858 * 2 + sqr(4);
+	t = t + 859 * 2 + sqr(5);
+	t = t + 860 * 2 + sqr(6);
+	t = t + 861 * 2 + sqr(0);
+	t = t + 862 * 2 + sqr(1);
+	t = t + 863 * 2 + sqr(2);
+	t = t + 864 * 2 + sqr(3);
+	t = t + 865 * 2 + sqr(4);
+	t = t + 866 * 2 + sqr(5);
+	t = t + 867 * 2 + sqr(6);
+	t = t + 868 * 2 + sqr(0);
+	t = t + 869 * 2 + sqr(1);
+	t = t + 870 * 2 + sqr(2);
+	t = t + 871 * 2 + sqr(3);
+	t = t + 872 * 2 + sqr(4);
+	t = t + 873 * 2 + sqr(5);
+	t = t + 874 * 2 + sqr(6);
+	t = t + 875 * 2 + sqr(0);
+	t = t + 876 * 2 + sqr(1);
+	t = t + 877 * 2 + sqr(2);
+	t = t + 878 * 2 + sqr(3);
+	t = t + 879 * 2 + sqr(4);
+	t = t + 880 * 2 + sqr(5);
+	t = t + 881 * 2 + sqr(6);
+	t = t + 882 * 2 + sqr(0);
+	t = t + 883 * 2 + sqr(1);
+	t = t + 884 * 2 + sqr(2);
+	t = t + 885 * 2 + sqr(3);
+	t = t + 886 * 2 + sqr(4);
+	t = t + 887 * 2 + sqr(5);
+	t = t + 888 * 2 + sqr(6);
+	t = t + 889 * 2 + sqr(0);
+	t = t + 890 * 2 + sqr(1);
+	t = t + 891 * 2 + sqr(2);
+	t = t + 892 * 2 + sqr(3);
+	t = t + 893 * 2 + sqr(4);
+	t = t + 894 * 2 + sqr(5);
+	t = t + 895 * 2 + sqr(6);
+	t = t + 896 * 2 + sqr(0);
+	t = t + 897 * 2 + sqr(1);
+	t = t + 898 * 2 + sqr(2);
+	t = t + 899 * 2 + sqr(3);
+	t = t + 900 * 2 + sqr(4);
+	t = t + 901 * 2 + sqr(5);
+	t = t + 902 * 2 + sqr(6);
+	t = t + 903 * 2 + sqr(0);
+	t = t + 904 * 2 + sqr(1);
+	t = t + 905 * 2 + sqr(2);
+	t = t + 906 * 2 + sqr(3);
+	t = t + 907 * 2 + sqr(4);
+	t = t + 908 * 2 + sqr(5);
+	t = t + 909 * 2 + sqr(6);
+	t = t + 910 * 2 + sqr(0);
+	t = t + 911 * 2 + sqr(1);
+	t = t + 912 * 2 + sqr(2);
+	t = t + 913 * 2 + sqr(3);
+	t = t + 914 * 2 + sqr(4);
+	t = t + 915 * 2 + sqr(5);
+	t = t + 916 * 2 + sqr(6);
+	t = t + 917 * 2 + sqr(0);
+	t = t + 918 * 2 + sqr(1);
+	t = t + 919 * 2 + sqr(2);
+	t = t + 920 * 2 + sqr(3);
+	t = t + 921 * 2 + sqr(4);
+	t = t + 922 * 2 + sqr(5);
+	t = t + 923 * 2 + sqr(6);
+	t = t + 924 * 2 + sqr(0);
+	t = t + 925 * 2 + sqr(1);
+	t = t + 926 * 2 + sqr(2);
+	t = t + 927 * 2 + sqr(3);
+	t = t + 928 * 2 + sqr(4);
+	t = t + 929 * 2 + sqr(5);
+	t = t + 930 * 2 + sqr(6);
+	t = t + 931 * 2 + sqr(0);
+	t = t + 932 * 2 + sqr(1);
+	t = t + 933 * 2 + sqr(2);
+	t = t + 934 * 2 + sqr(3);
+	t = t + 935 * 2 + sqr(4);
+	t = t + 936 * 2 + sqr(5);
+	t = t + 937 * 2 + sqr(6);
+	t = t + 938 * 2 + sqr(0);
+	t = t + 939 * 2 + sqr(1);
+	t = t + 940 * 2 + sqr(2);
+	t = t + 941 * 2 + sqr(3);
+	t = t + 942 * 2 + sqr(4);
+	t = t + 943 * 2 + sqr(5);
+	t = t + 944 * 2 + sqr(6);
+	t = t + 945 * 2 + sqr(0);
+	t = t + 946 * 2 + sqr(1);
+	t = t + 947 * 2 + sqr(2);
+	t = t + 948 * 2 + sqr(3);
+	t = t + 949 * 2 + sqr(4);
+	t = t + 950 * 2 + sqr(5);
+	t = t + 951 * 2 + sqr(6);
+	t = t + 952 * 2 + sqr(0);
+	t = t + 953 * 2 + sqr(1);
+	t = t + 954 * 2 + sqr(2);
+	t = t + 955 * 2 + sqr(3);
+	t = t + 956 * 2 + sqr(4);
+	t = t + 957 * 2 + sqr(5);
+	t = t + 958 * 2 + sqr(6);
+	t = t + 959 * 2 + sqr(0);
+	t = t + 960 * 2 + sqr(1);
+	t = t + 961 * 2 + sqr(2);
+	t = t + 962 * 2 + sqr(3);
+	t = t + 963 * 2 + sqr(4);
+	t = t + 964 * 2 + sqr(5);
+	t = t + 965 * 2 + sqr(6);
+	t = t + 966 * 2 + sqr(0);
+	t = t + 967 * 2 + sqr(1);
+	t = t + 968 * 2 + sqr(2);
+	t = t + 969 * 2 + sqr(3);
+	t = t + 970 * 2 + sqr(4);
+	t = t + 971 * 2 + sqr(5);
+	t = t + 972 * 2 + sqr(6);
+	t = t + 973 * 2 + sqr(0);
+	t = t + 974 * 2 + sqr(1);
+	t = t + 975 * 2 + sqr(2);
+	t = t + 976 * 2 + sqr(3);
+	t = t + 977 * 2 + sqr(4);
+	t = t + 978 * 2 + sqr(5);
+	t = t + 979 * 2 + sqr(6);
+	t = t + 980 * 2 + sqr(0);
+	t = t + 981 * 2 + sqr(1);
+	t = t + 982 * 2 + sqr(2);
+	t = t + 983 * 2 + sqr(3);
+	t = t + 984 * 2 + sqr(4);
+	t = t + 985 * 2 + sqr(5);
+	t = t + 986 * 2 + sqr(6);
+	t = t + 987 * 2 + sqr(0);
+	t = t + 988 * 2 + sqr(1);
+	t = t + 989 * 2 + sqr(2);
+	t = t + 990 * 2 + sqr(3);
+	t = t + 991 * 2 + sqr(4);
+	t = t + 992 * 2 + sqr(5);
+	t = t + 993 * 2 + sqr(6);
+	t = t + 994 * 2 + sqr(0);
+	t = t + 995 * 2 + sqr(1);
+	t = t + 996 * 2 + sqr(2);
+	t = t + 997 * 2 + sqr(3);
+	t = t + 998 * 2 + sqr(4);
+	t = t + 999 * 2 + sqr(5);
+	t = t + 1000 * 2 + sqr(6);
+	t = t + 1001 * 2 + sqr(0);
+	t = t + 1002 * 2 + sqr(1);
+	t = t + 1003 * 2 + sqr(2);
+	t = t + 1004 * 2 + sqr(3);
+	t = t + 1005 * 2 + sqr(4);
+	t = t + 1006 * 2 + sqr(5);
+	t = t + 1007 * 2 + sqr(6);
+	t = t + 1008 * 2 + sqr(0);
+	t = t + 1009 * 2 + sqr(1);
+	t = t + 1010 * 2 + sqr(2);
+	t = t + 1011 * 2 + sqr(3);
+	t = t + 1012 * 2 + sqr(4);
+	t = t + 1013 * 2 + sqr(5);
+	t = t + 1014 * 2 + sqr(6);
+	t = t + 1015 * 2 + sqr(0);
+	t = t + 1016 * 2 + sqr(1);
+	t = t + 1017 * 2 + sqr(2);
+	t = t + 1018 * 2 + sqr(3);
+	t = t + 1019 * 2 + sqr(4);
+	t = t + 1020 * 2 + sqr(5);
+	t = t + 1021 * 2 + sqr(6);
+	t = t + 1022 * 2 + sqr(0);
+	t = t + 1023 * 2 + sqr(1);
+	t = t + 1024 * 2 + sqr(2);
+	t = t + 1025 * 2 + sqr(3);
+	t = t + 1026 * 2 + sqr(4);
+	t = t + 1027 * 2 + sqr(5);
+	t = t + 1028 * 2 + sqr(6);
+	t = t + 1029 * 2 + sqr(0);
+	t = t + 1030 * 2 + sqr(1);
+	t = t + 1031 * 2 + sqr(2);
+	t = t + 1032 * 2 + sqr(3);
+	t = t + 1033 * 2 + sqr(4);
+	t = t + 1034 * 2 + sqr(5);
+	t = t + 1035 * 2 + sqr(6);
+	t = t + 1036 * 2 + sqr(0);
+	t = t + 1037 * 2 + sqr(1);
+	t = t + 1038 * 2 + sqr(2);
+	t = t + 1039 * 2 + sqr(3);
+	t = t + 1040 * 2 + sqr(4);
+	t = t + 1041 * 2 + sqr(5);
+	t = t + 1042 * 2 + sqr(6);
+	t = t + 1043 * 2 + sqr(0);
+	t = t + 1044 * 2 + sqr(1);
+	t = t + 1045 * 2 + sqr(2);
+	t = t + 1046 * 2 + sqr(3);
+	t = t + 1047 * 2 + sqr(4);
+	t = t + 1048 * 2 + sqr(5);
+	t = t + 1049 * 2 + sqr(6);
+	t = t + 1050 * 2 + sqr(0);
+	t = t + 1051 * 2 + sqr(1);
+	t = t + 1052 * 2 + sqr(2);
+	t = t + 1053 * 2 + sqr(3);
+	t = t + 1054 * 2 + sqr(4);
+	t = t + 1055 * 2 + sqr(5);
+	t = t + 1056 * 2 + sqr(6);
+	t = t + 1057 * 2 + sqr(0);
+	t = t + 1058 * 2 + sqr(1);
+	t = t + 1059 * 2 + sqr(2);
+	t = t + 1060 * 2 + sqr(3);
+	t = t + 1061 * 2 + sqr(4);
+	t = t + 1062 * 2 + sqr(5);
+	t = t + 1063 * 2 + sqr(6);
+	t = t + 1064 * 2 + sqr(0);
+	t = t + 1065 * 2 + sqr(1);
+	t = t + 1066 * 2 + sqr(2);
+	t = t + 1067 * 2 + sqr(3);
+	t = t + 1068 * 2 + sqr(4);
+	t = t + 1069 * 2 + sqr(5);
+	t = t + 1070 * 2 + sqr(6);
+	t = t + 1071 * 2 + sqr(0);
+	t = t + 1072 * 2 + sqr(1);
+	t = t + 1073 * 2 + sqr(2);
+	t = t + 1074 * 2 + sqr(3);
+	t = t + 1075 * 2 + sqr(4);
+	t = t + 1076 * 2 + sqr(5);
+	t = t + 1077 * 2 + sqr(6);
+	t = t + 1078 * 2 + sqr(0);
+	t = t + 1079 * 2 + sqr(1);
+	t = t + 1080 * 2 + sqr(2);
+	t = t + 1081 * 2 + sqr(3);
+	t = t + 1082 * 2 + sqr(4);
+	t = t + 1083 * 2 + sqr(5);
+	t = t + 1084 * 2 + sqr(6);
+	t = t + 1085 * 2 + sqr(0);
+	t = t + 1086 * 2 + sqr(1);
+	t = t + 1087 * 2 + sqr(2);
+	t = t + 1088 * 2 + sqr(3);
+	t = t + 1089 * 2 + sqr(4);
+	t = t + 1090 * 2 + sqr(5);
+	t = t + 1091 * 2 + sqr(6);
+	t = t + 1092 * 2 + sqr(0);
+	t = t + 1093 * 2 + sqr(1);
+	t = t + 1094 * 2 + sqr(2);
+	t = t + 1095 * 2 + sqr(3);
+	t = t + 1096 * 2 + sqr(4);
+	t = t + 1097 * 2 + sqr(5);
+	t = t + 1098 * 2 + sqr(6);
+	t = t + 1099 * 2 + sqr(0);
+	t = t + 1100 * 2 + sqr(1);
+	t = t + 1101 * 2 + sqr(2);
+	t = t + 1102 * 2 + sqr(3);
+	t = t + 1103 * 2 + sqr(4);
+	t = t + 1104 * 2 + sqr(5);
+	t = t + 1105 * 2 + sqr(6);
+	t = t + 1106 * 2 + sqr(0);
+	t = t + 1107 * 2 + sqr(1);
+	t = t + 1108 * 2 + sqr(2);
+	t = t + 1109 * 2 + sqr(3);
+	t = t + 1110 * 2 + sqr(4);
+	t = t + 1111 * 2 + sqr(5);
+	t = t + 1112 * 2 + sqr(6);
+	t = t + 1113 * 2 + sqr(0);
+	t = t + 1114 * 2 + sqr(1);
+	t = t + 1115 * 2 + sqr(2);
+	t = t + 1116 * 2 + sqr(3);
+	t = t + 1117 * 2 + sqr(4);
+	t = t + 1118 * 2 + sqr(5);
+	t = t + 1119 * 2 + sqr(6);
+	t = t + 1120 * 2 + sqr(0);
+	t = t + 1121 * 2 + sqr(1);
+	t = t + 1122 * 2 + sqr(2);
+	t = t + 1123 * 2 + sqr(3);
+	t = t + 1124 * 2 + sqr(4);
+	t = t + 1125 * 2 + sqr(5);
+	t = t + 1126 * 2 + sqr(6);
+	t = t + 1127 * 2 + sqr(0);
+	t = t + 1128 * 2 + sqr(1);
+	t = t + 1129 * 2 + sqr(2);
+	t = t + 1130 * 2 + sqr(3);
+	t = t + 1131 * 2 + sqr(4);
+	t = t + 1132 * 2 + sqr(5);
+	t = t + 1133 * 2 + sqr(6);
+	t = t + 1134 * 2 + sqr(0);
+	t = t + 1135 * 2 + sqr(1);
+	t = t + 1136 * 2 + sqr(2);
+	t = t + 1137 * 2 + sqr(3);
+	t = t + 1138 * 2 + sqr(4);
+	t = t + 1139 * 2 + sqr(5);
+	t = t + 1140 * 2 + sqr(6);
+	t = t + 1141 * 2 + sqr(0);
+	t = t + 1142 * 2 + sqr(1);
+	t = t + 1143 * 2 + sqr(2);
+	t = t + 1144 * 2 + sqr(3);
+	t = t + 1145 * 2 + sqr(4);
+	t = t + 1146 * 2 + sqr(5);
+	t = t + 1147 * 2 + sqr(6);
+	t = t + 1148 * 2 + sqr(0);
+	t = t + 1149 * 2 + sqr(1);
+	t = t + 1150 * 2 + sqr(2);
+	t = t + 1151 * 2 + sqr(3);
+	t = t + 1152 * 2 + sqr(4);
+	t = t + 1153 * 2 + sqr(5);
+	t = t + 1154 * 2 + sqr(6);
+	t = t + 1155 * 2 + sqr(0);
+	t = t + 1156 * 2 + sqr(1);
+	t = t + 1157 * 2 + sqr(2);
+	t = t + 1158 * 2 + sqr(3);
+	t = t + 1159 * 2 + sqr(4);
+	t = t + 1160 * 2 + sqr(5);
+	t = t + 1161 * 2 + sqr(6);
+	t = t + 1162 * 2 + sqr(0);
+	t = t + 1163 * 2 + sqr(1);
+	t = t + 1164 * 2 + sqr(2);
+	t = t + 1165 * 2 + sqr(3);
+	t = t + 1166 * 2 + sqr(4);
+	t = t + 1167 * 2 + sqr(5);
+	t = t + 1168 * 2 + sqr(6);
+	t = t + 1169 * 2 + sqr(0);
+	t = t + 1170 * 2 + sqr(1);
+	t = t + 1171 * 2 + sqr(2);
+	t = t + 1172 * 2 + sqr(3);
+	t = t + 1173 * 2 + sqr(4);
+	t = t + 1174 * 2 + sqr(5);
+	t = t + 1175 * 2 + sqr(6);
+	t = t + 1176 * 2 + sqr(0);
+	t = t + 1177 * 2 + sqr(1);
+	t = t + 1178 * 2 + sqr(2);
+	t = t + 1179 * 2 + sqr(3);
+	t = t + 1180 * 2 + sqr(4);
+	t = t + 1181 * 2 + sqr(5);
+	t = t + 1182 * 2 + sqr(6);
+	t = t + 1183 * 2 + sqr(0);
+	t = t + 1184 * 2 + sqr(1);
+	t = t + 1185 * 2 + sqr(2);
+	t = t + 1186 * 2 + sqr(3);
+	t = t + 1187 * 2 + sqr(4);
+	t = t + 1188 * 2 + sqr(5);
+	t = t + 1189 * 2 + sqr(6);
+	t = t + 1190 * 2 + sqr(0);
+	t = t + 1191 * 2 + sqr(1);
+	t = t + 1192 * 2 + sqr(2);
+	t = t + 1193 * 2 + sqr(3);
+	t = t + 1194 * 2 + sqr(4);
+	t = t + 1195 * 2 + sqr(5);
+	t = t + 1196 * 2 + sqr(6);
+	t = t + 1197 * 2 + sqr(0);
+	t = t + 1198 * 2 + sqr(1);
+	t = t + 1199 * 2 + sqr(2);
+	t = t + 1200 * 2 + sqr(3);
+	t = t + 1201 * 2 + sqr(4);
+	t = t + 1202 * 2 + sqr(5);
+	t = t + 1203 * 2 + sqr(6);
+	t = t + 1204 * 2 + sqr(0);
+	t = t + 1205 * 2 + sqr(1);
+	t = t + 1206 * 2 + sqr(2);
+	t = t + 1207 * 2 + sqr(3);
+	t = t + 1208 * 2 + sqr(4);
+	t = t + 1209 * 2 + sqr(5);
+	t = t + 1210 * 2 + sqr(6);
+	t = t + 1211 * 2 + sqr(0);
+	t = t + 1212 * 2 + sqr(1);
+	t = t + 1213 * 2 + sqr(2);
+	t = t + 1214 * 2 + sqr(3);
+	t = t + 1215 * 2 + sqr(4);
+	t = t + 1216 * 2 + sqr(5);
+	t = t + 1217 * 2 + sqr(6);
+	t = t + 1218 * 2 + sqr(0);
+	t = t + 1219 * 2 + sqr(1);
+	t = t + 1220 * 2 + sqr(2);
+	t = t + 1221 * 2 + sqr(3);
+	t = t + 1222 * 2 + sqr(4);
+	t = t + 1223 * 2 + sqr(5);
+	t = t + 1224 * 2 + sqr(6);
+	t = t + 1225 * 2 + sqr(0);
+	t = t + 1226 * 2 + sqr(1);
+	t = t + 1227 * 2 + sqr(2);
+	t = t + 1228 * 2 + sqr(3);
+	t = t + 1229 * 2 + sqr(4);
+	t = t + 1230 * 2 + sqr(5);
+	t = t + 1231 * 2 + sqr(6);
+	t = t + 1232 * 2 + sqr(0);
+	t = t + 1233 * 2 + sqr(1);
+	t = t + 1234 * 2 + sqr(2);
+	t = t + 1235 * 2 + sqr(3);
+	t = t + 1236 * 2 + sqr(4);
+	t = t + 1237 * 2 + sqr(5);
+	t = t + 1238 * 2 + sqr(6);
+	t = t + 1239 * 2 + sqr(0);
+	t = t + 1240 * 2 + sqr(1);
+	t = t + 1241 * 2 + sqr(2);
+	t = t + 1242 * 2 + sqr(3);
+	t = t + 1243 * 2 + sqr(4);
+	t = t + 1244 * 2 + sqr(5);
+	t = t + 1245 * 2 + sqr(6);
+	t = t + 1246 * 2 + sqr(0);
+	t = t + 1247 * 2 + sqr(1);
+	t = t + 1248 * 2 + sqr(2);
+	t = t + 1249 * 2 + sqr(3);
+	t = t + 1250 * 2 + sqr(4);
+	t = t + 1251 * 2 + sqr(5);
+	t = t + 1252 * 2 + sqr(6);
+	t = t + 1253 * 2 + sqr(0);
+	t = t + 1254 * 2 + sqr(1);
+	t = t + 1255 * 2 + sqr(2);
+	t = t + 1256 * 2 + sqr(3);
+	t = t + 1257 * 2 + sqr(4);
+	t = t + 1258 * 2 + sqr(5);
+	t = t + 1259 * 2 + sqr(6);
+	t = t + 1260 * 2 + sqr(0);
+	t = t + 1261 * 2 + sqr(1);
+	t = t + 1262 * 2 + sqr(2);
+	t = t + 1263 * 2 + sqr(3);
+	t = t + 1264 * 2 + sqr(4);
+	t = t + 1265 * 2 + sqr(5);
+	t = t + 1266 * 2 + sqr(6);
+	t = t + 1267 * 2 + sqr(0);
+	t = t + 1268 * 2 + sqr(1);
+	t = t + 1269 * 2 + sqr(2);
+	t = t + 1270 * 2 + sqr(3);
+	t = t + 1271 * 2 + sqr(4);
+	t = t + 1272 * 2 + sqr(5);
+	t = t + 1273 * 2 + sqr(6);
+	t = t + 1274 * 2 + sqr(0);
+	t = t + 1275 * 2 + sqr(1);
+	t = t + 1276 * 2 + sqr(2);
+	t = t + 1277 * 2 + sqr(3);
+	t = t + 1278 * 2 + sqr(4);
+	t = t + 1279 * 2 + sqr(5);
+	t = t + 1280 * 2 + sqr(6);
+	t = t + 1281 * 2 + sqr(0);
+	t = t + 1282 * 2 + sqr(1);
+	t = t + 1283 * 2 + sqr(2);
+	t = t + 1284 * 2 + sqr(3);
+	t = t + 1285 * 2 + sqr(4);
+	t = t + 1286 * 2 + sqr(5);
+	t = t + 1287 * 2 + sqr(6);
+	t = t + 1288 * 2 + sqr(0);
+	t = t + 1289 * 2 + sqr(1);
+	t = t + 1290 * 2 + sqr(2);
+	t = t + 1291 * 2 + sqr(3);
+	t = t + 1292 * 2 + sqr(4);
+	t = t + 1293 * 2 + sqr(5);
+	t = t + 1294 * 2 + sqr(6);
+	t = t + 1295 * 2 + sqr(0);
+	t = t + 1296 * 2 + sqr(1);
+	t = t + 1297 * 2 + sqr(2);
+	t = t + 1298 * 2 + sqr(3);
+	t = t + 1299 * 2 + sqr(4);
+	t = t + 1300 * 2 + sqr(5);
+	t = t + 1301 * 2 + sqr(6);
+	t = t + 1302 * 2 + sqr(0);
+	t = t + 1303 * 2 + sqr(1);
+	t = t + 1304 * 2 + sqr(2);
+	t = t + 1305 * 2 + sqr(3);
+	t = t + 1306 * 2 + sqr(4);
+	t = t + 1307 * 2 + sqr(5);
+	t = t + 1308 * 2 + sqr(6);
+	t = t + 1309 * 2 + sqr(0);
+	t = t + 1310 * 2 + sqr(1);
+	t = t + 1311 * 2 + sqr(2);
+	t = t + 1312 * 2 + sqr(3);
+	t = t + 1313 * 2 + sqr(4);
+	t = t + 1314 * 2 + sqr(5);
+	t = t + 1315 * 2 + sqr(6);
+	t = t + 1316 * 2 + sqr(0);
+	t = t + 1317 * 2 + sqr(1);
+	t = t + 1318 * 2 + sqr(2);
+	t = t + 1319 * 2 + sqr(3);
+	t = t + 1320 * 2 + sqr(4);
+	t = t + 1321 * 2 + sqr(5);
+	t = t + 1322 * 2 + sqr(6);
+	t = t + 1323 * 2 + sqr(0);
+	t = t + 1324 * 2 + sqr(1);
+	t = t + 1325 * 2 + sqr(2);
+	t = t + 1326 * 2 + sqr(3);
+	t = t + 1327 * 2 + sqr(4);
+	t = t + 1328 * 2 + sqr(5);
+	t = t + 1329 * 2 + sqr(6);
+	t = t + 1330 * 2 + sqr(0);
+	t = t + 1331 * 2 + sqr(1);
+	t = t + 1332 * 2 + sqr(2);
+	t = t + 1333 * 2 + sqr(3);
+	t = t + 1334 * 2 + sqr(4);
+	t = t + 1335 * 2 + sqr(5);
+	t = t + 1336 * 2 + sqr(6);
+	t = t + 1337 * 2 + sqr(0);
+	t = t + 1338 * 2 + sqr(1);
+	t = t + 1339 * 2 + sqr(2);
+	t = t + 1340 * 2 + sqr(3);
+	t = t + 1341 * 2 + sqr(4);
+	t = t + 1342 * 2 + sqr(5);
+	t = t + 1343 * 2 + sqr(6);
+	t = t + 1344 * 2 + sqr(0);
+	t = t + 1345 * 2 + sqr(1);
+	t = t + 1346 * 2 + sqr(2);
+	t = t + 1347 * 2 + sqr(3);
+	t = t + 1348 * 2 + sqr(4);
+	t = t + 1349 * 2 + sqr(5);
+	t = t + 1350 * 2 + sqr(6);
+	t = t + 1351 * 2 + sqr(0);
+	t = t + 1352 * 2 + sqr(1);
+	t = t + 1353 * 2 + sqr(2);
+	t = t + 1354 * 2 + sqr(3);
+	t = t + 1355 * 2 + sqr(4);
+	t = t + 1356 * 2 + sqr(5);
+	t = t + 1357 * 2 + sqr(6);
+	t = t + 1358 * 2 + sqr(0);
+	t = t + 1359 * 2 + sqr(1);
+	t = t + 1360 * 2 + sqr(2);
+	t = t + 1361 * 2 + sqr(3);
+	t = t + 1362 * 2 + sqr(4);
+	t = t + 1363 * 2 + sqr(5);
+	t = t + 1364 * 2 + sqr(6);
+	t = t + 1365 * 2 + sqr(0);
+	t = t + 1366 * 2 + sqr(1);
+	t = t + 1367 * 2 + sqr(2);
+	t = t + 1368 * 2 + sqr(3);
+	t = t + 1369 * 2 + sqr(4);
+	t = t + 1370 * 2 + sqr(5);
+	t = t + 1371 * 2 + sqr(6);
+	t = t + 1372 * 2 + sqr(0);
+	t = t + 1373 * 2 + sqr(1);
+	t = t + 1374 * 2 + sqr(2);
+	t = t + 1375 * 2 + sqr(3);
+	t = t + 1376 * 2 + sqr(4);
+	t = t + 1377 * 2 + sqr(5);
+	t = t + 1378 * 2 + sqr(6);
+	t = t + 1379 * 2 + sqr(0);
+	t = t + 1380 * 2 + sqr(1);
+	t = t + 1381 * 2 + sqr(2);
+	t = t + 1382 * 2 + sqr(3);
+	t = t + 1383 * 2 + sqr(4);
+	t = t + 1384 * 2 + sqr(5);
+	t = t + 1385 * 2 + sqr(6);
+	t = t + 1386 * 2 + sqr(0);
+	t = t + 1387 * 2 + sqr(1);
+	t = t + 1388 * 2 + sqr(2);
+	t = t + 1389 * 2 + sqr(3);
+	t = t + 1390 * 2 + sqr(4);
+	t = t + 1391 * 2 + sqr(5);
+	t = t + 1392 * 2 + sqr(6);
+	t = t + 1393 * 2 + sqr(0);
+	t = t + 1394 * 2 + sqr(1);
+	t = t + 1395 * 2 + sqr(2);
+	t = t + 1396 * 2 + sqr(3);
+	t = t + 1397 * 2 + sqr(4);
+	t = t + 1398 * 2 + sqr(5);
+	t = t + 1399 * 2 + sqr(6);
+	t = t + 1400 * 2 + sqr(0);
+	t = t + 1401 * 2 + sqr(1);
+	t = t + 1402 * 2 + sqr(2);
+	t = t + 1403 * 2 + sqr(3);
+	t = t + 1404 * 2 + sqr(4);
+	t = t + 1405 * 2 + sqr(5);
+	t = t + 1406 * 2 + sqr(6);
+	t = t + 1407 * 2 + sqr(0);
+	t = t + 1408 * 2 + sqr(1);
+	t = t + 1409 * 2 + sqr(2);
+	t = t + 1410 * 2 + sqr(3);
+	t = t + 1411 * 2 + sqr(4);
+	t = t + 1412 * 2 + sqr(5);
+	t = t + 1413 * 2 + sqr(6);
+	t = t + 1414 * 2 + sqr(0);
+	t = t + 1415 * 2 + sqr(1);
+	t = t + 1416 * 2 + sqr(2);
+	t = t + 1417 * 2 + sqr(3);
+	t = t + 1418 * 2 + sqr(4);
+	t = t + 1419 * 2 + sqr(5);
+	t = t + 1420 * 2 + sqr(6);
+	t = t + 1421 * 2 + sqr(0);
+	t = t + 1422 * 2 + sqr(1);
+	t = t + 1423 * 2 + sqr(2);
+	t = t + 1424 * 2 + sqr(3);
+	t = t + 1425 * 2 + sqr(4);
+	t = t + 1426 * 2 + sqr(5);
+	t = t + 1427 * 2 + sqr(6);
+	t = t + 1428 * 2 + sqr(0);
+	t = t + 1429 * 2 + sqr(1);
+	t = t + 1430 * 2 + sqr(2);
+	t = t + 1431 * 2 + sqr(3);
+	t = t + 1432 * 2 + sqr(4);
+	t = t + 1433 * 2 + sqr(5);
+	t = t + 1434 * 2 + sqr(6);
+	t = t + 1435 * 2 + sqr(0);
+	t = t + 1436 * 2 + sqr(1);
+	t = t + 1437 * 2 + sqr(2);
+	t = t + 1438 * 2 + sqr(3);
+	t = t + 1439 * 2 + sqr(4);
+	t = t + 1440 * 2 + sqr(5);
+	t = t + 1441 * 2 + sqr(6);
+	t = t + 1442 * 2 + sqr(0);
+	t = t + 1443 * 2 + sqr(1);
+	t = t + 1444 * 2 + sqr(2);
+	t = t + 1445 * 2 + sqr(3);
+	t = t + 1446 * 2 + sqr(4);
+	t = t + 1447 * 2 + sqr(5);
+	t = t + 1448 * 2 + sqr(6);
+	t = t + 1449 * 2 + sqr(0);
+	t = t + 1450 * 2 + sqr(1);
+	t = t + 1451 * 2 + sqr(2);
+	t = t + 1452 * 2 + sqr(3);
+	t = t + 1453 * 2 + sqr(4);
+	t = t + 1454 * 2 + sqr(5);
+	t = t + 1455 * 2 + sqr(6);
+	t = t + 1456 * 2 + sqr(0);
+	t = t + 1457 * 2 + sqr(1);
+	t = t + 1458 * 2 + sqr(2);
+	t = t + 1459 * 2 + sqr(3);
+	t = t + 1460 * 2 + sqr(4);
+	t = t + 1461 * 2 + sqr(5);
+	t = t + 1462 * 2 + sqr(6);
+	t = t + 1463 * 2 + sqr(0);
+	t = t + 1464 * 2 + sqr(1);
+	t = t + 1465 * 2 + sqr(2);
+	t = t + 1466 * 2 + sqr(3);
+	t = t + 1467 * 2 + sqr(4);
+	t = t + 1468 * 2 + sqr(5);
+	t = t + 1469 * 2 + sqr(6);
+	t = t + 1470 * 2 + sqr(0);
+	t = t + 1471 * 2 + sqr(1);
+	t = t + 1472 * 2 + sqr(2);
+	t = t + 1473 * 2 + sqr(3);
+	t = t + 1474 * 2 + sqr(4);
+	t = t + 1475 * 2 + sqr(5);
+	t = t + 1476 * 2 + sqr(6);
+	t = t + 1477 * 2 + sqr(0);
+	t = t + 1478 * 2 + sqr(1);
+	t = t + 1479 * 2 + sqr(2);
+	t = t + 1480 * 2 + sqr(3);
+	t = t + 1481 * 2 + sqr(4);
+	t = t + 1482 * 2 + sqr(5);
+	t = t + 1483 * 2 + sqr(6);
+	t = t + 1484 * 2 + sqr(0);
+	t = t + 1485 * 2 + sqr(1);
+	t = t + 1486 * 2 + sqr(2);
+	t = t + 1487 * 2 + sqr(3);
+	t = t + 1488 * 2 + sqr(4);
+	t = t + 1489 * 2 + sqr(5);
+	t = t + 1490 * 2 + sqr(6);
+	t = t + 1491 * 2 + sqr(0);
+	t = t + 1492 * 2 + sqr(1);
+	t = t + 1493 * 2 + sqr(2);
+	t = t + 1494 * 2 + sqr(3);
+	t = t + 1495 * 2 + sqr(4);
+	t = t + 1496 * 2 + sqr(5);
+	t = t + 1497 * 2 + sqr(6);
+	t = t + 1498 * 2 + sqr(0);
+	t = t + 1499 * 2 + sqr(1);
+	t = t + 1500 * 2 + sqr(2);
+	t = t + 1501 * 2 + sqr(3);
+	t = t + 1502 * 2 + sqr(4);
+	t = t + 1503 * 2 + sqr(5);
+	t = t + 1504 * 2 + sqr(6);
+	t = t + 1505 * 2 + sqr(0);
+	t = t + 1506 * 2 + sqr(1);
+	t = t + 1507 * 2 + sqr(2);
+	t = t + 1508 * 2 + sqr(3);
+	t = t + 1509 * 2 + sqr(4);
+	t = t + 1510 * 2 + sqr(5);
+	t = t + 1511 * 2 + sqr(6);
+	t = t + 1512 * 2 + sqr(0);
+	t = t + 1513 * 2 + sqr(1);
+	t = t + 1514 * 2 + sqr(2);
+	t = t + 1515 * 2 + sqr(3);
+	t = t + 1516 * 2 + sqr(4);
+	t = t + 1517 * 2 + sqr(5);
+	t = t + 1518 * 2 + sqr(6);
+	t = t + 1519 * 2 + sqr(0);
+	t = t + 1520 * 2 + sqr(1);
+	t = t + 1521 * 2 + sqr(2);
+	t = t + 1522 * 2 + sqr(3);
+	t = t + 1523 * 2 + sqr(4);
+	t = t + 1524 * 2 + sqr(5);
+	t = t + 1525 * 2 + sqr(6);
+	t = t + 1526 * 2 + sqr(0);
+	t = t + 1527 * 2 + sqr(1);
+	t = t + 1528 * 2 + sqr(2);
+	t = t + 1529 * 2 + sqr(3);
+	t = t + 1530 * 2 + sqr(4);
+	t = t + 1531 * 2 + sqr(5);
+	t = t + 1532 * 2 + sqr(6);
+	t = t + 1533 * 2 + sqr(0);
+	t = t + 1534 * 2 + sqr(1);
+	t = t + 1535 * 2 + sqr(2);
+	t = t + 1536 * 2 + sqr(3);
+	t = t + 1537 * 2 + sqr(4);
+	t = t + 1538 * 2 + sqr(5);
+	t = t + 1539 * 2 + sqr(6);
+	t = t + 1540 * 2 + sqr(0);
+	t = t + 1541 * 2 + sqr(1);
+	t = t + 1542 * 2 + sqr(2);
+	t = t + 1543 * 2 + sqr(3);
+	t = t + 1544 * 2 + sqr(4);
+	t = t + 1545 * 2 + sqr(5);
+	t = t + 1546 * 2 + sqr(6);
+	t = t + 1547 * 2 + sqr(0);
+	t = t + 1548 * 2 + sqr(1);
+	t = t + 1549 * 2 + sqr(2);
+	t = t + 1550 * 2 + sqr(3);
+	t = t + 1551 * 2 + sqr(4);
+	t = t + 1552 * 2 + sqr(5);
+	t = t + 1553 * 2 + sqr(6);
+	t = t + 1554 * 2 + sqr(0);
+	t = t + 1555 * 2 + sqr(1);
+	t = t + 1556 * 2 + sqr(2);
+	t = t + 1557 * 2 + sqr(3);
+	t = t + 1558 * 2 + sqr(4);
+	t = t + 1559 * 2 + sqr(5);
+	t = t + 1560 * 2 + sqr(6);
+	t = t + 1561 * 2 + sqr(0);
+	t = t + 1562 * 2 + sqr(1);
+	t = t + 1563 * 2 + sqr(2);
+	t = t + 1564 * 2 + sqr(3);
+	t = t + 1565 * 2 + sqr(4);
+	t = t + 1566 * 2 + sqr(5);
+	t = t + 1567 * 2 + sqr(6);
+	t = t + 1568 * 2 + sqr(0);
+	t = t + 1569 * 2 + sqr(1);
+	t = t + 1570 * 2 + sqr(2);
+	t = t + 1571 * 2 + sqr(3);
+	t = t + 1572 * 2 + sqr(4);
+	t = t + 1573 * 2 + sqr(5);
+	t = t + 1574 * 2 + sqr(6);
+	t = t + 1575 * 2 + sqr(0);
+	t = t + 1576 * 2 + sqr(1);
+	t = t + 1577 * 2 + sqr(2);
+	t = t + 1578 * 2 + sqr(3);
+	t = t + 1579 * 2 + sqr(4);
+	t = t + 1580 * 2 + sqr(5);
+	t = t + 1581 * 2 + sqr(6);
+	t = t + 1582 * 2 + sqr(0);
+	t = t + 1583 * 2 + sqr(1);
+	t = t + 1584 * 2 + sqr(2);
+	t = t + 1585 * 2 + sqr(3);
+	t = t + 1586 * 2 + sqr(4);
+	t = t + 1587 * 2 + sqr(5);
+	t = t + 1588 * 2 + sqr(6);
+	t = t + 1589 * 2 + sqr(0);
+	t = t + 1590 * 2 + sqr(1);
+	t = t + 1591 * 2 + sqr(2);
+	t = t + 1592 * 2 + sqr(3);
+	t = t + 1593 * 2 + sqr(4);
+	t = t + 1594 * 2 + sqr(5);
+	t = t + 1595 * 2 + sqr(6);
+	t = t + 1596 * 2 + sqr(0);
+	t = t + 1597 * 2 + sqr(1);
+	t = t + 1598 * 2 + sqr(2);
+	t = t + 1599 * 2 + sqr(3);
+	t = t + 1600 * 2 + sqr(4);
+	t = t + 1601 * 2 + sqr(5);
+	t = t + 1602 * 2 + sqr(6);
+	t = t + 1603 * 2 + sqr(0);
+	t = t + 1604 * 2 + sqr(1);
+	t = t + 1605 * 2 + sqr(2);
+	t = t + 1606 * 2 + sqr(3);
+	t = t + 1607 * 2 + sqr(4);
+	t = t + 1608 * 2 + sqr(5);
+	t = t + 1609 * 2 + sqr(6);
+	t = t + 1610 * 2 + sqr(0);
+	t = t + 1611 * 2 + sqr(1);
+	t = t + 1612 * 2 + sqr(2);
+	t = t + 1613 * 2 + sqr(3);
+	t = t + 1614 * 2 + sqr(4);
+	t = t + 1615 * 2 + sqr(5);
+	t = t + 1616 * 2 + sqr(6);
+	t = t + 1617 * 2 + sqr(0);
+	t = t + 1618 * 2 + sqr(1);
+	t = t + 1619 * 2 + sqr(2);
+	t = t + 1620 * 2 + sqr(3);
+	t = t + 1621 * 2 + sqr(4);
+	t = t + 1622 * 2 + sqr(5);
+	t = t + 1623 * 2 + sqr(6);
+	t = t + 1624 * 2 + sqr(0);
+	t = t + 1625 * 2 + sqr(1);
+	t = t + 1626 * 2 + sqr(2);
+	t = t + 1627 * 2 + sqr(3);
+	t = t + 1628 * 2 + sqr(4);
+	t = t + 1629 * 2 + sqr(5);
+	t = t + 1630 * 2 + sqr(6);
+	t = t + 1631 * 2 + sqr(0);
+	t = t + 1632 * 2 + sqr(1);
+	t = t + 1633 * 2 + sqr(2);
+	t = t + 1634 * 2 + sqr(3);
+	t = t + 1635 * 2 + sqr(4);
+	t = t + 1636 * 2 + sqr(5);
+	t = t + 1637 * 2 + sqr(6);
+	t = t + 1638 * 2 + sqr(0);
+	t = t + 1639 * 2 + sqr(1);
+	t = t + 1640 * 2 + sqr(2);
+	t = t + 1641 * 2 + sqr(3);
+	t = t + 1642 * 2 + sqr(4);
+	t = t + 1643 * 2 + sqr(5);
+	t = t + 1644 * 2 + sqr(6);
+	t = t + 1645 * 2 + sqr(0);
+	t = t + 1646 * 2 + sqr(1);
+	t = t + 1647 * 2 + sqr(2);
+	t = t + 1648 * 2 + sqr(3);
+	t = t + 1649 * 2 + sqr(4);
+	t = t + 1650 * 2 + sqr(5);
+	t = t + 1651 * 2 + sqr(6);
+	t = t + 1652 * 2 + sqr(0);
+	t = t + 1653 * 2 + sqr(1);
+	t = t + 1654 * 2 + sqr(2);
+	t = t + 1655 * 2 + sqr(3);
+	t = t + 1656 * 2 + sqr(4);
+	t = t + 1657 * 2 + sqr(5);
+	t = t + 1658 * 2 + sqr(6);
+	t = t + 1659 * 2 + sqr(0);
+	t = t + 1660 * 2 + sqr(1);
+	t = t + 1661 * 2 + sqr(2);
+	t = t + 1662 * 2 + sqr(3);
+	t = t + 1663 * 2 + sqr(4);
+	t = t + 1664 * 2 + sqr(5);
+	t = t + 1665 * 2 + sqr(6);
+	t = t + 1666 * 2 + sqr(0);
+	t = t + 1667 * 2 + sqr(1);
+	t = t + 1668 * 2 + sqr(2);
+	t = t + 1669 * 2 + sqr(3);
+	t = t + 1670 * 2 + sqr(4);
+	t = t + 1671 * 2 + sqr(5);
+	t = t + 1672 * 2 + sqr(6);
+	t = t + 1673 * 2 + sqr(0);
+	t = t + 1674 * 2 + sqr(1);
+	t = t + 1675 * 2 + sqr(2);
+	t = t + 1676 * 2 + sqr(3);
+	t = t + 1677 * 2 + sqr(4);
+	t = t + 1678 * 2 + sqr(5);
+	t = t + 1679 * 2 + sqr(6);
+	t = t + 1680 * 2 + sqr(0);
+	t = t + 1681 * 2 + sqr(1);
+	t = t + 1682 * 2 + sqr(2);
+	t = t + 1683 * 2 + sqr(3);
+	t = t + 1684 * 2 + sqr(4);
+	t = t + 1685 * 2 + sqr(5);
+	t = t + 1686 * 2 + sqr(6);
+	t = t + 1687 * 2 + sqr(0);
+	t = t + 1688 * 2 + sqr(1);
+	t = t + 1689 * 2 + sqr(2);
+	t = t + 1690 * 2 + sqr(3);
+	t = t + 1691 * 2 + sqr(4);
+	t = t + 1692 * 2 + sqr(5);
+	t = t + 1693 * 2 + sqr(6);
+	t = t + 1694 * 2 + sqr(0);
+	t = t + 1695 * 2 + sqr(1);
+	t = t + 1696 * 2 + sqr(2);
+	t = t + 1697 * 2 + sqr(3);
+	t = t + 1698 * 2 + sqr(4);
+	t = t + 1699 * 2 + sqr(5);
+	t = t + 1700 * 2 + sqr(6);
+	t = t + 1701 * 2 + sqr(0);
+	t = t + 1702 * 2 + sqr(1);
+	t = t + 1703 * 2 + sqr(2);
+	t = t + 1704 * 2 + sqr(3);
+	t = t + 1705 * 2 + sqr(4);
+	t = t + 1706 * 2 + sqr(5);
+	t = t + 1707 * 2 + sqr(6);
+	t = t + 1708 * 2 + sqr(0);
+	t = t + 1709 * 2 + sqr(1);
+	t = t + 1710 * 2 + sqr(2);
+	t = t + 1711 * 2 + sqr(3);
+	t = t + 1712 * 2 + sqr(4);
+	t = t + 1713 * 2 + sqr(5);
+	t = t + 1714 * 2 + sqr(6);
+	t = t + 1715 * 2 + sqr(0);
+	t = t + 1716 * 2 + sqr(1);
+	t = t + 1717 * 2 + sqr(2);
+	t = t + 1718 * 2 + sqr(3);
+	t = t + 1719 * 2 + sqr(4);
+	t = t + 1720 * 2 + sqr(5);
+	t = t + 1721 * 2 + sqr(6);
+	t = t + 1722 * 2 + sqr(0);
+	t = t + 1723 * 2 + sqr(1);
+	t = t + 1724 * 2 + sqr(2);
+	t = t + 1725 * 2 + sqr(3);
+	t = t + 1726 * 2 + sqr(4);
+	t = t + 1727 * 2 + sqr(5);
+	t = t + 1728 * 2 + sqr(6);
+	t = t + 1729 * 2 + sqr(0);
+	t = t + 1730 * 2 + sqr(1);
+	t = t + 1731 * 2 + sqr(2);
+	t = t + 1732 * 2 + sqr(3);
+	t = t + 1733 * 2 + sqr(4);
+	t = t + 1734 * 2 + sqr(5);
+	t = t + 1735 * 2 + sqr(6);
+	t = t + 1736 * 2 + sqr(0);
+	t = t + 1737 * 2 + sqr(1);
+	t = t + 1738 * 2 + sqr(2);
+	t = t + 1739 * 2 + sqr(3);
+	t = t + 1740 * 2 + sqr(4);
+	t = t + 1741 * 2 + sqr(5);
+	t = t + 1742 * 2 + sqr(6);
+	t = t + 1743 * 2 + sqr(0);
+	t = t + 1744 * 2 + sqr(1);
+	t = t + 1745 * 2 + sqr(2);
+	t = t + 1746 * 2 + sqr(3);
+	t = t + 1747 * 2 + sqr(4);
+	t = t + 1748 * 2 + sqr(5);
+	t = t + 1749 * 2 + sqr(6);
+	t = t + 1750 * 2 + sqr(0);
+	t = t + 1751 * 2 + sqr(1);
+	t = t + 1752 * 2 + sqr(2);
+	t = t + 1753 * 2 + sqr(3);
+	t = t + 1754 * 2 + sqr(4);
+	t = t + 1755 * 2 + sqr(5);
+	t = t + 1756 * 2 + sqr(6);
+	t = t + 1757 * 2 + sqr(0);
+	t = t + 1758 * 2 + sqr(1);
+	t = t + 1759 * 2 + sqr(2);
+	t = t + 1760 * 2 + sqr(3);
+	t = t + 1761 * 2 + sqr(4);
+	t = t + 1762 * 2 + sqr(5);
+	t = t + 1763 * 2 + sqr(6);
+	t = t + 1764 * 2 + sqr(0);
+	t = t + 1765 * 2 + sqr(1);
+	t = t + 1766 * 2 + sqr(2);
+	t = t + 1767 * 2 + sqr(3);
+	t = t + 1768 * 2 + sqr(4);
+	t = t + 1769 * 2 + sqr(5);
+	t = t + 1770 * 2 + sqr(6);
+	t = t + 1771 * 2 + sqr(0);
+	t = t + 1772 * 2 + sqr(1);
+	t = t + 1773 * 2 + sqr(2);
+	t = t + 1774 * 2 + sqr(3);
+	t = t + 1775 * 2 + sqr(4);
+	t = t + 1776 * 2 + sqr(5);
+	t = t + 1777 * 2 + sqr(6);
+	t = t + 1778 * 2 + sqr(0);
+	t = t + 1779 * 2 + sqr(1);
+	t = t + 1780 * 2 + sqr(2);
+	t = t + 1781 * 2 + sqr(3);
+	t = t + 1782 * 2 + sqr(4);
+	t = t + 1783 * 2 + sqr(5);
+	t = t + 1784 * 2 + sqr(6);
+	t = t + 1785 * 2 + sqr(0);
+	t = t + 1786 * 2 + sqr(1);
+	t = t + 1787 * 2 + sqr(2);
+	t = t + 1788 * 2 + sqr(3);
+	t = t + 1789 * 2 + sqr(4);
+	t = t + 1790 * 2 + sqr(5);
+	t = t + 1791 * 2 + sqr(6);
+	t = t + 1792 * 2 + sqr(0);
+	t = t + 1793 * 2 + sqr(1);
+	t = t + 1794 * 2 + sqr(2);
+	t = t + 1795 * 2 + sqr(3);
+	t = t + 1796 * 2 + sqr(4);
+	t = t + 1797 * 2 + sqr(5);
+	t = t + 1798 * 2 + sqr(6);
+	t = t + 1799 * 2 + sqr(0);
+	t = t + 1800 * 2 + sqr(1);
+	t = t + 1801 * 2 + sqr(2);
+	t = t + 1802 * 2 + sqr(3);
+	t = t + 1803 * 2 + sqr(4);
+	t = t + 1804 * 2 + sqr(5);
+	t = t + 1805 * 2 + sqr(6);
+	t = t + 1806 * 2 + sqr(0);
+	t = t + 1807 * 2 + sqr(1);
+	t = t + 1808 * 2 + sqr(2);
+	t = t + 1809 * 2 + sqr(3);
+	t = t + 1810 * 2 + sqr(4);
+	t = t + 1811 * 2 + sqr(5);
+	t = t + 1812 * 2 + sqr(6);
+	t = t + 1813 * 2 + sqr(0);
+	t = t + 1814 * 2 + sqr(1);
+	t = t + 1815 * 2 + sqr(2);
+	t = t + 1816 * 2 + sqr(3);
+	t = t + 1817 * 2 + sqr(4);
+	t = t + 1818 * 2 + sqr(5);
+	t = t + 1819 * 2 + sqr(6);
+	t = t + 1820 * 2 + sqr(0);
+	t = t + 1821 * 2 + sqr(1);
+	t = t + 1822 * 2 + sqr(2);
+	t = t + 1823 * 2 + sqr(3);
+	t = t + 1824 * 2 + sqr(4);
+	t = t + 1825 * 2 + sqr(5);
+	t = t + 1826 * 2 + sqr(6);
+	t = t + 1827 * 2 + sqr(0);
+	t = t + 1828 * 2 + sqr(1);
+	t = t + 1829 * 2 + sqr(2);
+	t = t + 1830 * 2 + sqr(3);
+	t = t + 1831 * 2 + sqr(4);
+	t = t + 1832 * 2 + sqr(5);
+	t = t + 1833 * 2 + sqr(6);
+	t = t + 1834 * 2 + sqr(0);
+	t = t + 1835 * 2 + sqr(1);
+	t = t + 1836 * 2 + sqr(2);
+	t = t + 1837 * 2 + sqr(3);
+	t = t + 1838 * 2 + sqr(4);
+	t = t + 1839 * 2 + sqr(5);
+	t = t + 1840 * 2 + sqr(6);
+	t = t + 1841 * 2 + sqr(0);
+	t = t + 1842 * 2 + sqr(1);
+	t = t + 1843 * 2 + sqr(2);
+	t = t + 1844 * 2 + sqr(3);
+	t = t + 1845 * 2 + sqr(4);
+	t = t + 1846 * 2 + sqr(5);
+	t = t + 1847 * 2 + sqr(6);
+	t = t + 1848 * 2 + sqr(0);
+	t = t + 1849 * 2 + sqr(1);
+	t = t + 1850 * 2 + sqr(2);
+	t = t + 1851 * 2 + sqr(3);
+	t = t + 1852 * 2 + sqr(4);
+	t = t + 1853 * 2 + sqr(5);
+	t = t + 1854 * 2 + sqr(6);
+	t = t + 1855 * 2 + sqr(0);
+	t = t + 1856 * 2 + sqr(1);
+	t = t + 1857 * 2 + sqr(2);
+	t = t + 1858 * 2 + sqr(3);
+	t = t + 1859 * 2 + sqr(4);
+	t = t + 1860 * 2 + sqr(5);
+	t = t + 1861 * 2 + sqr(6);
+	t = t + 1862 * 2 + sqr(0);
+	t = t + 1863 * 2 + sqr(1);
+	t = t + 1864 * 2 + sqr(2);
+	t = t + 1865 * 2 + sqr(3);
+	t = t + 1866 * 2 + sqr(4);
+	t = t + 1867 * 2 + sqr(5);
+	t = t + 1868 * 2 + sqr(6);
+	t = t + 1869 * 2 + sqr(0);
+	t = t + 1870 * 2 + sqr(1);
+	t = t + 1871 * 2 + sqr(2);
+	t = t + 1872 * 2 + sqr(3);
+	t = t + 1873 * 2 + sqr(4);
+	t = t + 1874 * 2 + sqr(5);
+	t = t + 1875 * 2 + sqr(6);
+	t = t + 1876 * 2 + sqr(0);
+	t = t + 1877 * 2 + sqr(1);
+	t = t + 1878 * 2 + sqr(2);
+	t = t + 1879 * 2 + sqr(3);
+	t = t + 1880 * 2 + sqr(4);
+	t = t + 1881 * 2 + sqr(5);
+	t = t + 1882 * 2 + sqr(6);
+	t = t + 1883 * 2 + sqr(0);
+	t = t + 1884 * 2 + sqr(1);
+	t = t + 1885 * 2 + sqr(2);
+	t = t + 1886 * 2 + sqr(3);
+	t = t + 1887 * 2 + sqr(4);
+	t = t + 1888 * 2 + sqr(5);
+	t = t + 1889 * 2 + sqr(6);
+	t = t + 1890 * 2 + sqr(0);
+	t = t + 1891 * 2 + sqr(1);
+	t = t + 1892 * 2 + sqr(2);
+	t = t + 1893 * 2 + sqr(3);
+	t = t + 1894 * 2 + sqr(4);
+	t = t + 1895 * 2 + sqr(5);
+	t = t + 1896 * 2 + sqr(6);
+	t = t + 1897 * 2 + sqr(0);
+	t = t + 1898 * 2 + sqr(1);
+	t = t + 1899 * 2 + sqr(2);
+	t = t + 1900 * 2 + sqr(3);
+	t = t + 1901 * 2 + sqr(4);
+	t = t + 1902 * 2 + sqr(5);
+	t = t + 1903 * 2 + sqr(6);
+	t = t + 1904 * 2 + sqr(0);
+	t = t + 1905 * 2 + sqr(1);
+	t = t + 1906 * 2 + sqr(2);
+	t = t + 1907 * 2 + sqr(3);
+	t = t + 1908 * 2 + sqr(4);
+	t = t + 1909 * 2 + sqr(5);
+	t = t + 1910 * 2 + sqr(6);
+	t = t + 1911 * 2 + sqr(0);
+	t = t + 1912 * 2 + sqr(1);
+	t = t + 1913 * 2 + sqr(2);
+	t = t + 1914 * 2 + sqr(3);
+	t = t + 1915 * 2 + sqr(4);
+	t = t + 1916 * 2 + sqr(5);
+	t = t + 1917 * 2 + sqr(6);
+	t = t + 1918 * 2 + sqr(0);
+	t = t + 1919 * 2 + sqr(1);
+	t = t + 1920 * 2 + sqr(2);
+	t = t + 1921 * 2 + sqr(3);
+	t = t + 1922 * 2 + sqr(4);
+	t = t + 1923 * 2 + sqr(5);
+	t = t + 1924 * 2 + sqr(6);
+	t = t + 1925 * 2 + sqr(0);
+	t = t + 1926 * 2 + sqr(1);
+	t = t + 1927 * 2 + sqr(2);
+	t = t + 1928 * 2 + sqr(3);
+	t = t + 1929 * 2 + sqr(4);
+	t = t + 1930 * 2 + sqr(5);
+	t = t + 1931 * 2 + sqr(6);
+	t = t + 1932 * 2 + sqr(0);
+	t = t + 1933 * 2 + sqr(1);
+	t = t + 1934 * 2 + sqr(2);
+	t = t + 1935 * 2 + sqr(3);
+	t = t + 1936 * 2 + sqr(4);
+	t = t + 1937 * 2 + sqr(5);
+	t = t + 1938 * 2 + sqr(6);
+	t = t + 1939 * 2 + sqr(0);
+	t = t + 1940 * 2 + sqr(1);
+	t = t + 1941 * 2 + sqr(2);
+	t = t + 1942 * 2 + sqr(3);
+	t = t + 1943 * 2 + sqr(4);
+	t = t + 1944 * 2 + sqr(5);
+	t = t + 1945 * 2 + sqr(6);
+	t = t + 1946 * 2 + sqr(0);
+	t = t + 1947 * 2 + sqr(1);
+	t = t + 1948 * 2 + sqr(2);
+	t = t + 1949 * 2 + sqr(3);
+	t = t + 1950 * 2 + sqr(4);
+	t = t + 1951 * 2 + sqr(5);
+	t = t + 1952 * 2 + sqr(6);
+	t = t + 1953 * 2 + sqr(0);
+	t = t + 1954 * 2 + sqr(1);
+	t = t + 1955 * 2 + sqr(2);
+	t = t + 1956 * 2 + sqr(3);
+	t = t + 1957 * 2 + sqr(4);
+	t = t + 1958 * 2 + sqr(5);
+	t = t + 1959 * 2 + sqr(6);
+	t = t + 1960 * 2 + sqr(0);
+	t = t + 1961 * 2 + sqr(1);
+	t = t + 1962 * 2 + sqr(2);
+	t = t + 1963 * 2 + sqr(3);
+	t = t + 1964 * 2 + sqr(4);
+	t = t + 1965 * 2 + sqr(5);
+	t = t + 1966 * 2 + sqr(6);
+	t = t + 1967 * 2 + sqr(0);
+	t = t + 1968 * 2 + sqr(1);
+	t = t + 1969 * 2 + sqr(2);
+	t = t + 1970 * 2 + sqr(3);
+	t = t + 1971 * 2 + sqr(4);
+	t = t + 1972 * 2 + sqr(5);
+	t = t + 1973 * 2 + sqr(6);
+	t = t + 1974 * 2 + sqr(0);
+	t = t + 1975 * 2 + sqr(1);
+	t = t + 1976 * 2 + sqr(2);
+	t = t + 1977 * 2 + sqr(3);
+	t = t + 1978 * 2 + sqr(4);
+	t = t + 1979 * 2 + sqr(5);
+	t = t + 1980 * 2 + sqr(6);
+	t = t + 1981 * 2 + sqr(0);
+	t = t + 1982 * 2 + sqr(1);
+	t = t + 1983 * 2 + sqr(2);
+	t = t + 1984 * 2 + sqr(3);
+	t = t + 1985 * 2 + sqr(4);
+	t = t + 1986 * 2 + sqr(5);
+	t = t + 1987 * 2 + sqr(6);
+	t = t + 1988 * 2 + sqr(0);
+	t = t + 1989 * 2 + sqr(1);
+	t = t + 1990 * 2 + sqr(2);
+	t = t + 1991 * 2 + sqr(3);
+	t = t + 1992 * 2 + sqr(4);
+	t = t + 1993 * 2 + sqr(5);
+	t = t + 1994 * 2 + sqr(6);
+	t = t + 1995 * 2 + sqr(0);
+	t = t + 1996 * 2 + sqr(1);
+	t = t + 1997 * 2 + sqr(2);
+	t = t + 1998 * 2 + sqr(3);
+	t = t + 1999 * 2 + sqr(4);
+	t = t + 2000 * 2 + sqr(5);
+	t = t + 2001 * 2 + sqr(6);
+	t = t + 2002 * 2 + sqr(0);
+	t = t + 2003 * 2 + sqr(1);
+	t = t + 2004 * 2 + sqr(2);
+	t = t + 2005 * 2 + sqr(3);
+	t = t + 2006 * 2 + sqr(4);
+	t = t + 2007 * 2 + sqr(5);
+	t = t + 2008 * 2 + sqr(6);
+	t = t + 2009 * 2 + sqr(0);
+	t = t + 2010 * 2 + sqr(1);
+	t = t + 2011 * 2 + sqr(2);
+	t = t + 2012 * 2 + sqr(3);
+	t = t + 2013 * 2 + sqr(4);
+	t = t + 2014 * 2 + sqr(5);
+	t = t + 2015 * 2 + sqr(6);
+	t = t + 2016 * 2 + sqr(0);
+	t = t + 2017 * 2 + sqr(1);
+	t = t + 2018 * 2 + sqr(2);
+	t = t + 2019 * 2 + sqr(3);
+	t = t + 2020 * 2 + sqr(4);
+	t = t + 2021 * 2 + sqr(5);
+	t = t + 2022 * 2 + sqr(6);
+	t = t + 2023 * 2 + sqr(0);
+	t = t + 2024 * 2 + sqr(1);
+	t = t + 2025 * 2 + sqr(2);
+	t = t + 2026 * 2 + sqr(3);
+	t = t + 2027 * 2 + sqr(4);
+	t = t + 2028 * 2 + sqr(5);
+	t = t + 2029 * 2 + sqr(6);
+	t = t + 2030 * 2 + sqr(0);
+	t = t + 2031 * 2 + sqr(1);
+	t = t + 2032 * 2 + sqr(2);
+	t = t + 2033 * 2 + sqr(3);
+	t = t + 2034 * 2 + sqr(4);
+	t = t + 2035 * 2 + sqr(5);
+	t = t + 2036 * 2 + sqr(6);
+	t = t + 2037 * 2 + sqr(0);
+	t = t + 2038 * 2 + sqr(1);
+	t = t + 2039 * 2 + sqr(2);
+	t = t + 2040 * 2 + sqr(3);
+	t = t + 2041 * 2 + sqr(4);
+	t = t + 2042 * 2 + sqr(5);
+	t = t + 2043 * 2 + sqr(6);
+	t = t + 2044 * 2 + sqr(0);
+	t = t + 2045 * 2 + sqr(1);
+	t = t + 2046 * 2 + sqr(2);
+	t = t + 2047 * 2 + sqr(3);
+	t = t + 2048 * 2 + sqr(4);
+	t = t + 2049 * 2 + sqr(5);
+	t = t + 2050 * 2 + sqr(6);
+	t = t + 2051 * 2 + sqr(0);
+	t = t + 2052 * 2 + sqr(1);
+	t = t + 2053 * 2 + sqr(2);
+	t = t + 2054 * 2 + sqr(3);
+	t = t + 2055 * 2 + sqr(4);
+	t = t + 2056 * 2 + sqr(5);
+	t = t + 2057 * 2 + sqr(6);
+	t = t + 2058 * 2 + sqr(0);
+	t = t + 2059 * 2 + sqr(1);
+	t = t + 2060 * 2 + sqr(2);
+	t = t + 2061 * 2 + sqr(3);
+	t = t + 2062 * 2 + sqr(4);
+	t = t + 2063 * 2 + sqr(5);
+	t = t + 2064 * 2 + sqr(6);
+	t = t + 2065 * 2 + sqr(0);
+	t = t + 2066 * 2 + sqr(1);
+	t = t + 2067 * 2 + sqr(2);
+	t = t + 2068 * 2 + sqr(3);
+	t = t + 2069 * 2 + sqr(4);
+	t = t + 2070 * 2 + sqr(5);
+	t = t + 2071 * 2 + sqr(6);
+	t = t + 2072 * 2 + sqr(0);
+	t = t + 2073 * 2 + sqr(1);
+	t = t + 2074 * 2 + sqr(2);
+	t = t + 2075 * 2 + sqr(3);
+	t = t + 2076 * 2 + sqr(4);
+	t = t + 2077 * 2 + sqr(5);
+	t = t + 2078 * 2 + sqr(6);
+	t = t + 2079 * 2 + sqr(0);
+	t = t + 2080 * 2 + sqr(1);
+	t = t + 2081 * 2 + sqr(2);
+	t = t + 2082 * 2 + sqr(3);
+	t = t + 2083 * 2 + sqr(4);
+	t = t + 2084 * 2 + sqr(5);
+	t = t + 2085 * 2 + sqr(6);
+	t = t + 2086 * 2 + sqr(0);
+	t = t + 2087 * 2 + sqr(1);
+	t = t + 2088 * 2 + sqr(2);
+	t = t + 2089 * 2 + sqr(3);
+	t = t + 2090 * 2 + sqr(4);
+	t = t + 2091 * 2 + sqr(5);
+	t = t + 2092 * 2 + sqr(6);
+	t = t + 2093 * 2 + sqr(0);
+	t = t + 2094 * 2 + sqr(1);
+	t = t + 2095 * 2 + sqr(2);
+	t = t + 2096 * 2 + sqr(3);
+	t = t + 2097 * 2 + sqr(4);
+	t = t + 2098 * 2 + sqr(5);
+	t = t + 2099 * 2 + sqr(6);
+	t = t + 2100 * 2 + sqr(0);
+	t = t + 2101 * 2 + sqr(1);
+	t = t + 2102 * 2 + sqr(2);
+	t = t + 2103 * 2 + sqr(3);
+	t = t + 2104 * 2 + sqr(4);
+	t = t + 2105 * 2 + sqr(5);
+	t = t + 2106 * 2 + sqr(6);
+	t = t + 2107 * 2 + sqr(0);
+	t = t + 2108 * 2 + sqr(1);
+	t = t + 2109 * 2 + sqr(2);
+	t = t + 2110 * 2 + sqr(3);
+	t = t + 2111 * 2 + sqr(4);
+	t = t + 2112 * 2 + sqr(5);
+	t = t + 2113 * 2 + sqr(6);
+	t = t + 2114 * 2 + sqr(0);
+	t = t + 2115 * 2 + sqr(1);
+	t = t + 2116 * 2 + sqr(2);
+	t = t + 2117 * 2 + sqr(3);
+	t = t + 2118 * 2 + sqr(4);
+	t = t + 2119 * 2 + sqr(5);
+	t = t + 2120 * 2 + sqr(6);
+	t = t + 2121 * 2 + sqr(0);
+	t = t + 2122 * 2 + sqr(1);
+	t = t + 2123 * 2 + sqr(2);
+	t = t + 2124 * 2 + sqr(3);
+	t = t + 2125 * 2 + sqr(4);
+	t = t + 2126 * 2 + sqr(5);
+	t = t + 2127 * 2 + sqr(6);
+	t = t + 2128 * 2 + sqr(0);
+	t = t + 2129 * 2 + sqr(1);
+	t = t + 2130 * 2 + sqr(2);
+	t = t + 2131 * 2 + sqr(3);
+	t = t + 2132 * 2 + sqr(4);
+	t = t + 2133 * 2 + sqr(5);
+	t = t + 2134 * 2 + sqr(6);
+	t = t + 2135 * 2 + sqr(0);
+	t = t + 2136 * 2 + sqr(1);
+	t = t + 2137 * 2 + sqr(2);
+	t = t + 2138 * 2 + sqr(3);
+	t = t + 2139 * 2 + sqr(4);
+	t = t + 2140 * 2 + sqr(5);
+	t = t + 2141 * 2 + sqr(6);
+	t = t + 2142 * 2 + sqr(0);
+	t = t + 2143 * 2 + sqr(1);
+	t = t + 2144 * 2 + sqr(2);
+	t = t + 2145 * 2 + sqr(3);
+	t = t + 2146 * 2 + sqr(4);
+	t = t + 2147 * 2 + sqr(5);
+	t = t + 2148 * 2 + sqr(6);
+	t = t + 2149 * 2 + sqr(0);
+	t = t + 2150 * 2 + sqr(1);
+	t = t + 2151 * 2 + sqr(2);
+	t = t + 2152 * 2 + sqr(3);
+	t = t + 2153 * 2 + sqr(4);
+	t = t + 2154 * 2 + sqr(5);
+	t = t + 2155 * 2 + sqr(6);
+	t = t + 2156 * 2 + sqr(0);
+	t = t + 2157 * 2 + sqr(1);
+	t = t + 2158 * 2 + sqr(2);
+	t = t + 2159 * 2 + sqr(3);
+	t = t + 2160 * 2 + sqr(4);
+	t = t + 2161 * 2 + sqr(5);
+	t = t + 2162 * 2 + sqr(6);
+	t = t + 2163 * 2 + sqr(0);
+	t = t + 2164 * 2 + sqr(1);
+	t = t + 2165 * 2 + sqr(2);
+	t = t + 2166 * 2 + sqr(3);
+	t = t + 2167 * 2 + sqr(4);
+	t = t + 2168 * 2 + sqr(5);
+	t = t + 2169 * 2 + sqr(6);
+	t = t + 2170 * 2 + sqr(0);
+	t = t + 2171 * 2 + sqr(1);
+	t = t + 2172 * 2 + sqr(2);
+	t = t + 2173 * 2 + sqr(3);
+	t = t + 2174 * 2 + sqr(4);
+	t = t + 2175 * 2 + sqr(5);
+	t = t + 2176 * 2 + sqr(6);
+	t = t + 2177 * 2 + sqr(0);
+	t = t + 2178 * 2 + sqr(1);
+	t = t + 2179 * 2 + sqr(2);
+	t = t + 2180 * 2 + sqr(3);
+	t = t + 2181 * 2 + sqr(4);
+	t = t + 2182 * 2 + sqr(5);
+	t = t + 2183 * 2 + sqr(6);
+	t = t + 2184 * 2 + sqr(0);
+	t = t + 2185 * 2 + sqr(1);
+	t = t + 2186 * 2 + sqr(2);
+	t = t + 2187 * 2 + sqr(3);
+	t = t + 2188 * 2 + sqr(4);
+	t = t + 2189 * 2 + sqr(5);
+	t = t + 2190 * 2 + sqr(6);
+	t = t + 2191 * 2 + sqr(0);
+	t = t + 2192 * 2 + sqr(1);
+	t = t + 2193 * 2 + sqr(2);
+	t = t + 2194 * 2 + sqr(3);
+	t = t + 2195 * 2 + sqr(4);
+	t = t + 2196 * 2 + sqr(5);
+	t = t + 2197 * 2 + sqr(6);
+	t = t + 2198 * 2 + sqr(0);
+	t = t + 2199 * 2 + sqr(1);
+	t = t + 2200 * 2 + sqr(2);
+	t = t + 2201 * 2 + sqr(3);
+	t = t + 2202 * 2 + sqr(4);
+	t = t + 2203 * 2 + sqr(5);
+	t = t + 2204 * 2 + sqr(6);
+	t = t + 2205 * 2 + sqr(0);
+	t = t + 2206 * 2 + sqr(1);
+	t = t + 2207 * 2 + sqr(2);
+	t = t + 2208 * 2 + sqr(3);
+	t = t + 2209 * 2 + sqr(4);
+	t = t + 2210 * 2 + sqr(5);
+	t = t + 2211 * 2 + sqr(6);
+	t = t + 2212 * 2 + sqr(0);
+	t = t + 2213 * 2 + sqr(1);
+	t = t + 2214 * 2 + sqr(2);
+	t = t + 2215 * 2 + sqr(3);
+	t = t + 2216 * 2 + sqr(4);
+	t = t + 2217 * 2 + sqr(5);
+	t = t + 2218 * 2 + sqr(6);
+	t = t + 2219 * 2 + sqr(0);
+	t = t + 2220 * 2 + sqr(1);
+	t = t + 2221 * 2 + sqr(2);
+	t = t + 2222 * 2 + sqr(3);
+	t = t + 2223 * 2 + sqr(4);
+	t = t + 2224 * 2 + sqr(5);
+	t = t + 2225 * 2 + sqr(6);
+	t = t + 2226 * 2 + sqr(0);
+	t = t + 2227 * 2 + sqr(1);
+	t = t + 2228 * 2 + sqr(2);
+	t = t + 2229 * 2 + sqr(3);
+	t = t + 2230 * 2 + sqr(4);
+	t = t + 2231 * 2 + sqr(5);
+	t = t + 2232 * 2 + sqr(6);
+	t = t + 2233 * 2 + sqr(0);
+	t = t + 2234 * 2 + sqr(1);
+	t = t + 2235 * 2 + sqr(2);
+	t = t + 2236 * 2 + sqr(3);
+	t = t + 2237 * 2 + sqr(4);
+	t = t + 2238 * 2 + sqr(5);
+	t = t + 2239 * 2 + sqr(6);
+	t = t + 2240 * 2 + sqr(0);
+	t = t + 2241 * 2 + sqr(1);
+	t = t + 2242 * 2 + sqr(2);
+	t = t + 2243 * 2 + sqr(3);
+	t = t + 2244 * 2 + sqr(4);
+	t = t + 2245 * 2 + sqr(5);
+	t = t + 2246 * 2 + sqr(6);
+	t = t + 2247 * 2 + sqr(0);
+	t = t + 2248 * 2 + sqr(1);
+	t = t + 2249 * 2 + sqr(2);
+	t = t + 2250 * 2 + sqr(3);
+	t = t + 2251 * 2 + sqr(4);
+	t = t + 2252 * 2 + sqr(5);
+	t = t + 2253 * 2 + sqr(6);
+	t = t + 2254 * 2 + sqr(0);
+	t = t + 2255 * 2 + sqr(1);
+	t = t + 2256 * 2 + sqr(2);
+	t = t + 2257 * 2 + sqr(3);
+	t = t + 2258 * 2 + sqr(4);
+	t = t + 2259 * 2 + sqr(5);
+	t = t + 2260 * 2 + sqr(6);
+	t = t + 2261 * 2 + sqr(0);
+	t = t + 2262 * 2 + sqr(1);
+	t = t + 2263 * 2 + sqr(2);
+	t = t + 2264 * 2 + sqr(3);
+	t = t + 2265 * 2 + sqr(4);
+	t = t + 2266 * 2 + sqr(5);
+	t = t + 2267 * 2 + sqr(6);
+	t = t + 2268 * 2 + sqr(0);
+	t = t + 2269 * 2 + sqr(1);
+	t = t + 2270 * 2 + sqr(2);
+	t = t + 2271 * 2 + sqr(3);
+	t = t + 2272 * 2 + sqr(4);
+	t = t + 2273 * 2 + sqr(5);
+	t = t + 2274 * 2 + sqr(6);
+	t = t + 2275 * 2 + sqr(0);
+	t = t + 2276 * 2 + sqr(1);
+	t = t + 2277 * 2 + sqr(2);
+	t = t + 2278 * 2 + sqr(3);
+	t = t + 2279 * 2 + sqr(4);
+	t = t + 2280 * 2 + sqr(5);
+	t = t + 2281 * 2 + sqr(6);
+	t = t + 2282 * 2 + sqr(0);
+	t = t + 2283 * 2 + sqr(1);
+	t = t + 2284 * 2 + sqr(2);
+	t = t + 2285 * 2 + sqr(3);
+	t = t + 2286 * 2 + sqr(4);
+	t = t + 2287 * 2 + sqr(5);
+	t = t + 2288 * 2 + sqr(6);
+	t = t + 2289 * 2 + sqr(0);
+	t = t + 2290 * 2 + sqr(1);
+	t = t + 2291 * 2 + sqr(2);
+	t = t + 2292 * 2 + sqr(3);
+	t = t + 2293 * 2 + sqr(4);
+	t = t + 2294 * 2 + sqr(5);
+	t = t + 2295 * 2 + sqr(6);
+	t = t + 2296 * 2 + sqr(0);
+	t = t + 2297 * 2 + sqr(1);
+	t = t + 2298 * 2 + sqr(2);
+	t = t + 2299 * 2 + sqr(3);
+	t = t + 2300 * 2 + sqr(4);
+	t = t + 2301 * 2 + sqr(5);
+	t = t + 2302 * 2 + sqr(6);
+	t = t + 2303 * 2 + sqr(0);
+	t = t + 2304 * 2 + sqr(1);
+	t = t + 2305 * 2 + sqr(2);
+	t = t + 2306 * 2 + sqr(3);
+	t = t + 2307 * 2 + sqr(4);
+	t = t + 2308 * 2 + sqr(5);
+	t = t + 2309 * 2 + sqr(6);
+	t = t + 2310 * 2 + sqr(0);
+	t = t + 2311 * 2 + sqr(1);
+	t = t + 2312 * 2 + sqr(2);
+	t = t + 2313 * 2 + sqr(3);
+	t = t + 2314 * 2 + sqr(4);
+	t = t + 2315 * 2 + sqr(5);
+	t = t + 2316 * 2 + sqr(6);
+	t = t + 2317 * 2 + sqr(0);
+	t = t + 2318 * 2 + sqr(1);
+	t = t + 2319 * 2 + sqr(2);
+	t = t + 2320 * 2 + sqr(3);
+	t = t + 2321 * 2 + sqr(4);
+	t = t + 2322 * 2 + sqr(5);
+	t = t + 2323 * 2 + sqr(6);
+	t = t + 2324 * 2 + sqr(0);
+	t = t + 2325 * 2 + sqr(1);
+	t = t + 2326 * 2 + sqr(2);
+	t = t + 2327 * 2 + sqr(3);
+	t = t + 2328 * 2 + sqr(4);
+	t = t + 2329 * 2 + sqr(5);
+	t = t + 2330 * 2 + sqr(6);
+	t = t + 2331 * 2 + sqr(0);
+	t = t + 2332 * 2 + sqr(1);
+	t = t + 2333 * 2 + sqr(2);
+	t = t + 2334 * 2 + sqr(3);
+	t = t + 2335 * 2 + sqr(4);
+	t = t + 2336 * 2 + sqr(5);
+	t = t + 2337 * 2 + sqr(6);
+	t = t + 2338 * 2 + sqr(0);
+	t = t + 2339 * 2 + sqr(1);
+	t = t + 2340 * 2 + sqr(2);
+	t = t + 2341 * 2 + sqr(3);
+	t = t + 2342 * 2 + sqr(4);
+	t = t + 2343 * 2 + sqr(5);
+	t = t + 2344 * 2 + sqr(6);
+	t = t + 2345 * 2 + sqr(0);
+	t = t + 2346 * 2 + sqr(1);
+	t = t + 2347 * 2 + sqr(2);
+	t = t + 2348 * 2 + sqr(3);
+	t = t + 2349 * 2 + sqr(4);
+	t = t + 2350 * 2 + sqr(5);
+	t = t + 2351 * 2 + sqr(6);
+	t = t + 2352 * 2 + sqr(0);
+	t = t + 2353 * 2 + sqr(1);
+	t = t + 2354 * 2 + sqr(2);
+	t = t + 2355 * 2 + sqr(3);
+	t = t + 2356 * 2 + sqr(4);
+	t = t + 2357 * 2 + sqr(5);
+	t = t + 2358 * 2 + sqr(6);
+	t = t + 2359 * 2 + sqr(0);
+	t = t + 2360 * 2 + sqr(1);
+	t = t + 2361 * 2 + sqr(2);
+	t = t + 2362 * 2 + sqr(3);
+	t = t + 2363 * 2 + sqr(4);
+	t = t + 2364 * 2 + sqr(5);
+	t = t + 2365 * 2 + sqr(6);
+	t = t + 2366 * 2 + sqr(0);
+	t = t + 2367 * 2 + sqr(1);
+	t = t + 2368 * 2 + sqr(2);
+	t = t + 2369 * 2 + sqr(3);
+	t = t + 2370 * 2 + sqr(4);
+	t = t + 2371 * 2 + sqr(5);
+	t = t + 2372 * 2 + sqr(6);
+	t = t + 2373 * 2 + sqr(0);
+	t = t + 2374 * 2 + sqr(1);
+	t = t + 2375 * 2 + sqr(2);
+	t = t + 2376 * 2 + sqr(3);
+	t = t + 2377 * 2 + sqr(4);
+	t = t + 2378 * 2 + sqr(5);
+	t = t + 2379 * 2 + sqr(6);
+	t = t + 2380 * 2 + sqr(0);
+	t = t + 2381 * 2 + sqr(1);
+	t = t + 2382 * 2 + sqr(2);
+	t = t + 2383 * 2 + sqr(3);
+	t = t + 2384 * 2 + sqr(4);
+	t = t + 2385 * 2 + sqr(5);
+	t = t + 2386 * 2 + sqr(6);
+	t = t + 2387 * 2 + sqr(0);
+	t = t + 2388 * 2 + sqr(1);
+	t = t + 2389 * 2 + sqr(2);
+	t = t + 2390 * 2 + sqr(3);
+	t = t + 2391 * 2 + sqr(4);
+	t = t + 2392 * 2 + sqr(5);
+	t = t + 2393 * 2 + sqr(6);
+	t = t + 2394 * 2 + sqr(0);
+	t = t + 2395 * 2 + sqr(1);
+	t = t + 2396 * 2 + sqr(2);
+	t = t + 2397 * 2 + sqr(3);
+	t = t + 2398 * 2 + sqr(4);
+	t = t + 2399 * 2 + sqr(5);
+	t = t + 2400 * 2 + sqr(6);
+	t = t + 2401 * 2 + sqr(0);
+	t = t + 2402 * 2 + sqr(1);
+	t = t + 2403 * 2 + sqr(2);
+	t = t + 2404 * 2 + sqr(3);
+	t = t + 2405 * 2 + sqr(4);
+	t = t + 2406 * 2 + sqr(5);
+	t = t + 2407 * 2 + sqr(6);
+	t = t + 2408 * 2 + sqr(0);
+	t = t + 2409 * 2 + sqr(1);
+	t = t + 2410 * 2 + sqr(2);
+	t = t + 2411 * 2 + sqr(3);
+	t = t + 2412 * 2 + sqr(4);
+	t = t + 2413 * 2 + sqr(5);
+	t = t + 2414 * 2 + sqr(6);
+	t = t + 2415 * 2 + sqr(0);
+	t = t + 2416 * 2 + sqr(1);
+	t = t + 2417 * 2 + sqr(2);
+	t = t + 2418 * 2 + sqr(3);
+	t = t + 2419 * 2 + sqr(4);
+	t = t + 2420 * 2 + sqr(5);
+	t = t + 2421 * 2 + sqr(6);
+	t = t + 2422 * 2 + sqr(0);
+	t = t + 2423 * 2 + sqr(1);
+	t = t + 2424 * 2 + sqr(2);
+	t = t + 2425 * 2 + sqr(3);
+	t = t + 2426 * 2 + sqr(4);
+	t = t + 2427 * 2 + sqr(5);
+	t = t + 2428 * 2 + sqr(6);
+	t = t + 2429 * 2 + sqr(0);
+	t = t + 2430 * 2 + sqr(1);
+	t = t + 2431 * 2 + sqr(2);
+	t = t + 2432 * 2 + sqr(3);
+	t = t + 2433 * 2 + sqr(4);
+	t = t + 2434 * 2 + sqr(5);
+	t = t + 2435 * 2 + sqr(6);
+	t = t + 2436 * 2 + sqr(0);
+	t = t + 2437 * 2 + sqr(1);
+	t = t + 2438 * 2 + sqr(2);
+	t = t + 2439 * 2 + sqr(3);
+	t = t + 2440 * 2 + sqr(4);
+	t = t + 2441 * 2 + sqr(5);
+	t = t + 2442 * 2 + sqr(6);
+	t = t + 2443 * 2 + sqr(0);
+	t = t + 2444 * 2 + sqr(1);
+	t = t + 2445 * 2 + sqr(2);
+	t = t + 2446 * 2 + sqr(3);
+	t = t + 2447 * 2 + sqr(4);
+	t = t + 2448 * 2 + sqr(5);
+	t = t + 2449 * 2 + sqr(6);
+	t = t + 2450 * 2 + sqr(0);
+	t = t + 2451 * 2 + sqr(1);
+	t = t + 2452 * 2 + sqr(2);
+	t = t + 2453 * 2 + sqr(3);
+	t = t + 2454 * 2 + sqr(4);
+	t = t + 2455 * 2 + sqr(5);
+	t = t + 2456 * 2 + sqr(6);
+	t = t + 2457 * 2 + sqr(0);
+	t = t + 2458 * 2 + sqr(1);
+	t = t + 2459 * 2 + sqr(2);
+	t = t + 2460 * 2 + sqr(3);
+	t = t + 2461 * 2 + sqr(4);
+	t = t + 2462 * 2 + sqr(5);
+	t = t + 2463 * 2 + sqr(6);
+	t = t + 2464 * 2 + sqr(0);
+	t = t + 2465 * 2 + sqr(1);
+	t = t + 2466 * 2 + sqr(2);
+	t = t + 2467 * 2 + sqr(3);
+	t = t + 2468 * 2 + sqr(4);
+	t = t + 2469 * 2 + sqr(5);
+	t = t + 2470 * 2 + sqr(6);
+	t = t + 2471 * 2 + sqr(0);
+	t = t + 2472 * 2 + sqr(1);
+	t = t + 2473 * 2 + sqr(2);
+	t = t + 2474 * 2 + sqr(3);
+	t = t + 2475 * 2 + sqr(4);
+	t = t + 2476 * 2 + sqr(5);
+	t = t + 2477 * 2 + sqr(6);
+	t = t + 2478 * 2 + sqr(0);
+	t = t + 2479 * 2 + sqr(1);
+	t = t + 2480 * 2 + sqr(2);
+	t = t + 2481 * 2 + sqr(3);
+	t = t + 2482 * 2 + sqr(4);
+	t = t + 2483 * 2 + sqr(5);
+	t = t + 2484 * 2 + sqr(6);
+	t = t + 2485 * 2 + sqr(0);
+	t = t + 2486 * 2 + sqr(1);
+	t = t + 2487 * 2 + sqr(2);
+	t = t + 2488 * 2 + sqr(3);
+	t = t + 2489 * 2 + sqr(4);
+	t = t + 2490 * 2 + sqr(5);
+	t = t + 2491 * 2 + sqr(6);
+	t = t + 2492 * 2 + sqr(0);
+	t = t + 2493 * 2 + sqr(1);
+	t = t + 2494 * 2 + sqr(2);
+	t = t + 2495 * 2 + sqr(3);
+	t = t + 2496 * 2 + sqr(4);
+	t = t + 2497 * 2 + sqr(5);
+	t = t + 2498 * 2 + sqr(6);
+	t = t + 2499 * 2 + sqr(0);
+	t = t + 2500 * 2 + sqr(1);
+	t = t + 2501 * 2 + sqr(2);
+	t = t + 2502 * 2 + sqr(3);
+	t = t + 2503 * 2 + sqr(4);
+	t = t + 2504 * 2 + sqr(5);
+	t = t + 2505 * 2 + sqr(6);
+	t = t + 2506 * 2 + sqr(0);
+	t = t + 2507 * 2 + sqr(1);
+	t = t + 2508 * 2 + sqr(2);
+	t = t + 2509 * 2 + sqr(3);
+	t = t + 2510 * 2 + sqr(4);
+	t = t + 2511 * 2 + sqr(5);
+	t = t + 2512 * 2 + sqr(6);
+	t = t + 2513 * 2 + sqr(0);
+	t = t + 2514 * 2 + sqr(1);
+	t = t + 2515 * 2 + sqr(2);
+	t = t + 2516 * 2 + sqr(3);
+	t = t + 2517 * 2 + sqr(4);
+	t = t + 2518 * 2 + sqr(5);
+	t = t + 2519 * 2 + sqr(6);
+	t = t + 2520 * 2 + sqr(0);
+	t = t + 2521 * 2 + sqr(1);
+	t = t + 2522 * 2 + sqr(2);
+	t = t + 2523 * 2 + sqr(3);
+	t = t + 2524 * 2 + sqr(4);
+	t = t + 2525 * 2 + sqr(5);
+	t = t + 2526 * 2 + sqr(6);
+	t = t + 2527 * 2 + sqr(0);
+	t = t + 2528 * 2 + sqr(1);
+	t = t + 2529 * 2 + sqr(2);
+	t = t + 2530 * 2 + sqr(3);
+	t = t + 2531 * 2 + sqr(4);
+	t = t + 2532 * 2 + sqr(5);
+	t = t + 2533 * 2 + sqr(6);
+	t = t + 2534 * 2 + sqr(0);
+	t = t + 2535 * 2 + sqr(1);
+	t = t + 2536 * 2 + sqr(2);
+	t = t + 2537 * 2 + sqr(3);
+	t = t + 2538 * 2 + sqr(4);
+	t = t + 2539 * 2 + sqr(5);
+	t = t + 2540 * 2 + sqr(6);
+	t = t + 2541 * 2 + sqr(0);
+	t = t + 2542 * 2 + sqr(1);
+	t = t + 2543 * 2 + sqr(2);
+	t = t + 2544 * 2 + sqr(3);
+	t = t + 2545 * 2 + sqr(4);
+	t = t + 2546 * 2 + sqr(5);
+	t = t + 2547 * 2 + sqr(6);
+	t = t + 2548 * 2 + sqr(0);
+	t = t + 2549 * 2 + sqr(1);
+	t = t + 2550 * 2 + sqr(2);
+	t = t + 2551 * 2 + sqr(3);
+	t = t + 2552 * 2 + sqr(4);
+	t = t + 2553 * 2 + sqr(5);
+	t = t + 2554 * 2 + sqr(6);
+	t = t + 2555 * 2 + sqr(0);
+	t = t + 2556 * 2 + sqr(1);
+	t = t + 2557 * 2 + sqr(2);
+	t = t + 2558 * 2 + sqr(3);
+	t = t + 2559 * 2 + sqr(4);
+	t = t + 2560 * 2 + sqr(5);
+	t = t + 2561 * 2 + sqr(6);
+	t = t + 2562 * 2 + sqr(0);
+	t = t + 2563 * 2 + sqr(1);
+	t = t + 2564 * 2 + sqr(2);
+	t = t + 2565 * 2 + sqr(3);
+	t = t + 2566 * 2 + sqr(4);
+	t = t + 2567 * 2 + sqr(5);
+	t = t + 2568 * 2 + sqr(6);
+	t = t + 2569 * 2 + sqr(0);
+	t = t + 2570 * 2 + sqr(1);
+	t = t + 2571 * 2 + sqr(2);
+	t = t + 2572 * 2 + sqr(3);
+	t = t + 2573 * 2 + sqr(4);
+	t = t + 2574 * 2 + sqr(5);
+	t = t + 2575 * 2 + sqr(6);
+	t = t + 2576 * 2 + sqr(0);
+	t = t + 2577 * 2 + sqr(1);
+	t = t + 2578 * 2 + sqr(2);
+	t = t + 2579 * 2 + sqr(3);
+	t = t + 2580 * 2 + sqr(4);
+	t = t + 2581 * 2 + sqr(5);
+	t = t + 2582 * 2 + sqr(6);
+	t = t + 2583 * 2 + sqr(0);
+	t = t + 2584 * 2 + sqr(1);
+	t = t + 2585 * 2 + sqr(2);
+	t = t + 2586 * 2 + sqr(3);
+	t = t + 2587 * 2 + sqr(4);
+	t = t + 2588 * 2 + sqr(5);
+	t = t + 2589 * 2 + sqr(6);
+	t = t + 2590 * 2 + sqr(0);
+	t = t + 2591 * 2 + sqr(1);
+	t = t + 2592 * 2 + sqr(2);
+	t = t + 2593 * 2 + sqr(3);
+	t = t + 2594 * 2 + sqr(4);
+	t = t + 2595 * 2 + sqr(5);
+	t = t + 2596 * 2 + sqr(6);
+	t = t + 2597 * 2 + sqr(0);
+	t = t + 2598 * 2 + sqr(1);
+	t = t + 2599 * 2 + sqr(2);
+	t = t + 2600 * 2 + sqr(3);
+	t = t + 2601 * 2 + sqr(4);
+	t = t + 2602 * 2 + sqr(5);
+	t = t + 2603 * 2 + sqr(6);
+	t = t + 2604 * 2 + sqr(0);
+	t = t + 2605 * 2 + sqr(1);
+	t = t + 2606 * 2 + sqr(2);
+	t = t + 2607 * 2 + sqr(3);
+	t = t + 2608 * 2 + sqr(4);
+	t = t + 2609 * 2 + sqr(5);
+	t = t + 2610 * 2 + sqr(6);
+	t = t + 2611 * 2 + sqr(0);
+	t = t + 2612 * 2 + sqr(1);
+	t = t + 2613 * 2 + sqr(2);
+	t = t + 2614 * 2 + sqr(3);
+	t = t + 2615 * 2 + sqr(4);
+	t = t + 2616 * 2 + sqr(5);
+	t = t + 2617 * 2 + sqr(6);
+	t = t + 2618 * 2 + sqr(0);
+	t = t + 2619 * 2 + sqr(1);
+	t = t + 2620 * 2 + sqr(2);
+	t = t + 2621 * 2 + sqr(3);
+	t = t + 2622 * 2 + sqr(4);
+	t = t + 2623 * 2 + sqr(5);
+	t = t + 2624 * 2 + sqr(6);
+	t = t + 2625 * 2 + sqr(0);
+	t = t + 2626 * 2 + sqr(1);
+	t = t + 2627 * 2 + sqr(2);
+	t = t + 2628 * 2 + sqr(3);
+	t = t + 2629 * 2 + sqr(4);
+	t = t + 2630 * 2 + sqr(5);
+	t = t + 2631 * 2 + sqr(6);
+	t = t + 2632 * 2 + sqr(0);
+	t = t + 2633 * 2 + sqr(1);
+	t = t + 2634 * 2 + sqr(2);
+	t = t + 2635 * 2 + sqr(3);
+	t = t + 2636 * 2 + sqr(4);
+	t = t + 2637 * 2 + sqr(5);
+	t = t + 2638 * 2 + sqr(6);
+	t = t + 2639 * 2 + sqr(0);
+	t = t + 2640 * 2 + sqr(1);
+	t = t + 2641 * 2 + sqr(2);
+	t = t + 2642 * 2 + sqr(3);
+	t = t + 2643 * 2 + sqr(4);
+	t = t + 2644 * 2 + sqr(5);
+	t = t + 2645 * 2 + sqr(6);
+	t = t + 2646 * 2 + sqr(0);
+	t = t + 2647 * 2 + sqr(1);
+	t = t + 2648 * 2 + sqr(2);
+	t = t + 2649 * 2 + sqr(3);
+	t = t + 2650 * 2 + sqr(4);
+	t = t + 2651 * 2 + sqr(5);
+	t = t + 2652 * 2 + sqr(6);
+	t = t + 2653 * 2 + sqr(0);
+	t = t + 2654 * 2 + sqr(1);
+	t = t + 2655 * 2 + sqr(2);
+	t = t + 2656 * 2 + sqr(3);
+	t = t + 2657 * 2 + sqr(4);
+	t = t + 2658 * 2 + sqr(5);
+	t = t + 2659 * 2 + sqr(6);
+	t = t + 2660 * 2 + sqr(0);
+	t = t + 2661 * 2 + sqr(1);
+	t = t + 2662 * 2 + sqr(2);
+	t = t + 2663 * 2 + sqr(3);
+	t = t + 2664 * 2 + sqr(4);
+	t = t + 2665 * 2 + sqr(5);
+	t = t + 2666 * 2 + sqr(6);
+	t = t + 2667 * 2 + sqr(0);
+	t = t + 2668 * 2 + sqr(1);
+	t = t + 2669 * 2 + sqr(2);
+	t = t + 2670 * 2 + sqr(3);
+	t = t + 2671 * 2 + sqr(4);
+	t = t + 2672 * 2 + sqr(5);
+	t = t + 2673 * 2 + sqr(6);
+	t = t + 2674 * 2 + sqr(0);
+	t = t + 2675 * 2 + sqr(1);
+	t = t + 2676 * 2 + sqr(2);
+	t = t + 2677 * 2 + sqr(3);
+	t = t + 2678 * 2 + sqr(4);
+	t = t + 2679 * 2 + sqr(5);
+	t = t + 2680 * 2 + sqr(6);
+	t = t + 2681 * 2 + sqr(0);
+	t = t + 2682 * 2 + sqr(1);
+	t = t + 2683 * 2 + sqr(2);
+	t = t + 2684 * 2 + sqr(3);
+	t = t + 2685 * 2 + sqr(4);
+	t = t + 2686 * 2 + sqr(5);
+	t = t + 2687 * 2 + sqr(6);
+	t = t + 2688 * 2 + sqr(0);
+	t = t + 2689 * 2 + sqr(1);
+	t = t + 2690 * 2 + sqr(2);
+	t = t + 2691 * 2 + sqr(3);
+	t = t + 2692 * 2 + sqr(4);
+	t = t + 2693 * 2 + sqr(5);
+	t = t + 2694 * 2 + sqr(6);
+	t = t + 2695 * 2 + sqr(0);
+	t = t + 2696 * 2 + sqr(1);
+	t = t + 2697 * 2 + sqr(2);
+	t = t + 2698 * 2 + sqr(3);
+	t = t + 2699 * 2 + sqr(4);
+	t = t + 2700 * 2 + sqr(5);
+	t = t + 2701 * 2 + sqr(6);
+	t = t + 2702 * 2 + sqr(0);
+	t = t + 2703 * 2 + sqr(1);
+	t = t + 2704 * 2 + sqr(2);
+	t = t + 2705 * 2 + sqr(3);
+	t = t + 2706 * 2 + sqr(4);
+	t = t + 2707 * 2 + sqr(5);
+	t = t + 2708 * 2 + sqr(6);
+	t = t + 2709 * 2 + sqr(0);
+	t = t + 2710 * 2 + sqr(1);
+	t = t + 2711 * 2 + sqr(2);
+	t = t + 2712 * 2 + sqr(3);
+	t = t + 2713 * 2 + sqr(4);
+	t = t + 2714 * 2 + sqr(5);
+	t = t + 2715 * 2 + sqr(6);
+	t = t + 2716 * 2 + sqr(0);
+	t = t + 2717 * 2 + sqr(1);
+	t = t + 2718 * 2 + sqr(2);
+	t = t + 2719 * 2 + sqr(3);
+	t = t + 2720 * 2 + sqr(4);
+	t = t + 2721 * 2 + sqr(5);
+	t = t + 2722 * 2 + sqr(6);
+	t = t + 2723 * 2 + sqr(0);
+	t = t + 2724 * 2 + sqr(1);
+	t = t + 2725 * 2 + sqr(2);
+	t = t + 2726 * 2 + sqr(3);
+	t = t + 2727 * 2 + sqr(4);
+	t = t + 2728 * 2 + sqr(5);
+	t = t + 2729 * 2 + sqr(6);
+	t = t + 2730 * 2 + sqr(0);
+	t = t + 2731 * 2 + sqr(1);
+	t = t + 2732 * 2 + sqr(2);
+	t = t + 2733 * 2 + sqr(3);
+	t = t + 2734 * 2 + sqr(4);
+	t = t + 2735 * 2 + sqr(5);
+	t = t + 2736 * 2 + sqr(6);
+	t = t + 2737 * 2 + sqr(0);
+	t = t + 2738 * 2 + sqr(1);
+	t = t + 2739 * 2 + sqr(2);
+	t = t + 2740 * 2 + sqr(3);
+	t = t + 2741 * 2 + sqr(4);
+	t = t + 2742 * 2 + sqr(5);
+	t = t + 2743 * 2 + sqr(6);
+	t = t + 2744 * 2 + sqr(0);
+	t = t + 2745 * 2 + sqr(1);
+	t = t + 2746 * 2 + sqr(2);
+	t = t + 2747 * 2 + sqr(3);
+	t = t + 2748 * 2 + sqr(4);
+	t = t + 2749 * 2 + sqr(5);
+	t = t + 2750 * 2 + sqr(6);
+	t = t + 2751 * 2 + sqr(0);
+	t = t + 2752 * 2 + sqr(1);
+	t = t + 2753 * 2 + sqr(2);
+	t = t + 2754 * 2 + sqr(3);
+	t = t + 2755 * 2 + sqr(4);
+	t = t + 2756 * 2 + sqr(5);
+	t = t + 2757 * 2 + sqr(6);
+	t = t + 2758 * 2 + sqr(0);
+	t = t + 2759 * 2 + sqr(1);
+	t = t + 2760 * 2 + sqr(2);
+	t = t + 2761 * 2 + sqr(3);
+	t = t + 2762 * 2 + sqr(4);
+	t = t + 2763 * 2 + sqr(5);
+	t = t + 2764 * 2 + sqr(6);
+	t = t + 2765 * 2 + sqr(0);
+	t = t + 2766 * 2 + sqr(1);
+	t = t + 2767 * 2 + sqr(2);
+	t = t + 2768 * 2 + sqr(3);
+	t = t + 2769 * 2 + sqr(4);
+	t = t + 2770 * 2 + sqr(5);
+	t = t + 2771 * 2 + sqr(6);
+	t = t + 2772 * 2 + sqr(0);
+	t = t + 2773 * 2 + sqr(1);
+	t = t + 2774 * 2 + sqr(2);
+	t = t + 2775 * 2 + sqr(3);
+	t = t + 2776 * 2 + sqr(4);
+	t = t + 2777 * 2 + sqr(5);
+	t = t + 2778 * 2 + sqr(6);
+	t = t + 2779 * 2 + sqr(0);
+	t = t + 2780 * 2 + sqr(1);
+	t = t + 2781 * 2 + sqr(2);
+	t = t + 2782 * 2 + sqr(3);
+	t = t + 2783 * 2 + sqr(4);
+	t = t + 2784 * 2 + sqr(5);
+	t = t + 2785 * 2 + sqr(6);
+	t = t + 2786 * 2 + sqr(0);
+	t = t + 2787 * 2 + sqr(1);
+	t = t + 2788 * 2 + sqr(2);
+	t = t + 2789 * 2 + sqr(3);
+	t = t + 2790 * 2 + sqr(4);
+	t = t + 2791 * 2 + sqr(5);
+	t = t + 2792 * 2 + sqr(6);
+	t = t + 2793 * 2 + sqr(0);
+	t = t + 2794 * 2 + sqr(1);
+	t = t + 2795 * 2 + sqr(2);
+	t = t + 2796 * 2 + sqr(3);
+	t = t + 2797 * 2 + sqr(4);
+	t = t + 2798 * 2 + sqr(5);
+	t = t + 2799 * 2 + sqr(6);
+	t = t + 2800 * 2 + sqr(0);
+	t = t + 2801 * 2 + sqr(1);
+	t = t + 2802 * 2 + sqr(2);
+	t = t + 2803 * 2 + sqr(3);
+	t = t + 2804 * 2 + sqr(4);
+	t = t + 2805 * 2 + sqr(5);
+	t = t + 2806 * 2 + sqr(6);
+	t = t + 2807 * 2 + sqr(0);
+	t = t + 2808 * 2 + sqr(1);
+	t = t + 2809 * 2 + sqr(2);
+	t = t + 2810 * 2 + sqr(3);
+	t = t + 2811 * 2 + sqr(4);
+	t = t + 2812 * 2 + sqr(5);
+	t = t + 2813 * 2 + sqr(6);
+	t = t + 2814 * 2 + sqr(0);
+	t = t + 2815 * 2 + sqr(1);
+	t = t + 2816 * 2 + sqr(2);
+	t = t + 2817 * 2 + sqr(3);
+	t = t + 2818 * 2 + sqr(4);
+	t = t + 2819 * 2 + sqr(5);
+	t = t + 2820 * 2 + sqr(6);
+	t = t + 2821 * 2 + sqr(0);
+	t = t + 2822 * 2 + sqr(1);
+	t = t + 2823 * 2 + sqr(2);
+	t = t + 2824 * 2 + sqr(3);
+	t = t + 2825 * 2 + sqr(4);
+	t = t + 2826 * 2 + sqr(5);
+	t = t + 2827 * 2 + sqr(6);
+	t = t + 2828 * 2 + sqr(0);
+	t = t + 2829 * 2 + sqr(1);
+	t = t + 2830 * 2 + sqr(2);
+	t = t + 2831 * 2 + sqr(3);
+	t = t + 2832 * 2 + sqr(4);
+	t = t + 2833 * 2 + sqr(5);
+	t = t + 2834 * 2 + sqr(6);
+	t = t + 2835 * 2 + sqr(0);
+	t = t + 2836 * 2 + sqr(1);
+	t = t + 2837 * 2 + sqr(2);
+	t = t + 2838 * 2 + sqr(3);
+	t = t + 2839 * 2 + sqr(4);
+	t = t + 2840 * 2 + sqr(5);
+	t = t + 2841 * 2 + sqr(6);
+	t = t + 2842 * 2 + sqr(0);
+	t = t + 2843 * 2 + sqr(1);
+	t = t + 2844 * 2 + sqr(2);
+	t = t + 2845 * 2 + sqr(3);
+	t = t + 2846 * 2 + sqr(4);
+	t = t + 2847 * 2 + sqr(5);
+	t = t + 2848 * 2 + sqr(6);
+	t = t + 2849 * 2 + sqr(0);
+	t = t + 2850 * 2 + sqr(1);
+	t = t + 2851 * 2 + sqr(2);
+	t = t + 2852 * 2 + sqr(3);
+	t = t + 2853 * 2 + sqr(4);
+	t = t + 2854 * 2 + sqr(5);
+	t = t + 2855 * 2 + sqr(6);
+	t = t + 2856 * 2 + sqr(0);
+	t = t + 2857 * 2 + sqr(1);
+	t = t + 2858 * 2 + sqr(2);
+	t = t + 2859 * 2 + sqr(3);
+	t = t + 2860 * 2 + sqr(4);
+	t = t + 2861 * 2 + sqr(5);
+	t = t + 2862 * 2 + sqr(6);
+	t = t + 2863 * 2 + sqr(0);
+	t = t + 2864 * 2 + sqr(1);
+	t = t + 2865 * 2 + sqr(2);
+	t = t + 2866 * 2 + sqr(3);
+	t = t + 2867 * 2 + sqr(4);
+	t = t + 2868 * 2 + sqr(5);
+	t = t + 2869 * 2 + sqr(6);
+	t = t + 2870 * 2 + sqr(0);
+	t = t + 2871 * 2 + sqr(1);
+	t = t + 2872 * 2 + sqr(2);
+	t = t + 2873 * 2 + sqr(3);
+	t = t + 2874 * 2 + sqr(4);
+	t = t + 2875 * 2 + sqr(5);
+	t = t + 2876 * 2 + sqr(6);
+	t = t + 2877 * 2 + sqr(0);
+	t = t + 2878 * 2 + sqr(1);
+	t = t + 2879 * 2 + sqr(2);
+	t = t + 2880 * 2 + sqr(3);
+	t = t + 2881 * 2 + sqr(4);
+	t = t + 2882 * 2 + sqr(5);
+	t = t + 2883 * 2 + sqr(6);
+	t = t + 2884 * 2 + sqr(0);
+	t = t + 2885 * 2 + sqr(1);
+	t = t + 2886 * 2 + sqr(2);
+	t = t + 2887 * 2 + sqr(3);
+	t = t + 2888 * 2 + sqr(4);
+	t = t + 2889 * 2 + sqr(5);
+	t = t + 2890 * 2 + sqr(6);
+	t = t + 2891 * 2 + sqr(0);
+	t = t + 2892 * 2 + sqr(1);
+	t = t + 2893 * 2 + sqr(2);
+	t = t + 2894 * 2 + sqr(3);
+	t = t + 2895 * 2 + sqr(4);
+	t = t + 2896 * 2 + sqr(5);
+	t = t + 2897 * 2 + sqr(6);
+	t = t + 2898 * 2 + sqr(0);
+	t = t + 2899 * 2 + sqr(1);
+	t = t + 2900 * 2 + sqr(2);
+	t = t + 2901 * 2 + sqr(3);
+	t = t + 2902 * 2 + sqr(4);
+	t = t + 2903 * 2 + sqr(5);
+	t = t + 2904 * 2 + sqr(6);
+	t = t + 2905 * 2 + sqr(0);
+	t = t + 2906 * 2 + sqr(1);
+	t = t + 2907 * 2 + sqr(2);
+	t = t + 2908 * 2 + sqr(3);
+	t = t + 2909 * 2 + sqr(4);
+	t = t + 2910 * 2 + sqr(5);
+	t = t + 2911 * 2 + sqr(6);
+	t = t + 2912 * 2 + sqr(0);
+	t = t + 2913 * 2 + sqr(1);
+	t = t + 2914 * 2 + sqr(2);
+	t = t + 2915 * 2 + sqr(3);
+	t = t + 2916 * 2 + sqr(4);
+	t = t + 2917 * 2 + sqr(5);
+	t = t + 2918 * 2 + sqr(6);
+	t = t + 2919 * 2 + sqr(0);
+	t = t + 2920 * 2 + sqr(1);
+	t = t + 2921 * 2 + sqr(2);
+	t = t + 2922 * 2 + sqr(3);
+	t = t + 2923 * 2 + sqr(4);
+	t = t + 2924 * 2 + sqr(5);
+	t = t + 2925 * 2 + sqr(6);
+	t = t + 2926 * 2 + sqr(0);
+	t = t + 2927 * 2 + sqr(1);
+	t = t + 2928 * 2 + sqr(2);
+	t = t + 2929 * 2 + sqr(3);
+	t = t + 2930 * 2 + sqr(4);
+	t = t + 2931 * 2 + sqr(5);
+	t = t + 2932 * 2 + sqr(6);
+	t = t + 2933 * 2 + sqr(0);
+	t = t + 2934 * 2 + sqr(1);
+	t = t + 2935 * 2 + sqr(2);
+	t = t + 2936 * 2 + sqr(3);
+	t = t + 2937 * 2 + sqr(4);
+	t = t + 2938 * 2 + sqr(5);
+	t = t + 2939 * 2 + sqr(6);
+	t = t + 2940 * 2 + sqr(0);
+	t = t + 2941 * 2 + sqr(1);
+	t = t + 2942 * 2 + sqr(2);
+	t = t + 2943 * 2 + sqr(3);
+	t = t + 2944 * 2 + sqr(4);
+	t = t + 2945 * 2 + sqr(5);
+	t = t + 2946 * 2 + sqr(6);
+	t = t + 2947 * 2 + sqr(0);
+	t = t + 2948 * 2 + sqr(1);
+	t = t + 2949 * 2 + sqr(2);
+	t = t + 2950 * 2 + sqr(3);
+	t = t + 2951 * 2 + sqr(4);
+	t = t + 2952 * 2 + sqr(5);
+	t = t + 2953 * 2 + sqr(6);
+	t = t + 2954 * 2 + sqr(0);
+	t = t + 2955 * 2 + sqr(1);
+	t = t + 2956 * 2 + sqr(2);
+	t = t + 2957 * 2 + sqr(3);
+	t = t + 2958 * 2 + sqr(4);
+	t = t + 2959 * 2 + sqr(5);
+	t = t + 2960 * 2 + sqr(6);
+	t = t + 2961 * 2 + sqr(0);
+	t = t + 2962 * 2 + sqr(1);
+	t = t + 2963 * 2 + sqr(2);
+	t = t + 2964 * 2 + sqr(3);
+	t = t + 2965 * 2 + sqr(4);
+	t = t + 2966 * 2 + sqr(5);
+	t = t + 2967 * 2 + sqr(6);
+	t = t + 2968 * 2 + sqr(0);
+	t = t + 2969 * 2 + sqr(1);
+	t = t + 2970 * 2 + sqr(2);
+	t = t + 2971 * 2 + sqr(3);
+	t = t + 2972 * 2 + sqr(4);
+	t = t + 2973 * 2 + sqr(5);
+	t = t + 2974 * 2 + sqr(6);
+	t = t + 2975 * 2 + sqr(0);
+	t = t + 2976 * 2 + sqr(1);
+	t = t + 2977 * 2 + sqr(2);
+	t = t + 2978 * 2 + sqr(3);
+	t = t + 2979 * 2 + sqr(4);
+	t = t + 2980 * 2 + sqr(5);
+	t = t + 2981 * 2 + sqr(6);
+	t = t + 2982 * 2 + sqr(0);
+	t = t + 2983 * 2 + sqr(1);
+	t = t + 2984 * 2 + sqr(2);
+	t = t + 2985 * 2 + sqr(3);
+	t = t + 2986 * 2 + sqr(4);
+	t = t + 2987 * 2 + sqr(5);
+	t = t + 2988 * 2 + sqr(6);
+	t = t + 2989 * 2 + sqr(0);
+	t = t + 2990 * 2 + sqr(1);
+	t = t + 2991 * 2 + sqr(2);
+	t = t + 2992 * 2 + sqr(3);
+	t = t + 2993 * 2 + sqr(4);
+	t = t + 2994 * 2 + sqr(5);
+	t = t + 2995 * 2 + sqr(6);
+	t = t + 2996 * 2 + sqr(0);
+	t = t + 2997 * 2 + sqr(1);
+	t = t + 2998 * 2 + sqr(2);
+	t = t + 2999 * 2 + sqr(3);
+	t = t + 3000 * 2 + sqr(4);
+	t = t + 3001 * 2 + sqr(5);
+	t = t + 3002 * 2 + sqr(6);
+	t = t + 3003 * 2 + sqr(0);
+	t = t + 3004 * 2 + sqr(1);
+	t = t + 3005 * 2 + sqr(2);
+	t = t + 3006 * 2 + sqr(3);
+	t = t + 3007 * 2 + sqr(4);
+	t = t + 3008 * 2 + sqr(5);
+	t = t + 3009 * 2 + sqr(6);
+	t = t + 3010 * 2 + sqr(0);
+	t = t + 3011 * 2 + sqr(1);
+	t = t + 3012 * 2 + sqr(2);
+	t = t + 3013 * 2 + sqr(3);
+	t = t + 3014 * 2 + sqr(4);
+	t = t + 3015 * 2 + sqr(5);
+	t = t + 3016 * 2 + sqr(6);
+	t = t + 3017 * 2 + sqr(0);
+	t = t + 3018 * 2 + sqr(1);
+	t = t + 3019 * 2 + sqr(2);
+	t = t + 3020 * 2 + sqr(3);
+	t = t + 3021 * 2 + sqr(4);
+	t = t + 3022 * 2 + sqr(5);
+	t = t + 3023 * 2 + sqr(6);
+	t = t + 3024 * 2 + sqr(0);
+	t = t + 3025 * 2 + sqr(1);
+	t = t + 3026 * 2 + sqr(2);
+	t = t + 3027 * 2 + sqr(3);
+	t = t + 3028 * 2 + sqr(4);
+	t = t + 3029 * 2 + sqr(5);
+	t = t + 3030 * 2 + sqr(6);
+	t = t + 3031 * 2 + sqr(0);
+	t = t + 3032 * 2 + sqr(1);
+	t = t + 3033 * 2 + sqr(2);
+	t = t + 3034 * 2 + sqr(3);
+	t = t + 3035 * 2 + sqr(4);
+	t = t + 3036 * 2 + sqr(5);
+	t = t + 3037 * 2 + sqr(6);
+	t = t + 3038 * 2 + sqr(0);
+	t = t + 3039 * 2 + sqr(1);
+	t = t + 3040 * 2 + sqr(2);
+	t = t + 3041 * 2 + sqr(3);
+	t = t + 3042 * 2 + sqr(4);
+	t = t + 3043 * 2 + sqr(5);
+	t = t + 3044 * 2 + sqr(6);
+	t = t + 3045 * 2 + sqr(0);
+	t = t + 3046 * 2 + sqr(1);
+	t = t + 3047 * 2 + sqr(2);
+	t = t + 3048 * 2 + sqr(3);
+	t = t + 3049 * 2 + sqr(4);
+	t = t + 3050 * 2 + sqr(5);
+	t = t + 3051 * 2 + sqr(6);
+	t = t + 3052 * 2 + sqr(0);
+	t = t + 3053 * 2 + sqr(1);
+	t = t + 3054 * 2 + sqr(2);
+	t = t + 3055 * 2 + sqr(3);
+	t = t + 3056 * 2 + sqr(4);
+	t = t + 3057 * 2 + sqr(5);
+	t = t + 3058 * 2 + sqr(6);
+	t = t + 3059 * 2 + sqr(0);
+	t = t + 3060 * 2 + sqr(1);
+	t = t + 3061 * 2 + sqr(2);
+	t = t + 3062 * 2 + sqr(3);
+	t = t + 3063 * 2 + sqr(4);
+	t = t + 3064 * 2 + sqr(5);
+	t = t + 3065 * 2 + sqr(6);
+	t = t + 3066 * 2 + sqr(0);
+	t = t + 3067 * 2 + sqr(1);
+	t = t + 3068 * 2 + sqr(2);
+	t = t + 3069 * 2 + sqr(3);
+	t = t + 3070 * 2 + sqr(4);
+	t = t + 3071 * 2 + sqr(5);
+	t = t + 3072 * 2 + sqr(6);
+	t = t + 3073 * 2 + sqr(0);
+	t = t + 3074 * 2 + sqr(1);
+	t = t + 3075 * 2 + sqr(2);
+	t = t + 3076 * 2 + sqr(3);
+	t = t + 3077 * 2 + sqr(4);
+	t = t + 3078 * 2 + sqr(5);
+	t = t + 3079 * 2 + sqr(6);
+	t = t + 3080 * 2 + sqr(0);
+	t = t + 3081 * 2 + sqr(1);
+	t = t + 3082 * 2 + sqr(2);
+	t = t + 3083 * 2 + sqr(3);
+	t = t + 3084 * 2 + sqr(4);
+	t = t + 3085 * 2 + sqr(5);
+	t = t + 3086 * 2 + sqr(6);
+	t = t + 3087 * 2 + sqr(0);
+	t = t + 3088 * 2 + sqr(1);
+	t = t + 3089 * 2 + sqr(2);
+	t = t + 3090 * 2 + sqr(3);
+	t = t + 3091 * 2 + sqr(4);
+	t = t + 3092 * 2 + sqr(5);
+	t = t + 3093 * 2 + sqr(6);
+	t = t + 3094 * 2 + sqr(0);
+	t = t + 3095 * 2 + sqr(1);
+	t = t + 3096 * 2 + sqr(2);
+	t = t + 3097 * 2 + sqr(3);
+	t = t + 3098 * 2 + sqr(4);
+	t = t + 3099 * 2 + sqr(5);
+	t = t + 3100 * 2 + sqr(6);
+	t = t + 3101 * 2 + sqr(0);
+	t = t + 3102 * 2 + sqr(1);
+	t = t + 3103 * 2 + sqr(2);
+	t = t + 3104 * 2 + sqr(3);
+	t = t + 3105 * 2 + sqr(4);
+	t = t + 3106 * 2 + sqr(5);
+	t = t + 3107 * 2 + sqr(6);
+	t = t + 3108 * 2 + sqr(0);
+	t = t + 3109 * 2 + sqr(1);
+	t = t + 3110 * 2 + sqr(2);
+	t = t + 3111 * 2 + sqr(3);
+	t = t + 3112 * 2 + sqr(4);
+	t = t + 3113 * 2 + sqr(5);
+	t = t + 3114 * 2 + sqr(6);
+	t = t + 3115 * 2 + sqr(0);
+	t = t + 3116 * 2 + sqr(1);
+	t = t + 3117 * 2 + sqr(2);
+	t = t + 3118 * 2 + sqr(3);
+	t = t + 3119 * 2 + sqr(4);
+	t = t + 3120 * 2 + sqr(5);
+	t = t + 3121 * 2 + sqr(6);
+	t = t + 3122 * 2 + sqr(0);
+	t = t + 3123 * 2 + sqr(1);
+	t = t + 3124 * 2 + sqr(2);
+	t = t + 3125 * 2 + sqr(3);
+	t = t + 3126 * 2 + sqr(4);
+	t = t + 3127 * 2 + sqr(5);
+	t = t + 3128 * 2 + sqr(6);
+	t = t + 3129 * 2 + sqr(0);
+	t = t + 3130 * 2 + sqr(1);
+	t = t + 3131 * 2 + sqr(2);
+	t = t + 3132 * 2 + sqr(3);
+	t = t + 3133 * 2 + sqr(4);
+	t = t + 3134 * 2 + sqr(5);
+	t = t + 3135 * 2 + sqr(6);
+	t = t + 3136 * 2 + sqr(0);
+	t = t + 3137 * 2 + sqr(1);
+	t = t + 3138 * 2 + sqr(2);
+	t = t + 3139 * 2 + sqr(3);
+	t = t + 3140 * 2 + sqr(4);
+	t = t + 3141 * 2 + sqr(5);
+	t = t + 3142 * 2 + sqr(6);
+	t = t + 3143 * 2 + sqr(0);
+	t = t + 3144 * 2 + sqr(1);
+	t = t + 3145 * 2 + sqr(2);
+	t = t + 3146 * 2 + sqr(3);
+	t = t + 3147 * 2 + sqr(4);
+	t = t + 3148 * 2 + sqr(5);
+	t = t + 3149 * 2 + sqr(6);
+	t = t + 3150 * 2 + sqr(0);
+	t = t + 3151 * 2 + sqr(1);
+	t = t + 3152 * 2 + sqr(2);
+	t = t + 3153 * 2 + sqr(3);
+	t = t + 3154 * 2 + sqr(4);
+	t = t + 3155 * 2 + sqr(5);
+	t = t + 3156 * 2 + sqr(6);
+	t = t + 3157 * 2 + sqr(0);
+	t = t + 3158 * 2 + sqr(1);
+	t = t + 3159 * 2 + sqr(2);
+	t = t + 3160 * 2 + sqr(3);
+	t = t + 3161 * 2 + sqr(4);
+	t = t + 3162 * 2 + sqr(5);
+	t = t + 3163 * 2 + sqr(6);
+	t = t + 3164 * 2 + sqr(0);
+	t = t + 3165 * 2 + sqr(1);
+	t = t + 3166 * 2 + sqr(2);
+	t = t + 3167 * 2 + sqr(3);
+	t = t + 3168 * 2 + sqr(4);
+	t = t + 3169 * 2 + sqr(5);
+	t = t + 3170 * 2 + sqr(6);
+	t = t + 3171 * 2 + sqr(0);
+	t = t + 3172 * 2 + sqr(1);
+	t = t + 3173 * 2 + sqr(2);
+	t = t + 3174 * 2 + sqr(3);
+	t = t + 3175 * 2 + sqr(4);
+	t = t + 3176 * 2 + sqr(5);
+	t = t + 3177 * 2 + sqr(6);
+	t = t + 3178 * 2 + sqr(0);
+	t = t + 3179 * 2 + sqr(1);
+	t = t + 3180 * 2 + sqr(2);
+	t = t + 3181 * 2 + sqr(3);
+	t = t + 3182 * 2 + sqr(4);
+	t = t + 3183 * 2 + sqr(5);
+	t = t + 3184 * 2 + sqr(6);
+	t = t + 3185 * 2 + sqr(0);
+	t = t + 3186 * 2 + sqr(1);
+	t = t + 3187 * 2 + sqr(2);
+	t = t + 3188 * 2 + sqr(3);
+	t = t + 3189 * 2 + sqr(4);
+	t = t + 3190 * 2 + sqr(5);
+	t = t + 3191 * 2 + sqr(6);
+	t = t + 3192 * 2 + sqr(0);
+	t = t + 3193 * 2 + sqr(1);
+	t = t + 3194 * 2 + sqr(2);
+	t = t + 3195 * 2 + sqr(3);
+	t = t + 3196 * 2 + sqr(4);
+	t = t + 3197 * 2 + sqr(5);
+	t = t + 3198 * 2 + sqr(6);
+	t = t + 3199 * 2 + sqr(0);
+	t = t + 3200 * 2 + sqr(1);
+	t = t + 3201 * 2 + sqr(2);
+	t = t + 3202 * 2 + sqr(3);
+	t = t + 3203 * 2 + sqr(4);
+	t = t + 3204 * 2 + sqr(5);
+	t = t + 3205 * 2 + sqr(6);
+	t = t + 3206 * 2 + sqr(0);
+	t = t + 3207 * 2 + sqr(1);
+	t = t + 3208 * 2 + sqr(2);
+	t = t + 3209 * 2 + sqr(3);
+	t = t + 3210 * 2 + sqr(4);
+	t = t + 3211 * 2 + sqr(5);
+	t = t + 3212 * 2 + sqr(6);
+	t = t + 3213 * 2 + sqr(0);
+	t = t + 3214 * 2 + sqr(1);
+	t = t + 3215 * 2 + sqr(2);
+	t = t + 3216 * 2 + sqr(3);
+	t = t + 3217 * 2 + sqr(4);
+	t = t + 3218 * 2 + sqr(5);
+	t = t + 3219 * 2 + sqr(6);
+	t = t + 3220 * 2 + sqr(0);
+	t = t + 3221 * 2 + sqr(1);
+	t = t + 3222 * 2 + sqr(2);
+	t = t + 3223 * 2 + sqr(3);
+	t = t + 3224 * 2 + sqr(4);
+	t = t + 3225 * 2 + sqr(5);
+	t = t + 3226 * 2 + sqr(6);
+	t = t + 3227 * 2 + sqr(0);
+	t = t + 3228 * 2 + sqr(1);
+	t = t + 3229 * 2 + sqr(2);
+	t = t + 3230 * 2 + sqr(3);
+	t = t + 3231 * 2 + sqr(4);
+	t = t + 3232 * 2 + sqr(5);
+	t = t + 3233 * 2 + sqr(6);
+	t = t + 3234 * 2 + sqr(0);
+	t = t + 3235 * 2 + sqr(1);
+	t = t + 3236 * 2 + sqr(2);
+	t = t + 3237 * 2 + sqr(3);
+	t = t + 3238 * 2 + sqr(4);
+	t = t + 3239 * 2 + sqr(5);
+	t = t + 3240 * 2 + sqr(6);
+	t = t + 3241 * 2 + sqr(0);
+	t = t + 3242 * 2 + sqr(1);
+	t = t + 3243 * 2 + sqr(2);
+	t = t + 3244 * 2 + sqr(3);
+	t = t + 3245 * 2 + sqr(4);
+	t = t + 3246 * 2 + sqr(5);
+	t = t + 3247 * 2 + sqr(6);
+	t = t + 3248 * 2 + sqr(0);
+	t = t + 3249 * 2 + sqr(1);
+	t = t + 3250 * 2 + sqr(2);
+	t = t + 3251 * 2 + sqr(3);
+	t = t + 3252 * 2 + sqr(4);
+	t = t + 3253 * 2 + sqr(5);
+	t = t + 3254 * 2 + sqr(6);
+	t = t + 3255 * 2 + sqr(0);
+	t = t + 3256 * 2 + sqr(1);
+	t = t + 3257 * 2 + sqr(2);
+	t = t + 3258 * 2 + sqr(3);
+	t = t + 3259 * 2 + sqr(4);
+	t = t + 3260 * 2 + sqr(5);
+	t = t + 3261 * 2 + sqr(6);
+	t = t + 3262 * 2 + sqr(0);
+	t = t + 3263 * 2 + sqr(1);
+	t = t + 3264 * 2 + sqr(2);
+	t = t + 3265 * 2 + sqr(3);
+	t = t + 3266 * 2 + sqr(4);
+	t = t + 3267 * 2 + sqr(5);
+	t = t + 3268 * 2 + sqr(6);
+	t = t + 3269 * 2 + sqr(0);
+	t = t + 3270 * 2 + sqr(1);
+	t = t + 3271 * 2 + sqr(2);
+	t = t + 3272 * 2 + sqr(3);
+	t = t + 3273 * 2 + sqr(4);
+	t = t + 3274 * 2 + sqr(5);
+	t = t + 3275 * 2 + sqr(6);
+	t = t + 3276 * 2 + sqr(0);
+	t = t + 3277 * 2 + sqr(1);
+	t = t + 3278 * 2 + sqr(2);
+	t = t + 3279 * 2 + sqr(3);
+	t = t + 3280 * 2 + sqr(4);
+	t = t + 3281 * 2 + sqr(5);
+	t = t + 3282 * 2 + sqr(6);
+	t = t + 3283 * 2 + sqr(0);
+	t = t + 3284 * 2 + sqr(1);
+	t = t + 3285 * 2 + sqr(2);
+	t = t + 3286 * 2 + sqr(3);
+	t = t + 3287 * 2 + sqr(4);
+	t = t + 3288 * 2 + sqr(5);
+	t = t + 3289 * 2 + sqr(6);
+	t = t + 3290 * 2 + sqr(0);
+	t = t + 3291 * 2 + sqr(1);
+	t = t + 3292 * 2 + sqr(2);
+	t = t + 3293 * 2 + sqr(3);
+	t = t + 3294 * 2 + sqr(4);
+	t = t + 3295 * 2 + sqr(5);
+	t = t + 3296 * 2 + sqr(6);
+	t = t + 3297 * 2 + sqr(0);
+	t = t + 3298 * 2 + sqr(1);
+	t = t + 3299 * 2 + sqr(2);
+	t = t + 3300 * 2 + sqr(3);
+	t = t + 3301 * 2 + sqr(4);
+	t = t + 3302 * 2 + sqr(5);
+	t = t + 3303 * 2 + sqr(6);
+	t = t + 3304 * 2 + sqr(0);
+	t = t + 3305 * 2 + sqr(1);
+	t = t + 3306 * 2 + sqr(2);
+	t = t + 3307 * 2 + sqr(3);
+	t = t + 3308 * 2 + sqr(4);
+	t = t + 3309 * 2 + sqr(5);
+	t = t + 3310 * 2 + sqr(6);
+	t = t + 3311 * 2 + sqr(0);
+	t = t + 3312 * 2 + sqr(1);
+	t = t + 3313 * 2 + sqr(2);
+	t = t + 3314 * 2 + sqr(3);
+	t = t + 3315 * 2 + sqr(4);
+	t = t + 3316 * 2 + sqr(5);
+	t = t + 3317 * 2 + sqr(6);
+	t = t + 3318 * 2 + sqr(0);
+	t = t + 3319 * 2 + sqr(1);
+	t = t + 3320 * 2 + sqr(2);
+	t = t + 3321 * 2 + sqr(3);
+	t = t + 3322 * 2 + sqr(4);
+	t = t + 3323 * 2 + sqr(5);
+	t = t + 3324 * 2 + sqr(6);
+	t = t + 3325 * 2 + sqr(0);
+	t = t + 3326 * 2 + sqr(1);
+	t = t + 3327 * 2 + sqr(2);
+	t = t + 3328 * 2 + sqr(3);
+	t = t + 3329 * 2 + sqr(4);
+	t = t + 3330 * 2 + sqr(5);
+	t = t + 3331 * 2 + sqr(6);
+	t = t + 3332 * 2 + sqr(0);
+	t = t + 3333 * 2 + sqr(1);
+	t = t + 3334 * 2 + sqr(2);
+	t = t + 3335 * 2 + sqr(3);
+	t = t + 3336 * 2 + sqr(4);
+	t = t + 3337 * 2 + sqr(5);
+	t = t + 3338 * 2 + sqr(6);
+	t = t + 3339 * 2 + sqr(0);
+	t = t + 3340 * 2 + sqr(1);
+	t = t + 3341 * 2 + sqr(2);
+	t = t + 3342 * 2 + sqr(3);
+	t = t + 3343 * 2 + sqr(4);
+	t = t + 3344 * 2 + sqr(5);
+	t = t + 3345 * 2 + sqr(6);
+	t = t + 3346 * 2 + sqr(0);
+	t = t + 3347 * 2 + sqr(1);
+	t = t + 3348 * 2 + sqr(2);
+	t = t + 3349 * 2 + sqr(3);
+	t = t + 3350 * 2 + sqr(4);
+	t = t + 3351 * 2 + sqr(5);
+	t = t + 3352 * 2 + sqr(6);
+	t = t + 3353 * 2 + sqr(0);
+	t = t + 3354 * 2 + sqr(1);
+	t = t + 3355 * 2 + sqr(2);
+	t = t + 3356 * 2 + sqr(3);
+	t = t + 3357 * 2 + sqr(4);
+	t = t + 3358 * 2 + sqr(5);
+	t = t + 3359 * 2 + sqr(6);
+	t = t + 3360 * 2 + sqr(0);
+	t = t + 3361 * 2 + sqr(1);
+	t = t + 3362 * 2 + sqr(2);
+	t = t + 3363 * 2 + sqr(3);
+	t = t + 3364 * 2 + sqr(4);
+	t = t + 3365 * 2 + sqr(5);
+	t = t + 3366 * 2 + sqr(6);
+	t = t + 3367 * 2 + sqr(0);
+	t = t + 3368 * 2 + sqr(1);
+	t = t + 3369 * 2 + sqr(2);
+	t = t + 3370 * 2 + sqr(3);
+	t = t + 3371 * 2 + sqr(4);
+	t = t + 3372 * 2 + sqr(5);
+	t = t + 3373 * 2 + sqr(6);
+	t = t + 3374 * 2 + sqr(0);
+	t = t + 3375 * 2 + sqr(1);
+	t = t + 3376 * 2 + sqr(2);
+	t = t + 3377 * 2 + sqr(3);
+	t = t + 3378 * 2 + sqr(4);
+	t = t + 3379 * 2 + sqr(5);
+	t = t + 3380 * 2 + sqr(6);
+	t = t + 3381 * 2 + sqr(0);
+	t = t + 3382 * 2 + sqr(1);
+	t = t + 3383 * 2 + sqr(2);
+	t = t + 3384 * 2 + sqr(3);
+	t = t + 3385 * 2 + sqr(4);
+	t = t + 3386 * 2 + sqr(5);
+	t = t + 3387 * 2 + sqr(6);
+	t = t + 3388 * 2 + sqr(0);
+	t = t + 3389 * 2 + sqr(1);
+	t = t + 3390 * 2 + sqr(2);
+	t = t + 3391 * 2 + sqr(3);
+	t = t + 3392 * 2 + sqr(4);
+	t = t + 3393 * 2 + sqr(5);
+	t = t + 3394 * 2 + sqr(6);
+	t = t + 3395 * 2 + sqr(0);
+	t = t + 3396 * 2 + sqr(1);
+	t = t + 3397 * 2 + sqr(2);
+	t = t + 3398 * 2 + sqr(3);
+	t = t + 3399 * 2 + sqr(4);
+	t = t + 3400 * 2 + sqr(5);
+	t = t + 3401 * 2 + sqr(6);
+	t = t + 3402 * 2 + sqr(0);
+	t = t + 3403 * 2 + sqr(1);
+	t = t + 3404 * 2 + sqr(2);
+	t = t + 3405 * 2 + sqr(3);
+	t = t + 3406 * 2 + sqr(4);
+	t = t + 3407 * 2 + sqr(5);
+	t = t + 3408 * 2 + sqr(6);
+	t = t + 3409 * 2 + sqr(0);
+	t = t + 3410 * 2 + sqr(1);
+	t = t + 3411 * 2 + sqr(2);
+	t = t + 3412 * 2 + sqr(3);
+	t = t + 3413 * 2 + sqr(4);
+	t = t + 3414 * 2 + sqr(5);
+	t = t + 3415 * 2 + sqr(6);
+	t = t + 3416 * 2 + sqr(0);
+	t = t + 3417 * 2 + sqr(1);
+	t = t + 3418 * 2 + sqr(2);
+	t = t + 3419 * 2 + sqr(3);
+	t = t + 3420 * 2 + sqr(4);
+	t = t + 3421 * 2 + sqr(5);
+	t = t + 3422 * 2 + sqr(6);
+	t = t + 3423 * 2 + sqr(0);
+	t = t + 3424 * 2 + sqr(1);
+	t = t + 3425 * 2 + sqr(2);
+	t = t + 3426 * 2 + sqr(3);
+	t = t + 3427 * 2 + sqr(4);
+	t = t + 3428 * 2 + sqr(5);
+	t = t + 3429 * 2 + sqr(6);
+	t = t + 3430 * 2 + sqr(0);
+	t = t + 3431 * 2 + sqr(1);
+	t = t + 3432 * 2 + sqr(2);
+	t = t + 3433 * 2 + sqr(3);
+	t = t + 3434 * 2 + sqr(4);
+	t = t + 3435 * 2 + sqr(5);
+	t = t + 3436 * 2 + sqr(6);
+	t = t + 3437 * 2 + sqr(0);
+	t = t + 3438 * 2 + sqr(1);
+	t = t + 3439 * 2 + sqr(2);
+	t = t + 3440 * 2 + sqr(3);
+	t = t + 3441 * 2 + sqr(4);
+	t = t + 3442 * 2 + sqr(5);
+	t = t + 3443 * 2 + sqr(6);
+	t = t + 3444 * 2 + sqr(0);
+	t = t + 3445 * 2 + sqr(1);
+	t = t + 3446 * 2 + sqr(2);
+	t = t + 3447 * 2 + sqr(3);
+	t = t + 3448 * 2 + sqr(4);
+	t = t + 3449 * 2 + sqr(5);
+	t = t + 3450 * 2 + sqr(6);
+	t = t + 3451 * 2 + sqr(0);
+	t = t + 3452 * 2 + sqr(1);
+	t = t + 3453 * 2 + sqr(2);
+	t = t + 3454 * 2 + sqr(3);
+	t = t + 3455 * 2 + sqr(4);
+	t = t + 3456 * 2 + sqr(5);
+	t = t + 3457 * 2 + sqr(6);
+	t = t + 3458 * 2 + sqr(0);
+	t = t + 3459 * 2 + sqr(1);
+	t = t + 3460 * 2 + sqr(2);
+	t = t + 3461 * 2 + sqr(3);
+	t = t + 3462 * 2 + sqr(4);
+	t = t + 3463 * 2 + sqr(5);
+	t = t + 3464 * 2 + sqr(6);
+	t = t + 3465 * 2 + sqr(0);
+	t = t + 3466 * 2 + sqr(1);
+	t = t + 3467 * 2 + sqr(2);
+	t = t + 3468 * 2 + sqr(3);
+	t = t + 3469 * 2 + sqr(4);
+	t = t + 3470 * 2 + sqr(5);
+	t = t + 3471 * 2 + sqr(6);
+	t = t + 3472 * 2 + sqr(0);
+	t = t + 3473 * 2 + sqr(1);
+	t = t + 3474 * 2 + sqr(2);
+	t = t + 3475 * 2 + sqr(3);
+	t = t + 3476 * 2 + sqr(4);
+	t = t + 3477 * 2 + sqr(5);
+	t = t + 3478 * 2 + sqr(6);
+	t = t + 3479 * 2 + sqr(0);
+	t = t + 3480 * 2 + sqr(1);
+	t = t + 3481 * 2 + sqr(2);
+	t = t + 3482 * 2 + sqr(3);
+	t = t + 3483 * 2 + sqr(4);
+	t = t + 3484 * 2 + sqr(5);
+	t = t + 3485 * 2 + sqr(6);
+	t = t + 3486 * 2 + sqr(0);
+	t = t + 3487 * 2 + sqr(1);
+	t = t + 3488 * 2 + sqr(2);
+	t = t + 3489 * 2 + sqr(3);
+	t = t + 3490 * 2 + sqr(4);
+	t = t + 3491 * 2 + sqr(5);
+	t = t + 3492 * 2 + sqr(6);
+	t = t + 3493 * 2 + sqr(0);
+	t = t + 3494 * 2 + sqr(1);
+	t = t + 3495 * 2 + sqr(2);
+	t = t + 3496 * 2 + sqr(3);
+	t = t + 3497 * 2 + sqr(4);
+	t = t + 3498 * 2 + sqr(5);
+	t = t + 3499 * 2 + sqr(6);
+	t = t + 3500 * 2 + sqr(0);
+	t = t + 3501 * 2 + sqr(1);
+	t = t + 3502 * 2 + sqr(2);
+	t = t + 3503 * 2 + sqr(3);
+	t = t + 3504 * 2 + sqr(4);
+	t = t + 3505 * 2 + sqr(5);
+	t = t + 3506 * 2 + sqr(6);
+	t = t + 3507 * 2 + sqr(0);
+	t = t + 3508 * 2 + sqr(1);
+	t = t + 3509 * 2 + sqr(2);
+	t = t + 3510 * 2 + sqr(3);
+	t = t + 3511 * 2 + sqr(4);
+	t = t + 3512 * 2 + sqr(5);
+	t = t + 3513 * 2 + sqr(6);
+	t = t + 3514 * 2 + sqr(0);
+	t = t + 3515 * 2 + sqr(1);
+	t = t + 3516 * 2 + sqr(2);
+	t = t + 3517 * 2 + sqr(3);
+	t = t + 3518 * 2 + sqr(4);
+	t = t + 3519 * 2 + sqr(5);
+	t = t + 3520 * 2 + sqr(6);
+	t = t + 3521 * 2 + sqr(0);
+	t = t + 3522 * 2 + sqr(1);
+	t = t + 3523 * 2 + sqr(2);
+	t = t + 3524 * 2 + sqr(3);
+	t = t + 3525 * 2 + sqr(4);
+	t = t + 3526 * 2 + sqr(5);
+	t = t + 3527 * 2 + sqr(6);
+	t = t + 3528 * 2 + sqr(0);
+	t = t + 3529 * 2 + sqr(1);
+	t = t + 3530 * 2 + sqr(2);
+	t = t + 3531 * 2 + sqr(3);
+	t = t + 3532 * 2 + sqr(4);
+	t = t + 3533 * 2 + sqr(5);
+	t = t + 3534 * 2 + sqr(6);
+	t = t + 3535 * 2 + sqr(0);
+	t = t + 3536 * 2 + sqr(1);
+	t = t + 3537 * 2 + sqr(2);
+	t = t + 3538 * 2 + sqr(3);
+	t = t + 3539 * 2 + sqr(4);
+	t = t + 3540 * 2 + sqr(5);
+	t = t + 3541 * 2 + sqr(6);
+	t = t + 3542 * 2 + sqr(0);
+	t = t + 3543 * 2 + sqr(1);
+	t = t + 3544 * 2 + sqr(2);
+	t = t + 3545 * 2 + sqr(3);
+	t = t + 3546 * 2 + sqr(4);
+	t = t + 3547 * 2 + sqr(5);
+	t = t + 3548 * 2 + sqr(6);
+	t = t + 3549 * 2 + sqr(0);
+	t = t + 3550 * 2 + sqr(1);
+	t = t + 3551 * 2 + sqr(2);
+	t = t + 3552 * 2 + sqr(3);
+	t = t + 3553 * 2 + sqr(4);
+	t = t + 3554 * 2 + sqr(5);
+	t = t + 3555 * 2 + sqr(6);
+	t = t + 3556 * 2 + sqr(0);
+	t = t + 3557 * 2 + sqr(1);
+	t = t + 3558 * 2 + sqr(2);
+	t = t + 3559 * 2 + sqr(3);
+	t = t + 3560 * 2 + sqr(4);
+	t = t + 3561 * 2 + sqr(5);
+	t = t + 3562 * 2 + sqr(6);
+	t = t + 3563 * 2 + sqr(0);
+	t = t + 3564 * 2 + sqr(1);
+	t = t + 3565 * 2 + sqr(2);
+	t = t + 3566 * 2 + sqr(3);
+	t = t + 3567 * 2 + sqr(4);
+	t = t + 3568 * 2 + sqr(5);
+	t = t + 3569 * 2 + sqr(6);
+	t = t + 3570 * 2 + sqr(0);
+	t = t + 3571 * 2 + sqr(1);
+	t = t + 3572 * 2 + sqr(2);
+	t = t + 3573 * 2 + sqr(3);
+	t = t + 3574 * 2 + sqr(4);
+	t = t + 3575 * 2 + sqr(5);
+	t = t + 3576 * 2 + sqr(6);
+	t = t + 3577 * 2 + sqr(0);
+	t = t + 3578 * 2 + sqr(1);
+	t = t + 3579 * 2 + sqr(2);
+	t = t + 3580 * 2 + sqr(3);
+	t = t + 3581 * 2 + sqr(4);
+	t = t + 3582 * 2 + sqr(5);
+	t = t + 3583 * 2 + sqr(6);
+	t = t + 3584 * 2 + sqr(0);
+	t = t + 3585 * 2 + sqr(1);
+	t = t + 3586 * 2 + sqr(2);
+	t = t + 3587 * 2 + sqr(3);
+	t = t + 3588 * 2 + sqr(4);
+	t = t + 3589 * 2 + sqr(5);
+	t = t + 3590 * 2 + sqr(6);
+	t = t + 3591 * 2 + sqr(0);
+	t = t + 3592 * 2 + sqr(1);
+	t = t + 3593 * 2 + sqr(2);
+	t = t + 3594 * 2 + sqr(3);
+	t = t + 3595 * 2 + sqr(4);
+	t = t + 3596 * 2 + sqr(5);
+	t = t + 3597 * 2 + sqr(6);
+	t = t + 3598 * 2 + sqr(0);
+	t = t + 3599 * 2 + sqr(1);
+	t = t + 3600 * 2 + sqr(2);
+	t = t + 3601 * 2 + sqr(3);
+	t = t + 3602 * 2 + sqr(4);
+	t = t + 3603 * 2 + sqr(5);
+	t = t + 3604 * 2 + sqr(6);
+	t = t + 3605 * 2 + sqr(0);
+	t = t + 3606 * 2 + sqr(1);
+	t = t + 3607 * 2 + sqr(2);
+	t = t + 3608 * 2 + sqr(3);
+	t = t + 3609 * 2 + sqr(4);
+	t = t + 3610 * 2 + sqr(5);
+	t = t + 3611 * 2 + sqr(6);
+	t = t + 3612 * 2 + sqr(0);
+	t = t + 3613 * 2 + sqr(1);
+	t = t + 3614 * 2 + sqr(2);
+	t = t + 3615 * 2 + sqr(3);
+	t = t + 3616 * 2 + sqr(4);
+	t = t + 3617 * 2 + sqr(5);
+	t = t + 3618 * 2 + sqr(6);
+	t = t + 3619 * 2 + sqr(0);
+	t = t + 3620 * 2 + sqr(1);
+	t = t + 3621 * 2 + sqr(2);
+	t = t + 3622 * 2 + sqr(3);
+	t = t + 3623 * 2 + sqr(4);
+	t = t + 3624 * 2 + sqr(5);
+	t = t + 3625 * 2 + sqr(6);
+	t = t + 3626 * 2 + sqr(0);
+	t = t + 3627 * 2 + sqr(1);
+	t = t + 3628 * 2 + sqr(2);
+	t = t + 3629 * 2 + sqr(3);
+	t = t + 3630 * 2 + sqr(4);
+	t = t + 3631 * 2 + sqr(5);
+	t = t + 3632 * 2 + sqr(6);
+	t = t + 3633 * 2 + sqr(0);
+	t = t + 3634 * 2 + sqr(1);
+	t = t + 3635 * 2 + sqr(2);
+	t = t + 3636 * 2 + sqr(3);
+	t = t + 3637 * 2 + sqr(4);
+	t = t + 3638 * 2 + sqr(5);
+	t = t + 3639 * 2 + sqr(6);
+	t = t + 3640 * 2 + sqr(0);
+	t = t + 3641 * 2 + sqr(1);
+	t = t + 3642 * 2 + sqr(2);
+	t = t + 3643 * 2 + sqr(3);
+	t = t + 3644 * 2 + sqr(4);
+	t = t + 3645 * 2 + sqr(5);
+	t = t + 3646 * 2 + sqr(6);
+	t = t + 3647 * 2 + sqr(0);
+	t = t + 3648 * 2 + sqr(1);
+	t = t + 3649 * 2 + sqr(2);
+	t = t + 3650 * 2 + sqr(3);
+	t = t + 3651 * 2 + sqr(4);
+	t = t + 3652 * 2 + sqr(5);
+	t = t + 3653 * 2 + sqr(6);
+	t = t + 3654 * 2 + sqr(0);
+	t = t + 3655 * 2 + sqr(1);
+	t = t + 3656 * 2 + sqr(2);
+	t = t + 3657 * 2 + sqr(3);
+	t = t + 3658 * 2 + sqr(4);
+	t = t + 3659 * 2 + sqr(5);
+	t = t + 3660 * 2 + sqr(6);
+	t = t + 3661 * 2 + sqr(0);
+	t = t + 3662 * 2 + sqr(1);
+	t = t + 3663 * 2 + sqr(2);
+	t = t + 3664 * 2 + sqr(3);
+	t = t + 3665 * 2 + sqr(4);
+	t = t + 3666 * 2 + sqr(5);
+	t = t + 3667 * 2 + sqr(6);
+	t = t + 3668 * 2 + sqr(0);
+	t = t + 3669 * 2 + sqr(1);
+	t = t + 3670 * 2 + sqr(2);
+	t = t + 3671 * 2 + sqr(3);
+	t = t + 3672 * 2 + sqr(4);
+	t = t + 3673 * 2 + sqr(5);
+	t = t + 3674 * 2 + sqr(6);
+	t = t + 3675 * 2 + sqr(0);
+	t = t + 3676 * 2 + sqr(1);
+	t = t + 3677 * 2 + sqr(2);
+	t = t + 3678 * 2 + sqr(3);
+	t = t + 3679 * 2 + sqr(4);
+	t = t + 3680 * 2 + sqr(5);
+	t = t + 3681 * 2 + sqr(6);
+	t = t + 3682 * 2 + sqr(0);
+	t = t + 3683 * 2 + sqr(1);
+	t = t + 3684 * 2 + sqr(2);
+	t = t + 3685 * 2 + sqr(3);
+	t = t + 3686 * 2 + sqr(4);
+	t = t + 3687 * 2 + sqr(5);
+	t = t + 3688 * 2 + sqr(6);
+	t = t + 3689 * 2 + sqr(0);
+	t = t + 3690 * 2 + sqr(1);
+	t = t + 3691 * 2 + sqr(2);
+	t = t + 3692 * 2 + sqr(3);
+	t = t + 3693 * 2 + sqr(4);
+	t = t + 3694 * 2 + sqr(5);
+	t = t + 3695 * 2 + sqr(6);
+	t = t + 3696 * 2 + sqr(0);
+	t = t + 3697 * 2 + sqr(1);
+	t = t + 3698 * 2 + sqr(2);
+	t = t + 3699 * 2 + sqr(3);
+	t = t + 3700 * 2 + sqr(4);
+	t = t + 3701 * 2 + sqr(5);
+	t = t + 3702 * 2 + sqr(6);
+	t = t + 3703 * 2 + sqr(0);
+	t = t + 3704 * 2 + sqr(1);
+	t = t + 3705 * 2 + sqr(2);
+	t = t + 3706 * 2 + sqr(3);
+	t = t + 3707 * 2 + sqr(4);
+	t = t + 3708 * 2 + sqr(5);
+	t = t + 3709 * 2 + sqr(6);
+	t = t + 3710 * 2 + sqr(0);
+	t = t + 3711 * 2 + sqr(1);
+	t = t + 3712 * 2 + sqr(2);
+	t = t + 3713 * 2 + sqr(3);
+	t = t + 3714 * 2 + sqr(4);
+	t = t + 3715 * 2 + sqr(5);
+	t = t + 3716 * 2 + sqr(6);
+	t = t + 3717 * 2 + sqr(0);
+	t = t + 3718 * 2 + sqr(1);
+	t = t + 3719 * 2 + sqr(2);
+	t = t + 3720 * 2 + sqr(3);
+	t = t + 3721 * 2 + sqr(4);
+	t = t + 3722 * 2 + sqr(5);
+	t = t + 3723 * 2 + sqr(6);
+	t = t + 3724 * 2 + sqr(0);
+	t = t + 3725 * 2 + sqr(1);
+	t = t + 3726 * 2 + sqr(2);
+	t = t + 3727 * 2 + sqr(3);
+	t = t + 3728 * 2 + sqr(4);
+	t = t + 3729 * 2 + sqr(5);
+	t = t + 3730 * 2 + sqr(6);
+	t = t + 3731 * 2 + sqr(0);
+	t = t + 3732 * 2 + sqr(1);
+	t = t + 3733 * 2 + sqr(2);
+	t = t + 3734 * 2 + sqr(3);
+	t = t + 3735 * 2 + sqr(4);
+	t = t + 3736 * 2 + sqr(5);
+	t = t + 3737 * 2 + sqr(6);
+	t = t + 3738 * 2 + sqr(0);
+	t = t + 3739 * 2 + sqr(1);
+	t = t + 3740 * 2 + sqr(2);
+	t = t + 3741 * 2 + sqr(3);
+	t = t + 3742 * 2 + sqr(4);
+	t = t + 3743 * 2 + sqr(5);
+	t = t + 3744 * 2 + sqr(6);
+	t = t + 3745 * 2 + sqr(0);
+	t = t + 3746 * 2 + sqr(1);
+	t = t + 3747 * 2 + sqr(2);
+	t = t + 3748 * 2 + sqr(3);
+	t = t + 3749 * 2 + sqr(4);
+	t = t + 3750 * 2 + sqr(5);
+	t = t + 3751 * 2 + sqr(6);
+	t = t + 3752 * 2 + sqr(0);
+	t = t + 3753 * 2 + sqr(1);
+	t = t + 3754 * 2 + sqr(2);
+	t = t + 3755 * 2 + sqr(3);
+	t = t + 3756 * 2 + sqr(4);
+	t = t + 3757 * 2 + sqr(5);
+	t = t + 3758 * 2 + sqr(6);
+	t = t + 3759 * 2 + sqr(0);
+	t = t + 3760 * 2 + sqr(1);
+	t = t + 3761 * 2 + sqr(2);
+	t = t + 3762 * 2 + sqr(3);
+	t = t + 3763 * 2 + sqr(4);
+	t = t + 3764 * 2 + sqr(5);
+	t = t + 3765 * 2 + sqr(6);
+	t = t + 3766 * 2 + sqr(0);
+	t = t + 3767 * 2 + sqr(1);
+	t = t + 3768 * 2 + sqr(2);
+	t = t + 3769 * 2 + sqr(3);
+	t = t + 3770 * 2 + sqr(4);
+	t = t + 3771 * 2 + sqr(5);
+	t = t + 3772 * 2 + sqr(6);
+	t = t + 3773 * 2 + sqr(0);
+	t = t + 3774 * 2 + sqr(1);
+	t = t + 3775 * 2 + sqr(2);
+	t = t + 3776 * 2 + sqr(3);
+	t = t + 3777 * 2 + sqr(4);
+	t = t + 3778 * 2 + sqr(5);
+	t = t + 3779 * 2 + sqr(6);
+	t = t + 3780 * 2 + sqr(0);
+	t = t + 3781 * 2 + sqr(1);
+	t = t + 3782 * 2 + sqr(2);
+	t = t + 3783 * 2 + sqr(3);
+	t = t + 3784 * 2 + sqr(4);
+	t = t + 3785 * 2 + sqr(5);
+	t = t + 3786 * 2 + sqr(6);
+	t = t + 3787 * 2 + sqr(0);
+	t = t + 3788 * 2 + sqr(1);
+	t = t + 3789 * 2 + sqr(2);
+	t = t + 3790 * 2 + sqr(3);
+	t = t + 3791 * 2 + sqr(4);
+	t = t + 3792 * 2 + sqr(5);
+	t = t + 3793 * 2 + sqr(6);
+	t = t + 3794 * 2 + sqr(0);
+	t = t + 3795 * 2 + sqr(1);
+	t = t + 3796 * 2 + sqr(2);
+	t = t + 3797 * 2 + sqr(3);
+	t = t + 3798 * 2 + sqr(4);
+	t = t + 3799 * 2 + sqr(5);
+	t = t + 3800 * 2 + sqr(6);
+	t = t + 3801 * 2 + sqr(0);
+	t = t + 3802 * 2 + sqr(1);
+	t = t + 3803 * 2 + sqr(2);
+	t = t + 3804 * 2 + sqr(3);
+	t = t + 3805 * 2 + sqr(4);
+	t = t + 3806 * 2 + sqr(5);
+	t = t + 3807 * 2 + sqr(6);
+	t = t + 3808 * 2 + sqr(0);
+	t = t + 3809 * 2 + sqr(1);
+	t = t + 3810 * 2 + sqr(2);
+	t = t + 3811 * 2 + sqr(3);
+	t = t + 3812 * 2 + sqr(4);
+	t = t + 3813 * 2 + sqr(5);
+	t = t + 3814 * 2 + sqr(6);
+	t = t + 3815 * 2 + sqr(0);
+	t = t + 3816 * 2 + sqr(1);
+	t = t + 3817 * 2 + sqr(2);
+	t = t + 3818 * 2 + sqr(3);
+	t = t + 3819 * 2 + sqr(4);
+	t = t + 3820 * 2 + sqr(5);
+	t = t + 3821 * 2 + sqr(6);
+	t = t + 3822 * 2 + sqr(0);
+	t = t + 3823 * 2 + sqr(1);
+	t = t + 3824 * 2 + sqr(2);
+	t = t + 3825 * 2 + sqr(3);
+	t = t + 3826 * 2 + sqr(4);
+	t = t + 3827 * 2 + sqr(5);
+	t = t + 3828 * 2 + sqr(6);
+	t = t + 3829 * 2 + sqr(0);
+	t = t + 3830 * 2 + sqr(1);
+	t = t + 3831 * 2 + sqr(2);
+	t = t + 3832 * 2 + sqr(3);
+	t = t + 3833 * 2 + sqr(4);
+	t = t + 3834 * 2 + sqr(5);
+	t = t + 3835 * 2 + sqr(6);
+	t = t + 3836 * 2 + sqr(0);
+	t = t + 3837 * 2 + sqr(1);
+	t = t + 3838 * 2 + sqr(2);
+	t = t + 3839 * 2 + sqr(3);
+	t = t + 3840 * 2 + sqr(4);
+	t = t + 3841 * 2 + sqr(5);
+	t = t + 3842 * 2 + sqr(6);
+	t = t + 3843 * 2 + sqr(0);
+	t = t + 3844 * 2 + sqr(1);
+	t = t + 3845 * 2 + sqr(2);
+	t = t + 3846 * 2 + sqr(3);
+	t = t + 3847 * 2 + sqr(4);
+	t = t + 3848 * 2 + sqr(5);
+	t = t + 3849 * 2 + sqr(6);
+	t = t + 3850 * 2 + sqr(0);
+	t = t + 3851 * 2 + sqr(1);
+	t = t + 3852 * 2 + sqr(2);
+	t = t + 3853 * 2 + sqr(3);
+	t = t + 3854 * 2 + sqr(4);
+	t = t + 3855 * 2 + sqr(5);
+	t = t + 3856 * 2 + sqr(6);
+	t = t + 3857 * 2 + sqr(0);
+	t = t + 3858 * 2 + sqr(1);
+	t = t + 3859 * 2 + sqr(2);
+	t = t + 3860 * 2 + sqr(3);
+	t = t + 3861 * 2 + sqr(4);
+	t = t + 3862 * 2 + sqr(5);
+	t = t + 3863 * 2 + sqr(6);
+	t = t + 3864 * 2 + sqr(0);
+	t = t + 3865 * 2 + sqr(1);
+	t = t + 3866 * 2 + sqr(2);
+	t = t + 3867 * 2 + sqr(3);
+	t = t + 3868 * 2 + sqr(4);
+	t = t + 3869 * 2 + sqr(5);
+	t = t + 3870 * 2 + sqr(6);
+	t = t + 3871 * 2 + sqr(0);
+	t = t + 3872 * 2 + sqr(1);
+	t = t + 3873 * 2 + sqr(2);
+	t = t + 3874 * 2 + sqr(3);
+	t = t + 3875 * 2 + sqr(4);
+	t = t + 3876 * 2 + sqr(5);
+	t = t + 3877 * 2 + sqr(6);
+	t = t + 3878 * 2 + sqr(0);
+	t = t + 3879 * 2 + sqr(1);
+	t = t + 3880 * 2 + sqr(2);
+	t = t + 3881 * 2 + sqr(3);
+	t = t + 3882 * 2 + sqr(4);
+	t = t + 3883 * 2 + sqr(5);
+	t = t + 3884 * 2 + sqr(6);
+	t = t + 3885 * 2 + sqr(0);
+	t = t + 3886 * 2 + sqr(1);
+	t = t + 3887 * 2 + sqr(2);
+	t = t + 3888 * 2 + sqr(3);
+	t = t + 3889 * 2 + sqr(4);
+	t = t + 3890 * 2 + sqr(5);
+	t = t + 3891 * 2 + sqr(6);
+	t = t + 3892 * 2 + sqr(0);
+	t = t + 3893 * 2 + sqr(1);
+	t = t + 3894 * 2 + sqr(2);
+	t = t + 3895 * 2 + sqr(3);
+	t = t + 3896 * 2 + sqr(4);
+	t = t + 3897 * 2 + sqr(5);
+	t = t + 3898 * 2 + sqr(6);
+	t = t + 3899 * 2 + sqr(0);
+	t = t + 3900 * 2 + sqr(1);
+	t = t + 3901 * 2 + sqr(2);
+	t = t + 3902 * 2 + sqr(3);
+	t = t + 3903 * 2 + sqr(4);
+	t = t + 3904 * 2 + sqr(5);
+	t = t + 3905 * 2 + sqr(6);
+	t = t + 3906 * 2 + sqr(0);
+	t = t + 3907 * 2 + sqr(1);
+	t = t + 3908 * 2 + sqr(2);
+	t = t + 3909 * 2 + sqr(3);
+	t = t + 3910 * 2 + sqr(4);
+	t = t + 3911 * 2 + sqr(5);
+	t = t + 3912 * 2 + sqr(6);
+	t = t + 3913 * 2 + sqr(0);
+	t = t + 3914 * 2 + sqr(1);
+	t = t + 3915 * 2 + sqr(2);
+	t = t + 3916 * 2 + sqr(3);
+	t = t + 3917 * 2 + sqr(4);
+	t = t + 3918 * 2 + sqr(5);
+	t = t + 3919 * 2 + sqr(6);
+	t = t + 3920 * 2 + sqr(0);
+	t = t + 3921 * 2 + sqr(1);
+	t = t + 3922 * 2 + sqr(2);
+	t = t + 3923 * 2 + sqr(3);
+	t = t + 3924 * 2 + sqr(4);
+	t = t + 3925 * 2 + sqr(5);
+	t = t + 3926 * 2 + sqr(6);
+	t = t + 3927 * 2 + sqr(0);
+	t = t + 3928 * 2 + sqr(1);
+	t = t + 3929 * 2 + sqr(2);
+	t = t + 3930 * 2 + sqr(3);
+	t = t + 3931 * 2 + sqr(4);
+	t = t + 3932 * 2 + sqr(5);
+	t = t + 3933 * 2 + sqr(6);
+	t = t + 3934 * 2 + sqr(0);
+	t = t + 3935 * 2 + sqr(1);
+	t = t + 3936 * 2 + sqr(2);
+	t = t + 3937 * 2 + sqr(3);
+	t = t + 3938 * 2 + sqr(4);
+	t = t + 3939 * 2 + sqr(5);
+	t = t + 3940 * 2 + sqr(6);
+	t = t + 3941 * 2 + sqr(0);
+	t = t + 3942 * 2 + sqr(1);
+	t = t + 3943 * 2 + sqr(2);
+	t = t + 3944 * 2 + sqr(3);
+	t = t + 3945 * 2 + sqr(4);
+	t = t + 3946 * 2 + sqr(5);
+	t = t + 3947 * 2 + sqr(6);
+	t = t + 3948 * 2 + sqr(0);
+	t = t + 3949 * 2 + sqr(1);
+	t = t + 3950 * 2 + sqr(2);
+	t = t + 3951 * 2 + sqr(3);
+	t = t + 3952 * 2 + sqr(4);
+	t = t + 3953 * 2 + sqr(5);
+	t = t + 3954 * 2 + sqr(6);
+	t = t + 3955 * 2 + sqr(0);
+	t = t + 3956 * 2 + sqr(1);
+	t = t + 3957 * 2 + sqr(2);
+	t = t + 3958 * 2 + sqr(3);
+	t = t + 3959 * 2 + sqr(4);
+	t = t + 3960 * 2 + sqr(5);
+	t = t + 3961 * 2 + sqr(6);
+	t = t + 3962 * 2 + sqr(0);
+	t = t + 3963 * 2 + sqr(1);
+	t = t + 3964 * 2 + sqr(2);
+	t = t + 3965 * 2 + sqr(3);
+	t = t + 3966 * 2 + sqr(4);
+	t = t + 3967 * 2 + sqr(5);
+	t = t + 3968 * 2 + sqr(6);
+	t = t + 3969 * 2 + sqr(0);
+	t = t + 3970 * 2 + sqr(1);
+	t = t + 3971 * 2 + sqr(2);
+	t = t + 3972 * 2 + sqr(3);
+	t = t + 3973 * 2 + sqr(4);
+	t = t + 3974 * 2 + sqr(5);
+	t = t + 3975 * 2 + sqr(6);
+	t = t + 3976 * 2 + sqr(0);
+	t = t + 3977 * 2 + sqr(1);
+	t = t + 3978 * 2 + sqr(2);
+	t = t + 3979 * 2 + sqr(3);
+	t = t + 3980 * 2 + sqr(4);
+	t = t + 3981 * 2 + sqr(5);
+	t = t + 3982 * 2 + sqr(6);
+	t = t + 3983 * 2 + sqr(0);
+	t = t + 3984 * 2 + sqr(1);
+	t = t + 3985 * 2 + sqr(2);
+	t = t + 3986 * 2 + sqr(3);
+	t = t + 3987 * 2 + sqr(4);
+	t = t + 3988 * 2 + sqr(5);
+	t = t + 3989 * 2 + sqr(6);
+	t = t + 3990 * 2 + sqr(0);
+	t = t + 3991 * 2 + sqr(1);
+	t = t + 3992 * 2 + sqr(2);
+	t = t + 3993 * 2 + sqr(3);
+	t = t + 3994 * 2 + sqr(4);
+	t = t + 3995 * 2 + sqr(5);
+	t = t + 3996 * 2 + sqr(6);
+	t = t + 3997 * 2 + sqr(0);
+	t = t + 3998 * 2 + sqr(1);
+	t = t + 3999 * 2 + sqr(2);
+	prnt(t);
+]
@@ -0,0 +1,57 @@
+func float classify(n)
+[
+	if (n < 10)
+	[
+		if (n < 5)
+		[
+			ret 1;
+		]
+		else
+		[
+			ret 2;
+		]
+	]
+	else
+	[
+		if (n < 50)
+		[
+			ret 3;
+		]
+	]
+	ret 4;
+]
+
+func Main()
+[
+	var i = 0;
+	var small = 0;
+	var large = 0;
+	var sum = 0;
+	while (i < 20000)
+	[
+		var n = mod(i | 100);
+		if (n < 50)
+		[
+			if (n < 25)
+			[
+				small++;
+			]
+			else
+			[
+				if (n < 40)
+				[
+					sum = sum + n;
+				]
+			]
+		]
+		else
+		[
+			large++;
+		]
+		sum = sum + classify(n);
+		i++;
+	]
+	prnt(small);
+	prnt(large);
+	prnt(sum);
+]
@@ -0,0 +1,33 @@
+func float steps(n)
+[
+	var count = 0;
+	while (n > 1)
+	[
+		var rest = mod(n | 2);
+		if (rest == 0)
+		[
+			n = n / 2;
+		]
+		if (rest != 0)
+		[
+			n = n * 3 + 1;
+		]
+		count++;
+	]
+	ret count;
+]
+
+var longest = steps(27);
+
+func Main()
+[
+	var i = 0;
+	var total = 0;
+	while (i < 2000)
+	[
+		var s = steps(97) + steps(871);
+		total = total + s + longest;
+		i++;
+	]
+	prnt(total);
+]
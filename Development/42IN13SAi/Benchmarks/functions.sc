@@ -0,0 +1,22 @@
+func float distance(x | y)
+[
+	ret sqrt(sqr(x) + sqr(y));
+]
+
+func float angle(x)
+[
+	ret sin(x) * cos(x) + cos(x / 4);
+]
+
+func Main()
+[
+	var i = 0;
+	var total = 0;
+	while (i < 20000)
+	[
+		total = total + distance(i | i + 1);
+		total = total + angle(i);
+		i++;
+	]
+	prnt(total);
+]
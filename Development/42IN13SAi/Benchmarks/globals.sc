@@ -0,0 +1,2019 @@
+var g0 = 0;
+var g1 = 1;
+var g2 = 2;
+var g3 = 3;
+var g4 = 4;
+var g5 = 5;
+var g6 = 6;
+var g7 = 7;
+var g8 = 8;
+var g9 = 9;
+var g10 = 0;
+var g11 = 1;
+var g12 = 2;
+var g13 = 3;
+var g14 = 4;
+var g15 = 5;
+var g16 = 6;
+var g17 = 7;
+var g18 = 8;
+var g19 = 9;
+var g20 = 0;
+var g21 = 1;
+var g22 = 2;
+var g23 = 3;
+var g24 = 4;
+var g25 = 5;
+var g26 = 6;
+var g27 = 7;
+var g28 = 8;
+var g29 = 9;
+var g30 = 0;
+var g31 = 1;
+var g32 = 2;
+var g33 = 3;
+var g34 = 4;
+var g35 = 5;
+var g36 = 6;
+var g37 = 7;
+var g38 = 8;
+var g39 = 9;
+var g40 = 0;
+var g41 = 1;
+var g42 = 2;
+var g43 = 3;
+var g44 = 4;
+var g45 = 5;
+var g46 = 6;
+var g47 = 7;
+var g48 = 8;
+var g49 = 9;
+var g50 = 0;
+var g51 = 1;
+var g52 = 2;
+var g53 = 3;
+var g54 = 4;
+var g55 = 5;
+var g56 = 6;
+var g57 = 7;
+var g58 = 8;
+var g59 = 9;
+var g60 = 0;
+var g61 = 1;
+var g62 = 2;
+var g63 = 3;
+var g64 = 4;
+var g65 = 5;
+var g66 = 6;
+var g67 = 7;
+var g68 = 8;
+var g69 = 9;
+var g70 = 0;
+var g71 = 1;
+var g72 = 2;
+var g73 = 3;
+var g74 = 4;
+var g75 = 5;
+var g76 = 6;
+var g77 = 7;
+var g78 = 8;
+var g79 = 9;
+var g80 = 0;
+var g81 = 1;
+var g82 = 2;
+var g83 = 3;
+var g84 = 4;
+var g85 = 5;
+var g86 = 6;
+var g87 = 7;
+var g88 = 8;
+var g89 = 9;
+var g90 = 0;
+var g91 = 1;
+var g92 = 2;
+var g93 = 3;
+var g94 = 4;
+var g95 = 5;
+var g96 = 6;
+var g97 = 7;
+var g98 = 8;
+var g99 = 9;
+var g100 = 0;
+var g101 = 1;
+var g102 = 2;
+var g103 = 3;
+var g104 = 4;
+var g105 = 5;
+var g106 = 6;
+var g107 = 7;
+var g108 = 8;
+var g109 = 9;
+var g110 = 0;
+var g111 = 1;
+var g112 = 2;
+var g113 = 3;
+var g114 = 4;
+var g115 = 5;
+var g116 = 6;
+var g117 = 7;
+var g118 = 8;
+var g119 = 9;
+var g120 = 0;
+var g121 = 1;
+var g122 = 2;
+var g123 = 3;
+var g124 = 4;
+var g125 = 5;
+var g126 = 6;
+var g127 = 7;
+var g128 = 8;
+var g129 = 9;
+var g130 = 0;
+var g131 = 1;
+var g132 = 2;
+var g133 = 3;
+var g134 = 4;
+var g135 = 5;
+var g136 = 6;
+var g137 = 7;
+var g138 = 8;
+var g139 = 9;
+var g140 = 0;
+var g141 = 1;
+var g142 = 2;
+var g143 = 3;
+var g144 = 4;
+var g145 = 5;
+var g146 = 6;
+var g147 = 7;
+var g148 = 8;
+var g149 = 9;
+var g150 = 0;
+var g151 = 1;
+var g152 = 2;
+var g153 = 3;
+var g154 = 4;
+var g155 = 5;
+var g156 = 6;
+var g157 = 7;
+var g158 = 8;
+var g159 = 9;
+var g160 = 0;
+var g161 = 1;
+var g162 = 2;
+var g163 = 3;
+var g164 = 4;
+var g165 = 5;
+var g166 = 6;
+var g167 = 7;
+var g168 = 8;
+var g169 = 9;
+var g170 = 0;
+var g171 = 1;
+var g172 = 2;
+var g173 = 3;
+var g174 = 4;
+var g175 = 5;
+var g176 = 6;
+var g177 = 7;
+var g178 = 8;
+var g179 = 9;
+var g180 = 0;
+var g181 = 1;
+var g182 = 2;
+var g183 = 3;
+var g184 = 4;
+var g185 = 5;
+var g186 = 6;
+var g187 = 7;
+var g188 = 8;
+var g189 = 9;
+var g190 = 0;
+var g191 = 1;
+var g192 = 2;
+var g193 = 3;
+var g194 = 4;
+var g195 = 5;
+var g196 = 6;
+var g197 = 7;
+var g198 = 8;
+var g199 = 9;
+var g200 = 0;
+var g201 = 1;
+var g202 = 2;
+var g203 = 3;
+var g204 = 4;
+var g205 = 5;
+var g206 = 6;
+var g207 = 7;
+var g208 = 8;
+var g209 = 9;
+var g210 = 0;
+var g211 = 1;
+var g212 = 2;
+var g213 = 3;
+var g214 = 4;
+var g215 = 5;
+var g216 = 6;
+var g217 = 7;
+var g218 = 8;
+var g219 = 9;
+var g220 = 0;
+var g221 = 1;
+var g222 = 2;
+var g223 = 3;
+var g224 = 4;
+var g225 = 5;
+var g226 = 6;
+var g227 = 7;
+var g228 = 8;
+var g229 = 9;
+var g230 = 0;
+var g231 = 1;
+var g232 = 2;
+var g233 = 3;
+var g234 = 4;
+var g235 = 5;
+var g236 = 6;
+var g237 = 7;
+var g238 = 8;
+var g239 = 9;
+var g240 = 0;
+var g241 = 1;
+var g242 = 2;
+var g243 = 3;
+var g244 = 4;
+var g245 = 5;
+var g246 = 6;
+var g247 = 7;
+var g248 = 8;
+var g249 = 9;
+var g250 = 0;
+var g251 = 1;
+var g252 = 2;
+var g253 = 3;
+var g254 = 4;
+var g255 = 5;
+var g256 = 6;
+var g257 = 7;
+var g258 = 8;
+var g259 = 9;
+var g260 = 0;
+var g261 = 1;
+var g262 = 2;
+var g263 = 3;
+var g264 = 4;
+var g265 = 5;
+var g266 = 6;
+var g267 = 7;
+var g268 = 8;
+var g269 = 9;
+var g270 = 0;
+var g271 = 1;
+var g272 = 2;
+var g273 = 3;
+var g274 = 4;
+var g275 = 5;
+var g276 = 6;
+var g277 = 7;
+var g278 = 8;
+var g279 = 9;
+var g280 = 0;
+var g281 = 1;
+var g282 = 2;
+var g283 = 3;
+var g284 = 4;
+var g285 = 5;
+var g286 = 6;
+var g287 = 7;
+var g288 = 8;
+var g289 = 9;
+var g290 = 0;
+var g291 = 1;
+var g292 = 2;
+var g293 = 3;
+var g294 = 4;
+var g295 = 5;
+var g296 = 6;
+var g297 = 7;
+var g298 = 8;
+var g299 = 9;
+var g300 = 0;
+var g301 = 1;
+var g302 = 2;
+var g303 = 3;
+var g304 = 4;
+var g305 = 5;
+var g306 = 6;
+var g307 = 7;
+var g308 = 8;
+var g309 = 9;
+var g310 = 0;
+var g311 = 1;
+var g312 = 2;
+var g313 = 3;
+var g314 = 4;
+var g315 = 5;
+var g316 = 6;
+var g317 = 7;
+var g318 = 8;
+var g319 = 9;
+var g320 = 0;
+var g321 = 1;
+var g322 = 2;
+var g323 = 3;
+var g324 = 4;
+var g325 = 5;
+var g326 = 6;
+var g327 = 7;
+var g328 = 8;
+var g329 = 9;
+var g330 = 0;
+var g331 = 1;
+var g332 = 2;
+var g333 = 3;
+var g334 = 4;
+var g335 = 5;
+var g336 = 6;
+var g337 = 7;
+var g338 = 8;
+var g339 = 9;
+var g340 = 0;
+var g341 = 1;
+var g342 = 2;
+var g343 = 3;
+var g344 = 4;
+var g345 = 5;
+var g346 = 6;
+var g347 = 7;
+var g348 = 8;
+var g349 = 9;
+var g350 = 0;
+var g351 = 1;
+var g352 = 2;
+var g353 = 3;
+var g354 = 4;
+var g355 = 5;
+var g356 = 6;
+var g357 = 7;
+var g358 = 8;
+var g359 = 9;
+var g360 = 0;
+var g361 = 1;
+var g362 = 2;
+var g363 = 3;
+var g364 = 4;
+var g365 = 5;
+var g366 = 6;
+var g367 = 7;
+var g368 = 8;
+var g369 = 9;
+var g370 = 0;
+var g371 = 1;
+var g372 = 2;
+var g373 = 3;
+var g374 = 4;
+var g375 = 5;
+var g376 = 6;
+var g377 = 7;
+var g378 = 8;
+var g379 = 9;
+var g380 = 0;
+var g381 = 1;
+var g382 = 2;
+var g383 = 3;
+var g384 = 4;
+var g385 = 5;
+var g386 = 6;
+var g387 = 7;
+var g388 = 8;
+var g389 = 9;
+var g390 = 0;
+var g391 = 1;
+var g392 = 2;
+var g393 = 3;
+var g394 = 4;
+var g395 = 5;
+var g396 = 6;
+var g397 = 7;
+var g398 = 8;
+var g399 = 9;
+var g400 = 0;
+var g401 = 1;
+var g402 = 2;
+var g403 = 3;
+var g404 = 4;
+var g405 = 5;
+var g406 = 6;
+var g407 = 7;
+var g408 = 8;
+var g409 = 9;
+var g410 = 0;
+var g411 = 1;
+var g412 = 2;
+var g413 = 3;
+var g414 = 4;
+var g415 = 5;
+var g416 = 6;
+var g417 = 7;
+var g418 = 8;
+var g419 = 9;
+var g420 = 0;
+var g421 = 1;
+var g422 = 2;
+var g423 = 3;
+var g424 = 4;
+var g425 = 5;
+var g426 = 6;
+var g427 = 7;
+var g428 = 8;
+var g429 = 9;
+var g430 = 0;
+var g431 = 1;
+var g432 = 2;
+var g433 = 3;
+var g434 = 4;
+var g435 = 5;
+var g436 = 6;
+var g437 = 7;
+var g438 = 8;
+var g439 = 9;
+var g440 = 0;
+var g441 = 1;
+var g442 = 2;
+var g443 = 3;
+var g444 = 4;
+var g445 = 5;
+var g446 = 6;
+var g447 = 7;
+var g448 = 8;
+var g449 = 9;
+var g450 = 0;
+var g451 = 1;
+var g452 = 2;
+var g453 = 3;
+var g454 = 4;
+var g455 = 5;
+var g456 = 6;
+var g457 = 7;
+var g458 = 8;
+var g459 = 9;
+var g460 = 0;
+var g461 = 1;
+var g462 = 2;
+var g463 = 3;
+var g464 = 4;
+var g465 = 5;
+var g466 = 6;
+var g467 = 7;
+var g468 = 8;
+var g469 = 9;
+var g470 = 0;
+var g471 = 1;
+var g472 = 2;
+var g473 = 3;
+var g474 = 4;
+var g475 = 5;
+var g476 = 6;
+var g477 = 7;
+var g478 = 8;
+var g479 = 9;
+var g480 = 0;
+var g481 = 1;
+var g482 = 2;
+var g483 = 3;
+var g484 = 4;
+var g485 = 5;
+var g486 = 6;
+var g487 = 7;
+var g488 = 8;
+var g489 = 9;
+var g490 = 0;
+var g491 = 1;
+var g492 = 2;
+var g493 = 3;
+var g494 = 4;
+var g495 = 5;
+var g496 = 6;
+var g497 = 7;
+var g498 = 8;
+var g499 = 9;
+var g500 = 0;
+var g501 = 1;
+var g502 = 2;
+var g503 = 3;
+var g504 = 4;
+var g505 = 5;
+var g506 = 6;
+var g507 = 7;
+var g508 = 8;
+var g509 = 9;
+var g510 = 0;
+var g511 = 1;
+var g512 = 2;
+var g513 = 3;
+var g514 = 4;
+var g515 = 5;
+var g516 = 6;
+var g517 = 7;
+var g518 = 8;
+var g519 = 9;
+var g520 = 0;
+var g521 = 1;
+var g522 = 2;
+var g523 = 3;
+var g524 = 4;
+var g525 = 5;
+var g526 = 6;
+var g527 = 7;
+var g528 = 8;
+var g529 = 9;
+var g530 = 0;
+var g531 = 1;
+var g532 = 2;
+var g533 = 3;
+var g534 = 4;
+var g535 = 5;
+var g536 = 6;
+var g537 = 7;
+var g538 = 8;
+var g539 = 9;
+var g540 = 0;
+var g541 = 1;
+var g542 = 2;
+var g543 = 3;
+var g544 = 4;
+var g545 = 5;
+var g546 = 6;
+var g547 = 7;
+var g548 = 8;
+var g549 = 9;
+var g550 = 0;
+var g551 = 1;
+var g552 = 2;
+var g553 = 3;
+var g554 = 4;
+var g555 = 5;
+var g556 = 6;
+var g557 = 7;
+var g558 = 8;
+var g559 = 9;
+var g560 = 0;
+var g561 = 1;
+var g562 = 2;
+var g563 = 3;
+var g564 = 4;
+var g565 = 5;
+var g566 = 6;
+var g567 = 7;
+var g568 = 8;
+var g569 = 9;
+var g570 = 0;
+var g571 = 1;
+var g572 = 2;
+var g573 = 3;
+var g574 = 4;
+var g575 = 5;
+var g576 = 6;
+var g577 = 7;
+var g578 = 8;
+var g579 = 9;
+var g580 = 0;
+var g581 = 1;
+var g582 = 2;
+var g583 = 3;
+var g584 = 4;
+var g585 = 5;
+var g586 = 6;
+var g587 = 7;
+var g588 = 8;
+var g589 = 9;
+var g590 = 0;
+var g591 = 1;
+var g592 = 2;
+var g593 = 3;
+var g594 = 4;
+var g595 = 5;
+var g596 = 6;
+var g597 = 7;
+var g598 = 8;
+var g599 = 9;
+var g600 = 0;
+var g601 = 1;
+var g602 = 2;
+var g603 = 3;
+var g604 = 4;
+var g605 = 5;
+var g606 = 6;
+var g607 = 7;
+var g608 = 8;
+var g609 = 9;
+var g610 = 0;
+var g611 = 1;
+var g612 = 2;
+var g613 = 3;
+var g614 = 4;
+var g615 = 5;
+var g616 = 6;
+var g617 = 7;
+var g618 = 8;
+var g619 = 9;
+var g620 = 0;
+var g621 = 1;
+var g622 = 2;
+var g623 = 3;
+var g624 = 4;
+var g625 = 5;
+var g626 = 6;
+var g627 = 7;
+var g628 = 8;
+var g629 = 9;
+var g630 = 0;
+var g631 = 1;
+var g632 = 2;
+var g633 = 3;
+var g634 = 4;
+var g635 = 5;
+var g636 = 6;
+var g637 = 7;
+var g638 = 8;
+var g639 = 9;
+var g640 = 0;
+var g641 = 1;
+var g642 = 2;
+var g643 = 3;
+var g644 = 4;
+var g645 = 5;
+var g646 = 6;
+var g647 = 7;
+var g648 = 8;
+var g649 = 9;
+var g650 = 0;
+var g651 = 1;
+var g652 = 2;
+var g653 = 3;
+var g654 = 4;
+var g655 = 5;
+var g656 = 6;
+var g657 = 7;
+var g658 = 8;
+var g659 = 9;
+var g660 = 0;
+var g661 = 1;
+var g662 = 2;
+var g663 = 3;
+var g664 = 4;
+var g665 = 5;
+var g666 = 6;
+var g667 = 7;
+var g668 = 8;
+var g669 = 9;
+var g670 = 0;
+var g671 = 1;
+var g672 = 2;
+var g673 = 3;
+var g674 = 4;
+var g675 = 5;
+var g676 = 6;
+var g677 = 7;
+var g678 = 8;
+var g679 = 9;
+var g680 = 0;
+var g681 = 1;
+var g682 = 2;
+var g683 = 3;
+var g684 = 4;
+var g685 = 5;
+var g686 = 6;
+var g687 = 7;
+var g688 = 8;
+var g689 = 9;
+var g690 = 0;
+var g691 = 1;
+var g692 = 2;
+var g693 = 3;
+var g694 = 4;
+var g695 = 5;
+var g696 = 6;
+var g697 = 7;
+var g698 = 8;
+var g699 = 9;
+var g700 = 0;
+var g701 = 1;
+var g702 = 2;
+var g703 = 3;
+var g704 = 4;
+var g705 = 5;
+var g706 = 6;
+var g707 = 7;
+var g708 = 8;
+var g709 = 9;
+var g710 = 0;
+var g711 = 1;
+var g712 = 2;
+var g713 = 3;
+var g714 = 4;
+var g715 = 5;
+var g716 = 6;
+var g717 = 7;
+var g718 = 8;
+var g719 = 9;
+var g720 = 0;
+var g721 = 1;
+var g722 = 2;
+var g723 = 3;
+var g724 = 4;
+var g725 = 5;
+var g726 = 6;
+var g727 = 7;
+var g728 = 8;
+var g729 = 9;
+var g730 = 0;
+var g731 = 1;
+var g732 = 2;
+var g733 = 3;
+var g734 = 4;
+var g735 = 5;
+var g736 = 6;
+var g737 = 7;
+var g738 = 8;
+var g739 = 9;
+var g740 = 0;
+var g741 = 1;
+var g742 = 2;
+var g743 = 3;
+var g744 = 4;
+var g745 = 5;
+var g746 = 6;
+var g747 = 7;
+var g748 = 8;
+var g749 = 9;
+var g750 = 0;
+var g751 = 1;
+var g752 = 2;
+var g753 = 3;
+var g754 = 4;
+var g755 = 5;
+var g756 = 6;
+var g757 = 7;
+var g758 = 8;
+var g759 = 9;
+var g760 = 0;
+var g761 = 1;
+var g762 = 2;
+var g763 = 3;
+var g764 = 4;
+var g765 = 5;
+var g766 = 6;
+var g767 = 7;
+var g768 = 8;
+var g769 = 9;
+var g770 = 0;
+var g771 = 1;
+var g772 = 2;
+var g773 = 3;
+var g774 = 4;
+var g775 = 5;
+var g776 = 6;
+var g777 = 7;
+var g778 = 8;
+var g779 = 9;
+var g780 = 0;
+var g781 = 1;
+var g782 = 2;
+var g783 = 3;
+var g784 = 4;
+var g785 = 5;
+var g786 = 6;
+var g787 = 7;
+var g788 = 8;
+var g789 = 9;
+var g790 = 0;
+var g791 = 1;
+var g792 = 2;
+var g793 = 3;
+var g794 = 4;
+var g795 = 5;
+var g796 = 6;
+var g797 = 7;
+var g798 = 8;
+var g799 = 9;
+var g800 = 0;
+var g801 = 1;
+var g802 = 2;
+var g803 = 3;
+var g804 = 4;
+var g805 = 5;
+var g806 = 6;
+var g807 = 7;
+var g808 = 8;
+var g809 = 9;
+var g810 = 0;
+var g811 = 1;
+var g812 = 2;
+var g813 = 3;
+var g814 = 4;
+var g815 = 5;
+var g816 = 6;
+var g817 = 7;
+var g818 = 8;
+var g819 = 9;
+var g820 = 0;
+var g821 = 1;
+var g822 = 2;
+var g823 = 3;
+var g824 = 4;
+var g825 = 5;
+var g826 = 6;
+var g827 = 7;
+var g828 = 8;
+var g829 = 9;
+var g830 = 0;
+var g831 = 1;
+var g832 = 2;
+var g833 = 3;
+var g834 = 4;
+var g835 = 5;
+var g836 = 6;
+var g837 = 7;
+var g838 = 8;
+var g839 = 9;
+var g840 = 0;
+var g841 = 1;
+var g842 = 2;
+var g843 = 3;
+var g844 = 4;
+var g845 = 5;
+var g846 = 6;
+var g847 = 7;
+var g848 = 8;
+var g849 = 9;
+var g850 = 0;
+var g851 = 1;
+var g852 = 2;
+var g853 = 3;
+var g854 = 4;
+var g855 = 5;
+var g856 = 6;
+var g857 = 7;
+var g858 = 8;
+var g859 = 9;
+var g860 = 0;
+var g861 = 1;
+var g862 = 2;
+var g863 = 3;
+var g864 = 4;
+var g865 = 5;
+var g866 = 6;
+var g867 = 7;
+var g868 = 8;
+var g869 = 9;
+var g870 = 0;
+var g871 = 1;
+var g872 = 2;
+var g873 = 3;
+var g874 = 4;
+var g875 = 5;
+var g876 = 6;
+var g877 = 7;
+var g878 = 8;
+var g879 = 9;
+var g880 = 0;
+var g881 = 1;
+var g882 = 2;
+var g883 = 3;
+var g884 = 4;
+var g885 = 5;
+var g886 = 6;
+var g887 = 7;
+var g888 = 8;
+var g889 = 9;
+var g890 = 0;
+var g891 = 1;
+var g892 = 2;
+var g893 = 3;
+var g894 = 4;
+var g895 = 5;
+var g896 = 6;
+var g897 = 7;
+var g898 = 8;
+var g899 = 9;
+var g900 = 0;
+var g901 = 1;
+var g902 = 2;
+var g903 = 3;
+var g904 = 4;
+var g905 = 5;
+var g906 = 6;
+var g907 = 7;
+var g908 = 8;
+var g909 = 9;
+var g910 = 0;
+var g911 = 1;
+var g912 = 2;
+var g913 = 3;
+var g914 = 4;
+var g915 = 5;
+var g916 = 6;
+var g917 = 7;
+var g918 = 8;
+var g919 = 9;
+var g920 = 0;
+var g921 = 1;
+var g922 = 2;
+var g923 = 3;
+var g924 = 4;
+var g925 = 5;
+var g926 = 6;
+var g927 = 7;
+var g928 = 8;
+var g929 = 9;
+var g930 = 0;
+var g931 = 1;
+var g932 = 2;
+var g933 = 3;
+var g934 = 4;
+var g935 = 5;
+var g936 = 6;
+var g937 = 7;
+var g938 = 8;
+var g939 = 9;
+var g940 = 0;
+var g941 = 1;
+var g942 = 2;
+var g943 = 3;
+var g944 = 4;
+var g945 = 5;
+var g946 = 6;
+var g947 = 7;
+var g948 = 8;
+var g949 = 9;
+var g950 = 0;
+var g951 = 1;
+var g952 = 2;
+var g953 = 3;
+var g954 = 4;
+var g955 = 5;
+var g956 = 6;
+var g957 = 7;
+var g958 = 8;
+var g959 = 9;
+var g960 = 0;
+var g961 = 1;
+var g962 = 2;
+var g963 = 3;
+var g964 = 4;
+var g965 = 5;
+var g966 = 6;
+var g967 = 7;
+var g968 = 8;
+var g969 = 9;
+var g970 = 0;
+var g971 = 1;
+var g972 = 2;
+var g973 = 3;
+var g974 = 4;
+var g975 = 5;
+var g976 = 6;
+var g977 = 7;
+var g978 = 8;
+var g979 = 9;
+var g980 = 0;
+var g981 = 1;
+var g982 = 2;
+var g983 = 3;
+var g984 = 4;
+var g985 = 5;
+var g986 = 6;
+var g987 = 7;
+var g988 = 8;
+var g989 = 9;
+var g990 = 0;
+var g991 = 1;
+var g992 = 2;
+var g993 = 3;
+var g994 = 4;
+var g995 = 5;
+var g996 = 6;
+var g997 = 7;
+var g998 = 8;
+var g999 = 9;
+var g1000 = 0;
+var g1001 = 1;
+var g1002 = 2;
+var g1003 = 3;
+var g1004 = 4;
+var g1005 = 5;
+var g1006 = 6;
+var g1007 = 7;
+var g1008 = 8;
+var g1009 = 9;
+var g1010 = 0;
+var g1011 = 1;
+var g1012 = 2;
+var g1013 = 3;
+var g1014 = 4;
+var g1015 = 5;
+var g1016 = 6;
+var g1017 = 7;
+var g1018 = 8;
+var g1019 = 9;
+var g1020 = 0;
+var g1021 = 1;
+var g1022 = 2;
+var g1023 = 3;
+var g1024 = 4;
+var g1025 = 5;
+var g1026 = 6;
+var g1027 = 7;
+var g1028 = 8;
+var g1029 = 9;
+var g1030 = 0;
+var g1031 = 1;
+var g1032 = 2;
+var g1033 = 3;
+var g1034 = 4;
+var g1035 = 5;
+var g1036 = 6;
+var g1037 = 7;
+var g1038 = 8;
+var g1039 = 9;
+var g1040 = 0;
+var g1041 = 1;
+var g1042 = 2;
+var g1043 = 3;
+var g1044 = 4;
+var g1045 = 5;
+var g1046 = 6;
+var g1047 = 7;
+var g1048 = 8;
+var g1049 = 9;
+var g1050 = 0;
+var g1051 = 1;
+var g1052 = 2;
+var g1053 = 3;
+var g1054 = 4;
+var g1055 = 5;
+var g1056 = 6;
+var g1057 = 7;
+var g1058 = 8;
+var g1059 = 9;
+var g1060 = 0;
+var g1061 = 1;
+var g1062 = 2;
+var g1063 = 3;
+var g1064 = 4;
+var g1065 = 5;
+var g1066 = 6;
+var g1067 = 7;
+var g1068 = 8;
+var g1069 = 9;
+var g1070 = 0;
+var g1071 = 1;
+var g1072 = 2;
+var g1073 = 3;
+var g1074 = 4;
+var g1075 = 5;
+var g1076 = 6;
+var g1077 = 7;
+var g1078 = 8;
+var g1079 = 9;
+var g1080 = 0;
+var g1081 = 1;
+var g1082 = 2;
+var g1083 = 3;
+var g1084 = 4;
+var g1085 = 5;
+var g1086 = 6;
+var g1087 = 7;
+var g1088 = 8;
+var g1089 = 9;
+var g1090 = 0;
+var g1091 = 1;
+var g1092 = 2;
+var g1093 = 3;
+var g1094 = 4;
+var g1095 = 5;
+var g1096 = 6;
+var g1097 = 7;
+var g1098 = 8;
+var g1099 = 9;
+var g1100 = 0;
+var g1101 = 1;
+var g1102 = 2;
+var g1103 = 3;
+var g1104 = 4;
+var g1105 = 5;
+var g1106 = 6;
+var g1107 = 7;
+var g1108 = 8;
+var g1109 = 9;
+var g1110 = 0;
+var g1111 = 1;
+var g1112 = 2;
+var g1113 = 3;
+var g1114 = 4;
+var g1115 = 5;
+var g1116 = 6;
+var g1117 = 7;
+var g1118 = 8;
+var g1119 = 9;
+var g1120 = 0;
+var g1121 = 1;
+var g1122 = 2;
+var g1123 = 3;
+var g1124 = 4;
+var g1125 = 5;
+var g1126 = 6;
+var g1127 = 7;
+var g1128 = 8;
+var g1129 = 9;
+var g1130 = 0;
+var g1131 = 1;
+var g1132 = 2;
+var g1133 = 3;
+var g1134 = 4;
+var g1135 = 5;
+var g1136 = 6;
+var g1137 = 7;
+var g1138 = 8;
+var g1139 = 9;
+var g1140 = 0;
+var g1141 = 1;
+var g1142 = 2;
+var g1143 = 3;
+var g1144 = 4;
+var g1145 = 5;
+var g1146 = 6;
+var g1147 = 7;
+var g1148 = 8;
+var g1149 = 9;
+var g1150 = 0;
+var g1151 = 1;
+var g1152 = 2;
+var g1153 = 3;
+var g1154 = 4;
+var g1155 = 5;
+var g1156 = 6;
+var g1157 = 7;
+var g1158 = 8;
+var g1159 = 9;
+var g1160 = 0;
+var g1161 = 1;
+var g1162 = 2;
+var g1163 = 3;
+var g1164 = 4;
+var g1165 = 5;
+var g1166 = 6;
+var g1167 = 7;
+var g1168 = 8;
+var g1169 = 9;
+var g1170 = 0;
+var g1171 = 1;
+var g1172 = 2;
+var g1173 = 3;
+var g1174 = 4;
+var g1175 = 5;
+var g1176 = 6;
+var g1177 = 7;
+var g1178 = 8;
+var g1179 = 9;
+var g1180 = 0;
+var g1181 = 1;
+var g1182 = 2;
+var g1183 = 3;
+var g1184 = 4;
+var g1185 = 5;
+var g1186 = 6;
+var g1187 = 7;
+var g1188 = 8;
+var g1189 = 9;
+var g1190 = 0;
+var g1191 = 1;
+var g1192 = 2;
+var g1193 = 3;
+var g1194 = 4;
+var g1195 = 5;
+var g1196 = 6;
+var g1197 = 7;
+var g1198 = 8;
+var g1199 = 9;
+var g1200 = 0;
+var g1201 = 1;
+var g1202 = 2;
+var g1203 = 3;
+var g1204 = 4;
+var g1205 = 5;
+var g1206 = 6;
+var g1207 = 7;
+var g1208 = 8;
+var g1209 = 9;
+var g1210 = 0;
+var g1211 = 1;
+var g1212 = 2;
+var g1213 = 3;
+var g1214 = 4;
+var g1215 = 5;
+var g1216 = 6;
+var g1217 = 7;
+var g1218 = 8;
+var g1219 = 9;
+var g1220 = 0;
+var g1221 = 1;
+var g1222 = 2;
+var g1223 = 3;
+var g1224 = 4;
+var g1225 = 5;
+var g1226 = 6;
+var g1227 = 7;
+var g1228 = 8;
+var g1229 = 9;
+var g1230 = 0;
+var g1231 = 1;
+var g1232 = 2;
+var g1233 = 3;
+var g1234 = 4;
+var g1235 = 5;
+var g1236 = 6;
+var g1237 = 7;
+var g1238 = 8;
+var g1239 = 9;
+var g1240 = 0;
+var g1241 = 1;
+var g1242 = 2;
+var g1243 = 3;
+var g1244 = 4;
+var g1245 = 5;
+var g1246 = 6;
+var g1247 = 7;
+var g1248 = 8;
+var g1249 = 9;
+var g1250 = 0;
+var g1251 = 1;
+var g1252 = 2;
+var g1253 = 3;
+var g1254 = 4;
+var g1255 = 5;
+var g1256 = 6;
+var g1257 = 7;
+var g1258 = 8;
+var g1259 = 9;
+var g1260 = 0;
+var g1261 = 1;
+var g1262 = 2;
+var g1263 = 3;
+var g1264 = 4;
+var g1265 = 5;
+var g1266 = 6;
+var g1267 = 7;
+var g1268 = 8;
+var g1269 = 9;
+var g1270 = 0;
+var g1271 = 1;
+var g1272 = 2;
+var g1273 = 3;
+var g1274 = 4;
+var g1275 = 5;
+var g1276 = 6;
+var g1277 = 7;
+var g1278 = 8;
+var g1279 = 9;
+var g1280 = 0;
+var g1281 = 1;
+var g1282 = 2;
+var g1283 = 3;
+var g1284 = 4;
+var g1285 = 5;
+var g1286 = 6;
+var g1287 = 7;
+var g1288 = 8;
+var g1289 = 9;
+var g1290 = 0;
+var g1291 = 1;
+var g1292 = 2;
+var g1293 = 3;
+var g1294 = 4;
+var g1295 = 5;
+var g1296 = 6;
+var g1297 = 7;
+var g1298 = 8;
+var g1299 = 9;
+var g1300 = 0;
+var g1301 = 1;
+var g1302 = 2;
+var g1303 = 3;
+var g1304 = 4;
+var g1305 = 5;
+var g1306 = 6;
+var g1307 = 7;
+var g1308 = 8;
+var g1309 = 9;
+var g1310 = 0;
+var g1311 = 1;
+var g1312 = 2;
+var g1313 = 3;
+var g1314 = 4;
+var g1315 = 5;
+var g1316 = 6;
+var g1317 = 7;
+var g1318 = 8;
+var g1319 = 9;
+var g1320 = 0;
+var g1321 = 1;
+var g1322 = 2;
+var g1323 = 3;
+var g1324 = 4;
+var g1325 = 5;
+var g1326 = 6;
+var g1327 = 7;
+var g1328 = 8;
+var g1329 = 9;
+var g1330 = 0;
+var g1331 = 1;
+var g1332 = 2;
+var g1333 = 3;
+var g1334 = 4;
+var g1335 = 5;
+var g1336 = 6;
+var g1337 = 7;
+var g1338 = 8;
+var g1339 = 9;
+var g1340 = 0;
+var g1341 = 1;
+var g1342 = 2;
+var g1343 = 3;
+var g1344 = 4;
+var g1345 = 5;
+var g1346 = 6;
+var g1347 = 7;
+var g1348 = 8;
+var g1349 = 9;
+var g1350 = 0;
+var g1351 = 1;
+var g1352 = 2;
+var g1353 = 3;
+var g1354 = 4;
+var g1355 = 5;
+var g1356 = 6;
+var g1357 = 7;
+var g1358 = 8;
+var g1359 = 9;
+var g1360 = 0;
+var g1361 = 1;
+var g1362 = 2;
+var g1363 = 3;
+var g1364 = 4;
+var g1365 = 5;
+var g1366 = 6;
+var g1367 = 7;
+var g1368 = 8;
+var g1369 = 9;
+var g1370 = 0;
+var g1371 = 1;
+var g1372 = 2;
+var g1373 = 3;
+var g1374 = 4;
+var g1375 = 5;
+var g1376 = 6;
+var g1377 = 7;
+var g1378 = 8;
+var g1379 = 9;
+var g1380 = 0;
+var g1381 = 1;
+var g1382 = 2;
+var g1383 = 3;
+var g1384 = 4;
+var g1385 = 5;
+var g1386 = 6;
+var g1387 = 7;
+var g1388 = 8;
+var g1389 = 9;
+var g1390 = 0;
+var g1391 = 1;
+var g1392 = 2;
+var g1393 = 3;
+var g1394 = 4;
+var g1395 = 5;
+var g1396 = 6;
+var g1397 = 7;
+var g1398 = 8;
+var g1399 = 9;
+var g1400 = 0;
+var g1401 = 1;
+var g1402 = 2;
+var g1403 = 3;
+var g1404 = 4;
+var g1405 = 5;
+var g1406 = 6;
+var g1407 = 7;
+var g1408 = 8;
+var g1409 = 9;
+var g1410 = 0;
+var g1411 = 1;
+var g1412 = 2;
+var g1413 = 3;
+var g1414 = 4;
+var g1415 = 5;
+var g1416 = 6;
+var g1417 = 7;
+var g1418 = 8;
+var g1419 = 9;
+var g1420 = 0;
+var g1421 = 1;
+var g1422 = 2;
+var g1423 = 3;
+var g1424 = 4;
+var g1425 = 5;
+var g1426 = 6;
+var g1427 = 7;
+var g1428 = 8;
+var g1429 = 9;
+var g1430 = 0;
+var g1431 = 1;
+var g1432 = 2;
+var g1433 = 3;
+var g1434 = 4;
+var g1435 = 5;
+var g1436 = 6;
+var g1437 = 7;
+var g1438 = 8;
+var g1439 = 9;
+var g1440 = 0;
+var g1441 = 1;
+var g1442 = 2;
+var g1443 = 3;
+var g1444 = 4;
+var g1445 = 5;
+var g1446 = 6;
+var g1447 = 7;
+var g1448 = 8;
+var g1449 = 9;
+var g1450 = 0;
+var g1451 = 1;
+var g1452 = 2;
+var g1453 = 3;
+var g1454 = 4;
+var g1455 = 5;
+var g1456 = 6;
+var g1457 = 7;
+var g1458 = 8;
+var g1459 = 9;
+var g1460 = 0;
+var g1461 = 1;
+var g1462 = 2;
+var g1463 = 3;
+var g1464 = 4;
+var g1465 = 5;
+var g1466 = 6;
+var g1467 = 7;
+var g1468 = 8;
+var g1469 = 9;
+var g1470 = 0;
+var g1471 = 1;
+var g1472 = 2;
+var g1473 = 3;
+var g1474 = 4;
+var g1475 = 5;
+var g1476 = 6;
+var g1477 = 7;
+var g1478 = 8;
+var g1479 = 9;
+var g1480 = 0;
+var g1481 = 1;
+var g1482 = 2;
+var g1483 = 3;
+var g1484 = 4;
+var g1485 = 5;
+var g1486 = 6;
+var g1487 = 7;
+var g1488 = 8;
+var g1489 = 9;
+var g1490 = 0;
+var g1491 = 1;
+var g1492 = 2;
+var g1493 = 3;
+var g1494 = 4;
+var g1495 = 5;
+var g1496 = 6;
+var g1497 = 7;
+var g1498 = 8;
+var g1499 = 9;
+var g1500 = 0;
+var g1501 = 1;
+var g1502 = 2;
+var g1503 = 3;
+var g1504 = 4;
+var g1505 = 5;
+var g1506 = 6;
+var g1507 = 7;
+var g1508 = 8;
+var g1509 = 9;
+var g1510 = 0;
+var g1511 = 1;
+var g1512 = 2;
+var g1513 = 3;
+var g1514 = 4;
+var g1515 = 5;
+var g1516 = 6;
+var g1517 = 7;
+var g1518 = 8;
+var g1519 = 9;
+var g1520 = 0;
+var g1521 = 1;
+var g1522 = 2;
+var g1523 = 3;
+var g1524 = 4;
+var g1525 = 5;
+var g1526 = 6;
+var g1527 = 7;
+var g1528 = 8;
+var g1529 = 9;
+var g1530 = 0;
+var g1531 = 1;
+var g1532 = 2;
+var g1533 = 3;
+var g1534 = 4;
+var g1535 = 5;
+var g1536 = 6;
+var g1537 = 7;
+var g1538 = 8;
+var g1539 = 9;
+var g1540 = 0;
+var g1541 = 1;
+var g1542 = 2;
+var g1543 = 3;
+var g1544 = 4;
+var g1545 = 5;
+var g1546 = 6;
+var g1547 = 7;
+var g1548 = 8;
+var g1549 = 9;
+var g1550 = 0;
+var g1551 = 1;
+var g1552 = 2;
+var g1553 = 3;
+var g1554 = 4;
+var g1555 = 5;
+var g1556 = 6;
+var g1557 = 7;
+var g1558 = 8;
+var g1559 = 9;
+var g1560 = 0;
+var g1561 = 1;
+var g1562 = 2;
+var g1563 = 3;
+var g1564 = 4;
+var g1565 = 5;
+var g1566 = 6;
+var g1567 = 7;
+var g1568 = 8;
+var g1569 = 9;
+var g1570 = 0;
+var g1571 = 1;
+var g1572 = 2;
+var g1573 = 3;
+var g1574 = 4;
+var g1575 = 5;
+var g1576 = 6;
+var g1577 = 7;
+var g1578 = 8;
+var g1579 = 9;
+var g1580 = 0;
+var g1581 = 1;
+var g1582 = 2;
+var g1583 = 3;
+var g1584 = 4;
+var g1585 = 5;
+var g1586 = 6;
+var g1587 = 7;
+var g1588 = 8;
+var g1589 = 9;
+var g1590 = 0;
+var g1591 = 1;
+var g1592 = 2;
+var g1593 = 3;
+var g1594 = 4;
+var g1595 = 5;
+var g1596 = 6;
+var g1597 = 7;
+var g1598 = 8;
+var g1599 = 9;
+var g1600 = 0;
+var g1601 = 1;
+var g1602 = 2;
+var g1603 = 3;
+var g1604 = 4;
+var g1605 = 5;
+var g1606 = 6;
+var g1607 = 7;
+var g1608 = 8;
+var g1609 = 9;
+var g1610 = 0;
+var g1611 = 1;
+var g1612 = 2;
+var g1613 = 3;
+var g1614 = 4;
+var g1615 = 5;
+var g1616 = 6;
+var g1617 = 7;
+var g1618 = 8;
+var g1619 = 9;
+var g1620 = 0;
+var g1621 = 1;
+var g1622 = 2;
+var g1623 = 3;
+var g1624 = 4;
+var g1625 = 5;
+var g1626 = 6;
+var g1627 = 7;
+var g1628 = 8;
+var g1629 = 9;
+var g1630 = 0;
+var g1631 = 1;
+var g1632 = 2;
+var g1633 = 3;
+var g1634 = 4;
+var g1635 = 5;
+var g1636 = 6;
+var g1637 = 7;
+var g1638 = 8;
+var g1639 = 9;
+var g1640 = 0;
+var g1641 = 1;
+var g1642 = 2;
+var g1643 = 3;
+var g1644 = 4;
+var g1645 = 5;
+var g1646 = 6;
+var g1647 = 7;
+var g1648 = 8;
+var g1649 = 9;
+var g1650 = 0;
+var g1651 = 1;
+var g1652 = 2;
+var g1653 = 3;
+var g1654 = 4;
+var g1655 = 5;
+var g1656 = 6;
+var g1657 = 7;
+var g1658 = 8;
+var g1659 = 9;
+var g1660 = 0;
+var g1661 = 1;
+var g1662 = 2;
+var g1663 = 3;
+var g1664 = 4;
+var g1665 = 5;
+var g1666 = 6;
+var g1667 = 7;
+var g1668 = 8;
+var g1669 = 9;
+var g1670 = 0;
+var g1671 = 1;
+var g1672 = 2;
+var g1673 = 3;
+var g1674 = 4;
+var g1675 = 5;
+var g1676 = 6;
+var g1677 = 7;
+var g1678 = 8;
+var g1679 = 9;
+var g1680 = 0;
+var g1681 = 1;
+var g1682 = 2;
+var g1683 = 3;
+var g1684 = 4;
+var g1685 = 5;
+var g1686 = 6;
+var g1687 = 7;
+var g1688 = 8;
+var g1689 = 9;
+var g1690 = 0;
+var g1691 = 1;
+var g1692 = 2;
+var g1693 = 3;
+var g1694 = 4;
+var g1695 = 5;
+var g1696 = 6;
+var g1697 = 7;
+var g1698 = 8;
+var g1699 = 9;
+var g1700 = 0;
+var g1701 = 1;
+var g1702 = 2;
+var g1703 = 3;
+var g1704 = 4;
+var g1705 = 5;
+var g1706 = 6;
+var g1707 = 7;
+var g1708 = 8;
+var g1709 = 9;
+var g1710 = 0;
+var g1711 = 1;
+var g1712 = 2;
+var g1713 = 3;
+var g1714 = 4;
+var g1715 = 5;
+var g1716 = 6;
+var g1717 = 7;
+var g1718 = 8;
+var g1719 = 9;
+var g1720 = 0;
+var g1721 = 1;
+var g1722 = 2;
+var g1723 = 3;
+var g1724 = 4;
+var g1725 = 5;
+var g1726 = 6;
+var g1727 = 7;
+var g1728 = 8;
+var g1729 = 9;
+var g1730 = 0;
+var g1731 = 1;
+var g1732 = 2;
+var g1733 = 3;
+var g1734 = 4;
+var g1735 = 5;
+var g1736 = 6;
+var g1737 = 7;
+var g1738 = 8;
+var g1739 = 9;
+var g1740 = 0;
+var g1741 = 1;
+var g1742 = 2;
+var g1743 = 3;
+var g1744 = 4;
+var g1745 = 5;
+var g1746 = 6;
+var g1747 = 7;
+var g1748 = 8;
+var g1749 = 9;
+var g1750 = 0;
+var g1751 = 1;
+var g1752 = 2;
+var g1753 = 3;
+var g1754 = 4;
+var g1755 = 5;
+var g1756 = 6;
+var g1757 = 7;
+var g1758 = 8;
+var g1759 = 9;
+var g1760 = 0;
+var g1761 = 1;
+var g1762 = 2;
+var g1763 = 3;
+var g1764 = 4;
+var g1765 = 5;
+var g1766 = 6;
+var g1767 = 7;
+var g1768 = 8;
+var g1769 = 9;
+var g1770 = 0;
+var g1771 = 1;
+var g1772 = 2;
+var g1773 = 3;
+var g1774 = 4;
+var g1775 = 5;
+var g1776 = 6;
+var g1777 = 7;
+var g1778 = 8;
+var g1779 = 9;
+var g1780 = 0;
+var g1781 = 1;
+var g1782 = 2;
+var g1783 = 3;
+var g1784 = 4;
+var g1785 = 5;
+var g1786 = 6;
+var g1787 = 7;
+var g1788 = 8;
+var g1789 = 9;
+var g1790 = 0;
+var g1791 = 1;
+var g1792 = 2;
+var g1793 = 3;
+var g1794 = 4;
+var g1795 = 5;
+var g1796 = 6;
+var g1797 = 7;
+var g1798 = 8;
+var g1799 = 9;
+var g1800 = 0;
+var g1801 = 1;
+var g1802 = 2;
+var g1803 = 3;
+var g1804 = 4;
+var g1805 = 5;
+var g1806 = 6;
+var g1807 = 7;
+var g1808 = 8;
+var g1809 = 9;
+var g1810 = 0;
+var g1811 = 1;
+var g1812 = 2;
+var g1813 = 3;
+var g1814 = 4;
+var g1815 = 5;
+var g1816 = 6;
+var g1817 = 7;
+var g1818 = 8;
+var g1819 = 9;
+var g1820 = 0;
+var g1821 = 1;
+var g1822 = 2;
+var g1823 = 3;
+var g1824 = 4;
+var g1825 = 5;
+var g1826 = 6;
+var g1827 = 7;
+var g1828 = 8;
+var g1829 = 9;
+var g1830 = 0;
+var g1831 = 1;
+var g1832 = 2;
+var g1833 = 3;
+var g1834 = 4;
+var g1835 = 5;
+var g1836 = 6;
+var g1837 = 7;
+var g1838 = 8;
+var g1839 = 9;
+var g1840 = 0;
+var g1841 = 1;
+var g1842 = 2;
+var g1843 = 3;
+var g1844 = 4;
+var g1845 = 5;
+var g1846 = 6;
+var g1847 = 7;
+var g1848 = 8;
+var g1849 = 9;
+var g1850 = 0;
+var g1851 = 1;
+var g1852 = 2;
+var g1853 = 3;
+var g1854 = 4;
+var g1855 = 5;
+var g1856 = 6;
+var g1857 = 7;
+var g1858 = 8;
+var g1859 = 9;
+var g1860 = 0;
+var g1861 = 1;
+var g1862 = 2;
+var g1863 = 3;
+var g1864 = 4;
+var g1865 = 5;
+var g1866 = 6;
+var g1867 = 7;
+var g1868 = 8;
+var g1869 = 9;
+var g1870 = 0;
+var g1871 = 1;
+var g1872 = 2;
+var g1873 = 3;
+var g1874 = 4;
+var g1875 = 5;
+var g1876 = 6;
+var g1877 = 7;
+var g1878 = 8;
+var g1879 = 9;
+var g1880 = 0;
+var g1881 = 1;
+var g1882 = 2;
+var g1883 = 3;
+var g1884 = 4;
+var g1885 = 5;
+var g1886 = 6;
+var g1887 = 7;
+var g1888 = 8;
+var g1889 = 9;
+var g1890 = 0;
+var g1891 = 1;
+var g1892 = 2;
+var g1893 = 3;
+var g1894 = 4;
+var g1895 = 5;
+var g1896 = 6;
+var g1897 = 7;
+var g1898 = 8;
+var g1899 = 9;
+var g1900 = 0;
+var g1901 = 1;
+var g1902 = 2;
+var g1903 = 3;
+var g1904 = 4;
+var g1905 = 5;
+var g1906 = 6;
+var g1907 = 7;
+var g1908 = 8;
+var g1909 = 9;
+var g1910 = 0;
+var g1911 = 1;
+var g1912 = 2;
+var g1913 = 3;
+var g1914 = 4;
+var g1915 = 5;
+var g1916 = 6;
+var g1917 = 7;
+var g1918 = 8;
+var g1919 = 9;
+var g1920 = 0;
+var g1921 = 1;
+var g1922 = 2;
+var g1923 = 3;
+var g1924 = 4;
+var g1925 = 5;
+var g1926 = 6;
+var g1927 = 7;
+var g1928 = 8;
+var g1929 = 9;
+var g1930 = 0;
+var g1931 = 1;
+var g1932 = 2;
+var g1933 = 3;
+var g1934 = 4;
+var g1935 = 5;
+var g1936 = 6;
+var g1937 = 7;
+var g1938 = 8;
+var g1939 = 9;
+var g1940 = 0;
+var g1941 = 1;
+var g1942 = 2;
+var g1943 = 3;
+var g1944 = 4;
+var g1945 = 5;
+var g1946 = 6;
+var g1947 = 7;
+var g1948 = 8;
+var g1949 = 9;
+var g1950 = 0;
+var g1951 = 1;
+var g1952 = 2;
+var g1953 = 3;
+var g1954 = 4;
+var g1955 = 5;
+var g1956 = 6;
+var g1957 = 7;
+var g1958 = 8;
+var g1959 = 9;
+var g1960 = 0;
+var g1961 = 1;
+var g1962 = 2;
+var g1963 = 3;
+var g1964 = 4;
+var g1965 = 5;
+var g1966 = 6;
+var g1967 = 7;
+var g1968 = 8;
+var g1969 = 9;
+var g1970 = 0;
+var g1971 = 1;
+var g1972 = 2;
+var g1973 = 3;
+var g1974 = 4;
+var g1975 = 5;
+var g1976 = 6;
+var g1977 = 7;
+var g1978 = 8;
+var g1979 = 9;
+var g1980 = 0;
+var g1981 = 1;
+var g1982 = 2;
+var g1983 = 3;
+var g1984 = 4;
+var g1985 = 5;
+var g1986 = 6;
+var g1987 = 7;
+var g1988 = 8;
+var g1989 = 9;
+var g1990 = 0;
+var g1991 = 1;
+var g1992 = 2;
+var g1993 = 3;
+var g1994 = 4;
+var g1995 = 5;
+var g1996 = 6;
+var g1997 = 7;
+var g1998 = 8;
+var g1999 = 9;
+
+func float spread(x)
+[
+	ret g1999 * x + g1000;
+]
+
+func Main()
+[
+	var i = 0;
+	var total = 0;
+	while (i < 20000)
+	[
+		g1999 = g1999 + g1;
+		total = total + spread(g1997) / 1000;
+		i++;
+	]
+	prnt(total);
+	prnt(g1999);
+]
@@ -0,0 +1,27 @@
+func Main()
+[
+	var i = 1;
+	var sum = 0;
+	var divisors = 0;
+	var steps = 0;
+	while (i <= 20000)
+	[
+		sum = sum + mod(i * 7 | 13) - mod(i | 5);
+		var common = gcd(i | 360);
+		if (common == 1)
+		[
+			divisors++;
+		]
+		var j = mod(i | 17);
+		while (j > 0)
+		[
+			steps = steps + j;
+			j--;
+		]
+		i++;
+	]
+	prnt(sum);
+	prnt(divisors);
+	prnt(steps);
+	prnt(fib(40) + gcd(1071 | 462));
+]
@@ -0,0 +1,23 @@
+var scale = 2.5;
+
+func Main()
+[
+	var a = 3;
+	var b = 4;
+	var k = 2;
+	var i = 0;
+	var total = 0;
+	while (i < 50000)
+	[
+		var r = sqrt(a * a + b * b);
+		total = total + r * pow(M_E | k) + i * scale / 10;
+		i++;
+	]
+	prnt(total);
+
+	frl (var j = 0 | j < 100 * k | j++)
+	[
+		total = total - sin(a * 30) * cos(b * 15);
+	]
+	prnt(total);
+]
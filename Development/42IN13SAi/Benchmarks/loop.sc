@@ -0,0 +1,15 @@
+func Main()
+[
+	var i = 0;
+	var sum = 0;
+	while (i < 200000)
+	[
+		sum = sum + 3;
+		if (sum > 1000)
+		[
+			sum -= 1000;
+		]
+		i++;
+	]
+	prnt(sum);
+]
@@ -0,0 +1,26005 @@
+var g = 1;
+func float f0(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f1(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f2(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f3(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f4(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f5(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f6(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f7(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f8(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f9(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f10(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f11(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f12(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f13(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f14(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f15(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f16(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f17(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f18(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f19(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f20(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f21(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f22(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f23(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f24(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f25(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f26(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f27(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f28(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f29(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f30(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f31(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f32(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f33(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f34(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f35(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f36(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f37(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f38(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f39(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f40(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f41(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f42(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f43(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f44(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f45(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f46(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f47(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f48(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f49(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f50(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f51(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f52(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f53(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f54(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f55(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f56(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f57(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f58(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f59(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f60(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f61(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f62(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f63(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f64(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f65(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f66(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f67(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f68(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f69(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f70(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f71(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f72(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f73(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f74(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f75(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f76(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f77(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f78(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f79(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f80(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f81(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f82(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f83(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f84(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f85(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f86(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f87(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f88(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f89(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f90(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f91(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f92(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f93(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f94(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f95(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f96(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f97(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f98(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f99(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f100(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f101(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f102(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f103(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f104(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f105(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f106(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f107(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f108(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f109(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f110(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f111(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f112(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f113(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f114(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f115(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f116(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f117(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f118(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f119(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f120(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f121(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f122(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f123(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f124(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f125(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f126(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f127(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f128(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f129(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f130(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f131(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f132(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f133(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f134(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f135(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f136(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f137(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f138(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f139(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f140(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f141(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f142(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f143(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f144(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f145(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f146(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f147(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f148(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f149(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f150(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f151(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f152(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f153(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f154(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f155(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f156(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f157(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f158(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f159(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f160(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f161(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f162(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f163(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f164(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f165(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f166(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f167(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f168(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f169(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f170(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f171(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f172(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f173(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f174(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f175(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f176(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f177(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f178(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f179(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f180(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f181(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f182(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f183(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f184(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f185(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f186(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f187(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f188(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f189(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f190(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f191(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f192(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f193(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f194(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f195(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f196(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f197(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f198(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f199(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f200(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f201(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f202(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f203(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f204(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f205(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f206(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f207(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f208(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f209(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f210(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f211(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f212(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f213(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f214(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f215(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f216(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f217(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f218(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f219(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f220(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f221(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f222(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f223(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f224(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f225(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f226(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f227(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f228(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f229(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f230(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f231(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f232(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f233(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f234(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f235(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f236(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f237(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f238(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f239(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f240(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f241(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f242(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f243(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f244(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f245(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f246(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f247(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f248(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f249(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f250(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f251(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f252(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f253(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f254(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f255(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f256(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f257(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f258(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f259(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f260(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f261(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f262(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f263(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f264(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f265(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f266(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f267(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f268(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f269(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f270(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f271(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f272(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f273(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f274(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f275(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f276(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f277(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f278(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f279(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f280(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f281(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f282(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f283(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f284(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f285(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f286(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f287(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f288(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f289(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f290(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f291(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f292(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f293(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f294(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f295(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f296(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f297(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f298(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f299(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f300(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f301(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f302(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f303(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f304(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f305(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f306(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f307(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f308(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f309(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f310(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f311(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f312(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f313(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f314(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f315(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f316(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f317(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f318(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f319(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f320(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f321(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f322(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f323(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f324(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f325(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f326(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f327(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f328(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f329(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f330(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f331(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f332(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f333(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f334(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f335(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f336(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f337(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f338(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f339(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f340(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f341(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f342(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f343(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f344(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f345(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f346(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f347(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f348(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f349(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f350(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f351(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f352(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f353(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f354(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f355(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f356(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f357(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f358(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f359(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f360(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f361(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f362(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f363(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f364(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f365(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f366(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f367(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f368(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f369(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f370(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f371(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f372(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f373(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f374(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f375(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f376(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f377(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f378(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f379(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f380(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f381(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f382(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f383(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f384(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f385(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f386(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f387(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f388(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f389(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f390(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f391(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f392(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f393(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f394(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f395(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f396(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f397(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f398(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func float f399(a)
+[
+	var t = a;
+	t = t + g * 0 - sqr(a);
+	t = t + g * 1 - sqr(a);
+	t = t + g * 2 - sqr(a);
+	t = t + g * 3 - sqr(a);
+	t = t + g * 4 - sqr(a);
+	t = t + g * 5 - sqr(a);
+	t = t + g * 6 - sqr(a);
+	t = t + g * 7 - sqr(a);
+	t = t + g * 8 - sqr(a);
+	t = t + g * 9 - sqr(a);
+	t = t + g * 10 - sqr(a);
+	t = t + g * 11 - sqr(a);
+	t = t + g * 12 - sqr(a);
+	t = t + g * 13 - sqr(a);
+	t = t + g * 14 - sqr(a);
+	t = t + g * 15 - sqr(a);
+	t = t + g * 16 - sqr(a);
+	t = t + g * 17 - sqr(a);
+	t = t + g * 18 - sqr(a);
+	t = t + g * 19 - sqr(a);
+	t = t + g * 20 - sqr(a);
+	t = t + g * 21 - sqr(a);
+	t = t + g * 22 - sqr(a);
+	t = t + g * 23 - sqr(a);
+	t = t + g * 24 - sqr(a);
+	t = t + g * 25 - sqr(a);
+	t = t + g * 26 - sqr(a);
+	t = t + g * 27 - sqr(a);
+	t = t + g * 28 - sqr(a);
+	t = t + g * 29 - sqr(a);
+	t = t + g * 30 - sqr(a);
+	t = t + g * 31 - sqr(a);
+	t = t + g * 32 - sqr(a);
+	t = t + g * 33 - sqr(a);
+	t = t + g * 34 - sqr(a);
+	t = t + g * 35 - sqr(a);
+	t = t + g * 36 - sqr(a);
+	t = t + g * 37 - sqr(a);
+	t = t + g * 38 - sqr(a);
+	t = t + g * 39 - sqr(a);
+	t = t + g * 40 - sqr(a);
+	t = t + g * 41 - sqr(a);
+	t = t + g * 42 - sqr(a);
+	t = t + g * 43 - sqr(a);
+	t = t + g * 44 - sqr(a);
+	t = t + g * 45 - sqr(a);
+	t = t + g * 46 - sqr(a);
+	t = t + g * 47 - sqr(a);
+	t = t + g * 48 - sqr(a);
+	t = t + g * 49 - sqr(a);
+	t = t + g * 50 - sqr(a);
+	t = t + g * 51 - sqr(a);
+	t = t + g * 52 - sqr(a);
+	t = t + g * 53 - sqr(a);
+	t = t + g * 54 - sqr(a);
+	t = t + g * 55 - sqr(a);
+	t = t + g * 56 - sqr(a);
+	t = t + g * 57 - sqr(a);
+	t = t + g * 58 - sqr(a);
+	t = t + g * 59 - sqr(a);
+	ret t;
+]
+func Main()
+[
+	prnt(f1(2));
+]
@@ -0,0 +1,31 @@
+func float steps(n)
+[
+	var count = 0;
+	while (n > 1)
+	[
+		var rest = mod(n | 2);
+		if (rest == 0)
+		[
+			n = n / 2;
+		]
+		if (rest != 0)
+		[
+			n = n * 3 + 1;
+		]
+		count++;
+	]
+	ret count;
+]
+
+func Main()
+[
+	var i = 0;
+	var total = 0;
+	while (i < 20000)
+	[
+		var n = mod(i | 100);
+		total = total + steps(n + 1);
+		i++;
+	]
+	prnt(total);
+]
@@ -0,0 +1,18 @@
+func Main()
+[
+	var i = 1;
+	var wave = 0;
+	var length = 0;
+	var growth = 1;
+	while (i <= 20000)
+	[
+		wave = wave + sin(i) * cos(i / 3);
+		length = length + sqrt(i) / cbrt(i);
+		growth = growth * pow(1.0001 | 0.5);
+		i++;
+	]
+	prnt(wave);
+	prnt(length);
+	prnt(growth);
+	prnt(ln(length) + log10(growth));
+]
@@ -0,0 +1,24 @@
+var ox = 1.5;
+var oy = 2.5;
+
+func Main()
+[
+	var x = 0;
+	var y = 0;
+	var d = 0;
+	var total = 0;
+	var i = 0;
+	while (i < 2000)
+	[
+		x = i / 10;
+		y = x * 2 + oy;
+		d = sqrt(sqr(x - ox) + sqr(y - oy));
+		total = total + d;
+		d = sqrt(sqr(x - ox) + sqr(y - oy)) + sqr(x - ox);
+		total = total + d / 2;
+		d = sqr(x - ox) * sqr(y - oy) + sqrt(sqr(x - ox) + sqr(y - oy));
+		total = total + d / 1000;
+		i++;
+	]
+	prnt(total);
+]
@@ -0,0 +1,24 @@
+var gravity = 9.81;
+var step = 0.001;
+
+func Main()
+[
+	var height = 100;
+	var speed = 0;
+	var time = 0;
+	var bounces = 0;
+	while (bounces < 10)
+	[
+		speed = speed + gravity * step;
+		height = height - speed * step;
+		time = time + step;
+		if (height <= 0)
+		[
+			height = 0;
+			speed = 0 - speed * 0.8;
+			bounces++;
+		]
+	]
+	prnt(time);
+	prnt(speed);
+]
@@ -0,0 +1,20 @@
+func float count(n | total)
+[
+	if (n < 1)
+	[
+		ret total;
+	]
+	ret count(n - 1 | total + mod(n | 7));
+]
+
+func Main()
+[
+	var i = 0;
+	var total = 0;
+	while (i < 20)
+	[
+		total = total + count(2000 | 0);
+		i++;
+	]
+	prnt(total);
+]
@@ -0,0 +1,275 @@
+#define _USE_MATH_DEFINES
+#include "Builtins.h"
+#include <math.h>
+#include "InvalidInputException.h"
+#include "ZeroDivideException.h"
+
+namespace
+{
+	typedef BuiltinMath<long double> Table;
+
+	constexpr bool SameText(const char* a, const char* b)
+	{
+		return *a == *b && (*a == '\0' || SameText(a + 1, b + 1));
+	}
+
+	// No other builtin after index has its name or its token
+	constexpr bool IsUnique(int index, int other)
+	{
+		return other == Table::count || (!SameText(Table::table[index].name, Table::table[other].name)
+			&& Table::table[index].type != Table::table[other].type && IsUnique(index, other + 1));
+	}
+
+	// The expression is the name with a $, a handler takes one to three numbers and
+	// a builtin the VirtualMachine runs itself has its arity written down
+	constexpr bool IsValid(int index)
+	{
+		return index == Table::count || (Table::table[index].expression[0] == '$' && SameText(Table::table[index].expression + 1, Table::table[index].name)
+			&& Table::table[index].arity >= 0 && Table::table[index].arity <= 3 && (!Table::table[index].typed || Table::table[index].pure)
+			&& !(Table::table[index].pure && Table::table[index].statement) && IsUnique(index, index + 1) && IsValid(index + 1));
+	}
+
+	// The tables of both precisions hold the same builtins in the same order
+	constexpr bool IsSameTable(int index)
+	{
+		return index == Table::count || (SameText(Table::table[index].name, BuiltinMath<double>::table[index].name)
+			&& Table::table[index].arity == BuiltinMath<double>::table[index].arity && IsSameTable(index + 1));
+	}
+
+	static_assert(IsValid(0), "every builtin needs its own name and token, the expression $name and a handler of one to three numbers");
+	static_assert(Table::count == BuiltinMath<double>::count && IsSameTable(0), "the builtins differ per precision");
+}
+
+#pragma region ComplexMath
+
+template <typename Value>
+Value BuiltinMath<Value>::Sqr(Value num1)
+{
+	return std::pow(num1, 2);
+}
+
+template <typename Value>
+Value BuiltinMath<Value>::Cbc(Value num1)
+{
+	return std::pow(num1, 3);
+}
+
+template <typename Value>
+Value BuiltinMath<Value>::Pow(Value num1, Value num2)
+{
+	return std::pow(num1, num2);
+}
+
+template <typename Value>
+Value BuiltinMath<Value>::Sqrt(Value num1)
+{
+	if (num1 < 0)
+		throw InvalidInputException("InvalidInputException occured. Can't calculate square root of negative value.");
+
+	return std::sqrt(num1);
+}
+
+template <typename Value>
+Value BuiltinMath<Value>::Cbrt(Value num1)
+{
+	return std::cbrt(num1);
+}
+
+template <typename Value>
+Value BuiltinMath<Value>::Sin(Value num1)
+{
+	return std::sin(num1 * (M_PI / 180));
+}
+
+template <typename Value>
+Value BuiltinMath<Value>::Sinr(Value num1)
+{
+	return std::sin(num1);
+}
+
+template <typename Value>
+Value BuiltinMath<Value>::Cos(Value num1)
+{
+	return std::cos(num1 * (M_PI / 180));
+}
+
+template <typename Value>
+Value BuiltinMath<Value>::Cosr(Value num1)
+{
+	return std::cos(num1);
+}
+
+template <typename Value>
+Value BuiltinMath<Value>::Tan(Value num1)
+{
+	return std::tan(num1 * (M_PI / 180));
+}
+
+template <typename Value>
+Value BuiltinMath<Value>::Tanr(Value num1)
+{
+	return std::tan(num1);
+}
+
+template <typename Value>
+Value BuiltinMath<Value>::Degree(Value num1)
+{
+	return num1 * (180 / M_PI);
+}
+
+template <typename Value>
+Value BuiltinMath<Value>::Radiant(Value num1)
+{
+	return num1 * (M_PI / 180);
+}
+
+template <typename Value>
+Value BuiltinMath<Value>::Percent(Value num1, Value num2)
+{
+	if (num2 == 0)
+		throw ZeroDivideException("Division by 0 exception occured.");
+
+	return (num1 / num2) * 100;
+}
+
+template <typename Value>
+Value BuiltinMath<Value>::Permillage(Value num1, Value num2)
+{
+	if (num2 == 0)
+		throw ZeroDivideException("Division by 0 exception occured.");
+
+	return (num1 / num2) * 1000;
+}
+
+template <typename Value>
+Value BuiltinMath<Value>::CommonLog(Value num1)
+{
+	if (num1 <= 0)
+		throw InvalidInputException("Invalid Input");
+
+	return std::log10(num1);
+}
+
+template <typename Value>
+Value BuiltinMath<Value>::BinaryLog(Value num1)
+{
+	if (num1 <= 0)
+		throw InvalidInputException("Invalid Input");
+
+	return std::log2(num1);
+}
+
+template <typename Value>
+Value BuiltinMath<Value>::NaturalLog(Value num1)
+{
+	if (num1 <= 0)
+		throw InvalidInputException("Invalid Input");
+
+	return std::log(num1);
+}
+
+template <typename Value>
+Value BuiltinMath<Value>::Log(Value num1, Value num2)
+{
+	if (num1 <= 0 || num2 <= 0 || num2 == 1)
+		throw InvalidInputException("Invalid Input");
+
+	return std::log(num1) / std::log(num2);
+}
+
+template <typename Value>
+Value BuiltinMath<Value>::Modulo(Value num1, Value num2)
+{
+	if (num2 == 0)
+		throw ZeroDivideException("Division by 0 exception occured.");
+
+	return std::fmod(num1, num2);
+}
+
+template <typename Value>
+Value BuiltinMath<Value>::Discriminant(Value numA, Value numB, Value numC)
+{
+	return std::pow(numB, 2) - (4 * numA * numC);
+}
+
+template <typename Value>
+Value BuiltinMath<Value>::Pythagorean(Value num, Value numC)
+{
+	if (num <= 0 || numC <= 0)
+		throw InvalidInputException("An InvalidInputException occured. Input for 'pyt' can't be negative.");
+
+	if (num > numC)
+		throw InvalidInputException("An InvalidInputException occured. Input 'c' can't be smaller than 'x'");
+
+	return std::sqrt(std::pow(numC, 2) - std::pow(num, 2));
+}
+
+template <typename Value>
+Value BuiltinMath<Value>::PythagoreanH(Value numA, Value numB)
+{
+	if (numA <= 0 || numB <= 0)
+		throw InvalidInputException("An InvalidInputException occured. Input for 'pyth' can't be negative.");
+
+	return std::sqrt(std::pow(numA, 2) + std::pow(numB, 2));
+}
+
+#pragma endregion ComplexMath
+
+#pragma region Physics
+
+template <typename Value>
+Value BuiltinMath<Value>::Distance(Value num1, Value num2)
+{
+	return num1 * num2;
+}
+
+// velo, time, avgv and accl
+template <typename Value>
+Value BuiltinMath<Value>::Quotient(Value num1, Value num2)
+{
+	if (num2 == 0)
+		throw ZeroDivideException("Division by 0 exception occured.");
+
+	return num1 / num2;
+}
+
+#pragma endregion Physics
+
+template class BuiltinMath<long double>;
+template class BuiltinMath<double>;
+
+int Builtins::Count()
+{
+	return Table::count;
+}
+
+const Builtin& Builtins::Get(int index)
+{
+	return Table::table[index];
+}
+
+const Builtin* Builtins::Find(MyTokenType type)
+{
+	for (const Builtin& builtin : Table::table)
+	{
+		if (builtin.type == type)
+			return &builtin;
+	}
+	return nullptr;
+}
+
+const Builtin* Builtins::Find(const std::string& expression)
+{
+	int index = IndexOf(expression);
+	return index >= 0 ? &Table::table[index] : nullptr;
+}
+
+int Builtins::IndexOf(const std::string& expression)
+{
+	for (int i = 0; i < Table::count; i++)
+	{
+		if (expression == Table::table[i].expression)
+			return i;
+	}
+	return -1;
+}
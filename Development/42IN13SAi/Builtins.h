@@ -0,0 +1,191 @@
+#pragma once
+
+#include <string>
+
+#include "MyTokenType.h"
+
+// What a builtin is for the tokenizer, the parser and the analyses, the same
+// for every precision
+struct Builtin
+{
+	enum Flags
+	{
+		Pure = 1,
+		Statement = 2,
+		CanFail = 4
+	};
+
+	// As it is written, the token is the name followed by (
+	const char* name;
+	MyTokenType type;
+
+	// The expression of its node
+	const char* expression;
+	int arity;
+
+	// No output and it doesn't stop the program, running it twice or not at all changes nothing
+	bool pure;
+
+	// Starts a statement and gives no value, prnt(x); stop(); abc(a|b|c);
+	bool statement;
+
+	// Throws for some numbers, like sqrt of a negative number
+	bool canFail;
+
+	// Computed by a handler of BuiltinMath, the others have an operation of their own in the VirtualMachine
+	bool typed;
+
+	constexpr Builtin(const char* p_name, MyTokenType p_type, const char* p_expression, int p_arity, int flags, bool p_typed)
+		: name(p_name), type(p_type), expression(p_expression), arity(p_arity), pure((flags & Pure) != 0), statement((flags & Statement) != 0), canFail((flags & CanFail) != 0), typed(p_typed)
+	{
+	}
+};
+
+// The handler of a builtin for one precision, its arity is the number of numbers it takes
+template <typename Value>
+struct BuiltinHandler
+{
+	typedef Value(*Unary)(Value);
+	typedef Value(*Binary)(Value, Value);
+	typedef Value(*Ternary)(Value, Value, Value);
+
+	Unary unary;
+	Binary binary;
+	Ternary ternary;
+
+	constexpr BuiltinHandler() : unary(nullptr), binary(nullptr), ternary(nullptr) {}
+	constexpr BuiltinHandler(Unary handler) : unary(handler), binary(nullptr), ternary(nullptr) {}
+	constexpr BuiltinHandler(Binary handler) : unary(nullptr), binary(handler), ternary(nullptr) {}
+	constexpr BuiltinHandler(Ternary handler) : unary(nullptr), binary(nullptr), ternary(handler) {}
+
+	constexpr int GetArity() const
+	{
+		return unary != nullptr ? 1 : (binary != nullptr ? 2 : (ternary != nullptr ? 3 : -1));
+	}
+};
+
+template <typename Value>
+struct BuiltinEntry : Builtin
+{
+	BuiltinHandler<Value> handler;
+
+	// A builtin of BuiltinMath, the arity is the one of the handler
+	constexpr BuiltinEntry(const char* p_name, MyTokenType p_type, const char* p_expression, int flags, BuiltinHandler<Value> p_handler)
+		: Builtin(p_name, p_type, p_expression, p_handler.GetArity(), flags, true), handler(p_handler)
+	{
+	}
+
+	// A builtin the VirtualMachine runs itself
+	constexpr BuiltinEntry(const char* p_name, MyTokenType p_type, const char* p_expression, int flags, int p_arity)
+		: Builtin(p_name, p_type, p_expression, p_arity, flags, false), handler()
+	{
+	}
+};
+
+// Every builtin function of Short-C, one line of the table is all a new one needs:
+//
+//   { "sin", MyTokenType::Sine, "$sin", Builtin::Pure, &Sin }
+//
+//   sin(30)  ->  Sine token  ->  $sin with 1 parameter  ->  Sin(30.0) in the precision of the run
+//
+// The Grammar makes the tokens from the names, the parser reads as many
+// parameters as the handler takes and the VirtualMachine calls the handler
+// with the numbers, it doesn't check the count again. The table is checked
+// when it is compiled, see Builtins.cpp. A handler computes in the Value
+// type of a NumericPolicy, one table per NumericMode, and throws the same
+// exceptions the operations of the VirtualMachine throw.
+template <typename Value>
+class BuiltinMath
+{
+public:
+	static Value Sqr(Value num1);
+	static Value Cbc(Value num1);
+	static Value Pow(Value num1, Value num2);
+	static Value Sqrt(Value num1);
+	static Value Cbrt(Value num1);
+
+	static Value Sin(Value num1);
+	static Value Sinr(Value num1);
+	static Value Cos(Value num1);
+	static Value Cosr(Value num1);
+	static Value Tan(Value num1);
+	static Value Tanr(Value num1);
+
+	static Value Degree(Value num1);
+	static Value Radiant(Value num1);
+	static Value Percent(Value num1, Value num2);
+	static Value Permillage(Value num1, Value num2);
+	static Value CommonLog(Value num1);
+	static Value BinaryLog(Value num1);
+	static Value NaturalLog(Value num1);
+	static Value Log(Value num1, Value num2);
+	static Value Modulo(Value num1, Value num2);
+
+	static Value Discriminant(Value numA, Value numB, Value numC);
+	static Value Pythagorean(Value num, Value numC);
+	static Value PythagoreanH(Value numA, Value numB);
+
+	static Value Distance(Value num1, Value num2);
+	static Value Quotient(Value num1, Value num2);
+
+	static constexpr BuiltinEntry<Value> table[] = {
+		// Default functions
+		{ "prnt", MyTokenType::PrintLine, "$prnt", Builtin::Statement, 1 },
+		{ "stop", MyTokenType::Stop, "$stop", Builtin::Statement, 0 },
+
+		// Math functions
+		{ "sqr", MyTokenType::Square, "$sqr", Builtin::Pure, &Sqr },
+		{ "cbc", MyTokenType::Cube, "$cbc", Builtin::Pure, &Cbc },
+		{ "pow", MyTokenType::Power, "$pow", Builtin::Pure, &Pow },
+		{ "sqrt", MyTokenType::SquareRoot, "$sqrt", Builtin::Pure | Builtin::CanFail, &Sqrt },
+		{ "cbrt", MyTokenType::CubeRoot, "$cbrt", Builtin::Pure, &Cbrt },
+		{ "sin", MyTokenType::Sine, "$sin", Builtin::Pure, &Sin },
+		{ "cos", MyTokenType::Cosine, "$cos", Builtin::Pure, &Cos },
+		{ "tan", MyTokenType::Tangent, "$tan", Builtin::Pure, &Tan },
+		{ "sinr", MyTokenType::SineR, "$sinr", Builtin::Pure, &Sinr },
+		{ "cosr", MyTokenType::CosineR, "$cosr", Builtin::Pure, &Cosr },
+		{ "tanr", MyTokenType::TangentR, "$tanr", Builtin::Pure, &Tanr },
+		{ "deg", MyTokenType::Degree, "$deg", Builtin::Pure, &Degree },
+		{ "rad", MyTokenType::Radiant, "$rad", Builtin::Pure, &Radiant },
+		{ "perc", MyTokenType::Percent, "$perc", Builtin::Pure | Builtin::CanFail, &Percent },
+		{ "perm", MyTokenType::Permillage, "$perm", Builtin::Pure | Builtin::CanFail, &Permillage },
+		{ "log10", MyTokenType::CommonLog, "$log10", Builtin::Pure | Builtin::CanFail, &CommonLog },
+		{ "log2", MyTokenType::BinaryLog, "$log2", Builtin::Pure | Builtin::CanFail, &BinaryLog },
+		{ "log", MyTokenType::Log, "$log", Builtin::Pure | Builtin::CanFail, &Log },
+		{ "ln", MyTokenType::NaturalLog, "$ln", Builtin::Pure | Builtin::CanFail, &NaturalLog },
+		{ "mod", MyTokenType::Modulo, "$mod", Builtin::Pure | Builtin::CanFail, &Modulo },
+		{ "gcd", MyTokenType::Gcd, "$gcd", Builtin::Pure | Builtin::CanFail, 2 },
+		{ "dis", MyTokenType::Discriminant, "$dis", Builtin::Pure, &Discriminant },
+		{ "abc", MyTokenType::AbcFormula, "$abc", Builtin::Statement, 3 },
+		{ "fib", MyTokenType::Fibonacci, "$fib", Builtin::Pure | Builtin::CanFail, 1 },
+		{ "pyt", MyTokenType::Pythagoras, "$pyt", Builtin::Pure | Builtin::CanFail, &Pythagorean },
+		{ "pyth", MyTokenType::PythagorasH, "$pyth", Builtin::Pure | Builtin::CanFail, &PythagoreanH },
+
+		// Physics
+		{ "dist", MyTokenType::Distance, "$dist", Builtin::Pure, &Distance },
+		{ "velo", MyTokenType::Velocity, "$velo", Builtin::Pure | Builtin::CanFail, &Quotient },
+		{ "time", MyTokenType::Time, "$time", Builtin::Pure | Builtin::CanFail, &Quotient },
+		{ "avgv", MyTokenType::AverageVelocity, "$avgv", Builtin::Pure | Builtin::CanFail, &Quotient },
+		{ "accl", MyTokenType::Acceleration, "$accl", Builtin::Pure | Builtin::CanFail, &Quotient }
+	};
+
+	static constexpr int count = sizeof(table) / sizeof(table[0]);
+};
+
+template <typename Value>
+constexpr BuiltinEntry<Value> BuiltinMath<Value>::table[];
+
+// The builtins without their handlers, for everything that doesn't compute them
+class Builtins
+{
+public:
+	static int Count();
+	static const Builtin& Get(int index);
+
+	// nullptr when it isn't a builtin
+	static const Builtin* Find(MyTokenType type);
+	static const Builtin* Find(const std::string& expression);
+
+	// The index in the tables of BuiltinMath, -1 when it isn't a builtin
+	static int IndexOf(const std::string& expression);
+};
@@ -0,0 +1,858 @@
+#include "CommandLine.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <boost/filesystem.hpp>
+
+#ifdef _WIN32
+#define popen _popen
+#define pclose _pclose
+#endif
+
+CommandLine::CommandLine(int argc, const char* argv[])
+{
+	for (int i = 1; i < argc; i++)
+	{
+		std::string argument = argv[i];
+
+		if (argument == "--no-jit")
+			jitEnabled = false;
+		else if (argument == "--no-fuse")
+			options.fuseInstructions = false;
+		else if (argument == "--no-tail-calls")
+			options.eliminateTailCalls = false;
+		else if (argument == "--no-inline")
+			options.inlineFunctions = false;
+		else if (argument == "--inline-limit" && i + 1 < argc)
+			options.inlineLimit = atoi(argv[++i]);
+		else if (argument == "--no-licm")
+			options.hoistInvariants = false;
+		else if (argument == "--no-reduce")
+			options.reduceStrength = false;
+		else if (argument == "--fast-math")
+			options.fastMath = true;
+		else if (argument == "--no-cfg")
+			options.simplifyControlFlow = false;
+		else if (argument == "--no-int-types")
+			options.inferIntegers = false;
+		else if (argument == "--no-intern")
+			options.internExpressions = false;
+		else if (argument == "--double")
+			options.numericMode = NumericMode::Double;
+		else if (argument == "--compare-precision")
+			comparePrecision = true;
+		else if (argument == "--compare-fuse")
+			compareFuse = true;
+		else if (argument == "--parse-threads" && i + 1 < argc)
+			options.parseThreads = atoi(argv[++i]);
+		else if (argument == "--no-const-eval")
+			options.evaluateCalls = false;
+		else if (argument == "--eval-budget" && i + 1 < argc)
+			options.evaluationBudget = atoi(argv[++i]);
+		else if (argument == "--memoize")
+		{
+			memoize = true;
+			options.analyzePurity = true;
+		}
+		else if (argument == "--memo-size" && i + 1 < argc)
+			memoSize = atoi(argv[++i]);
+		else if (argument == "--no-cache")
+			useCache = false;
+		else if (argument == "--cache-size" && i + 1 < argc)
+			cacheSize = atoi(argv[++i]);
+		else if (argument == "--cache-dir" && i + 1 < argc)
+			cacheDirectory = argv[++i];
+		else if (argument == "--no-incremental")
+			incremental = false;
+		else if (argument == "--check")
+			check = true;
+		else if (argument == "--verbose")
+			verbose = true;
+		else if (argument == "--benchmark")
+			benchmark = true;
+		else if (argument == "--parse-benchmark" && i + 1 < argc)
+			parseBenchmarkTerms = atoi(argv[++i]);
+		else if (argument == "--import-benchmark" && i + 1 < argc)
+			importBenchmarkFunctions = atoi(argv[++i]);
+		else if (argument == "--emit-cpp")
+			emitCpp = true;
+		else if (argument == "--native")
+			native = true;
+		else if (argument == "--conformance")
+			conformance = true;
+		else if (argument == "--dump-ir")
+		{
+			dumpIr = true;
+			options.buildIr = true;
+		}
+		else if (argument == "--dump-stages" || argument == "--dump-json")
+		{
+			dumpStages = true;
+			dumpJson = dumpJson || argument == "--dump-json";
+			options.buildIr = true;
+			options.analyzePurity = true;
+		}
+		else if (argument == "--jit-threshold" && i + 1 < argc)
+			jitThreshold = atoi(argv[++i]);
+		else if (argument.compare(0, 2, "--") == 0)
+			validArguments = false;
+		else
+			files.push_back(argument);
+	}
+}
+
+CommandLine::~CommandLine()
+{
+}
+
+int CommandLine::Run()
+{
+	if (validArguments && files.empty() && parseBenchmarkTerms > 0)
+		return BenchmarkParser(parseBenchmarkTerms);
+	if (validArguments && files.empty() && importBenchmarkFunctions > 0)
+		return BenchmarkImports(importBenchmarkFunctions);
+
+	if (!validArguments || files.empty() || jitThreshold < 1 || memoSize < 1 || cacheSize < 1 || options.parseThreads < 0 || options.evaluationBudget < 1)
+	{
+		PrintUsage();
+		return 1;
+	}
+
+	// The nodes the passes make are only counted for the dumps
+	CompilerNode::SetCounting(dumpStages);
+
+	int result = 0;
+	for (std::string file : files)
+	{
+		int fileResult;
+		if (dumpStages)
+			fileResult = DumpStages(file);
+		else if (check)
+			fileResult = CheckFile(file);
+		else if (benchmark)
+			fileResult = BenchmarkFile(file);
+		else if (comparePrecision)
+			fileResult = ComparePrecision(file);
+		else if (compareFuse)
+			fileResult = CompareFuse(file);
+		else if (conformance)
+			fileResult = CheckConformance(file);
+		else if (native)
+			fileResult = RunNative(file);
+		else if (dumpIr)
+			fileResult = DumpIr(file);
+		else if (emitCpp)
+		{
+			std::string executable;
+			fileResult = TranspileFile(file, false, executable) ? 0 : 1;
+		}
+		else
+			fileResult = RunFile(file);
+
+		if (fileResult != 0)
+			result = fileResult;
+	}
+
+	std::string report = moduleLoader != nullptr ? moduleLoader->GetReport() : "";
+	if (verbose && !report.empty())
+		std::cerr << report << std::endl;
+	return result;
+}
+
+ModuleLoader* CommandLine::GetModuleLoader()
+{
+	if (moduleLoader == nullptr || moduleOptions != ProgramCache::GetOptionsText(options))
+	{
+		if (useCache && moduleCache == nullptr)
+			moduleCache = std::make_shared<ProgramCache>(cacheDirectory, (uint64_t)cacheSize * 1024 * 1024);
+		moduleLoader = std::make_shared<ModuleLoader>(options, moduleCache.get());
+		moduleOptions = ProgramCache::GetOptionsText(options);
+	}
+	return moduleLoader.get();
+}
+
+std::shared_ptr<Compiler> CommandLine::CompileFile(std::string file, CompilationDump* dump)
+{
+	// The files of one run share their unchanged lines and functions
+	if (incremental)
+		incrementalCache.StartRun();
+	TokenizerController tokenizer_controller(file, incremental ? &incrementalCache : nullptr);
+	DiagnosticsEngine diagnostics;
+	tokenizer_controller.SetDiagnostics(&diagnostics);
+
+	try
+	{
+		// Tokenize
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		uint64_t nodes = CompilerNode::GetCreatedCount();
+		tokenizer_controller.Tokenize();
+		if (dump != nullptr)
+			dump->AddTiming({ "Tokenizer", std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count(), CompilerNode::GetCreatedCount() - nodes });
+	}
+	catch (const std::exception& e)
+	{
+		PrintDiagnostics(diagnostics);
+		std::cerr << e.what() << std::endl;
+		return nullptr;
+	}
+
+	// Tokenizer has exceptions stop the build
+	PrintDiagnostics(diagnostics);
+	if (tokenizer_controller.HasExceptions())
+		return nullptr;
+	if (dump != nullptr)
+		dump->AddTokens(tokenizer_controller.GetCompilerTokens());
+
+	std::shared_ptr<Compiler> compiler = std::make_shared<Compiler>(tokenizer_controller.GetCompilerTokens(), options);
+	if (incremental)
+		compiler->SetIncrementalCache(&incrementalCache);
+	compiler->SetDiagnostics(&diagnostics);
+	compiler->SetModules(LoadImports(file));
+
+	try
+	{
+		// Compile
+		compiler->Compile();
+	}
+	catch (const std::exception& e)
+	{
+		PrintDiagnostics(diagnostics);
+		std::cerr << e.what() << std::endl;
+		return nullptr;
+	}
+
+	// Compiler has exceptions stop the build
+	PrintDiagnostics(diagnostics);
+	if (compiler->HasExceptions())
+		return nullptr;
+	if (dump != nullptr)
+		dump->AddNodes("parsed", compiler.get());
+
+	compiler->Optimize();
+	PrintDiagnostics(diagnostics);
+	if (dump != nullptr)
+	{
+		dump->AddNodes("optimized", compiler.get());
+		dump->AddTimings(compiler->GetPassTimings());
+		if (compiler->GetIrModule() != nullptr)
+			dump->SetIr(compiler->GetIrModule()->ToString());
+	}
+	if (verbose)
+	{
+		for (std::string message : compiler->GetCompileLog())
+			std::cerr << message << std::endl;
+	}
+
+	// A global that can't be evaluated without an exception stops the build
+	if (compiler->HasExceptions())
+		return nullptr;
+
+	return compiler;
+}
+
+// Tokenize and check a file without compiling it, like the editor does while it is typed in
+int CommandLine::CheckFile(std::string file)
+{
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	if (incremental)
+		incrementalCache.StartRun();
+	TokenizerController tokenizer_controller(file, incremental ? &incrementalCache : nullptr);
+	DiagnosticsEngine diagnostics;
+	tokenizer_controller.SetDiagnostics(&diagnostics);
+
+	bool valid = true;
+	try
+	{
+		tokenizer_controller.Tokenize();
+		PrintDiagnostics(diagnostics);
+		valid = !tokenizer_controller.HasExceptions();
+
+		if (valid)
+		{
+			Compiler compiler(tokenizer_controller.GetCompilerTokens(), options);
+			compiler.SetDiagnostics(&diagnostics);
+			compiler.SetModules(LoadImports(file));
+			compiler.Check();
+			PrintDiagnostics(diagnostics);
+			valid = !compiler.HasExceptions();
+		}
+	}
+	catch (const std::exception& e)
+	{
+		PrintDiagnostics(diagnostics);
+		std::cerr << e.what() << std::endl;
+		valid = false;
+	}
+
+	if (verbose)
+		std::cerr << "Checked " << file << " in " << std::fixed << std::setprecision(3) << std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() << "s" << std::endl;
+	if (!valid)
+		return 1;
+
+	std::cout << file << ": ok" << std::endl;
+	return 0;
+}
+
+// The diagnostics of a phase, together when it is done
+void CommandLine::PrintDiagnostics(DiagnosticsEngine& diagnostics)
+{
+	for (std::string message : diagnostics.TakeBatch())
+		std::clog << message << std::endl;
+}
+
+// The compiled program from the cache, or compile it and put it in
+std::shared_ptr<CompiledProgram> CommandLine::LoadProgram(std::string file)
+{
+	std::string key;
+	ProgramCache cache(cacheDirectory, (uint64_t)cacheSize * 1024 * 1024);
+	if (useCache)
+	{
+		std::ifstream stream(file, std::ios::binary);
+		std::string source((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+		key = ProgramCache::GetKey(ModuleLoader::GetSourceWithImports(source, ModuleLoader::GetDirectory(file)), options);
+
+		std::shared_ptr<CompiledProgram> program = stream ? cache.Load(key) : nullptr;
+		if (program != nullptr)
+		{
+			if (verbose)
+				std::cerr << "Loaded " << file << " from the program cache" << std::endl;
+			return program;
+		}
+	}
+
+	std::shared_ptr<Compiler> compiler = CompileFile(file);
+	if (compiler == nullptr)
+		return nullptr;
+
+	std::shared_ptr<CompiledProgram> program = std::make_shared<CompiledProgram>(compiler->GetSymbolTable(), compiler->GetSubroutineTable(), compiler->GetCompilerNodes());
+	if (useCache && !key.empty() && !cache.Store(key, *program) && verbose)
+		std::cerr << "Could not write " << file << " to the program cache" << std::endl;
+	return program;
+}
+
+bool CommandLine::Execute(std::string file, bool jit, std::string &output, double &seconds)
+{
+	std::shared_ptr<CompiledProgram> program = LoadProgram(file);
+	if (program == nullptr)
+		return false;
+
+	std::shared_ptr<LinkedList> nodesLinkedList = std::make_shared<LinkedList>(program->compilerNodes);
+	VirtualMachine virtual_machine(&program->symbolTable, &program->subroutineTable, nodesLinkedList);
+	virtual_machine.SetJitEnabled(jit);
+	virtual_machine.SetJitThreshold(jitThreshold);
+	virtual_machine.SetMemoizeEnabled(memoize);
+	virtual_machine.SetMemoCapacity(memoSize);
+	virtual_machine.SetNumericMode(options.numericMode);
+
+	QObject::connect(&virtual_machine, &VirtualMachine::PrintOutput, [&output](QString text) {
+		output += text.toStdString() + "\n";
+	});
+	QObject::connect(&virtual_machine, &VirtualMachine::PrintException, [&output](QString text) {
+		output += text.toStdString() + "\n";
+	});
+
+	// Run on this thread, the signals are delivered directly
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	virtual_machine.run();
+	seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	if (verbose)
+	{
+		std::cerr << virtual_machine.GetJitLog();
+		std::cerr << "Executed nodes: " << virtual_machine.GetExecutedNodeCount() << std::endl;
+		if (memoize)
+			std::cerr << virtual_machine.GetMemoLog();
+	}
+
+	return true;
+}
+
+int CommandLine::RunFile(std::string file)
+{
+	std::string output;
+	double seconds = 0;
+	if (!Execute(file, jitEnabled, output, seconds))
+		return 1;
+
+	std::cout << output;
+	return 0;
+}
+
+int CommandLine::BenchmarkFile(std::string file)
+{
+	std::string interpreterOutput;
+	std::string jitOutput;
+	double interpreterSeconds = 0;
+	double jitSeconds = 0;
+
+	if (!Execute(file, false, interpreterOutput, interpreterSeconds) || !Execute(file, true, jitOutput, jitSeconds))
+		return 1;
+
+	std::cout << file << std::fixed << std::setprecision(3)
+		<< ": interpreter " << interpreterSeconds << "s"
+		<< ", jit " << jitSeconds << "s";
+	if (jitSeconds > 0)
+		std::cout << " (" << std::setprecision(1) << interpreterSeconds / jitSeconds << "x)";
+	std::cout << std::endl;
+
+	// Both runs have to give exactly the same output
+	if (interpreterOutput != jitOutput)
+	{
+		std::cout << file << ": the output of the jit differs from the interpreter" << std::endl;
+		return 1;
+	}
+	return 0;
+}
+
+// Parse generated expressions without the passes and without running them.
+// The tokenizer is left out, the tokens of the expression are made directly
+// and put in place of the 0 in the tokens of a small program around it.
+int CommandLine::BenchmarkParser(int terms)
+{
+	std::string file = "parse-benchmark.sc";
+	std::ofstream source(file);
+	source << "func Main()\n[\n\tvar a = 1.5;\n\tvar b = 2.5;\n\tvar x = 0;\n\tprnt(x);\n]\n";
+	source.close();
+
+	TokenizerController tokenizer_controller(file);
+	tokenizer_controller.Tokenize();
+	std::vector<std::shared_ptr<Token>> program = tokenizer_controller.GetCompilerTokens();
+	std::remove(file.c_str());
+
+	auto placeholder = std::find_if(program.begin(), program.end(), [](std::shared_ptr<Token> token) {
+		return token->Type == MyTokenType::Float && token->Value == "0";
+	});
+	if (tokenizer_controller.HasExceptions() || placeholder == program.end())
+		return 1;
+
+	int line = (*placeholder)->LineNumber;
+	int level = (*placeholder)->Level;
+	auto makeToken = [line](int level, std::string value, MyTokenType type) {
+		return std::make_shared<Token>(line, 1, level, value, type, nullptr);
+	};
+
+	std::vector<std::pair<std::string, std::vector<std::shared_ptr<Token>>>> expressions;
+
+	// A long sum of products, like a generated formula
+	std::vector<std::shared_ptr<Token>> flat;
+	for (int i = 0; i < terms; i++)
+	{
+		if (i > 0)
+			flat.push_back(i % 3 == 0 ? makeToken(level, "-", MyTokenType::OperatorMinus) : makeToken(level, "+", MyTokenType::OperatorPlus));
+		flat.push_back(makeToken(level, i % 2 == 0 ? "a" : "b", MyTokenType::Identifier));
+		flat.push_back(i % 2 == 0 ? makeToken(level, "*", MyTokenType::OperatorMultiply) : makeToken(level, "/", MyTokenType::OperatorDivide));
+		flat.push_back(makeToken(level, i % 2 == 0 ? "2" : "3", MyTokenType::Float));
+	}
+	expressions.push_back(std::make_pair("flat", flat));
+
+	// As many parentheses inside each other, ((a + 1) + 1)
+	std::vector<std::shared_ptr<Token>> nested;
+	for (int i = 0; i < terms; i++)
+		nested.push_back(makeToken(level + i + 1, "(", MyTokenType::OpenBracket));
+	nested.push_back(makeToken(level + terms, "a", MyTokenType::Identifier));
+	for (int i = terms; i > 0; i--)
+	{
+		nested.push_back(makeToken(level + i, "+", MyTokenType::OperatorPlus));
+		nested.push_back(makeToken(level + i, "1", MyTokenType::Float));
+		nested.push_back(makeToken(level + i, ")", MyTokenType::CloseBracket));
+	}
+	expressions.push_back(std::make_pair("nested", nested));
+
+	int result = 0;
+	for (auto expression : expressions)
+	{
+		std::vector<std::shared_ptr<Token>> tokens(program.begin(), placeholder);
+		tokens.insert(tokens.end(), expression.second.begin(), expression.second.end());
+		tokens.insert(tokens.end(), placeholder + 1, program.end());
+
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		bool parsed = false;
+		{
+			Compiler compiler(tokens, options);
+			try
+			{
+				compiler.Compile();
+				parsed = !compiler.HasExceptions();
+			}
+			catch (const std::exception& e)
+			{
+				std::cerr << e.what() << std::endl;
+			}
+		}
+		double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+		std::cout << expression.first << ": " << terms << " terms, " << expression.second.size() << " tokens"
+			<< std::fixed << std::setprecision(3) << ", parsed in " << seconds << "s";
+		if (seconds > 0)
+			std::cout << " (" << std::setprecision(0) << expression.second.size() / seconds << " tokens/s)";
+		std::cout << (parsed ? "" : ", failed") << std::endl;
+
+		if (!parsed)
+			result = 1;
+	}
+	return result;
+}
+
+// A library of functions imported by 100 programs against 100 programs with the library
+// pasted in, without the caches. The imported library is compiled once for all of them.
+int CommandLine::BenchmarkImports(int functions)
+{
+	const int programCount = 100;
+	std::string directory = "import-benchmark";
+	boost::filesystem::create_directories(directory);
+
+	std::ostringstream library;
+	library << "var scale = 2;\n";
+	for (int i = 0; i < functions; i++)
+	{
+		library << "func float f" << i << "(a | b)\n[\n"
+			<< "\tvar t = a * scale + b;\n"
+			<< "\tfrl (var i = 0 | i < " << i % 5 + 1 << " | i++)\n\t[\n\t\tt = t + sqr(i) - b / 2;\n\t]\n"
+			<< "\tret t + " << i << ";\n]\n";
+	}
+	std::ofstream(directory + "/library.sc") << library.str();
+
+	std::vector<std::string> imported;
+	std::vector<std::string> pasted;
+	for (int i = 0; i < programCount; i++)
+	{
+		std::ostringstream main;
+		main << "func Main()\n[\n\tprnt(f" << i % functions << "(" << i << " | 3) + f" << (i * 7) % functions << "(1 | " << i << "));\n]\n";
+
+		imported.push_back(directory + "/imported" + std::to_string(i) + ".sc");
+		std::ofstream(imported.back()) << "import \"library.sc\";\n" << main.str();
+
+		pasted.push_back(directory + "/pasted" + std::to_string(i) + ".sc");
+		std::ofstream(pasted.back()) << library.str() << main.str();
+	}
+
+	// Every program is compiled from its source, the library once per loader
+	bool wasIncremental = incremental;
+	bool wasCached = useCache;
+	incremental = false;
+	useCache = false;
+	moduleLoader = nullptr;
+	moduleCache = nullptr;
+
+	int result = 0;
+	double seconds[2];
+	std::vector<std::string>* programs[2] = { &imported, &pasted };
+	for (int run = 0; run < 2; run++)
+	{
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		for (std::string file : *programs[run])
+		{
+			if (CompileFile(file) == nullptr)
+				result = 1;
+		}
+		seconds[run] = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	// An imported library has to give the same program as a pasted one
+	std::string importedOutput;
+	std::string pastedOutput;
+	double runSeconds;
+	if (!Execute(imported.back(), jitEnabled, importedOutput, runSeconds) || !Execute(pasted.back(), jitEnabled, pastedOutput, runSeconds) || importedOutput != pastedOutput)
+	{
+		std::cout << "import-benchmark: the output of the imported library differs from the pasted one" << std::endl;
+		result = 1;
+	}
+
+	std::string report = moduleLoader->GetReport();
+	incremental = wasIncremental;
+	useCache = wasCached;
+	moduleLoader = nullptr;
+
+	std::cout << programCount << " programs, a library of " << functions << " functions" << std::fixed << std::setprecision(3)
+		<< ": imported " << seconds[0] << "s, pasted " << seconds[1] << "s";
+	if (seconds[0] > 0)
+		std::cout << " (" << std::setprecision(1) << seconds[1] / seconds[0] << "x)";
+	std::cout << std::endl;
+	if (verbose)
+		std::cerr << report << std::endl;
+
+	boost::filesystem::remove_all(directory);
+	return result;
+}
+
+// The modules are loaded once for every file of the run, the ones it doesn't import aren't read
+std::map<std::string, std::shared_ptr<Module>> CommandLine::LoadImports(std::string file)
+{
+	std::ifstream stream(file, std::ios::binary);
+	std::string source((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+	return GetModuleLoader()->LoadImports(source, ModuleLoader::GetDirectory(file));
+}
+
+int CommandLine::ComparePrecision(std::string file)
+{
+	std::string longDoubleOutput;
+	std::string doubleOutput;
+	double longDoubleSeconds = 0;
+	double doubleSeconds = 0;
+
+	// Both runs are compiled in their own mode, the constant folding has to match the run
+	NumericMode mode = options.numericMode;
+	options.numericMode = NumericMode::LongDouble;
+	bool executed = Execute(file, jitEnabled, longDoubleOutput, longDoubleSeconds);
+	options.numericMode = NumericMode::Double;
+	executed = executed && Execute(file, jitEnabled, doubleOutput, doubleSeconds);
+	options.numericMode = mode;
+	if (!executed)
+		return 1;
+
+	std::cout << file << std::fixed << std::setprecision(3)
+		<< ": long double " << longDoubleSeconds << "s"
+		<< ", double " << doubleSeconds << "s";
+	if (doubleSeconds > 0)
+		std::cout << " (" << std::setprecision(1) << longDoubleSeconds / doubleSeconds << "x)";
+	std::cout << std::endl;
+
+	// Compare the output line by line, the lines that are numbers also by value
+	std::istringstream longDoubleLines(longDoubleOutput);
+	std::istringstream doubleLines(doubleOutput);
+	std::string longDoubleLine;
+	std::string doubleLine;
+	int lines = 0;
+	int differences = 0;
+	long double largestDifference = 0;
+	while (true)
+	{
+		bool hasLongDouble = (bool)std::getline(longDoubleLines, longDoubleLine);
+		bool hasDouble = (bool)std::getline(doubleLines, doubleLine);
+		if (!hasLongDouble && !hasDouble)
+			break;
+
+		lines++;
+		if (hasLongDouble && hasDouble && longDoubleLine == doubleLine)
+			continue;
+
+		differences++;
+		char* longDoubleEnd;
+		char* doubleEnd;
+		long double longDoubleValue = strtold(longDoubleLine.c_str(), &longDoubleEnd);
+		long double doubleValue = strtold(doubleLine.c_str(), &doubleEnd);
+		if (hasLongDouble && hasDouble && !longDoubleLine.empty() && !doubleLine.empty() && *longDoubleEnd == '\0' && *doubleEnd == '\0')
+			largestDifference = std::max(largestDifference, std::fabs(longDoubleValue - doubleValue));
+	}
+
+	std::cout << file << ": " << differences << " of " << lines << " lines differ";
+	if (differences > 0)
+		std::cout << ", largest difference " << std::scientific << std::setprecision(3) << (double)largestDifference;
+	std::cout << std::endl;
+	return 0;
+}
+
+// Compile and run a file with or without fused instructions, the program cache keeps both apart by the options
+bool CommandLine::ExecuteFused(std::string file, bool fuse, std::string &output, double &seconds)
+{
+	bool fuseInstructions = options.fuseInstructions;
+	options.fuseInstructions = fuse;
+	bool executed = Execute(file, jitEnabled, output, seconds);
+	options.fuseInstructions = fuseInstructions;
+	return executed;
+}
+
+// The fused instructions have to do exactly what the nodes they replace do
+int CommandLine::CompareFuse(std::string file)
+{
+	std::string fusedOutput;
+	std::string unfusedOutput;
+	double fusedSeconds = 0;
+	double unfusedSeconds = 0;
+
+	if (!ExecuteFused(file, true, fusedOutput, fusedSeconds) || !ExecuteFused(file, false, unfusedOutput, unfusedSeconds))
+		return 1;
+
+	if (fusedOutput != unfusedOutput)
+	{
+		std::cout << file << ": the output with fused instructions differs from the output without" << std::endl;
+		return 1;
+	}
+
+	std::cout << file << std::fixed << std::setprecision(3)
+		<< ": ok, fused " << fusedSeconds << "s"
+		<< ", not fused " << unfusedSeconds << "s" << std::endl;
+	return 0;
+}
+
+bool CommandLine::TranspileFile(std::string file, bool build, std::string &executable)
+{
+	std::shared_ptr<CompiledProgram> program = LoadProgram(file);
+	if (program == nullptr)
+		return false;
+
+	CppTranspiler transpiler(&program->symbolTable, &program->subroutineTable, program->compilerNodes);
+	if (!transpiler.Transpile(file))
+	{
+		for (std::string error : transpiler.GetErrors())
+			std::cerr << file << ": " << error << std::endl;
+		return false;
+	}
+
+	std::string sourceFile = file + ".cpp";
+	std::ofstream stream(sourceFile);
+	stream << transpiler.GetSource();
+	stream.close();
+	if (!stream)
+	{
+		std::cerr << "Could not write " << sourceFile << std::endl;
+		return false;
+	}
+
+	if (verbose)
+		std::cerr << "Wrote " << sourceFile << std::endl;
+
+	if (!build)
+		return true;
+
+#ifdef _WIN32
+	executable = file + ".exe";
+#else
+	executable = file + ".native";
+#endif
+	if (!CppTranspiler::BuildExecutable(sourceFile, executable))
+	{
+		std::cerr << "Could not build " << sourceFile << std::endl;
+		return false;
+	}
+
+	// Run it from the current directory when the path has no directory
+	if (executable.find_first_of("/\\") == std::string::npos)
+		executable = "./" + executable;
+	return true;
+}
+
+bool CommandLine::ExecuteNative(std::string executable, std::string &output)
+{
+	FILE* pipe = popen(("\"" + executable + "\"").c_str(), "r");
+	if (pipe == nullptr)
+		return false;
+
+	char buffer[4096];
+	size_t length;
+	while ((length = fread(buffer, 1, sizeof(buffer), pipe)) > 0)
+		output.append(buffer, length);
+
+	pclose(pipe);
+	return true;
+}
+
+int CommandLine::RunNative(std::string file)
+{
+	std::string executable;
+	if (!TranspileFile(file, true, executable))
+		return 1;
+
+	std::string output;
+	if (!ExecuteNative(executable, output))
+		return 1;
+
+	std::cout << output;
+	return 0;
+}
+
+int CommandLine::CheckConformance(std::string file)
+{
+	std::string virtualMachineOutput;
+	std::string nativeOutput;
+	std::string executable;
+	double seconds = 0;
+
+	if (!Execute(file, jitEnabled, virtualMachineOutput, seconds) || !TranspileFile(file, true, executable) || !ExecuteNative(executable, nativeOutput))
+		return 1;
+
+	// The native build has to print exactly what the VirtualMachine prints
+	if (virtualMachineOutput != nativeOutput)
+	{
+		std::cout << file << ": the output of the native build differs from the virtual machine" << std::endl;
+		return 1;
+	}
+
+	// And so has the VirtualMachine with the fusion turned the other way
+	std::string otherOutput;
+	if (!ExecuteFused(file, !options.fuseInstructions, otherOutput, seconds))
+		return 1;
+	if (otherOutput != virtualMachineOutput)
+	{
+		std::cout << file << ": the output with fused instructions differs from the output without" << std::endl;
+		return 1;
+	}
+
+	std::cout << file << ": ok" << std::endl;
+	return 0;
+}
+
+int CommandLine::DumpIr(std::string file)
+{
+	std::shared_ptr<Compiler> compiler = CompileFile(file);
+	if (compiler == nullptr)
+		return 1;
+
+	std::shared_ptr<IrModule> module = compiler->GetIrModule();
+	if (module == nullptr)
+	{
+		// The reason is in the compile log
+		for (std::string message : compiler->GetCompileLog())
+			std::cerr << message << std::endl;
+		return 1;
+	}
+
+	std::cout << module->ToString();
+	return 0;
+}
+
+// Every stage of the compile of a file, to diff two versions of a pass or to read by a tool
+int CommandLine::DumpStages(std::string file)
+{
+	CompilationDump dump;
+	if (CompileFile(file, &dump) == nullptr)
+		return 1;
+
+	std::cout << (dumpJson ? dump.ToJson() : dump.ToText());
+	return 0;
+}
+
+void CommandLine::PrintUsage()
+{
+	std::cerr << "Usage: 42IN13SAi [options] file..." << std::endl
+		<< "  --no-jit             only use the interpreter" << std::endl
+		<< "  --jit-threshold n    calls or loop iterations before compiling to machine code (default 100)" << std::endl
+		<< "  --no-fuse            don't fuse instructions" << std::endl
+		<< "  --no-tail-calls      keep the recursive calls in ret f(...)" << std::endl
+		<< "  --no-inline          don't inline small functions" << std::endl
+		<< "  --inline-limit n     the most statements an inlined function can have (default 8)" << std::endl
+		<< "  --no-licm            don't move loop-invariant expressions out of loops" << std::endl
+		<< "  --no-reduce          don't replace builtins with constant operands by cheaper ones" << std::endl
+		<< "  --fast-math          also rewrite x / c and integer powers when the last bit can change" << std::endl
+		<< "  --no-cfg             keep the jumps and $doNothing nodes as they were parsed" << std::endl
+		<< "  --no-int-types       run whole numbers with the long double handlers too" << std::endl
+		<< "  --no-intern          give every expression its own nodes instead of sharing identical ones" << std::endl
+		<< "  --double             compute the math operations in double instead of long double" << std::endl
+		<< "  --compare-precision  run every file in long double and in double and compare the output" << std::endl
+		<< "  --compare-fuse       run every file with and without fused instructions, fails when the output differs" << std::endl
+		<< "  --parse-threads n    the threads that parse the function bodies, 1 for none (default one per core)" << std::endl
+		<< "  --no-const-eval      don't run pure functions with constant arguments while compiling" << std::endl
+		<< "  --eval-budget n      the most statements a call run while compiling can take (default 10000)" << std::endl
+		<< "  --memoize            remember the results of pure functions" << std::endl
+		<< "  --memo-size n        the most results remembered per function (default 4096)" << std::endl
+		<< "  --no-cache           always compile, don't read or write the program cache" << std::endl
+		<< "  --cache-size n       the most megabytes the program cache can take (default 64)" << std::endl
+		<< "  --cache-dir path     the directory of the program cache (default the cache location of the user)" << std::endl
+		<< "  --no-incremental     tokenize and parse every file from scratch" << std::endl
+		<< "  --check              only report the errors of every file, without compiling or running it" << std::endl
+		<< "  --verbose            print the compile and JIT logs" << std::endl
+		<< "  --benchmark          run every file with and without the JIT and compare" << std::endl
+		<< "  --parse-benchmark n  time the parser on generated expressions of n terms, without files" << std::endl
+		<< "  --import-benchmark n compile 100 programs that import a library of n functions and 100 with it pasted in" << std::endl
+		<< "  --emit-cpp           write the C++ translation of every file to <file>.cpp" << std::endl
+		<< "  --native             build the C++ translation with the system compiler and run it" << std::endl
+		<< "  --conformance        compare the output of the native build and of the run without fused instructions with the virtual machine" << std::endl
+		<< "  --dump-ir            print the optimized IR of every file" << std::endl
+		<< "  --dump-stages        print the tokens, the nodes before and after the passes, the IR and the pass timings" << std::endl
+		<< "  --dump-json          the same as --dump-stages as JSON" << std::endl;
+}
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <QObject>
+
+#include "TokenizerController.h"
+#include "Compiler.h"
+#include "CompilerOptions.h"
+#include "DiagnosticsEngine.h"
+#include "VirtualMachine.h"
+#include "CppTranspiler.h"
+#include "IncrementalCache.h"
+#include "ProgramCache.h"
+#include "ModuleLoader.h"
+#include "CompilationDump.h"
+
+// Runs Short-C files without the editor
+//
+//   42IN13SAi [options] file...
+//
+//   --no-jit             only use the interpreter
+//   --jit-threshold n    calls or loop iterations before compiling to machine code
+//   --no-fuse            don't fuse instructions
+//   --no-tail-calls      keep the recursive calls in ret f(...)
+//   --no-inline          don't inline small functions
+//   --inline-limit n     the most statements an inlined function can have
+//   --no-licm            don't move loop-invariant expressions out of loops
+//   --no-reduce          don't replace builtins with constant operands by cheaper ones
+//   --fast-math          also rewrite x / c and integer powers when the last bit can change
+//   --no-cfg             keep the jumps and $doNothing nodes as they were parsed
+//   --no-int-types       run whole numbers with the long double handlers too
+//   --no-intern          give every expression its own nodes instead of sharing identical ones
+//   --double             compute the math operations in double instead of long double
+//   --compare-precision  run every file in long double and in double and compare the output
+//   --compare-fuse       run every file with and without fused instructions, fails when the output differs
+//   --parse-threads n    the threads that parse the function bodies, 1 for none
+//   --no-const-eval      don't run pure functions with constant arguments while compiling
+//   --eval-budget n      the most statements a call run while compiling can take
+//   --memoize            remember the results of pure functions
+//   --memo-size n        the most results remembered per function
+//   --no-cache           always compile, don't read or write the program cache
+//   --cache-size n       the most megabytes the program cache can take
+//   --cache-dir path     the directory of the program cache, "Program cache" for the one in the working directory
+//   --no-incremental     tokenize and parse every file from scratch
+//   --check              only report the errors of every file, without compiling or running it
+//   --verbose            print the compile and JIT logs
+//   --benchmark          run every file with and without the JIT and compare
+//   --parse-benchmark n  time the parser on generated expressions of n terms, without files
+//   --import-benchmark n compile 100 programs that import a library of n functions and 100 with it pasted in
+//   --emit-cpp           write the C++ translation of every file to <file>.cpp
+//   --native             build the C++ translation with the system compiler and run it
+//   --conformance        compare the output of the native build and of the run without fused instructions with the VirtualMachine
+//   --dump-ir            print the optimized IR of every file
+//   --dump-stages        print the tokens, the nodes before and after the passes, the IR and the pass timings
+//   --dump-json          the same as --dump-stages as JSON
+class CommandLine
+{
+public:
+	CommandLine(int argc, const char* argv[]);
+	virtual ~CommandLine();
+
+	int Run();
+
+private:
+	std::vector<std::string> files;
+	CompilerOptions options;
+	bool jitEnabled = true;
+	int jitThreshold = 100;
+	bool memoize = false;
+	int memoSize = 4096;
+	bool useCache = true;
+	int cacheSize = 64;
+	std::string cacheDirectory = ProgramCache::GetUserDirectory();
+	bool incremental = true;
+	IncrementalCache incrementalCache;
+	bool check = false;
+	bool verbose = false;
+	bool benchmark = false;
+	int parseBenchmarkTerms = 0;
+	int importBenchmarkFunctions = 0;
+	bool comparePrecision = false;
+	bool compareFuse = false;
+	bool emitCpp = false;
+	bool native = false;
+	bool conformance = false;
+	bool dumpIr = false;
+	bool dumpStages = false;
+	bool dumpJson = false;
+	bool validArguments = true;
+
+	// The modules of the files of the run, made again when the options change
+	std::shared_ptr<ProgramCache> moduleCache;
+	std::shared_ptr<ModuleLoader> moduleLoader;
+	std::string moduleOptions;
+	ModuleLoader* GetModuleLoader();
+
+	// The modules the imports of a file refer to
+	std::map<std::string, std::shared_ptr<Module>> LoadImports(std::string file);
+
+	// Tokenize and compile a file, nullptr when there are errors, dump gets every stage
+	std::shared_ptr<Compiler> CompileFile(std::string file, CompilationDump* dump = nullptr);
+
+	void PrintDiagnostics(DiagnosticsEngine& diagnostics);
+
+	// The program of a file from the program cache or compiled, nullptr when there are errors
+	std::shared_ptr<CompiledProgram> LoadProgram(std::string file);
+
+	// Compile and run a file, the output and exceptions are added to output
+	bool Execute(std::string file, bool jit, std::string &output, double &seconds);
+	bool ExecuteFused(std::string file, bool fuse, std::string &output, double &seconds);
+
+	// Write the C++ translation and optionally build it, returns the executable
+	bool TranspileFile(std::string file, bool build, std::string &executable);
+	bool ExecuteNative(std::string executable, std::string &output);
+
+	int CheckFile(std::string file);
+	int RunFile(std::string file);
+	int BenchmarkFile(std::string file);
+	int BenchmarkParser(int terms);
+	int BenchmarkImports(int functions);
+	int ComparePrecision(std::string file);
+	int CompareFuse(std::string file);
+	int RunNative(std::string file);
+	int CheckConformance(std::string file);
+	int DumpIr(std::string file);
+	int DumpStages(std::string file);
+	void PrintUsage();
+};
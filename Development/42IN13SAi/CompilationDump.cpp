@@ -0,0 +1,330 @@
+#include "CompilationDump.h"
+#include <algorithm>
+#include <cstdio>
+#include "LinkedList.h"
+#include "Subroutine.h"
+
+CompilationDump::CompilationDump()
+{
+}
+
+CompilationDump::~CompilationDump()
+{
+}
+
+void CompilationDump::AddTokens(const std::vector<std::shared_ptr<Token>>& p_tokens)
+{
+	tokens.clear();
+	for (std::shared_ptr<Token> token : p_tokens)
+		tokens.push_back(*token);
+}
+
+void CompilationDump::AddNodes(std::string name, Compiler* compiler)
+{
+	Stage stage;
+	stage.name = name;
+
+	std::list<std::shared_ptr<CompilerNode>> globalNodes = compiler->GetCompilerNodes();
+	stage.functions.push_back(MakeFunction(std::vector<std::shared_ptr<CompilerNode>>(globalNodes.begin(), globalNodes.end())));
+
+	std::vector<Subroutine*> subroutines = compiler->GetSubroutineTable()->GetSubroutineVector();
+	std::sort(subroutines.begin(), subroutines.end(), [](Subroutine* a, Subroutine* b) {
+		return a->name < b->name;
+	});
+
+	for (Subroutine* subroutine : subroutines)
+	{
+		std::vector<std::shared_ptr<CompilerNode>> statements;
+		for (std::shared_ptr<ListNode> listNode = subroutine->GetCompilerNodeCollection()->GetHead(); listNode && listNode->GetData(); listNode = listNode->GetNext())
+			statements.push_back(listNode->GetData());
+
+		Function function = MakeFunction(statements);
+		function.name = subroutine->name;
+		function.returnType = subroutine->returnType == MyTokenType::FloatReturn ? "float" : (subroutine->returnType == MyTokenType::Void ? "void" : GetTokenTypeName(subroutine->returnType));
+		function.parameters = subroutine->GetSymbolTable()->ParameterSize();
+		function.pure = subroutine->isPure;
+		stage.functions.push_back(function);
+	}
+	stages.push_back(stage);
+}
+
+void CompilationDump::AddTiming(PassTiming timing)
+{
+	timings.push_back(timing);
+}
+
+void CompilationDump::AddTimings(const std::vector<PassTiming>& p_timings)
+{
+	timings.insert(timings.end(), p_timings.begin(), p_timings.end());
+}
+
+void CompilationDump::SetIr(std::string text)
+{
+	ir = text;
+}
+
+CompilationDump::Function CompilationDump::MakeFunction(const std::vector<std::shared_ptr<CompilerNode>>& statements)
+{
+	Numbering numbering;
+	for (size_t i = 0; i < statements.size(); i++)
+	{
+		if (numbering.statements.count(statements[i].get()) == 0)
+			numbering.statements[statements[i].get()] = (int)i;
+	}
+	for (std::shared_ptr<CompilerNode> statement : statements)
+		CountUses(statement, numbering);
+
+	Function function;
+	for (std::shared_ptr<CompilerNode> statement : statements)
+		function.statements.push_back(MakeNode(statement, numbering));
+	return function;
+}
+
+// The times a node is a parameter or a statement, the children of a node are counted once
+void CompilationDump::CountUses(std::shared_ptr<CompilerNode> node, Numbering& numbering)
+{
+	if (node == nullptr || numbering.uses[node.get()]++ > 0)
+		return;
+
+	for (std::shared_ptr<CompilerNode> parameter : node->GetNodeparameters())
+		CountUses(parameter, numbering);
+}
+
+int CompilationDump::GetId(CompilerNode* node, Numbering& numbering)
+{
+	auto found = numbering.ids.find(node);
+	if (found != numbering.ids.end())
+		return found->second;
+
+	int id = (int)numbering.ids.size() + 1;
+	numbering.ids[node] = id;
+	return id;
+}
+
+CompilationDump::Node CompilationDump::MakeNode(std::shared_ptr<CompilerNode> node, Numbering& numbering)
+{
+	Node dumped;
+	if (node == nullptr)
+	{
+		dumped.expression = "null";
+		return dumped;
+	}
+
+	// A node that is shown twice is only its #n the second time
+	bool shared = numbering.uses[node.get()] > 1 || numbering.ids.count(node.get()) > 0;
+	if (shared)
+	{
+		dumped.id = GetId(node.get(), numbering);
+		if (numbering.shown[node.get()])
+		{
+			dumped.reference = true;
+			return dumped;
+		}
+		numbering.shown[node.get()] = true;
+	}
+
+	dumped.expression = node->GetExpression();
+	dumped.value = node->GetValue();
+	dumped.integral = node->IsIntegral();
+
+	std::shared_ptr<CompilerNode> jump = node->GetJumpTo();
+	if (jump != nullptr)
+	{
+		auto statement = numbering.statements.find(jump.get());
+		if (statement != numbering.statements.end())
+			dumped.jump = statement->second;
+		else
+			dumped.jumpId = GetId(jump.get(), numbering);
+	}
+
+	for (std::shared_ptr<CompilerNode> parameter : node->GetNodeparameters())
+		dumped.parameters.push_back(MakeNode(parameter, numbering));
+	return dumped;
+}
+
+std::string CompilationDump::ToText()
+{
+	std::string text = "== tokens " + std::to_string(tokens.size()) + "\n";
+	for (const Token& token : tokens)
+		text += std::to_string(token.LineNumber) + ":" + std::to_string(token.LinePosition) + " " + GetTokenTypeName(token.Type) + " " + Quote(token.Value) + "\n";
+
+	for (const Stage& stage : stages)
+	{
+		text += "== " + stage.name + "\n";
+		for (const Function& function : stage.functions)
+		{
+			if (function.name.empty())
+				text += "globals\n";
+			else
+				text += "func " + function.name + " " + function.returnType + " " + std::to_string(function.parameters) + (function.pure ? " pure" : "") + "\n";
+
+			for (size_t i = 0; i < function.statements.size(); i++)
+			{
+				text += "  " + std::to_string(i) + " ";
+				AppendText(text, function.statements[i], 2);
+			}
+		}
+	}
+
+	if (!ir.empty())
+		text += "== ir\n" + ir + (ir.back() == '\n' ? "" : "\n");
+
+	text += "== timings\n";
+	for (const PassTiming& timing : timings)
+	{
+		char seconds[32];
+		snprintf(seconds, sizeof(seconds), "%.6f", timing.seconds);
+		text += timing.name + " " + seconds + "s " + std::to_string(timing.nodes) + " nodes\n";
+	}
+	return text;
+}
+
+// A node on its line and its parameters under it, the first line is already indented
+void CompilationDump::AppendText(std::string& text, const Node& node, int depth)
+{
+	if (node.reference)
+	{
+		text += "#" + std::to_string(node.id) + "\n";
+		return;
+	}
+
+	text += node.expression;
+	if (!node.value.empty())
+		text += " " + Quote(node.value);
+	if (node.integral)
+		text += " int";
+	if (node.id > 0)
+		text += " #" + std::to_string(node.id);
+	if (node.jump >= 0)
+		text += " -> " + std::to_string(node.jump);
+	else if (node.jumpId > 0)
+		text += " -> #" + std::to_string(node.jumpId);
+	text += "\n";
+
+	for (const Node& parameter : node.parameters)
+	{
+		text += std::string(depth * 2 + 2, ' ');
+		AppendText(text, parameter, depth + 1);
+	}
+}
+
+std::string CompilationDump::ToJson()
+{
+	std::string text = "{\n\"tokens\": [";
+	for (size_t i = 0; i < tokens.size(); i++)
+	{
+		const Token& token = tokens[i];
+		text += std::string(i > 0 ? "," : "") + "\n{\"line\": " + std::to_string(token.LineNumber) + ", \"position\": " + std::to_string(token.LinePosition)
+			+ ", \"level\": " + std::to_string(token.Level) + ", \"type\": " + Quote(GetTokenTypeName(token.Type)) + ", \"value\": " + Quote(token.Value) + "}";
+	}
+
+	text += "\n],\n\"stages\": [";
+	for (size_t i = 0; i < stages.size(); i++)
+	{
+		text += std::string(i > 0 ? "," : "") + "\n{\"name\": " + Quote(stages[i].name) + ", \"functions\": [";
+		for (size_t j = 0; j < stages[i].functions.size(); j++)
+		{
+			const Function& function = stages[i].functions[j];
+			text += std::string(j > 0 ? "," : "") + "\n{\"name\": " + Quote(function.name) + ", \"returnType\": " + Quote(function.returnType)
+				+ ", \"parameters\": " + std::to_string(function.parameters) + ", \"pure\": " + (function.pure ? "true" : "false") + ", \"statements\": [";
+			for (size_t k = 0; k < function.statements.size(); k++)
+			{
+				text += std::string(k > 0 ? "," : "") + "\n";
+				AppendJson(text, function.statements[k]);
+			}
+			text += "]}";
+		}
+		text += "]}";
+	}
+
+	text += "\n],\n\"ir\": " + Quote(ir) + ",\n\"timings\": [";
+	for (size_t i = 0; i < timings.size(); i++)
+	{
+		char seconds[32];
+		snprintf(seconds, sizeof(seconds), "%.6f", timings[i].seconds);
+		text += std::string(i > 0 ? "," : "") + "\n{\"name\": " + Quote(timings[i].name) + ", \"seconds\": " + seconds + ", \"nodes\": " + std::to_string(timings[i].nodes) + "}";
+	}
+	return text + "\n]\n}\n";
+}
+
+void CompilationDump::AppendJson(std::string& text, const Node& node)
+{
+	if (node.reference)
+	{
+		text += "{\"ref\": " + std::to_string(node.id) + "}";
+		return;
+	}
+
+	text += "{\"expression\": " + Quote(node.expression);
+	if (!node.value.empty())
+		text += ", \"value\": " + Quote(node.value);
+	if (node.integral)
+		text += ", \"integral\": true";
+	if (node.id > 0)
+		text += ", \"id\": " + std::to_string(node.id);
+	if (node.jump >= 0)
+		text += ", \"jump\": " + std::to_string(node.jump);
+	else if (node.jumpId > 0)
+		text += ", \"jumpRef\": " + std::to_string(node.jumpId);
+
+	if (!node.parameters.empty())
+	{
+		text += ", \"parameters\": [";
+		for (size_t i = 0; i < node.parameters.size(); i++)
+		{
+			if (i > 0)
+				text += ", ";
+			AppendJson(text, node.parameters[i]);
+		}
+		text += "]";
+	}
+	text += "}";
+}
+
+// In double quotes with the escapes of JSON, the text dump uses them too
+std::string CompilationDump::Quote(const std::string& text)
+{
+	std::string quoted = "\"";
+	for (char c : text)
+	{
+		if (c == '"' || c == '\\')
+			quoted += std::string("\\") + c;
+		else if (c == '\n')
+			quoted += "\\n";
+		else if (c == '\t')
+			quoted += "\\t";
+		else if ((unsigned char)c < 0x20)
+		{
+			char escape[8];
+			snprintf(escape, sizeof(escape), "\\u%04x", (unsigned char)c);
+			quoted += escape;
+		}
+		else
+			quoted += c;
+	}
+	return quoted + "\"";
+}
+
+// In the order of MyTokenType.h
+std::string CompilationDump::GetTokenTypeName(MyTokenType type)
+{
+	static const char* names[] = {
+		"KeyIdentifier", "Var", "Array", "MainFunction", "Function", "Identifier", "If", "Else", "ElseIf", "ForLoop", "While", "Return",
+		"Float", "Special", "EOL", "And", "Or", "Separator", "OperatorPlus", "OperatorMinus", "OperatorDivide", "OperatorRaised",
+		"OperatorMultiply", "UniOperatorPlus", "UniOperatorMinus", "GreaterThan", "LowerThan", "GreaterOrEqThan", "LowerOrEqThan",
+		"Equals", "OpenMethod", "CloseMethod", "OpenCurlyBracket", "CloseCurlyBracket", "OpenBracket", "CloseBracket", "Comparator",
+		"Comment",
+		"Void", "FloatReturn", "None",
+		"Stop", "PrintLine",
+		"Cosine", "Sine", "Tangent", "CosineR", "SineR", "TangentR", "Square", "Cube", "Power", "SquareRoot", "CubeRoot", "Degree",
+		"Radiant", "Percent", "Permillage", "CommonLog", "BinaryLog", "NaturalLog", "Log", "Modulo", "Gcd", "Discriminant",
+		"AbcFormula", "Fibonacci", "Pythagoras", "PythagorasH",
+		"Distance", "Velocity", "Time", "AverageVelocity", "Acceleration",
+		"Math_PI", "Math_E",
+		"Import", "ModulePath",
+		"Extended_ASCII"
+	};
+
+	size_t index = (size_t)type;
+	return index < sizeof(names) / sizeof(names[0]) ? names[index] : std::to_string((int)type);
+}
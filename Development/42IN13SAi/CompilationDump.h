@@ -0,0 +1,107 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Compiler.h"
+#include "Token.h"
+
+// What every stage of a compile made, as text to diff or as JSON for tools:
+//
+//   == tokens 51                          == optimized
+//   1:1 Var "var"                         func main void 0
+//   1:4 Identifier "g"                      2 $whileCompare "$less" int -> 7
+//   ...                                         $getVariable "i" int #2
+//   == parsed                                   $value "3"
+//   func main void 0                        3 $assignment
+//     1 $whileLoop -> 4                         $identifier "$sq1_a"
+//         $less                                 #2
+//           $getVariable "i"              == timings
+//           $value "3"                    FunctionInliner 0.000058s 11 nodes
+//
+// A stage is taken when it is added, the later passes change the nodes in
+// place. The statements are numbered per function and a jump shows the
+// number of its target, a node that is used more than once gets #n where it
+// is first shown and is only referred to by #n after that. The functions are
+// sorted by name, the same program gives the same dump but for the times.
+class CompilationDump
+{
+public:
+	CompilationDump();
+	virtual ~CompilationDump();
+
+	void AddTokens(const std::vector<std::shared_ptr<Token>>& tokens);
+
+	// The globals and the functions of the compiler as they are now
+	void AddNodes(std::string stage, Compiler* compiler);
+
+	void AddTiming(PassTiming timing);
+	void AddTimings(const std::vector<PassTiming>& timings);
+
+	// The text of the optimized IR, when it is built
+	void SetIr(std::string text);
+
+	std::string ToText();
+	std::string ToJson();
+
+	static std::string GetTokenTypeName(MyTokenType type);
+
+private:
+	struct Node
+	{
+		std::string expression;
+		std::string value;
+		bool integral = false;
+
+		// #n of a shared node, reference is only the #n of one shown before
+		int id = 0;
+		bool reference = false;
+
+		// The number of the statement it jumps to, or the #n of a node that isn't a statement
+		int jump = -1;
+		int jumpId = 0;
+
+		std::vector<Node> parameters;
+	};
+
+	struct Function
+	{
+		// Empty for the globals
+		std::string name;
+		std::string returnType;
+		int parameters = 0;
+		bool pure = false;
+		std::vector<Node> statements;
+	};
+
+	struct Stage
+	{
+		std::string name;
+		std::vector<Function> functions;
+	};
+
+	std::vector<Token> tokens;
+	std::vector<Stage> stages;
+	std::vector<PassTiming> timings;
+	std::string ir;
+
+	// The statement numbers and the #n of the nodes of one function
+	struct Numbering
+	{
+		std::unordered_map<CompilerNode*, int> statements;
+		std::unordered_map<CompilerNode*, int> uses;
+		std::unordered_map<CompilerNode*, int> ids;
+		std::unordered_map<CompilerNode*, bool> shown;
+	};
+
+	static Function MakeFunction(const std::vector<std::shared_ptr<CompilerNode>>& statements);
+	static Node MakeNode(std::shared_ptr<CompilerNode> node, Numbering& numbering);
+	static void CountUses(std::shared_ptr<CompilerNode> node, Numbering& numbering);
+	static int GetId(CompilerNode* node, Numbering& numbering);
+
+	static void AppendText(std::string& text, const Node& node, int depth);
+	static void AppendJson(std::string& text, const Node& node);
+	static std::string Quote(const std::string& text);
+};
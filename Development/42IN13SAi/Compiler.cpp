@@ -1,12 +1,36 @@
 #include "Compiler.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <boost/filesystem.hpp>
+#include "Builtins.h"
 #include "InternalFunction.h"
 #include "Constant.h"
 #include "Parser.h"
+#include "ControlFlowSimplifier.h"
+#include "ExpressionInterner.h"
+#include "FunctionInliner.h"
+#include "InstructionFuser.h"
+#include "IntegerTypeInference.h"
+#include "LoopInvariantHoister.h"
+#include "PartialEvaluator.h"
+#include "PurityAnalysis.h"
+#include "StrengthReducer.h"
+#include "TailCallEliminator.h"
+#include "IrBuilder.h"
+#include "IrPassManager.h"
+#include "IrConstantPropagation.h"
+#include "IrDeadCodeElimination.h"
 
 Compiler::Compiler(std::vector<std::shared_ptr<Token>> tokens) : tokenizerTokens(tokens)
 {
 }
 
+Compiler::Compiler(std::vector<std::shared_ptr<Token>> tokens, CompilerOptions options) : tokenizerTokens(tokens), options(options)
+{
+}
+
 Compiler::~Compiler()
 {
 }
@@ -14,11 +38,650 @@ Compiler::~Compiler()
 //keep parsing as long as there are tokens
 void Compiler::Compile()
 {
-	while (currentIndex != tokenizerTokens.size() - 1)
+	StartPass();
+	if (!CompileFunctionBodies())
+	{
+		while (currentIndex != (int)tokenizerTokens.size() - 1)
+		{
+			currentSubroutine = Subroutine();
+			ParseFunctionOrGlobal();
+		}
+	}
+	CheckModuleFunctions();
+	EndPass("Parser");
+
+	// What the compile took from the last one
+	std::string report = cache != nullptr ? cache->GetReport() : "";
+	if (!report.empty())
+		Log(report);
+}
+
+// Parse the whole program like Compile does, for its diagnostics only. The
+// statements aren't kept, the expressions are made of shared nodes that only
+// hold what the checks of the parser look at and nothing is optimized:
+//
+//   var x = a + f(b | 2);    Compile: $assignment($identifier x, $add(a, $functionCall(f, b, 2)))
+//                            Check:   a, b and f looked up, the call f with 2 arguments kept
+//
+// The calls are checked after the parse, a function can be called before it
+// is defined. A call of a function that doesn't exist or with another number
+// of arguments than it has parameters is an error here, the compile leaves it
+// to the VirtualMachine. Nothing is shared with other compilers, a check can
+// run on a thread of its own while the program is edited.
+void Compiler::Check()
+{
+	checking = true;
+	while (currentIndex != (int)tokenizerTokens.size() - 1)
 	{
 		currentSubroutine = Subroutine();
 		ParseFunctionOrGlobal();
 	}
+	currentSubroutine = Subroutine();
+
+	CheckModuleFunctions();
+	CheckCalls();
+}
+
+void Compiler::CheckCalls()
+{
+	for (const Call& call : calls)
+	{
+		Subroutine* subroutine = subroutineTable.GetSubroutine(call.name);
+		if (subroutine == nullptr)
+			subroutine = FindModuleSubroutine(call.name);
+		if (subroutine == nullptr)
+			Diag(ExceptionEnum::err_unkown_function, call.line, 0) << call.name;
+		else if (subroutine->GetSymbolTable()->ParameterSize() != call.arguments)
+			Diag(ExceptionEnum::err_wrong_arity, call.line, 0) << call.name << std::to_string(subroutine->GetSymbolTable()->ParameterSize()) << std::to_string(call.arguments);
+	}
+	calls.clear();
+}
+
+bool Compiler::IsChecking()
+{
+	return checking;
+}
+
+void Compiler::AddCall(std::string name, int arguments, int line)
+{
+	calls.push_back({ name, arguments, line });
+}
+
+void Compiler::SetModules(std::map<std::string, std::shared_ptr<Module>> p_modules)
+{
+	modules = p_modules;
+}
+
+void Compiler::SetExported(bool p_exported)
+{
+	exported = p_exported;
+}
+
+// An import of a module the ModuleLoader loaded, its globals are known from here on
+// and its functions can be called. Its nodes are added by Link after the passes.
+void Compiler::ImportModule(std::string file, int line)
+{
+	auto found = modules.find(file);
+	if (found == modules.end())
+		Diag(ExceptionEnum::err_module_import, line, 0) << file << "it isn't loaded";
+	else if (found->second->program == nullptr)
+		Diag(ExceptionEnum::err_module_import, line, 0) << file << found->second->error;
+	else
+		AddModule(found->second, line, file);
+}
+
+// A module after the ones it imports, one imported twice is added once
+void Compiler::AddModule(std::shared_ptr<Module> module, int line, std::string file)
+{
+	for (auto& linked : linkedModules)
+	{
+		if (linked.module == module)
+			return;
+	}
+
+	// The path of an import of a module starts at the directory of that module
+	for (auto import : module->imports)
+	{
+		boost::filesystem::path path(import.first);
+		if (path.is_relative())
+			path = boost::filesystem::path(file).parent_path() / path;
+		AddModule(import.second, line, path.generic_string());
+	}
+
+	for (Symbol* symbol : module->program->symbolTable.GetAllSymbolVector())
+	{
+		if (!symbolTable.HasSymbol(symbol->name))
+			symbolTable.AddSymbol(*symbol);
+		externalNames.push_back(symbol->name);
+	}
+
+	for (Subroutine* subroutine : module->program->subroutineTable.GetSubroutineVector())
+	{
+		for (Symbol* symbol : subroutine->GetSymbolTable()->GetAllSymbolVector())
+			externalNames.push_back(symbol->name);
+	}
+
+	linkedModules.push_back({ module, line, file });
+}
+
+// A function of a module with the name of one of the program, or of a module before it
+void Compiler::CheckModuleFunctions()
+{
+	for (size_t i = 0; i < linkedModules.size(); i++)
+	{
+		for (Subroutine* subroutine : linkedModules[i].module->program->subroutineTable.GetSubroutineVector())
+		{
+			bool defined = subroutineTable.GetSubroutine(subroutine->atom) != nullptr;
+			for (size_t j = 0; j < i && !defined; j++)
+				defined = linkedModules[j].module->program->subroutineTable.GetSubroutine(subroutine->atom) != nullptr;
+			if (defined)
+				Diag(ExceptionEnum::err_module_function_defined, linkedModules[i].line, 0) << subroutine->name << linkedModules[i].file;
+		}
+	}
+}
+
+Subroutine* Compiler::FindModuleSubroutine(std::string name)
+{
+	for (auto& linked : linkedModules)
+	{
+		Subroutine* subroutine = linked.module->program->subroutineTable.GetSubroutine(name);
+		if (subroutine != nullptr)
+			return subroutine;
+	}
+	return nullptr;
+}
+
+// Add the functions of the modules and their global statements before the ones of the
+// program, a module runs its globals before the modules that import it do
+void Compiler::Link()
+{
+	if (linkedModules.empty())
+		return;
+
+	std::list<std::shared_ptr<CompilerNode>> moduleNodes;
+	int functions = 0;
+	for (auto& linked : linkedModules)
+	{
+		CompiledProgram* program = linked.module->program.get();
+		for (Subroutine* subroutine : program->subroutineTable.GetSubroutineVector())
+		{
+			if (subroutineTable.GetSubroutine(subroutine->atom) != nullptr)
+				continue;
+
+			subroutineTable.AddSubroutine(*subroutine);
+			functions++;
+		}
+		moduleNodes.insert(moduleNodes.end(), program->compilerNodes.begin(), program->compilerNodes.end());
+	}
+	compilerNodes.splice(compilerNodes.begin(), moduleNodes);
+
+	Log("Modules: linked " + std::to_string(linkedModules.size()) + " modules with " + std::to_string(functions) + " functions");
+}
+
+// Parse the globals and find the func blocks on this thread, take the blocks
+// that didn't change from the cache and parse the others on their own
+// Compiler on a thread each. Returns false, with nothing parsed, when a block
+// can't be parsed on its own or something has a diagnostic, the sequential
+// compile gives the diagnostics in their order.
+bool Compiler::CompileFunctionBodies()
+{
+	int threadCount = options.parseThreads > 0 ? options.parseThreads : (int)std::thread::hardware_concurrency();
+	if (threadCount <= 1 && cache == nullptr)
+		return false;
+
+	DiagnosticsEngine globalDiagnostics(1);
+	DiagnosticsEngine* reportDiagnostics = diagnostics;
+	std::vector<FunctionBody> bodies;
+	bool found = true;
+	uint64_t globalsHash = 0;
+	int globalsHashed = 0;
+	diagnostics = &globalDiagnostics;
+	try
+	{
+		while (found && currentIndex != (int)tokenizerTokens.size() - 1)
+		{
+			currentSubroutine = Subroutine();
+			MyTokenType type = PeekNext()->Type;
+			if (type == MyTokenType::Function || type == MyTokenType::MainFunction)
+			{
+				// A body sees the globals declared before it, like it does in the sequential compile
+				FunctionBody body;
+				body.start = currentIndex + 1;
+				body.end = FindBodyEnd(body.start);
+				body.globals = symbolTable.Size();
+				found = body.end >= 0;
+				if (found && cache != nullptr)
+					body.fingerprint = IncrementalCache::GetFingerprint(tokenizerTokens, body.start, body.end, globalsHash);
+				currentIndex = body.end;
+				bodies.push_back(body);
+			}
+			else
+			{
+				ParseGlobalStatement();
+
+				// The names and types the bodies after it can see
+				if (cache != nullptr && symbolTable.Size() > globalsHashed)
+				{
+					std::vector<Symbol*> symbols = symbolTable.GetAllSymbolVector();
+					for (; globalsHashed < (int)symbols.size(); globalsHashed++)
+						globalsHash = IncrementalCache::HashSymbol(globalsHash, symbols[globalsHashed]);
+				}
+			}
+		}
+	}
+	catch (const std::exception&)
+	{
+		found = false;
+	}
+	diagnostics = reportDiagnostics;
+
+	if (!found || hasExceptions || globalDiagnostics.HasDiagnostics() || bodies.empty() || (cache == nullptr && bodies.size() < 2))
+	{
+		Reset();
+		return false;
+	}
+
+	std::vector<FunctionBody*> changed;
+	for (FunctionBody& body : bodies)
+	{
+		if (cache != nullptr)
+			body.reused = cache->FindFunction(body.fingerprint, tokenizerTokens[body.start]->LineNumber, body.reusedLines);
+		if (body.reused == nullptr)
+			changed.push_back(&body);
+	}
+
+	// The threads take the next body until there are none left
+	std::vector<Symbol*> globals = symbolTable.GetAllSymbolVector();
+	std::atomic<size_t> next(0);
+	auto parseBodies = [this, &changed, &globals, &next]() {
+		for (size_t i = next++; i < changed.size(); i = next++)
+			ParseBody(*changed[i], globals);
+	};
+
+	threadCount = std::max(1, std::min(threadCount, (int)changed.size()));
+	std::vector<std::thread> threads;
+	for (int i = 1; i < threadCount; i++)
+		threads.push_back(std::thread(parseBodies));
+	parseBodies();
+	for (std::thread& thread : threads)
+		thread.join();
+
+	// Merge in the order of the source, a function defined twice is reported by the sequential compile
+	for (FunctionBody& body : bodies)
+	{
+		if (body.reused != nullptr)
+		{
+			if (subroutineTable.GetSubroutine(body.reused->atom) != nullptr)
+			{
+				Reset();
+				return false;
+			}
+
+			subroutineTable.AddSubroutine(*body.reused);
+			lines.insert(body.reusedLines.begin(), body.reusedLines.end());
+			continue;
+		}
+
+		std::vector<Subroutine*> subroutines = body.compiler->subroutineTable.GetSubroutineVector();
+		if (!body.parsed || subroutines.size() != 1 || subroutineTable.GetSubroutine(subroutines[0]->atom) != nullptr)
+		{
+			Reset();
+			return false;
+		}
+
+		// The cache gets a copy, the passes change the nodes of this compile
+		if (cache != nullptr)
+			cache->StoreFunction(body.fingerprint, subroutines[0], tokenizerTokens[body.start]->LineNumber, body.compiler->lines, body.seconds);
+
+		subroutineTable.AddSubroutine(*subroutines[0]);
+		lines.insert(body.compiler->lines.begin(), body.compiler->lines.end());
+		body.compiler = nullptr;
+	}
+
+	currentSubroutine = Subroutine();
+	if (threadCount > 1)
+		Log("Parallel parse: " + std::to_string(changed.size()) + " function bodies on " + std::to_string(threadCount) + " threads");
+	return true;
+}
+
+// The index of the ] that closes the func block starting at start, -1 when it has none
+int Compiler::FindBodyEnd(int start)
+{
+	int index = start;
+	while (index < (int)tokenizerTokens.size() && tokenizerTokens[index]->Type != MyTokenType::OpenMethod)
+		index++;
+	if (index == (int)tokenizerTokens.size())
+		return -1;
+
+	std::shared_ptr<Token> partner = tokenizerTokens[index]->Partner.lock();
+	while (index < (int)tokenizerTokens.size() && tokenizerTokens[index] != partner)
+		index++;
+	return partner != nullptr && index < (int)tokenizerTokens.size() ? index : -1;
+}
+
+// Parse one func block on a Compiler of its own, with its tokens and a copy of the globals before it
+void Compiler::ParseBody(FunctionBody& body, const std::vector<Symbol*>& globals)
+{
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	std::vector<std::shared_ptr<Token>> tokens(tokenizerTokens.begin() + body.start, tokenizerTokens.begin() + body.end + 1);
+	body.compiler = std::make_shared<Compiler>(tokens, options);
+	body.compiler->diagnostics = &body.diagnostics;
+	for (int i = 0; i < body.globals; i++)
+		body.compiler->symbolTable.AddSymbol(*globals[i]);
+
+	try
+	{
+		Parser(body.compiler.get()).ParseFunction();
+		body.parsed = body.compiler->currentIndex == (int)tokens.size() - 1 && !body.compiler->hasExceptions && !body.diagnostics.HasDiagnostics();
+	}
+	catch (const std::exception&)
+	{
+		body.parsed = false;
+	}
+	body.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Back to before the compile
+void Compiler::Reset()
+{
+	compilerNodes.clear();
+	symbolTable = SymbolTable();
+	subroutineTable = SubroutineTable();
+	currentSubroutine = Subroutine();
+	lines.clear();
+	linkedModules.clear();
+	externalNames.clear();
+	currentIndex = -1;
+	hasExceptions = false;
+}
+
+// Run the optimization passes over the globals and every subroutine.
+// Only call this when the compile has no exceptions.
+void Compiler::Optimize()
+{
+	// On the nodes as they were parsed, every statement still has its line
+	if (options.evaluateCalls)
+	{
+		StartPass();
+		EvaluateCalls();
+		EndPass("PartialEvaluator");
+	}
+
+	// A function without its tail calls may be small enough to inline
+	if (options.eliminateTailCalls)
+	{
+		StartPass();
+		TailCallEliminator eliminator;
+
+		for (Subroutine* subroutine : subroutineTable.GetSubroutineVector())
+			eliminator.Eliminate(subroutine);
+
+		Log(eliminator.GetReport());
+		EndPass("TailCallEliminator");
+	}
+
+	// Before the other passes, the inlined bodies are optimized with their caller
+	if (options.inlineFunctions)
+	{
+		StartPass();
+		FunctionInliner inliner(&symbolTable, &subroutineTable, options.inlineLimit);
+		inliner.Inline();
+
+		for (std::string message : inliner.GetLog())
+			Log(message);
+		EndPass("FunctionInliner");
+	}
+
+	// Before the fuser, a compare with a hoisted operand can still be fused
+	if (options.hoistInvariants)
+	{
+		StartPass();
+		LoopInvariantHoister hoister(&subroutineTable);
+
+		for (Subroutine* subroutine : subroutineTable.GetSubroutineVector())
+			hoister.Hoist(subroutine);
+
+		Log(hoister.GetReport());
+		EndPass("LoopInvariantHoister");
+	}
+
+	// Before the fuser, a folded builtin can be the constant of a fused add
+	if (options.reduceStrength)
+	{
+		StartPass();
+		StrengthReducer reducer(options.fastMath, options.numericMode);
+
+		for (std::shared_ptr<CompilerNode>& node : compilerNodes)
+			node = reducer.ReduceStatement(node);
+
+		for (Subroutine* subroutine : subroutineTable.GetSubroutineVector())
+			reducer.Reduce(subroutine->GetCompilerNodeCollection());
+
+		Log(reducer.GetReport());
+		EndPass("StrengthReducer");
+	}
+
+	if (options.fuseInstructions)
+	{
+		StartPass();
+		InstructionFuser fuser;
+
+		for (std::shared_ptr<CompilerNode>& node : compilerNodes)
+			node = fuser.FuseStatement(node);
+
+		for (Subroutine* subroutine : subroutineTable.GetSubroutineVector())
+			fuser.Fuse(subroutine->GetCompilerNodeCollection());
+
+		Log(fuser.GetReport());
+		EndPass("InstructionFuser");
+	}
+
+	// After the passes that add jumps, a fused branch can be threaded like the others
+	if (options.simplifyControlFlow)
+	{
+		StartPass();
+		ControlFlowSimplifier simplifier;
+
+		for (Subroutine* subroutine : subroutineTable.GetSubroutineVector())
+			simplifier.Simplify(subroutine);
+
+		Log(simplifier.GetReport());
+		EndPass("ControlFlowSimplifier");
+	}
+
+	// On the fused nodes, those are the ones the VirtualMachine runs
+	if (options.inferIntegers)
+	{
+		StartPass();
+		IntegerTypeInference inference(&subroutineTable);
+		for (std::string name : externalNames)
+			inference.AddExternal(name);
+
+		// The programs that import a module can write its globals and pass a fraction to its parameters
+		if (exported)
+		{
+			for (Symbol* symbol : symbolTable.GetAllSymbolVector())
+				inference.AddExternal(symbol->name);
+
+			for (Subroutine* subroutine : subroutineTable.GetSubroutineVector())
+			{
+				for (Symbol* symbol : subroutine->GetSymbolTable()->GetAllSymbolVector())
+				{
+					if (symbol->kind == SymbolKind::Parameter)
+						inference.AddExternal(symbol->name);
+				}
+			}
+		}
+		inference.Infer(compilerNodes);
+		Log(inference.GetReport());
+		EndPass("IntegerTypeInference");
+	}
+
+	// After the integral flags are set, a shared node has the same one in every statement
+	if (options.internExpressions)
+	{
+		StartPass();
+		ExpressionInterner interner(&subroutineTable);
+		interner.Intern(compilerNodes);
+		Log(interner.GetReport());
+		EndPass("ExpressionInterner");
+	}
+
+	// On the final nodes, the VirtualMachine can remember the results of the pure functions
+	if (options.analyzePurity)
+	{
+		StartPass();
+		PurityAnalysis purity(&subroutineTable);
+		purity.Analyze();
+		for (std::string message : purity.GetLog())
+			Log(message);
+		EndPass("PurityAnalysis");
+	}
+
+	// The modules were optimized on their own, a module is linked by the program that runs it
+	if (!exported && !linkedModules.empty())
+	{
+		StartPass();
+		Link();
+		EndPass("Link");
+	}
+
+	if (options.buildIr)
+	{
+		StartPass();
+		BuildIr();
+		EndPass("IrBuilder");
+	}
+}
+
+// Replace calls of pure functions with constant arguments by their results.
+// A global call that would throw can never run without an exception, so that
+// is an error, in a function it may never be reached and it is only logged.
+void Compiler::EvaluateCalls()
+{
+	PurityAnalysis purity(&subroutineTable);
+	purity.Analyze();
+
+	PartialEvaluator evaluator(&subroutineTable, &purity, options.evaluationBudget, options.numericMode);
+	for (std::shared_ptr<CompilerNode>& node : compilerNodes)
+	{
+		std::shared_ptr<CompilerNode> replacement = evaluator.EvaluateStatement(node, nullptr);
+		if (replacement != node)
+		{
+			lines[replacement.get()] = GetLine(node.get());
+			node = replacement;
+		}
+	}
+
+	for (Subroutine* subroutine : subroutineTable.GetSubroutineVector())
+	{
+		std::map<CompilerNode*, std::shared_ptr<CompilerNode>> replacements;
+		evaluator.Evaluate(subroutine, replacements);
+		for (auto replacement : replacements)
+			lines[replacement.second.get()] = GetLine(replacement.first);
+	}
+
+	for (PartialEvaluator::Failure failure : evaluator.GetFailures())
+	{
+		bool global = std::find(compilerNodes.begin(), compilerNodes.end(), failure.statement) != compilerNodes.end();
+		int line = GetLine(failure.statement.get());
+		if (!global)
+			Log("Not evaluated: " + failure.call + " on line " + std::to_string(line) + ", " + PartialEvaluator::GetErrorText(failure.error));
+		else if (failure.error == JitError::DivideByZero || failure.error == JitError::DivisionByZero)
+			Diag(ExceptionEnum::err_zero_divide, line, 0);
+		else
+			Diag(ExceptionEnum::err_constant_evaluation, line, 0) << failure.call << PartialEvaluator::GetErrorText(failure.error);
+	}
+
+	Log(evaluator.GetReport());
+}
+
+// Remember the line of the last node of the statement that was just parsed
+void Compiler::MarkLine(int line)
+{
+	if (checking)
+		return;
+
+	std::shared_ptr<CompilerNode> node;
+	if (currentSubroutine.isEmpty)
+		node = compilerNodes.empty() ? nullptr : compilerNodes.back();
+	else if (currentSubroutine.GetCompilerNodeCollection()->size() > 0)
+		node = currentSubroutine.GetCompilerNodeCollection()->GetTailData();
+
+	if (node != nullptr && lines.count(node.get()) == 0)
+		lines[node.get()] = line;
+}
+
+int Compiler::GetLine(CompilerNode* node)
+{
+	auto line = lines.find(node);
+	return line != lines.end() ? line->second : 0;
+}
+
+// Build the IR from the (fused) nodes and optimize it
+void Compiler::BuildIr()
+{
+	IrBuilder builder(&symbolTable, &subroutineTable, compilerNodes);
+	irModule = builder.Build();
+	if (irModule == nullptr)
+	{
+		for (std::string error : builder.GetErrors())
+			Log("IR: " + error);
+		return;
+	}
+
+	IrPassManager passManager;
+	passManager.SetVerify(options.verifyIr);
+	passManager.AddPass(std::unique_ptr<IrPass>(new IrConstantPropagation(options.numericMode)));
+	passManager.AddPass(std::unique_ptr<IrPass>(new IrDeadCodeElimination()));
+
+	bool valid = passManager.Run(*irModule);
+	for (std::string message : passManager.GetLog())
+		Log("IR " + message);
+
+	if (!valid)
+	{
+		for (std::string error : passManager.GetErrors())
+			Log("IR: " + error);
+		irModule = nullptr;
+	}
+}
+
+void Compiler::Log(std::string message)
+{
+	compileLog.push_back(message);
+}
+
+void Compiler::StartPass()
+{
+	passStart = std::chrono::steady_clock::now();
+	passNodes = CompilerNode::GetCreatedCount();
+}
+
+void Compiler::EndPass(std::string name)
+{
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - passStart).count();
+	passTimings.push_back({ name, seconds, CompilerNode::GetCreatedCount() - passNodes });
+}
+
+std::vector<PassTiming> Compiler::GetPassTimings()
+{
+	return passTimings;
+}
+
+std::vector<std::string> Compiler::GetCompileLog()
+{
+	return compileLog;
+}
+
+std::shared_ptr<IrModule> Compiler::GetIrModule()
+{
+	return irModule;
+}
+
+void Compiler::SetIncrementalCache(IncrementalCache* p_cache)
+{
+	cache = p_cache;
 }
 
 
@@ -94,6 +757,11 @@ Symbol* Compiler::GetSymbol(std::string name)
 	return symbolTable.GetSymbol(name);
 }
 
+Symbol* Compiler::GetSymbol(Atom atom)
+{
+	return symbolTable.GetSymbol(atom);
+}
+
 // Set the currentSubroutine
 void Compiler::SetSubroutine(Subroutine subroutine)
 {
@@ -115,6 +783,9 @@ void Compiler::AddSymbol(Symbol symbol)
 // Add a compiler node
 void Compiler::AddCompilerNode(std::shared_ptr<CompilerNode> node)
 {
+	if (checking)
+		return;
+
 	std::shared_ptr<CompilerNode> sNode = std::shared_ptr<CompilerNode>(node);
 	compilerNodes.push_back(sNode);
 }
@@ -124,6 +795,11 @@ bool Compiler::HasSymbol(std::string symbolName)
 	return symbolTable.HasSymbol(symbolName);
 }
 
+bool Compiler::HasSymbol(Atom symbolAtom)
+{
+	return symbolTable.HasSymbol(symbolAtom);
+}
+
 // Match the next token with the given type
 void Compiler::Match(MyTokenType type)
 {
@@ -176,10 +852,15 @@ void Compiler::ParseFunctionOrGlobal()
 // A global can only be a variable thats why it can only be an assignment.
 void Compiler::ParseGlobalStatement()
 {
+	int line = PeekNext()->LineNumber;
 	switch (PeekNext()->Type)
 	{
 	case MyTokenType::Var:
 		Parser(this).ParseAssignmentStatement(false);
+		MarkLine(line);
+		break;
+	case MyTokenType::Import:
+		Parser(this).ParseImport();
 		break;
 	default:
         throw VariableNotFoundException("A VariableNotFoundException occured at line " + std::to_string(PeekNext()->LineNumber) + " on position " + std::to_string(PeekNext()->LinePosition) + ".");
@@ -190,6 +871,7 @@ void Compiler::ParseGlobalStatement()
 // Parse statements.
 void Compiler::ParseStatement()
 {
+	int line = PeekNext()->LineNumber;
 	switch (PeekNext()->Type)
 	{
     case MyTokenType::ElseIf:
@@ -201,9 +883,11 @@ void Compiler::ParseStatement()
 		break;
 	case MyTokenType::Identifier:
 		ParseFunctionOrAssignment();
+		MarkLine(line);
 		break;
 	case MyTokenType::Var:
 		Parser(this).ParseAssignmentStatement(false);
+		MarkLine(line);
 		break;
 	case MyTokenType::MainFunction:
 	case MyTokenType::Function:
@@ -211,24 +895,16 @@ void Compiler::ParseStatement()
 		break;
 	case MyTokenType::Return:	
 		Parser(this).ParseReturn();
-		break;
-	case MyTokenType::PrintLine:
-		if (!currentSubroutine.isEmpty)
-			currentSubroutine.AddCompilerNode(std::shared_ptr<CompilerNode>(InternalFunction(this).GetInternalFunction(MyTokenType::PrintLine)));
-		Match(MyTokenType::EOL);
-		break;
-	case MyTokenType::Stop:
-		if (!currentSubroutine.isEmpty)
-			currentSubroutine.AddCompilerNode(std::shared_ptr<CompilerNode>(InternalFunction(this).GetInternalFunction(MyTokenType::Stop)));
-			Match(MyTokenType::EOL);
-		break;
-	case MyTokenType::AbcFormula:
-		if (!currentSubroutine.isEmpty)
-			currentSubroutine.AddCompilerNode(std::shared_ptr<CompilerNode>(InternalFunction(this).GetInternalFunction(MyTokenType::AbcFormula)));
-		Match(MyTokenType::EOL);
+		MarkLine(line);
 		break;
 	default:
-            Diag(ExceptionEnum::err_var_not_found) << PeekNext()->Value << PeekNext()->LineNumber;
+		if (IsInternalStatement(PeekNext()->Type))
+		{
+			ParseInternalStatement(PeekNext()->Type);
+			Match(MyTokenType::EOL);
+			break;
+		}
+            Diag(ExceptionEnum::err_var_not_found, PeekNext()->LineNumber, PeekNext()->LinePosition) << PeekNext()->Value;
             SkipUntil(MyTokenType::EOL);
 		break;
 	}
@@ -236,64 +912,39 @@ void Compiler::ParseStatement()
 
 void Compiler::ParseFunctionOrAssignment()
 {
-	std::shared_ptr<Token> temp = std::shared_ptr<Token>(new Token(GetNext()));
-	if (PeekNext()->Type == MyTokenType::OpenBracket)
-	{
-		tokenizerTokens.insert(tokenizerTokens.begin(), temp);
+	// Look past the identifier and step back, the statement starts with it
+	GetNext();
+	bool isCall = PeekNext()->Type == MyTokenType::OpenBracket;
+	currentIndex--;
+
+	if (isCall)
 		Parser(this).ParseFunctionCall();
-	}
 	else
-	{
-		tokenizerTokens.insert(tokenizerTokens.begin(), temp);
 		Parser(this).ParseAssignmentStatement(false);
-	}
+}
+
+// prnt, stop and abc as a statement, outside a function only the EOL is matched
+void Compiler::ParseInternalStatement(MyTokenType type)
+{
+	if (currentSubroutine.isEmpty)
+		return;
+
+	std::shared_ptr<CompilerNode> node = InternalFunction(this).GetInternalFunction(type);
+	if (!checking)
+		currentSubroutine.AddCompilerNode(node);
 }
 
 // Internal functions
 bool Compiler::IsInternalFunction(MyTokenType type)
 {
-	//check if type is an internal function
-	switch (type)
-	{
-		// Default functions
-		case MyTokenType::Stop:
-		case MyTokenType::PrintLine:
-		// Math functions
-		case MyTokenType::Cosine:
-		case MyTokenType::Sine:
-		case MyTokenType::Tangent:
-		case MyTokenType::CosineR:
-		case MyTokenType::SineR:
-		case MyTokenType::TangentR:
-		case MyTokenType::Square:
-		case MyTokenType::Cube:
-		case MyTokenType::Power:
-		case MyTokenType::SquareRoot:
-		case MyTokenType::CubeRoot:
-		case MyTokenType::Degree:
-		case MyTokenType::Radiant:
-		case MyTokenType::Percent:
-		case MyTokenType::Permillage:
-		case MyTokenType::CommonLog:
-		case MyTokenType::BinaryLog:
-		case MyTokenType::NaturalLog:
-		case MyTokenType::Log:
-		case MyTokenType::Modulo:
-		case MyTokenType::Gcd:
-		case MyTokenType::Fibonacci:
-		case MyTokenType::Pythagoras:
-		case MyTokenType::PythagorasH:
-		case MyTokenType::Distance:
-		case MyTokenType::Velocity:
-		case MyTokenType::Time:
-		case MyTokenType::AverageVelocity:
-		case MyTokenType::Acceleration:
-		case MyTokenType::Discriminant:
-		case MyTokenType::AbcFormula:
-			return true;
-		default:
-			return false;
-	}
+	return Builtins::Find(type) != nullptr;
+}
+
+// prnt, stop and abc, they give no value
+bool Compiler::IsInternalStatement(MyTokenType type)
+{
+	const Builtin* builtin = Builtins::Find(type);
+	return builtin != nullptr && builtin->statement;
 }
 
 // Internal functions
@@ -367,10 +1018,15 @@ std::string Compiler::TokenToString(MyTokenType type)
 	}
 }
 
-DiagnosticBuilder Compiler::Diag(ExceptionEnum exception)
+DiagnosticBuilder Compiler::Diag(ExceptionEnum exception, int line, int position)
 {
     hasExceptions = true;
-    return DiagnosticBuilder(exception);
+    return DiagnosticBuilder(exception, line, position, diagnostics);
+}
+
+void Compiler::SetDiagnostics(DiagnosticsEngine* p_diagnostics)
+{
+	diagnostics = p_diagnostics;
 }
 
 bool Compiler::HasExceptions()
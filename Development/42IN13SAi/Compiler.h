@@ -1,6 +1,9 @@
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <list>
+#include <map>
 #include <iterator>
 #include <string>
 #include <memory>
@@ -12,6 +15,10 @@
 #include "SymbolTable.h"
 #include "Subroutine.h"
 #include "SubroutineTable.h"
+#include "CompilerOptions.h"
+#include "IrModule.h"
+#include "IncrementalCache.h"
+#include "ModuleLoader.h"
 
 #include "MissingTokenException.h"
 #include "StatementNotFoundException.h"
@@ -22,6 +29,16 @@
 #include "IdentifierException.h"
 #include "UnexpectedParameterException.h"
 #include "DiagnosticsBuilder.h"
+#include "DiagnosticsEngine.h"
+
+// The wall time of a phase of the compile and the CompilerNodes it made, the
+// nodes are only counted while CompilerNode::SetCounting is on
+struct PassTiming
+{
+	std::string name;
+	double seconds;
+	uint64_t nodes;
+};
 
 class InternalFunction;
 class Parser;
@@ -29,10 +46,17 @@ class Compiler
 {
 public:
 	Compiler(std::vector<std::shared_ptr<Token>> tokens);
+	Compiler(std::vector<std::shared_ptr<Token>> tokens, CompilerOptions options);
 	virtual ~Compiler();
 
 	// Functions
 	void Compile();
+	void Optimize();
+
+	// Parse for the diagnostics only, without the nodes, see Check in Compiler.cpp
+	void Check();
+	bool IsChecking();
+	void AddCall(std::string name, int arguments, int line);
     
 	std::shared_ptr<Token> PeekNext();
 	Token GetNext();
@@ -49,12 +73,15 @@ public:
     void AddCompilerNode(std::shared_ptr<CompilerNode> node);
     
 	bool HasSymbol(std::string symbolName);
+	bool HasSymbol(Atom symbolAtom);
     Symbol* GetSymbol(std::string name);
+    Symbol* GetSymbol(Atom atom);
     void AddSymbol(Symbol symbol);
     
 	void ParseGlobalStatement();
 	void ParseStatement();
 	bool IsInternalFunction(MyTokenType type);
+	bool IsInternalStatement(MyTokenType type);
 	bool IsConstant(MyTokenType type);
 	CompilerNode ParseInternalFunction();
 	CompilerNode ParseConstant();
@@ -67,14 +94,38 @@ public:
 	SymbolTable* GetSymbolTable();
 	SubroutineTable* GetSubroutineTable();
 	std::list<std::shared_ptr<CompilerNode>> GetCompilerNodes();
+
+	// Messages of the optimization passes
+	void Log(std::string message);
+	std::vector<std::string> GetCompileLog();
+
+	// The parse and every pass that ran, in order
+	std::vector<PassTiming> GetPassTimings();
+
+	// The optimized IR, nullptr when it isn't built or can't be built
+	std::shared_ptr<IrModule> GetIrModule();
+
+	// The function bodies of the last compile, an unchanged body isn't parsed again
+	void SetIncrementalCache(IncrementalCache* p_cache);
     
     /// Returns a DiagnosticBuilder for the exception occuring
     ///
     /// @see ExceptionEnum.h
-    /// @param token The Token the exception happened on
     /// @param exception The exception that happened
+    /// @param line The line the exception happened on
+    /// @param position The position on the line, 0 when it isn't known
     ///
-    DiagnosticBuilder Diag(ExceptionEnum exception);
+    DiagnosticBuilder Diag(ExceptionEnum exception, int line, int position);
+
+	// Where the diagnostics go, nullptr to print every one to std::clog
+	void SetDiagnostics(DiagnosticsEngine* p_diagnostics);
+
+	// The loaded modules by the file as the imports write it, see ImportModule
+	void SetModules(std::map<std::string, std::shared_ptr<Module>> p_modules);
+
+	// Compile a module to be imported, it isn't linked and the importers can write its names
+	void SetExported(bool p_exported);
+	void ImportModule(std::string file, int line);
 	
 private:
 	// Variables
@@ -85,10 +136,85 @@ private:
 	SymbolTable symbolTable;
 	SubroutineTable subroutineTable;
 	Subroutine currentSubroutine;
+	CompilerOptions options;
+	std::vector<std::string> compileLog;
+	std::vector<PassTiming> passTimings;
+	std::chrono::steady_clock::time_point passStart;
+	uint64_t passNodes = 0;
+	std::shared_ptr<IrModule> irModule;
 	int currentToken = 0;
 	int currentIndex = -1;
+
+	// The line of the statements that are assignments, calls or rets
+	std::map<CompilerNode*, int> lines;
+
+	// Where the diagnostics go instead of std::clog, nullptr to print them
+	DiagnosticsEngine* diagnostics = nullptr;
+
+	IncrementalCache* cache = nullptr;
+
+	// The modules of the imports and the ones they import, each once and after its imports,
+	// with the line of the import. The names the modules have are written by other compiles.
+	struct LinkedModule
+	{
+		std::shared_ptr<Module> module;
+		int line;
+
+		// As it is imported, relative to the program
+		std::string file;
+	};
+
+	std::map<std::string, std::shared_ptr<Module>> modules;
+	std::vector<LinkedModule> linkedModules;
+	std::vector<std::string> externalNames;
+	bool exported = false;
+
+	// While checking the statements aren't kept and the calls are checked after the parse
+	struct Call
+	{
+		std::string name;
+		int arguments;
+		int line;
+	};
+
+	bool checking = false;
+	std::vector<Call> calls;
+
+	// A func block of the source, its tokens from start to end are parsed on a Compiler
+	// of its own or its Subroutine comes from the cache
+	struct FunctionBody
+	{
+		int start;
+		int end;
+		int globals;
+		uint64_t fingerprint;
+		std::shared_ptr<Compiler> compiler;
+		DiagnosticsEngine diagnostics = DiagnosticsEngine(1);
+		bool parsed = false;
+		double seconds = 0;
+		std::shared_ptr<Subroutine> reused;
+		std::map<CompilerNode*, int> reusedLines;
+	};
+
+	bool CompileFunctionBodies();
+	int FindBodyEnd(int start);
+	void ParseBody(FunctionBody& body, const std::vector<Symbol*>& globals);
+	void Reset();
+
+	void EvaluateCalls();
+	void CheckCalls();
+	void AddModule(std::shared_ptr<Module> module, int line, std::string file);
+	void CheckModuleFunctions();
+	Subroutine* FindModuleSubroutine(std::string name);
+	void Link();
+	void MarkLine(int line);
+	void StartPass();
+	void EndPass(std::string name);
+	int GetLine(CompilerNode* node);
+	void BuildIr();
 	void ParseFunctionOrGlobal();
 	void ParseFunctionOrAssignment();
+	void ParseInternalStatement(MyTokenType type);
 	std::string TokenToString(MyTokenType type);
     
     
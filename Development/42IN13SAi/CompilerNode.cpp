@@ -1,29 +1,64 @@
 #include "CompilerNode.h"
 
+std::atomic<bool> CompilerNode::counting(false);
+std::atomic<uint64_t> CompilerNode::created(0);
+
 CompilerNode::CompilerNode(std::string p_expression, std::vector<std::shared_ptr<CompilerNode>> p_nodeParameters, std::shared_ptr<CompilerNode> p_jumpTo, bool condition) : expression(p_expression), nodeParameters(p_nodeParameters), jumpTo(p_jumpTo), condition(condition)
 {
+	Count();
 }
 
 CompilerNode::CompilerNode(std::string p_expression, std::string p_value, bool condition) : expression(p_expression), value(p_value), condition(condition)
 {
+	atom = InternValue(expression, value);
+	Count();
+}
+
+CompilerNode::CompilerNode(std::string p_expression, std::string p_value, Atom p_atom, bool condition) : expression(p_expression), value(p_value), atom(p_atom), condition(condition)
+{
+	if (atom == 0)
+		atom = InternValue(expression, value);
+	Count();
 }
 
 CompilerNode::CompilerNode(std::string p_expression, std::string p_value, std::shared_ptr<CompilerNode> p_jumpTo, bool condition) : expression(p_expression), value(p_value), jumpTo(p_jumpTo), condition(condition)
 {
+	atom = InternValue(expression, value);
+	Count();
+}
+
+CompilerNode::CompilerNode(std::string p_expression, std::string p_value, std::vector<std::shared_ptr<CompilerNode>> p_nodeParameters, std::shared_ptr<CompilerNode> p_jumpTo, bool condition) : expression(p_expression), value(p_value), nodeParameters(p_nodeParameters), jumpTo(p_jumpTo), condition(condition)
+{
+	atom = InternValue(expression, value);
+	Count();
 }
 
 CompilerNode::CompilerNode() : expression(""), condition(condition)
 {
+	Count();
 }
 
-CompilerNode::CompilerNode(const CompilerNode& toCopy) : expression(toCopy.expression), nodeParameters(toCopy.nodeParameters), jumpTo(toCopy.jumpTo), value(toCopy.value), condition(toCopy.condition)
+CompilerNode::CompilerNode(const CompilerNode& toCopy) : expression(toCopy.expression), nodeParameters(toCopy.nodeParameters), jumpTo(toCopy.jumpTo), value(toCopy.value), atom(toCopy.atom), condition(toCopy.condition), integral(toCopy.integral)
 {
-	
+	Count();
 }
 
 CompilerNode::~CompilerNode()
 {
-	//delete jumpTo;
+	// Free the children that go with this node from a list instead of one
+	// destructor inside the other, a long expression is as deep as it is long
+	std::vector<std::shared_ptr<CompilerNode>> pending;
+	pending.swap(nodeParameters);
+	while (!pending.empty())
+	{
+		std::shared_ptr<CompilerNode> node = pending.back();
+		pending.pop_back();
+		if (node != nullptr && node.use_count() == 1)
+		{
+			pending.insert(pending.end(), node->nodeParameters.begin(), node->nodeParameters.end());
+			node->nodeParameters.clear();
+		}
+	}
 }
 
 void CompilerNode::SetJumpTo(std::shared_ptr<CompilerNode> jump)
@@ -46,7 +81,116 @@ std::string CompilerNode::GetValue()
 	return value;
 }
 
+Atom CompilerNode::GetAtom()
+{
+	return atom;
+}
+
+// The value of a node is a name, of a variable or a function, unless it is a
+// number or the operator of a compare the InstructionFuser fused
+Atom CompilerNode::InternValue(const std::string& expression, const std::string& value)
+{
+	if (value.empty() || expression == "$value" || expression == "$compare" || expression == "$ifCompare" || expression == "$whileCompare")
+		return 0;
+	return AtomTable::Intern(value);
+}
+
 std::vector<std::shared_ptr<CompilerNode>> CompilerNode::GetNodeparameters()
 {
 	return nodeParameters;
-}
\ No newline at end of file
+}
+
+// One parameter without copying the others
+std::shared_ptr<CompilerNode> CompilerNode::GetNodeparameter(size_t index)
+{
+	return nodeParameters[index];
+}
+
+void CompilerNode::SetNodeParameters(std::vector<std::shared_ptr<CompilerNode>> parameters)
+{
+	nodeParameters = parameters;
+}
+
+bool CompilerNode::IsIntegral()
+{
+	return integral;
+}
+
+void CompilerNode::SetIntegral(bool p_integral)
+{
+	integral = p_integral;
+}
+
+void CompilerNode::SetCounting(bool p_counting)
+{
+	counting = p_counting;
+}
+
+uint64_t CompilerNode::GetCreatedCount()
+{
+	return created;
+}
+
+std::shared_ptr<CompilerNode> CompilerNode::Rewrite(std::shared_ptr<CompilerNode> node, Visitor visit, Builder build)
+{
+	// The nodes that wait for their parameters, the last one is the one being rewritten
+	struct Frame
+	{
+		std::shared_ptr<CompilerNode> node;
+		std::vector<std::shared_ptr<CompilerNode>> parameters;
+		size_t next;
+		bool changed;
+	};
+	std::vector<Frame> frames;
+	std::shared_ptr<CompilerNode> parent = nullptr;
+	std::shared_ptr<CompilerNode> result;
+
+	while (true)
+	{
+		bool done = true;
+		result = node != nullptr && visit ? visit(node, parent) : nullptr;
+		if (node == nullptr)
+			result = node;
+		else if (result == nullptr)
+		{
+			frames.push_back({ node, node->GetNodeparameters(), 0, false });
+			done = false;
+		}
+
+		// A finished node is a new parameter of the one above it, that one is built after its last
+		while (!frames.empty())
+		{
+			Frame& frame = frames.back();
+			if (done)
+			{
+				if (result != frame.parameters.at(frame.next))
+				{
+					frame.parameters.at(frame.next) = result;
+					frame.changed = true;
+				}
+				frame.next++;
+			}
+
+			if (frame.next < frame.parameters.size())
+				break;
+
+			result = build ? build(frame.node, frame.parameters, frame.changed) : Copy(frame.node, frame.parameters, frame.changed);
+			frames.pop_back();
+			done = true;
+		}
+
+		if (frames.empty())
+			return result;
+
+		node = frames.back().parameters.at(frames.back().next);
+		parent = frames.back().node;
+	}
+}
+
+// What a pass makes of a node when only its parameters changed
+std::shared_ptr<CompilerNode> CompilerNode::Copy(std::shared_ptr<CompilerNode> node, std::vector<std::shared_ptr<CompilerNode>>& parameters, bool changed)
+{
+	if (!changed)
+		return node;
+	return std::make_shared<CompilerNode>(node->GetExpression(), node->GetValue(), parameters, node->GetJumpTo(), false);
+}
@@ -1,19 +1,41 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
+#include <functional>
 #include <string>
 #include <vector>
 #include <memory>
 
+#include "AtomTable.h"
+
 class CompilerNode
 {
 private:
 	std::string	expression;
 	std::string value;
+
+	// The atom of the value when it is a name, 0 for the numbers
+	Atom atom = 0;
+
 	std::vector<std::shared_ptr<CompilerNode>> nodeParameters;
 	std::weak_ptr<CompilerNode> jumpTo;
 	bool condition;
 
+	// Set by the IntegerTypeInference, the operands and the result are always whole numbers
+	bool integral = false;
+
+	static Atom InternValue(const std::string& expression, const std::string& value);
+
+	// The nodes made while counting is on, the dumps show what each pass made
+	static std::atomic<bool> counting;
+	static std::atomic<uint64_t> created;
+	void Count();
+
 public:
+	typedef std::function<std::shared_ptr<CompilerNode>(std::shared_ptr<CompilerNode> node, std::shared_ptr<CompilerNode> parent)> Visitor;
+	typedef std::function<std::shared_ptr<CompilerNode>(std::shared_ptr<CompilerNode> node, std::vector<std::shared_ptr<CompilerNode>>& parameters, bool changed)> Builder;
+
 	CompilerNode(std::string expression, std::vector<std::shared_ptr<CompilerNode>> nodeParameters, std::shared_ptr<CompilerNode> jumpTo, bool condition);
 
 	//properties of compilernode
@@ -23,13 +45,40 @@ public:
     CompilerNode(const CompilerNode& toCopy);
 	CompilerNode(std::string expression, std::vector<CompilerNode> nodeParameters, std::shared_ptr<CompilerNode> jumpTo, bool condition);
     CompilerNode(std::string expression, std::string value, std::shared_ptr<CompilerNode> jumpTo, bool condition);
+	CompilerNode(std::string expression, std::string value, std::vector<std::shared_ptr<CompilerNode>> nodeParameters, std::shared_ptr<CompilerNode> jumpTo, bool condition);
 	CompilerNode(std::string expression, std::string value, bool condition);
+
+	// A node of a name with the atom its token already has, 0 to intern the value
+	CompilerNode(std::string expression, std::string value, Atom atom, bool condition);
 	~CompilerNode();
 
 	void SetJumpTo(std::shared_ptr<CompilerNode> jump);
     std::shared_ptr<CompilerNode> GetJumpTo();
 	std::string GetExpression();
 	std::string GetValue();
+	Atom GetAtom();
 	std::vector<std::shared_ptr<CompilerNode>> GetNodeparameters();
+	std::shared_ptr<CompilerNode> GetNodeparameter(size_t index);
+	void SetNodeParameters(std::vector<std::shared_ptr<CompilerNode>> parameters);
+
+	bool IsIntegral();
+	void SetIntegral(bool p_integral);
+
+	static void SetCounting(bool p_counting);
+	static uint64_t GetCreatedCount();
+
+	// Rewrites an expression like a recursive walk would, with a stack of its own instead of
+	// the one of the thread. visit sees a node before its parameters and gives the node that
+	// takes its place or nullptr to go into the parameters, build gets the node with its new
+	// parameters after them, by default a node with changed parameters is copied. A visit of
+	// nullptr goes into every node
+	static std::shared_ptr<CompilerNode> Rewrite(std::shared_ptr<CompilerNode> node, Visitor visit, Builder build = nullptr);
+	static std::shared_ptr<CompilerNode> Copy(std::shared_ptr<CompilerNode> node, std::vector<std::shared_ptr<CompilerNode>>& parameters, bool changed);
 };
 
+inline void CompilerNode::Count()
+{
+	if (counting.load(std::memory_order_relaxed))
+		created.fetch_add(1, std::memory_order_relaxed);
+}
+
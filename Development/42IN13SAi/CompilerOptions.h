@@ -0,0 +1,58 @@
+#pragma once
+
+#include "NumericPolicy.h"
+
+// Switches for the passes that run over the compilernodes after parsing
+struct CompilerOptions
+{
+	// The threads that parse the func blocks, 0 for one per core and 1 to parse on the calling thread
+	int parseThreads = 0;
+
+	// Run calls of pure functions with constant arguments while compiling
+	bool evaluateCalls = true;
+
+	// Mark the pure functions again on the final nodes, the VirtualMachine only needs it to memoize
+	bool analyzePurity = false;
+
+	// The most statements one evaluated call can run
+	int evaluationBudget = 10000;
+
+	// Turn ret f(...) in f into a jump back to the start of f
+	bool eliminateTailCalls = true;
+
+	// Copy the body of small functions into their callers
+	bool inlineFunctions = true;
+
+	// The most statements a function can have to be inlined
+	int inlineLimit = 8;
+
+	// Move loop-invariant expressions in front of while and frl loops
+	bool hoistInvariants = true;
+
+	// Replace builtins with constant operands by cheaper ones
+	bool reduceStrength = true;
+
+	// Also make the rewrites that can change the last bit of a result
+	bool fastMath = false;
+
+	// The precision the program runs in, constant folding has to use the same one
+	NumericMode numericMode = NumericMode::LongDouble;
+
+	// Replace hot node sequences with fused superinstructions
+	bool fuseInstructions = true;
+
+	// Thread jumps through empty $doNothing nodes and remove the unreachable ones
+	bool simplifyControlFlow = true;
+
+	// Run the whole numbers with the int64 handlers of the VirtualMachine
+	bool inferIntegers = true;
+
+	// Share the identical expressions without side effects as one node
+	bool internExpressions = true;
+
+	// Build the SSA IR of the program and run the IR passes over it
+	bool buildIr = false;
+
+	// Check the IR after every pass
+	bool verifyIr = true;
+};
@@ -0,0 +1,28 @@
+func float third(a)
+[
+	ret a / 3;
+]
+func Main()
+[
+	var a = 7;
+	var b = 0;
+	if (a > 3)
+	[
+		prnt(1);
+	]
+	prnt(third(a));
+	prnt(0.1 + 0.2);
+	prnt(cos(60));
+	prnt(tan(45));
+	prnt(log2(10));
+	prnt(ln(3));
+	prnt(mod(17 | 5));
+	prnt(perc(3 | 40));
+	prnt(deg(1));
+	prnt(pyth(3 | 4));
+	prnt(dis(1 | 5 | 6));
+	prnt(fib(30));
+	prnt(gcd(100 | 75));
+	abc(1 | 5 | 6);
+	prnt(M_PI);
+]
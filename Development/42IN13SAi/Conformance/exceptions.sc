@@ -0,0 +1,8 @@
+func Main()
+[
+	var a = 7;
+	var b = 0;
+	prnt(sqrt(a));
+	prnt(a / b);
+	prnt(a);
+]
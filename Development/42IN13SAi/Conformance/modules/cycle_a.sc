@@ -0,0 +1,6 @@
+import "cycle_b.sc";
+
+func float a(n)
+[
+	ret b(n) + 1;
+]
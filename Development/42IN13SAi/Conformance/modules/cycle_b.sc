@@ -0,0 +1,6 @@
+import "cycle_a.sc";
+
+func float b(n)
+[
+	ret n * 2;
+]
@@ -0,0 +1,6 @@
+import "cycle_a.sc";
+
+func Main()
+[
+	prnt(a(1));
+]
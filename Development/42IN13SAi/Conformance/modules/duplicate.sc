@@ -0,0 +1,12 @@
+import "geometry.sc";
+
+# half comes from library.sc, which geometry.sc imports
+func float half(a)
+[
+	ret a;
+]
+
+func Main()
+[
+	prnt(half(3));
+]
@@ -0,0 +1,13 @@
+import "library.sc";
+
+var scale = 3;
+
+func float area(width | height)
+[
+	ret width * height * scale + offset;
+]
+
+func float radius(diameter)
+[
+	ret half(diameter);
+]
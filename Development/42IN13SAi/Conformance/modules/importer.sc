@@ -0,0 +1,16 @@
+import "library.sc";
+import "geometry.sc";
+
+func Main()
+[
+	prnt(half(7));
+	prnt(clamp(12 | 0 | 10));
+	prnt(area(2 | 4));
+	prnt(radius(9));
+
+	# The globals of a module belong to the program that imports it
+	offset = 0;
+	scale = 0.5;
+	prnt(area(2 | 4));
+	prnt(offset + scale);
+]
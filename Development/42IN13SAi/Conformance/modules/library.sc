@@ -0,0 +1,19 @@
+var offset = 1;
+
+func float half(a)
+[
+	ret a / 2;
+]
+
+func float clamp(a | low | high)
+[
+	if (a < low)
+	[
+		ret low;
+	]
+	if (a > high)
+	[
+		ret high;
+	]
+	ret a;
+]
@@ -0,0 +1,53 @@
+var total = 0;
+
+func float fib(n)
+[
+	if (n < 2)
+	[
+		ret n;
+	]
+	var a = fib(n - 1);
+	var b = fib(n - 2);
+	ret a + b;
+]
+
+func float tally(n)
+[
+	if (n < 1)
+	[
+		ret 0;
+	]
+	var s = tally(n - 1);
+	ret s + n;
+]
+
+func float count(n)
+[
+	frl (var i = 0 | i < n | i++)
+	[
+		total = total + i;
+	]
+	ret n;
+]
+
+func float f(n | acc)
+[
+	if (n < 1)
+	[
+		ret acc;
+	]
+	ret f(n - 1 | acc * n);
+]
+
+func Main()
+[
+	prnt(fib(10));
+	prnt(tally(5));
+	var c = count(2);
+	c = count(3) + c;
+	prnt(c);
+	prnt(total);
+	prnt(f(5 | 1));
+	var x = 3;
+	prnt(x);
+]
@@ -0,0 +1,52 @@
+var calls = 0;
+
+func float fact(n | acc)
+[
+	if (n < 2)
+	[
+		ret acc;
+	]
+	ret fact(n - 1 | acc * n);
+]
+
+func float sum(n | acc)
+[
+	while (n > 1000)
+	[
+		n = n - 1000;
+		acc = acc + 1;
+	]
+	if (n < 1)
+	[
+		ret acc;
+	]
+	ret sum(n - 1 | acc + n);
+]
+
+func float gcd2(a | b)
+[
+	if (b == 0)
+	[
+		ret a;
+	]
+	var r = a - b * 0;
+	if (a > b)
+	[
+		ret gcd2(a - b | b);
+	]
+	ret gcd2(r | b - a);
+]
+
+func Main()
+[
+	var x = fact(10 | 1);
+	prnt(x);
+	x = sum(3000 | 0);
+	prnt(x);
+	x = sum(30 | 0) + 1;
+	prnt(x);
+	x = gcd2(84 | 36);
+	prnt(x);
+	x = gcd2(17 | 5);
+	prnt(x);
+]
@@ -12,6 +12,8 @@ Constant::~Constant()
 
 
 std::shared_ptr<CompilerNode> Constant::getCompilerNode(std::string functionName) {
+	if (compiler->IsChecking())
+		return Parser::GetCheckedTerm("$checked", "");
 	std::vector<std::shared_ptr<CompilerNode>> compiler_nodes;
 	return std::make_shared<CompilerNode>(functionName, compiler_nodes, nullptr, false);
 }
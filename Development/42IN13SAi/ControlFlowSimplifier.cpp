@@ -0,0 +1,229 @@
+#include "ControlFlowSimplifier.h"
+#include <map>
+#include <set>
+
+ControlFlowSimplifier::ControlFlowSimplifier()
+{
+}
+
+ControlFlowSimplifier::~ControlFlowSimplifier()
+{
+}
+
+int ControlFlowSimplifier::Simplify(Subroutine* subroutine)
+{
+	std::shared_ptr<LinkedList> list = subroutine->GetCompilerNodeCollection();
+	std::vector<std::shared_ptr<ListNode>> listNodes;
+	std::map<CompilerNode*, int> nodeIndexes;
+	nodes.clear();
+	targets.clear();
+	for (std::shared_ptr<ListNode> listNode = list->GetHead(); listNode && listNode->GetData(); listNode = listNode->GetNext())
+	{
+		nodeIndexes[listNode->GetData().get()] = (int)nodes.size();
+		listNodes.push_back(listNode);
+		nodes.push_back(listNode->GetData());
+	}
+
+	int count = (int)nodes.size();
+	if (count == 0)
+		return 0;
+
+	// A $doNothing continues at its target, a false condition at the node after it
+	for (int i = 0; i < count; i++)
+	{
+		std::shared_ptr<CompilerNode> jumpTo = nodes[i]->GetJumpTo();
+		if (jumpTo == nullptr)
+		{
+			targets.push_back(-1);
+			continue;
+		}
+
+		// A jump out of the subroutine is left for the VirtualMachine to sort out
+		auto target = nodeIndexes.find(jumpTo.get());
+		if (target == nodeIndexes.end())
+			return 0;
+		targets.push_back(IsJump(nodes[i]) ? target->second : target->second + 1);
+	}
+
+	// Thread the forward jumps through the empty $doNothing nodes, the jumps back are loops
+	for (int i = 0; i < count; i++)
+	{
+		if (targets[i] <= i)
+			continue;
+
+		int target = targets[i];
+		if (IsJump(nodes[i]))
+		{
+			// The last node stays the target of a jump to the end
+			while (target + 1 < count && IsMarker(nodes[target]))
+				target++;
+		}
+		else
+		{
+			while (target < count && IsMarker(nodes[target]))
+				target++;
+		}
+
+		if (target != targets[i])
+		{
+			targets[i] = target;
+			threadedJumps++;
+		}
+
+		if (IsJump(nodes[i]) && nodes[target]->GetExpression() == "$ret")
+		{
+			nodes[i] = std::make_shared<CompilerNode>("$ret", nodes[target]->GetValue(), nodes[target]->GetNodeparameters(), nullptr, false);
+			targets[i] = -1;
+			duplicatedReturns++;
+		}
+	}
+
+	std::vector<bool> reachable = FindReachable();
+	std::vector<bool> keep(count);
+	std::set<int> jumpTargets;
+	for (int i = 0; i < count; i++)
+	{
+		keep[i] = reachable[i] && !IsMarker(nodes[i]);
+		if (reachable[i] && IsJump(nodes[i]))
+			jumpTargets.insert(targets[i]);
+	}
+
+	// The headers of the loops, the only jumps back
+	for (int i = 0; i < count; i++)
+	{
+		if (keep[i] && IsJump(nodes[i]) && targets[i] <= i)
+			keep[targets[i]] = true;
+	}
+
+	// A forward jump to the node that follows anyway goes, the last one first so the one in front of it can follow
+	int following = count;
+	for (int i = count - 1; i >= 0; i--)
+	{
+		if (!keep[i])
+			continue;
+
+		if (IsJump(nodes[i]) && targets[i] > i)
+		{
+			bool toEnd = following == count && IsMarker(nodes[targets[i]]);
+			if ((following == targets[i] || toEnd) && jumpTargets.count(i) == 0)
+			{
+				keep[i] = false;
+				removedJumps++;
+				continue;
+			}
+
+			if (IsMarker(nodes[targets[i]]))
+				keep[targets[i]] = true;
+		}
+		following = i;
+	}
+
+	// A condition continues after its target, the kept node in front of the one it continues at
+	std::vector<int> anchors(count, -1);
+	for (int i = 0; i < count; i++)
+	{
+		if (!keep[i] || targets[i] < 0 || IsJump(nodes[i]))
+			continue;
+
+		int anchor = targets[i] - 1;
+		while (anchor >= 0 && !keep[anchor])
+			anchor--;
+		if (anchor < 0)
+		{
+			anchor = targets[i] - 1;
+			keep[anchor] = true;
+		}
+		anchors[i] = anchor;
+	}
+
+	int removed = 0;
+	for (int i = 0; i < count; i++)
+	{
+		if (!keep[i])
+		{
+			if (IsMarker(nodes[i]))
+				removedMarkers++;
+			else if (!reachable[i])
+				removedUnreachable++;
+
+			list->Remove(listNodes[i]);
+			removed++;
+			continue;
+		}
+
+		if (listNodes[i]->GetData() != nodes[i])
+			listNodes[i]->SetData(nodes[i]);
+
+		std::shared_ptr<CompilerNode> target;
+		if (IsJump(nodes[i]))
+			target = nodes[targets[i]];
+		else if (anchors[i] >= 0)
+			target = nodes[anchors[i]];
+
+		if (target != nullptr && nodes[i]->GetJumpTo() != target)
+			nodes[i]->SetJumpTo(target);
+	}
+
+	return removed;
+}
+
+std::vector<bool> ControlFlowSimplifier::FindReachable()
+{
+	int count = (int)nodes.size();
+	std::vector<bool> reachable(count, false);
+	std::vector<int> work = { 0 };
+	reachable[0] = true;
+
+	while (!work.empty())
+	{
+		int index = work.back();
+		work.pop_back();
+
+		std::string expression = nodes[index]->GetExpression();
+		std::vector<int> successors;
+		if (expression == "$ret")
+			successors = {};
+		else if (IsJump(nodes[index]))
+			successors = { targets[index] };
+		else if (targets[index] >= 0)
+			successors = { index + 1, targets[index] };
+		else
+			successors = { index + 1 };
+
+		for (int successor : successors)
+		{
+			if (successor < count && !reachable[successor])
+			{
+				reachable[successor] = true;
+				work.push_back(successor);
+			}
+		}
+	}
+	return reachable;
+}
+
+// An empty $doNothing, left by the parser to have something to jump to
+bool ControlFlowSimplifier::IsMarker(std::shared_ptr<CompilerNode> node)
+{
+	return node->GetExpression() == "$doNothing" && node->GetJumpTo() == nullptr;
+}
+
+bool ControlFlowSimplifier::IsJump(std::shared_ptr<CompilerNode> node)
+{
+	return node->GetExpression() == "$doNothing" && node->GetJumpTo() != nullptr;
+}
+
+int ControlFlowSimplifier::GetRemovedCount()
+{
+	return removedMarkers + removedUnreachable + removedJumps;
+}
+
+std::string ControlFlowSimplifier::GetReport()
+{
+	return "Control flow: " + std::to_string(GetRemovedCount()) + " nodes removed ("
+		+ std::to_string(removedMarkers) + " empty $doNothing, "
+		+ std::to_string(removedUnreachable) + " unreachable, "
+		+ std::to_string(removedJumps) + " jumps to the next node), "
+		+ std::to_string(threadedJumps) + " jumps threaded, "
+		+ std::to_string(duplicatedReturns) + " jumps to a ret replaced by the ret";
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "CompilerNode.h"
+#include "LinkedList.h"
+#include "Subroutine.h"
+
+// Cleans up the jumps the parser leaves behind, on the control flow graph of
+// the statements of a subroutine:
+//
+//   $if a              -> J1           $if a              -> $doNothing
+//     $if b            -> J2             $if b            -> x = 1
+//       x = 1                              x = 1
+//     J2: $doNothing             ->        y = 1
+//     y = 1                                $doNothing       -> prnt(x)
+//     $doNothing       -> E                x = 2
+//   J1: $doNothing                         prnt(x)
+//     x = 2
+//   E: $doNothing
+//   prnt(x)
+//
+// A jump to a $doNothing without a target continues at the first statement
+// after it, a $doNothing that jumps to a ret becomes that ret. Statements no
+// path reaches, like the ones after a ret, are removed and so are the empty
+// $doNothing nodes and the jumps to the statement that follows anyway.
+//
+// A false condition continues after its target, so a condition gets the
+// statement in front of the one it continues at as its new target. The
+// statements keep their order: the JIT compiles a loop as the nodes from its
+// header up to its jump back, and the jumps back to a loop header or to the
+// start of a function without its tail calls are left alone.
+class ControlFlowSimplifier
+{
+public:
+	ControlFlowSimplifier();
+	virtual ~ControlFlowSimplifier();
+
+	// Simplify the statements of a subroutine, returns the number of removed nodes
+	int Simplify(Subroutine* subroutine);
+
+	int GetRemovedCount();
+	std::string GetReport();
+
+private:
+	int threadedJumps = 0;
+	int duplicatedReturns = 0;
+	int removedMarkers = 0;
+	int removedUnreachable = 0;
+	int removedJumps = 0;
+
+	std::vector<std::shared_ptr<CompilerNode>> nodes;
+	std::vector<int> targets;
+
+	std::vector<bool> FindReachable();
+	int GetSuccessor(int index);
+
+	static bool IsMarker(std::shared_ptr<CompilerNode> node);
+	static bool IsJump(std::shared_ptr<CompilerNode> node);
+};
@@ -0,0 +1,908 @@
+#include "CppTranspiler.h"
+#include "Builtins.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+namespace
+{
+	// Runtime function for a math operation or builtin
+	struct CppBuiltin
+	{
+		std::string function;
+		int arity;
+	};
+
+	const std::map<std::string, CppBuiltin>& GetBuiltins()
+	{
+		static std::map<std::string, CppBuiltin> builtins;
+		if (builtins.empty())
+		{
+			builtins["$add"] = { "Add", 2 };
+			builtins["$min"] = { "Subtract", 2 };
+			builtins["$mul"] = { "Multiply", 2 };
+			builtins["$div"] = { "Divide", 2 };
+			builtins["$uniPlus"] = { "Increment", 1 };
+			builtins["$uniMin"] = { "Decrement", 1 };
+			builtins["$powInt"] = { "PowInt", 2 };
+
+			// The runtime has a function with the capitalised name of every builtin with a value
+			for (int i = 0; i < Builtins::Count(); i++)
+			{
+				const Builtin& builtin = Builtins::Get(i);
+				if (builtin.statement)
+					continue;
+				std::string function = builtin.name;
+				function[0] = (char)std::toupper(function[0]);
+				builtins[builtin.expression] = { function, builtin.arity };
+			}
+		}
+		return builtins;
+	}
+
+	const std::map<std::string, std::string>& GetCompareOperators()
+	{
+		static std::map<std::string, std::string> operators;
+		if (operators.empty())
+		{
+			operators["$less"] = "<";
+			operators["$lessOrEq"] = "<=";
+			operators["$greater"] = ">";
+			operators["$greaterOrEq"] = ">=";
+			operators["$equals"] = "==";
+			operators["$notEquals"] = "!=";
+		}
+		return operators;
+	}
+}
+
+CppTranspiler::CppTranspiler(SymbolTable* p_globals, SubroutineTable* p_subroutines, std::list<std::shared_ptr<CompilerNode>> p_globalNodes)
+: globals(p_globals), subroutines(p_subroutines), globalNodes(p_globalNodes)
+{
+}
+
+CppTranspiler::~CppTranspiler()
+{
+}
+
+bool CppTranspiler::Transpile(std::string sourceName)
+{
+	// Generate the same code every time, the SubroutineTable is unordered
+	std::vector<Subroutine*> subroutineVector = subroutines->GetSubroutineVector();
+	std::sort(subroutineVector.begin(), subroutineVector.end(), [](Subroutine* a, Subroutine* b) { return a->name < b->name; });
+
+	// The global nodes run before main
+	currentSubroutine = nullptr;
+	code << "void RunGlobals()" << std::endl << "{" << std::endl;
+	TranspileNodes(std::vector<std::shared_ptr<CompilerNode>>(globalNodes.begin(), globalNodes.end()));
+	code << "}" << std::endl;
+
+	for (Subroutine* subroutine : subroutineVector)
+	{
+		currentSubroutine = subroutine;
+
+		std::vector<std::shared_ptr<CompilerNode>> nodes;
+		std::shared_ptr<LinkedList> nodeList = subroutine->GetCompilerNodeCollection();
+		for (std::shared_ptr<ListNode> listNode = nodeList->GetHead(); listNode && listNode->GetData(); listNode = listNode->GetNext())
+			nodes.push_back(listNode->GetData());
+
+		// A frl adds its variable to the locals when it runs
+		std::vector<std::string> locals;
+		for (Symbol* symbol : subroutine->GetSymbolTable()->GetAllSymbolVector())
+			locals.push_back(symbol->name);
+		for (std::shared_ptr<CompilerNode> node : nodes)
+		{
+			if (node->GetExpression() != "$forLoop" || node->GetNodeparameters().empty() || node->GetNodeparameters().at(0) == nullptr)
+				continue;
+
+			std::vector<std::shared_ptr<CompilerNode>> assignment = node->GetNodeparameters().at(0)->GetNodeparameters();
+			if (!assignment.empty() && assignment.at(0) != nullptr && forLoopVariables.insert(subroutine->name + ":" + assignment.at(0)->GetValue()).second)
+				locals.push_back(assignment.at(0)->GetValue());
+		}
+
+		std::vector<Symbol*> parameters = subroutine->GetSymbolTable()->GetSymbolVector();
+		code << std::endl << "std::string " << FunctionName(subroutine->name) << "(" << ParameterList(parameters.size(), true) << ")" << std::endl << "{" << std::endl;
+
+		// Every call has its own locals, like the VirtualMachine gives every call its own copy of the symbols
+		for (std::string local : locals)
+		{
+			if (variables.count(subroutine->name + ":" + local) > 0)
+				continue;
+
+			std::string variable = GetVariable(local);
+			localNames.insert(variable);
+			code << "\tdouble " << variable << " = 0;" << std::endl;
+			code << "\tbool " << variable << "_set = false;" << std::endl;
+		}
+		for (size_t i = 0; i < parameters.size(); i++)
+		{
+			code << "\t" << GetVariable(parameters[i]->name) << " = a" << i << ";" << std::endl;
+			code << "\t" << GetVariable(parameters[i]->name) << "_set = true;" << std::endl;
+		}
+
+		TranspileNodes(nodes);
+		code << "\treturn std::string();" << std::endl << "}" << std::endl;
+	}
+	currentSubroutine = nullptr;
+
+	if (!errors.empty())
+		return false;
+
+	std::ostringstream output;
+	output << "// Generated from " << sourceName << " by the Short-C C++ backend" << std::endl;
+	output << GetRuntime() << std::endl;
+
+	// Variables
+	for (std::string variable : variableNames)
+	{
+		if (localNames.count(variable) > 0)
+			continue;
+		output << "static double " << variable << " = 0;" << std::endl;
+		output << "static bool " << variable << "_set = false;" << std::endl;
+	}
+	output << std::endl;
+
+	for (Subroutine* subroutine : subroutineVector)
+		output << "std::string " << FunctionName(subroutine->name) << "(" << ParameterList(subroutine->GetSymbolTable()->ParameterSize(), false) << ");" << std::endl;
+	output << std::endl;
+
+	output << code.str() << std::endl;
+
+	output << "int main()" << std::endl;
+	output << "{" << std::endl;
+	output << "\ttry" << std::endl;
+	output << "\t{" << std::endl;
+	output << "\t\tRunGlobals();" << std::endl;
+	if (subroutines->GetSubroutine("main") != nullptr)
+		output << "\t\t" << FunctionName("main") << "();" << std::endl;
+	else
+		output << "\t\tthrow std::runtime_error(\"No main function found\");" << std::endl;
+	output << "\t}" << std::endl;
+	output << "\tcatch (const StopProgram&)" << std::endl;
+	output << "\t{" << std::endl;
+	output << "\t}" << std::endl;
+	output << "\tcatch (const std::exception& e)" << std::endl;
+	output << "\t{" << std::endl;
+	output << "\t\tstd::cout << e.what() << std::endl;" << std::endl;
+	output << "\t\treturn 1;" << std::endl;
+	output << "\t}" << std::endl;
+	output << "\treturn 0;" << std::endl;
+	output << "}" << std::endl;
+
+	source = output.str();
+	return true;
+}
+
+std::string CppTranspiler::GetSource()
+{
+	return source;
+}
+
+std::vector<std::string> CppTranspiler::GetErrors()
+{
+	return errors;
+}
+
+bool CppTranspiler::BuildExecutable(std::string sourceFile, std::string executableFile)
+{
+	const char* compiler = getenv("CXX");
+	std::string command = std::string(compiler != nullptr ? compiler : "c++") + " -std=c++11 -O2 -o \"" + executableFile + "\" \"" + sourceFile + "\"";
+	return system(command.c_str()) == 0;
+}
+
+void CppTranspiler::TranspileNodes(std::vector<std::shared_ptr<CompilerNode>> nodes)
+{
+	nodeIndexes.clear();
+	for (size_t i = 0; i < nodes.size(); i++)
+		nodeIndexes[nodes[i].get()] = (int)i;
+
+	// Only the jump targets get a label
+	std::set<int> targets;
+	for (std::shared_ptr<CompilerNode> node : nodes)
+	{
+		std::shared_ptr<CompilerNode> jumpTo = node->GetJumpTo();
+		if (jumpTo == nullptr || nodeIndexes.find(jumpTo.get()) == nodeIndexes.end())
+			continue;
+
+		// A $doNothing continues at the target, the conditions after it
+		if (node->GetExpression() == "$doNothing")
+			targets.insert(nodeIndexes[jumpTo.get()]);
+		else
+			targets.insert(nodeIndexes[jumpTo.get()] + 1);
+	}
+
+	indent = "\t";
+	for (size_t i = 0; i < nodes.size(); i++)
+	{
+		if (targets.count((int)i) > 0)
+			code << "L" << i << ":" << std::endl;
+
+		// Every statement gets its own block, goto can't skip initializations
+		temps = 0;
+		Line("{");
+		indent += "\t";
+		TranspileStatement(nodes[i]);
+		indent.pop_back();
+		Line("}");
+	}
+
+	if (targets.count((int)nodes.size()) > 0)
+		code << "L" << nodes.size() << ":" << std::endl << "\t;" << std::endl;
+}
+
+void CppTranspiler::TranspileStatement(std::shared_ptr<CompilerNode> node)
+{
+	std::string expression = node->GetExpression();
+	std::vector<std::shared_ptr<CompilerNode>> parameters = node->GetNodeparameters();
+
+	if (expression == "$assignment")
+	{
+		if (parameters.size() != 2 || parameters.at(0) == nullptr)
+			return Error("unexpected assignment");
+		if (parameters.at(0)->GetExpression() != "$identifier")
+			return;
+
+		Value value = TranspileExpression(parameters.at(1));
+		std::string variable = GetVariable(parameters.at(0)->GetValue());
+		Line(variable + " = " + AsNumber(value) + ";");
+		Line(variable + "_set = true;");
+	}
+	else if (expression == "$prnt")
+	{
+		if (parameters.size() != 1)
+			return Error("prnt expects 1 parameter");
+
+		Value value = TranspileExpression(parameters.at(0));
+		Line("Print(" + AsText(value) + ");");
+	}
+	else if (expression == "$stop")
+		Line("throw StopProgram();");
+	else if (expression == "$ret")
+	{
+		if (parameters.size() != 1)
+			return Error("ret expects 1 parameter");
+
+		Value value = TranspileExpression(parameters.at(0));
+		Line("return " + AsText(value) + ";");
+	}
+	else if (expression == "$if" || expression == "$whileLoop")
+	{
+		if (parameters.size() != 1)
+			return Error(expression + " expects 1 parameter");
+
+		Value condition = TranspileExpression(parameters.at(0));
+		Line("if (!(" + AsCondition(condition) + "))");
+		Line("\tgoto " + GetLabel(node->GetJumpTo(), 1) + ";");
+	}
+	else if (expression == "$ifCompare" || expression == "$whileCompare")
+	{
+		Value condition = TranspileCompare(node->GetValue(), parameters, true);
+		Line("if (!(" + AsCondition(condition) + "))");
+		Line("\tgoto " + GetLabel(node->GetJumpTo(), 1) + ";");
+	}
+	else if (expression == "$forLoop")
+		TranspileForLoop(node);
+	else if (expression == "$doNothing")
+	{
+		if (node->GetJumpTo() != nullptr)
+			Line("goto " + GetLabel(node->GetJumpTo(), 0) + ";");
+	}
+	else if (expression == "$increment" || expression == "$decrement")
+	{
+		std::string variable = GetVariable(node->GetValue());
+		Line(variable + " = Round((long double)Round(" + variable + ") " + (expression == "$increment" ? "+" : "-") + " 1);");
+		Line(variable + "_set = true;");
+	}
+	else if (expression == "$addConstant" || expression == "$subtractConstant")
+	{
+		if (parameters.size() != 1)
+			return Error(expression + " expects 1 parameter");
+
+		Value constant = TranspileExpression(parameters.at(0));
+		std::string variable = GetVariable(node->GetValue());
+		Line(variable + " = Round((long double)Round(" + variable + ") " + (expression == "$addConstant" ? "+ " : "- ") + AsNumber(constant) + ");");
+		Line(variable + "_set = true;");
+	}
+	else if (expression == "$abc")
+	{
+		// abc prints its result and has no value
+		if (parameters.size() != 3)
+			return Error("abc expects 3 parameters");
+
+		std::vector<std::string> arguments;
+		for (std::shared_ptr<CompilerNode> parameter : parameters)
+		{
+			std::string argument = NewTemp();
+			Line("const long double " + argument + " = " + AsNumber(TranspileExpression(parameter)) + ";");
+			arguments.push_back(argument);
+		}
+		Line("Abc(" + arguments[0] + ", " + arguments[1] + ", " + arguments[2] + ");");
+	}
+	else if (expression == "$functionCall")
+		TranspileFunctionCall(node, "");
+	else
+		TranspileExpression(node);
+}
+
+void CppTranspiler::TranspileForLoop(std::shared_ptr<CompilerNode> node)
+{
+	std::vector<std::shared_ptr<CompilerNode>> parameters = node->GetNodeparameters();
+	if (parameters.size() != 3 || parameters.at(0) == nullptr || parameters.at(0)->GetExpression() != "$assignment"
+		|| parameters.at(0)->GetNodeparameters().empty() || currentSubroutine == nullptr)
+		return Error("unexpected frl");
+
+	std::string variable = GetVariable(parameters.at(0)->GetNodeparameters().at(0)->GetValue());
+
+	// The step runs when the variable is set, the first time the assignment runs
+	Line("if (" + variable + "_set)");
+	Line("{");
+	indent += "\t";
+	if (parameters.at(2)->GetExpression() != "$value")
+		TranspileStatement(parameters.at(2));
+	indent.pop_back();
+	Line("}");
+
+	Line("if (!" + variable + "_set)");
+	Line("{");
+	indent += "\t";
+	TranspileStatement(parameters.at(0));
+	indent.pop_back();
+	Line("}");
+
+	Value condition = TranspileExpression(parameters.at(1));
+	Line("if (!(" + AsCondition(condition) + "))");
+	Line("\tgoto " + GetLabel(node->GetJumpTo(), 1) + ";");
+}
+
+void CppTranspiler::TranspileFunctionCall(std::shared_ptr<CompilerNode> node, std::string result)
+{
+	std::vector<std::shared_ptr<CompilerNode>> parameters = node->GetNodeparameters();
+	if (parameters.empty() || parameters.at(0) == nullptr || parameters.at(0)->GetExpression() != "$functionName")
+		return Error("expected function name");
+
+	std::string name = parameters.at(0)->GetValue();
+	Subroutine* subroutine = subroutines->GetSubroutine(name);
+	if (subroutine == nullptr)
+		return Error("function " + name + " does not exist");
+
+	std::vector<Symbol*> symbols = subroutine->GetSymbolTable()->GetSymbolVector();
+	if (parameters.size() - 1 != symbols.size())
+		return Error("function " + name + " expects " + std::to_string(symbols.size()) + " parameters");
+
+	// The arguments are evaluated from left to right before the call
+	std::string arguments;
+	for (size_t i = 0; i < symbols.size(); i++)
+	{
+		Value argument = TranspileExpression(parameters.at(i + 1));
+		std::string temp = NewTemp();
+		Line("const long double " + temp + " = " + AsNumber(argument) + ";");
+		arguments += (i > 0 ? ", " : "") + temp;
+	}
+
+	if (result.empty())
+		Line(FunctionName(name) + "(" + arguments + ");");
+	else
+		Line("const std::string " + result + " = " + FunctionName(name) + "(" + arguments + ");");
+}
+
+CppTranspiler::Value CppTranspiler::TranspileExpression(std::shared_ptr<CompilerNode> node)
+{
+	Value value = { ValueKind::Number, "0", "" };
+	if (node == nullptr)
+	{
+		Error("missing expression");
+		return value;
+	}
+
+	std::string expression = node->GetExpression();
+	std::vector<std::shared_ptr<CompilerNode>> parameters = node->GetNodeparameters();
+
+	if (expression == "$value")
+	{
+		value.kind = ValueKind::Literal;
+		value.code = node->GetValue();
+	}
+	else if (expression == "$getVariable")
+	{
+		// Copy the variable, a function called later in the expression can change it
+		value.code = NewTemp();
+		Line("const long double " + value.code + " = " + GetVariable(node->GetValue()) + ";");
+	}
+	else if (expression == "$mathpi")
+		value.code = "(long double)M_PI";
+	else if (expression == "$mathe")
+		value.code = "(long double)M_E";
+	else if (GetCompareOperators().count(expression) > 0)
+		value = TranspileCompare(expression, parameters, false);
+	else if (expression == "$compare")
+		value = TranspileCompare(node->GetValue(), parameters, true);
+	else if (expression == "$and" || expression == "$or")
+	{
+		// Only the literal text 1 counts as true, like the VirtualMachine
+		if (parameters.size() < 2)
+		{
+			Error(expression + " expects 2 parameters");
+			return value;
+		}
+
+		std::string result = NewTemp();
+		std::string first = AsText(TranspileExpression(parameters.at(0)));
+		if (expression == "$and")
+		{
+			std::string second = AsText(TranspileExpression(parameters.at(1)));
+			Line("const bool " + result + " = " + first + " == \"1\" && " + second + " == \"1\";");
+		}
+		else
+		{
+			Line("bool " + result + " = " + first + " == \"1\";");
+			Line("if (!" + result + ")");
+			Line("{");
+			indent += "\t";
+			std::string second = AsText(TranspileExpression(parameters.at(1)));
+			Line(result + " = " + second + " == \"1\";");
+			indent.pop_back();
+			Line("}");
+		}
+		value.code = "Bool(" + result + ")";
+		value.condition = result;
+	}
+	else if (expression == "$functionCall")
+	{
+		value.kind = ValueKind::Text;
+		value.code = NewTemp();
+		TranspileFunctionCall(node, value.code);
+	}
+	else if (GetBuiltins().count(expression) > 0)
+	{
+		CppBuiltin builtin = GetBuiltins().at(expression);
+		if ((int)parameters.size() != builtin.arity)
+		{
+			Error(expression + " expects " + std::to_string(builtin.arity) + " parameters");
+			return value;
+		}
+
+		std::string arguments;
+		for (std::shared_ptr<CompilerNode> parameter : parameters)
+		{
+			std::string argument = NewTemp();
+			Line("const long double " + argument + " = " + AsNumber(TranspileExpression(parameter)) + ";");
+			arguments += (arguments.empty() ? "" : ", ") + argument;
+		}
+
+		value.code = NewTemp();
+		Line("const long double " + value.code + " = " + builtin.function + "(" + arguments + ");");
+	}
+	else if (expression == "$abc")
+		Error("abc has no value");
+	else
+		Error(expression + " is not supported");
+
+	return value;
+}
+
+CppTranspiler::Value CppTranspiler::TranspileCompare(std::string operation, std::vector<std::shared_ptr<CompilerNode>> operands, bool fused)
+{
+	Value value = { ValueKind::Number, "0", "" };
+	if (operands.size() != 2 || GetCompareOperators().count(operation) == 0)
+	{
+		Error("unexpected compare " + operation);
+		return value;
+	}
+
+	std::string numbers[2];
+	for (int i = 0; i < 2; i++)
+	{
+		numbers[i] = NewTemp();
+
+		// The fused compare reads variables directly, with the same rounding
+		if (fused && operands.at(i) != nullptr && operands.at(i)->GetExpression() == "$getVariable")
+			Line("const double " + numbers[i] + " = Round(" + GetVariable(operands.at(i)->GetValue()) + ");");
+		else
+			Line("const double " + numbers[i] + " = " + AsNumber(TranspileExpression(operands.at(i))) + ";");
+	}
+
+	value.condition = NewTemp();
+	Line("const bool " + value.condition + " = " + numbers[0] + " " + GetCompareOperators().at(operation) + " " + numbers[1] + ";");
+	value.code = "Bool(" + value.condition + ")";
+	return value;
+}
+
+std::string CppTranspiler::AsNumber(Value value)
+{
+	switch (value.kind)
+	{
+	case ValueKind::Literal:
+		return Constant(value.code);
+	case ValueKind::Text:
+		return "Number(" + value.code + ")";
+	default:
+		return "Round(" + value.code + ")";
+	}
+}
+
+std::string CppTranspiler::AsText(Value value)
+{
+	switch (value.kind)
+	{
+	case ValueKind::Literal:
+		return "std::string(" + Quote(value.code) + ")";
+	case ValueKind::Text:
+		return value.code;
+	default:
+		return "ToString(" + value.code + ")";
+	}
+}
+
+std::string CppTranspiler::AsCondition(Value value)
+{
+	switch (value.kind)
+	{
+	case ValueKind::Literal:
+		return !value.code.empty() && value.code[0] == '1' ? "true" : "false";
+	case ValueKind::Text:
+		return "IsTrue(" + value.code + ")";
+	default:
+		return value.condition.empty() ? "IsTrue(" + value.code + ")" : value.condition;
+	}
+}
+
+std::string CppTranspiler::GetVariable(std::string name)
+{
+	// Locals first, then the globals
+	std::string key;
+	if (currentSubroutine != nullptr && (currentSubroutine->GetSymbolTable()->HasSymbol(name) || forLoopVariables.count(currentSubroutine->name + ":" + name) > 0))
+		key = currentSubroutine->name + ":" + name;
+	else if (globals->HasSymbol(name))
+		key = ":" + name;
+	else
+	{
+		Error("unknown variable " + name);
+		return "0";
+	}
+
+	auto variable = variables.find(key);
+	if (variable != variables.end())
+		return variable->second;
+
+	std::string identifier = "v" + std::to_string(variableNames.size()) + "_" + Identifier(name);
+	variables[key] = identifier;
+	variableNames.push_back(identifier);
+	return identifier;
+}
+
+// The parameters of a generated function, a0, a1, ... in the definition
+std::string CppTranspiler::ParameterList(size_t count, bool named)
+{
+	std::string list;
+	for (size_t i = 0; i < count; i++)
+		list += std::string(i > 0 ? ", " : "") + "long double" + (named ? " a" + std::to_string(i) : "");
+	return list;
+}
+
+std::string CppTranspiler::GetLabel(std::shared_ptr<CompilerNode> node, int offset)
+{
+	auto nodeIndex = nodeIndexes.find(node.get());
+	if (node == nullptr || nodeIndex == nodeIndexes.end())
+	{
+		Error("jump to a missing node");
+		return "L0";
+	}
+	return "L" + std::to_string(nodeIndex->second + offset);
+}
+
+std::string CppTranspiler::NewTemp()
+{
+	return "t" + std::to_string(temps++);
+}
+
+std::string CppTranspiler::FunctionName(std::string name)
+{
+	return "function_" + Identifier(name);
+}
+
+void CppTranspiler::Line(std::string line)
+{
+	code << indent << line << std::endl;
+}
+
+void CppTranspiler::Error(std::string message)
+{
+	if (currentSubroutine != nullptr)
+		message = "In function " + currentSubroutine->name + ": " + message;
+	errors.push_back(message);
+}
+
+// The number atof reads from a literal, written so the C++ compiler reads the same double
+std::string CppTranspiler::Constant(std::string literal)
+{
+	double number = atof(literal.c_str());
+	if (std::isinf(number))
+		return number > 0 ? "HUGE_VAL" : "-HUGE_VAL";
+
+	char buffer[64];
+	snprintf(buffer, sizeof(buffer), "%.17g", number);
+
+	std::string constant = buffer;
+	if (constant.find_first_of(".e") == std::string::npos)
+		constant += ".0";
+	return constant;
+}
+
+std::string CppTranspiler::Quote(std::string text)
+{
+	std::string quoted = "\"";
+	for (char c : text)
+	{
+		if (c == '"' || c == '\\')
+			quoted += '\\';
+		quoted += c;
+	}
+	return quoted + "\"";
+}
+
+std::string CppTranspiler::Identifier(std::string name)
+{
+	for (char& c : name)
+	{
+		if (!isalnum((unsigned char)c) && c != '_')
+			c = '_';
+	}
+	return name;
+}
+
+// The runtime every generated program starts with, the builtins are copied
+// from the VirtualMachine
+const char* CppTranspiler::GetRuntime()
+{
+	return R"runtime(
+#define _USE_MATH_DEFINES
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+#ifndef M_E
+#define M_E 2.71828182845904523536
+#endif
+
+namespace
+{
+	struct StopProgram {};
+
+	// Same formatting as VirtualMachine::toString
+	std::string ToString(long double value)
+	{
+		std::ostringstream strs;
+		strs << std::fixed << std::setprecision(14) << value;
+		return strs.str();
+	}
+
+	// Passing a value through a $value node: atof(toString(value))
+	double Round(long double value)
+	{
+		if (std::floor(value) == value && std::fabs(value) < 9007199254740992.0L)
+			return (double)value;
+
+		char buffer[64];
+		int length = snprintf(buffer, sizeof(buffer), "%.14Lf", value);
+		if (length > 0 && length < (int)sizeof(buffer))
+			return strtod(buffer, NULL);
+		return atof(ToString(value).c_str());
+	}
+
+	double Number(const std::string& text) { return atof(text.c_str()); }
+	long double Bool(bool value) { return value; }
+	bool IsTrue(long double value) { return ToString(value)[0] == '1'; }
+	bool IsTrue(const std::string& text) { return text[0] == '1'; }
+	void Print(const std::string& text) { std::cout << text << '\n'; }
+	void Fail(const std::string& message) { throw std::runtime_error(message); }
+
+	long double Add(long double num1, long double num2) { return num1 + num2; }
+	long double Subtract(long double num1, long double num2) { return num1 - num2; }
+	long double Multiply(long double num1, long double num2) { return num1 * num2; }
+	long double Divide(long double num1, long double num2)
+	{
+		if (num2 == 0)
+			Fail("Cannot divide by zero");
+		return num1 / num2;
+	}
+	long double Increment(long double num1) { return num1 + 1; }
+	long double Decrement(long double num1) { return num1 - 1; }
+
+	long double Sqr(long double num1) { return std::pow(num1, 2); }
+	long double Cbc(long double num1) { return std::pow(num1, 3); }
+	long double Pow(long double num1, long double num2) { return std::pow(num1, num2); }
+	long double PowInt(long double num1, long double num2)
+	{
+		if (std::floor(num2) != num2 || std::fabs(num2) > 64)
+			return std::pow(num1, num2);
+
+		long double result = 1;
+		long double factor = num1;
+		for (long long exponent = (long long)std::fabs(num2); exponent > 0; exponent /= 2)
+		{
+			if (exponent % 2 == 1)
+				result *= factor;
+			factor *= factor;
+		}
+		return num2 < 0 ? 1 / result : result;
+	}
+	long double Sqrt(long double num1)
+	{
+		if (num1 < 0)
+			Fail("InvalidInputException occured. Can't calculate square root of negative value.");
+		return std::sqrt(num1);
+	}
+	long double Cbrt(long double num1) { return std::cbrt(num1); }
+
+	long double Sin(long double num1) { return std::sin(num1 * (M_PI / 180)); }
+	long double Sinr(long double num1) { return std::sin(num1); }
+	long double Cos(long double num1) { return std::cos(num1 * (M_PI / 180)); }
+	long double Cosr(long double num1) { return std::cos(num1); }
+	long double Tan(long double num1) { return std::tan(num1 * (M_PI / 180)); }
+	long double Tanr(long double num1) { return std::tan(num1); }
+
+	long double Deg(long double num1) { return num1 * (180 / M_PI); }
+	long double Rad(long double num1) { return num1 * (M_PI / 180); }
+	long double Perc(long double num1, long double num2)
+	{
+		if (num2 == 0)
+			Fail("Division by 0 exception occured.");
+		return (num1 / num2) * 100;
+	}
+	long double Perm(long double num1, long double num2)
+	{
+		if (num2 == 0)
+			Fail("Division by 0 exception occured.");
+		return (num1 / num2) * 1000;
+	}
+	long double Log10(long double num1)
+	{
+		if (num1 <= 0)
+			Fail("Invalid Input");
+		return std::log10(num1);
+	}
+	long double Log2(long double num1)
+	{
+		if (num1 <= 0)
+			Fail("Invalid Input");
+		return std::log2(num1);
+	}
+	long double Ln(long double num1)
+	{
+		if (num1 <= 0)
+			Fail("Invalid Input");
+		return std::log(num1);
+	}
+	long double Log(long double num1, long double num2)
+	{
+		if (num1 <= 0 || num2 <= 0 || num2 == 1)
+			Fail("Invalid Input");
+		return std::log(num1) / std::log(num2);
+	}
+	long double Mod(long double num1, long double num2)
+	{
+		if (num2 == 0)
+			Fail("Division by 0 exception occured.");
+		return std::fmod(num1, num2);
+	}
+
+	long double Gcd(long double num1, long double num2)
+	{
+		long long int1 = num1;
+		long long int2 = num2;
+
+		if (num1 != int1 || num2 != int2)
+			Fail("An UnexpectedTypeException occured in function 'gcd'. Expected integer parameters.");
+
+		if (int1 < 0)
+			int1 *= -1;
+		if (int2 < 0)
+			int2 *= -1;
+
+		long long output = 1;
+		for (long long i = 1; i <= int1 && i <= int2; i++)
+			if (int1 % i == 0 && int2 % i == 0)
+				output = i;
+		return output;
+	}
+	long double Dis(long double numA, long double numB, long double numC) { return std::pow(numB, 2) - (4 * numA * numC); }
+	long double Fib(long double num1)
+	{
+		long long int1 = num1;
+
+		if (num1 != int1)
+			Fail("An UnexpectedTypeException occured in function 'fib'. Expected integer parameter.");
+		if (int1 >= 93)
+			Fail("An UnexpectedParameterException occured in function 'fib'. Result won't be precise for input '" + ToString(int1) + "'.");
+
+		if (int1 < 0)
+			int1 *= -1;
+		long long a = 1;
+		long long b = 0;
+		long long fib = 0;
+		for (int i = 0; i < int1; ++i)
+		{
+			b = fib;
+			fib = a + b;
+			a = b;
+		}
+		return fib;
+	}
+	long double Pyt(long double num, long double numC)
+	{
+		if (num <= 0 || numC <= 0)
+			Fail("An InvalidInputException occured. Input for 'pyt' can't be negative.");
+		if (num > numC)
+			Fail("An InvalidInputException occured. Input 'c' can't be smaller than 'x'");
+		return std::sqrt(pow(numC, 2) - pow(num, 2));
+	}
+	long double Pyth(long double numA, long double numB)
+	{
+		if (numA <= 0 || numB <= 0)
+			Fail("An InvalidInputException occured. Input for 'pyth' can't be negative.");
+		return std::sqrt(pow(numA, 2) + pow(numB, 2));
+	}
+	void Abc(long double numA, long double numB, long double numC)
+	{
+		if (numA == 0)
+			Fail("An InvalidInputException occured in function 'abc'. 'A' cannot be 0");
+
+		long double disc = std::pow(numB, 2) - (4 * numA * numC);
+		long double x1, x2;
+		std::string abcOutput = "The discriminant is " + ToString(disc) + ".\n";
+		if (disc < 0)
+			abcOutput = abcOutput + "There is no real root because the discriminant is negative.";
+		if (disc == 0)
+		{
+			x1 = (-numB / (2 * numA));
+			if (x1 == -0)
+				x1 = 0;
+			abcOutput = abcOutput + "There is one real root because the discriminant is zero.\nThe root is " + ToString(x1) + ".";
+		}
+		else if (disc > 0)
+		{
+			x1 = (-numB + std::sqrt(disc)) / (2 * numA);
+			x2 = (-numB - std::sqrt(disc)) / (2 * numA);
+			abcOutput = abcOutput + "There are two real roots because the discriminant is positive.\nThe roots are " + ToString(x1) + " and " + ToString(x2) + ".";
+		}
+		Print(abcOutput);
+	}
+
+	long double Dist(long double num1, long double num2) { return num1 * num2; }
+	long double Velo(long double num1, long double num2)
+	{
+		if (num2 == 0)
+			Fail("Division by 0 exception occured.");
+		return num1 / num2;
+	}
+	long double Time(long double num1, long double num2)
+	{
+		if (num2 == 0)
+			Fail("Division by 0 exception occured.");
+		return num1 / num2;
+	}
+	long double Avgv(long double num1, long double num2)
+	{
+		if (num2 == 0)
+			Fail("Division by 0 exception occured.");
+		return num1 / num2;
+	}
+	long double Accl(long double num1, long double num2)
+	{
+		if (num2 == 0)
+			Fail("Division by 0 exception occured.");
+		return num1 / num2;
+	}
+}
+)runtime";
+}
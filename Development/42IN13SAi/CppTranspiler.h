@@ -0,0 +1,96 @@
+#pragma once
+
+#include <list>
+#include <map>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "CompilerNode.h"
+#include "SymbolTable.h"
+#include "Subroutine.h"
+#include "SubroutineTable.h"
+
+// Translates the Compiler output to a self-contained C++ translation unit.
+//
+// The generated code does exactly what the VirtualMachine does: every value
+// that the VirtualMachine passes on as a $value node is rounded through the
+// same toString, the builtins use the same formulas and throw the same
+// exception messages. The globals are static, the locals and parameters are
+// declared in their function, the VirtualMachine gives every call its own
+// copy of the symbols of a Subroutine.
+class CppTranspiler
+{
+public:
+	CppTranspiler(SymbolTable* globals, SubroutineTable* subroutines, std::list<std::shared_ptr<CompilerNode>> globalNodes);
+	virtual ~CppTranspiler();
+
+	bool Transpile(std::string sourceName);
+	std::string GetSource();
+	std::vector<std::string> GetErrors();
+
+	// Compile the generated source with the system compiler ($CXX, or c++ when not set)
+	static bool BuildExecutable(std::string sourceFile, std::string executableFile);
+
+private:
+	// How the value of an expression is available
+	enum class ValueKind
+	{
+		Literal,	// the text of a $value node from the source
+		Number,		// the unrounded result of an operation or a variable
+		Text		// the returned text of a user function
+	};
+
+	struct Value
+	{
+		ValueKind kind;
+		std::string code;
+		std::string condition;	// bool code for compares
+	};
+
+	SymbolTable* globals;
+	SubroutineTable* subroutines;
+	std::list<std::shared_ptr<CompilerNode>> globalNodes;
+
+	std::ostringstream code;
+	std::string source;
+	std::vector<std::string> errors;
+
+	// Variables
+	std::map<std::string, std::string> variables;
+	std::vector<std::string> variableNames;
+	std::set<std::string> localNames;
+	std::set<std::string> forLoopVariables;
+	Subroutine* currentSubroutine = nullptr;
+
+	// Labels
+	std::map<CompilerNode*, int> nodeIndexes;
+	int temps = 0;
+	std::string indent;
+
+	void TranspileNodes(std::vector<std::shared_ptr<CompilerNode>> nodes);
+	void TranspileStatement(std::shared_ptr<CompilerNode> node);
+	void TranspileForLoop(std::shared_ptr<CompilerNode> node);
+	void TranspileFunctionCall(std::shared_ptr<CompilerNode> node, std::string result);
+	Value TranspileExpression(std::shared_ptr<CompilerNode> node);
+	Value TranspileCompare(std::string operation, std::vector<std::shared_ptr<CompilerNode>> operands, bool fused);
+
+	std::string AsNumber(Value value);
+	std::string AsText(Value value);
+	std::string AsCondition(Value value);
+
+	std::string GetVariable(std::string name);
+	std::string GetLabel(std::shared_ptr<CompilerNode> node, int offset);
+	std::string NewTemp();
+	std::string FunctionName(std::string name);
+	void Line(std::string line);
+	void Error(std::string message);
+
+	static std::string Constant(std::string literal);
+	static std::string Quote(std::string text);
+	static std::string Identifier(std::string name);
+	static std::string ParameterList(size_t count, bool named);
+	static const char* GetRuntime();
+};
@@ -10,32 +10,27 @@
 #define __mac_42IN13SAI__DiagnosticsBuilder__
 
 #include <iostream>
-#include <vector>
-#include <map>
-#include <boost/format.hpp>
+#include <string>
 
+#include "DiagnosticsEngine.h"
 #include "ExceptionEnum.h"
-//#include "ExceptionMessages.h"
 
-class Token;
+// Collects the arguments of a diagnostic and reports it when it goes out of
+// scope, to the engine or formatted to std::clog when there is none
 class DiagnosticBuilder {
 public:
-    DiagnosticBuilder(ExceptionEnum e);
+    DiagnosticBuilder(ExceptionEnum e, int line, int position, DiagnosticsEngine* p_engine);
+    DiagnosticBuilder(DiagnosticBuilder&& other);
     ~DiagnosticBuilder();
     
-    
-    
-    void BuildExceptionString();
     void AddString(std::string str) const;
     
 private:
-    //Token token;
-    static const std::map<ExceptionEnum, std::string> exceptionMessages;
-    ExceptionEnum currentException;
-    std::string errorMessage;
-    std::vector<std::string>* exceptionParams;
+    mutable Diagnostic diagnostic;
+    DiagnosticsEngine* engine;
     
-    std::string formatRange(const std::string& format_string, const std::vector<std::string>& args);
+    // A builder that was moved from doesn't report
+    bool active = true;
 };
 
 inline const DiagnosticBuilder &operator<<(const DiagnosticBuilder &DB, const std::string str)
@@ -0,0 +1,132 @@
+#include "DiagnosticsEngine.h"
+
+DiagnosticsEngine::DiagnosticsEngine() : DiagnosticsEngine(DefaultCapacity)
+{
+}
+
+DiagnosticsEngine::DiagnosticsEngine(size_t p_capacity) : capacity(p_capacity)
+{
+	entries.reserve(capacity);
+}
+
+DiagnosticsEngine::~DiagnosticsEngine()
+{
+}
+
+void DiagnosticsEngine::Report(const Diagnostic& diagnostic)
+{
+	std::string key = GetKey(diagnostic);
+	auto found = entryIndex.find(key);
+	if (found != entryIndex.end())
+	{
+		Diagnostic& entry = entries[found->second];
+		entry.count++;
+
+		int lastLine = entry.repeatLineCount > 0 ? entry.repeatLines[entry.repeatLineCount - 1] : entry.line;
+		if (diagnostic.line != lastLine && entry.repeatLineCount < Diagnostic::MaxRepeatLines)
+			entry.repeatLines[entry.repeatLineCount++] = diagnostic.line;
+	}
+	else if (entries.size() < capacity)
+	{
+		entryIndex[key] = entries.size();
+		entries.push_back(diagnostic);
+	}
+	else
+		dropped++;
+}
+
+bool DiagnosticsEngine::HasDiagnostics()
+{
+	return !entries.empty() || dropped > 0;
+}
+
+std::vector<std::string> DiagnosticsEngine::TakeBatch()
+{
+	std::vector<std::string> batch;
+	for (const Diagnostic& diagnostic : entries)
+	{
+		std::string message = Format(diagnostic);
+		for (int i = 0; i < diagnostic.repeatLineCount; i++)
+			message += (i == 0 ? (diagnostic.repeatLineCount == 1 ? ", also on line " : ", also on lines ") : ", ") + std::to_string(diagnostic.repeatLines[i]);
+
+		int more = diagnostic.count - 1 - diagnostic.repeatLineCount;
+		if (more > 0)
+			message += (diagnostic.repeatLineCount > 0 ? " and " : ", ") + std::to_string(more) + " more " + (more == 1 ? "time" : "times");
+		batch.push_back(message);
+	}
+	if (dropped > 0)
+		batch.push_back(std::to_string(dropped) + " more diagnostics not shown");
+
+	// The entries keep their memory for the next phase
+	entries.clear();
+	entryIndex.clear();
+	dropped = 0;
+	return batch;
+}
+
+// The exception and the arguments, not the line, the same mistake on every line is one entry
+std::string DiagnosticsEngine::GetKey(const Diagnostic& diagnostic)
+{
+	std::string key = std::to_string((int)diagnostic.exception);
+	for (int i = 0; i < diagnostic.argumentCount; i++)
+		key += '\0' + diagnostic.arguments[i];
+	return key;
+}
+
+std::string DiagnosticsEngine::Format(const Diagnostic& diagnostic)
+{
+	std::string values[Diagnostic::MaxArguments + 2];
+	int valueCount = 0;
+	for (int i = 0; i < diagnostic.argumentCount; i++)
+		values[valueCount++] = diagnostic.arguments[i];
+	values[valueCount++] = std::to_string(diagnostic.line);
+	values[valueCount++] = std::to_string(diagnostic.position);
+
+	const std::string& format = exceptionMessages.at(diagnostic.exception);
+	std::string message;
+	int next = 0;
+	for (size_t i = 0; i < format.size(); i++)
+	{
+		if (format[i] == '%' && i + 1 < format.size() && format[i + 1] == 's' && next < valueCount)
+		{
+			message += values[next++];
+			i++;
+		}
+		else
+			message += format[i];
+	}
+	return message;
+}
+
+const std::map<ExceptionEnum, std::string> DiagnosticsEngine::exceptionMessages
+{
+    { ExceptionEnum::err_partner_not_found, "Partner not found for %s on line %s at position %s"},
+    { ExceptionEnum::err_unkown_char, "Unrecognized character '%s' on line %s at position %s" },
+    { ExceptionEnum::err_main_parameters, "Main function can't contain parameters (line %s)" },
+    { ExceptionEnum::err_function_been_defined, "Redefinition of function '%s' (line %s)" },
+    { ExceptionEnum::err_parameter_in_use, "Redefinition of parameter '%s' (line %s)" },
+    { ExceptionEnum::err_function_in_function, "Function in function not allowed (line %s)" },
+    { ExceptionEnum::err_unexpected_return, "Unexpected return type (line %s)" },
+    { ExceptionEnum::err_expected_identifier, "Expected identifier (line %s)" },
+    { ExceptionEnum::err_unkown_identifier, "Unkown identifier '%s' (line %s)" },
+    { ExceptionEnum::err_identifier_in_use, "Redefinition of identifier '%s' (line %s)" },
+    { ExceptionEnum::err_expected_keyword, "Expected keyword (line %s)" },
+    { ExceptionEnum::err_zero_divide, "Can't divide by zero (line %s)" },
+    { ExceptionEnum::err_var_not_found, "Variable not found '%s' (line %s)" },
+    { ExceptionEnum::err_ret_as_var, "Return used as variable (line %s)" },
+    { ExceptionEnum::err_unexpected_type, "Unexpected type '%s' (line %s)" },
+    { ExceptionEnum::err_expected_lparen_after, "Expected left bracket after '%s' (line %s)" },
+    { ExceptionEnum::err_expected_rparen_after, "Expected right bracket after '%s' (line %s)" },
+    { ExceptionEnum::err_unkown_stmt, "Unkown statement '%s' (line %s)" },
+    { ExceptionEnum::err_unexpected_keyword, "An UnexpectedKeywordException occured. Expected an if keyword on line %s."},
+    { ExceptionEnum::err_expected_ret, "Expected return (line %s)" },
+    { ExceptionEnum::err_expected_parameter, "Expected parameter (line %s at position %s)"},
+    { ExceptionEnum::err_float_precision, "Float precision exception (line %s)" },
+    { ExceptionEnum::err_expected_ret_type, "Expected return type (line %s)" },
+    { ExceptionEnum::err_constant_evaluation, "Evaluating '%s' at compile time failed, %s (line %s)" },
+    { ExceptionEnum::err_unkown_function, "Unknown function '%s' (line %s)" },
+    { ExceptionEnum::err_wrong_arity, "Function '%s' takes %s parameters, %s given (line %s)" },
+    { ExceptionEnum::err_expected_module_path, "Expected the file of the module in quotes after import (line %s)" },
+    { ExceptionEnum::err_module_import, "Module '%s' can't be imported, %s (line %s)" },
+    { ExceptionEnum::err_module_function_defined, "Redefinition of function '%s' imported from '%s' (line %s)" }
+};
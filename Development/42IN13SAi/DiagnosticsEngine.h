@@ -0,0 +1,68 @@
+#pragma once
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ExceptionEnum.h"
+
+// A diagnostic as it is reported, the text is only made when it is shown
+struct Diagnostic
+{
+	static const int MaxArguments = 3;
+
+	ExceptionEnum exception;
+	int line = 0;
+	int position = 0;
+	std::string arguments[MaxArguments];
+	int argumentCount = 0;
+
+	// The times it was reported with the same arguments and the first other lines it was on
+	static const int MaxRepeatLines = 4;
+	int count = 1;
+	int repeatLines[MaxRepeatLines];
+	int repeatLineCount = 0;
+};
+
+// Collects the diagnostics of a phase and hands them over as one batch:
+//
+//   Report(err_var_not_found, 200, 3, "=")      entries  [err_var_not_found "=" line 200] x60
+//   Report(err_var_not_found, 201, 3, "=")  ->           [err_unkown_identifier "t" line 260]
+//   ...
+//   TakeBatch()  ->  "Variable not found '=' (line 200), also on lines 201, 202, 203, 204 and 55 more times"
+//                    "Unkown identifier 't' (line 260)"
+//
+// A diagnostic with the same exception and arguments as one before it only
+// counts, the first keeps its range and the next few lines are remembered.
+// The entries are reserved up front, past the capacity only the number is
+// kept. The messages of the entries are made by TakeBatch, the arguments
+// fill the %s of the message in order and the line and the position fill
+// the ones after them.
+class DiagnosticsEngine
+{
+public:
+	static const size_t DefaultCapacity = 200;
+
+	DiagnosticsEngine();
+	DiagnosticsEngine(size_t p_capacity);
+	virtual ~DiagnosticsEngine();
+
+	void Report(const Diagnostic& diagnostic);
+	bool HasDiagnostics();
+
+	// The messages of the diagnostics since the last batch
+	std::vector<std::string> TakeBatch();
+
+	static std::string Format(const Diagnostic& diagnostic);
+
+private:
+	static const std::map<ExceptionEnum, std::string> exceptionMessages;
+
+	size_t capacity;
+	std::vector<Diagnostic> entries;
+	std::unordered_map<std::string, size_t> entryIndex;
+	int dropped = 0;
+
+	static std::string GetKey(const Diagnostic& diagnostic);
+};
@@ -32,7 +32,13 @@ enum ExceptionEnum {
     err_unexpected_keyword,
     err_expected_parameter,
     err_float_precision,
-    err_expected_ret_type
+    err_expected_ret_type,
+    err_constant_evaluation,
+    err_unkown_function,
+    err_wrong_arity,
+    err_expected_module_path,
+    err_module_import,
+    err_module_function_defined
 };
 
 #endif
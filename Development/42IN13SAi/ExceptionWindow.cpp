@@ -33,6 +33,15 @@ void ExceptionWindow::addException(std::string exception)
 	listModel->setStringList(exceptions);
 }
 
+// The model is set once for the whole batch
+void ExceptionWindow::addExceptions(std::vector<std::string> exceptions)
+{
+	for (std::string exception : exceptions)
+		this->exceptions << QString::fromUtf8(exception.c_str());
+
+	listModel->setStringList(this->exceptions);
+}
+
 void ExceptionWindow::clearExceptions()
 {
 	exceptions.clear();
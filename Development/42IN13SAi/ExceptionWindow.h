@@ -5,6 +5,8 @@
 #include <qstandarditemmodel.h>
 #include <qstringlistmodel.h>
 #include <QAbstractItemView>
+#include <string>
+#include <vector>
 
 class ExceptionWindow : public QListView
 {
@@ -15,6 +17,7 @@ public:
 	~ExceptionWindow();
 
 	void addException(std::string exception);
+	void addExceptions(std::vector<std::string> exceptions);
 	void clearExceptions();
 
 	void SetTheme(std::map<std::string, QColor> colors);
@@ -0,0 +1,146 @@
+#include "ExpressionInterner.h"
+#include <cstdio>
+#include <functional>
+#include <set>
+
+ExpressionInterner::ExpressionInterner(SubroutineTable* p_subroutines) : subroutines(p_subroutines)
+{
+}
+
+ExpressionInterner::~ExpressionInterner()
+{
+}
+
+bool ExpressionInterner::NodeKey::operator==(const NodeKey& other) const
+{
+	return integral == other.integral && expression == other.expression && value == other.value && children == other.children;
+}
+
+size_t ExpressionInterner::NodeKeyHash::operator()(const NodeKey& key) const
+{
+	size_t hash = std::hash<std::string>()(key.expression);
+	hash = hash * 31 + std::hash<std::string>()(key.value);
+	hash = hash * 31 + (key.integral ? 1 : 0);
+	for (CompilerNode* child : key.children)
+		hash = hash * 31 + std::hash<CompilerNode*>()(child);
+	return hash;
+}
+
+int ExpressionInterner::Intern(std::list<std::shared_ptr<CompilerNode>>& globalNodes)
+{
+	for (std::shared_ptr<CompilerNode> node : globalNodes)
+		InternStatement(node);
+
+	for (Subroutine* subroutine : subroutines->GetSubroutineVector())
+	{
+		for (std::shared_ptr<ListNode> listNode = subroutine->GetCompilerNodeCollection()->GetHead(); listNode && listNode->GetData(); listNode = listNode->GetNext())
+			InternStatement(listNode->GetData());
+	}
+
+	return shared;
+}
+
+// A statement stays where it is, its expressions get the shared nodes from the leaves up
+void ExpressionInterner::InternStatement(std::shared_ptr<CompilerNode> node)
+{
+	std::set<CompilerNode*> impure;
+	CompilerNode::Rewrite(node, nullptr, [&](std::shared_ptr<CompilerNode> part, std::vector<std::shared_ptr<CompilerNode>>& parameters, bool changed) {
+		if (part != node)
+			return InternExpression(part, parameters, changed, impure);
+
+		if (changed)
+			node->SetNodeParameters(parameters);
+		return node;
+	});
+}
+
+// The shared node for a node with its interned parameters, a node that isn't free of side
+// effects or has a parameter that isn't is kept and goes into impure
+std::shared_ptr<CompilerNode> ExpressionInterner::InternExpression(std::shared_ptr<CompilerNode> node, std::vector<std::shared_ptr<CompilerNode>>& parameters, bool changed, std::set<CompilerNode*>& impure)
+{
+	bool pure = !HasSideEffects(node);
+	for (std::shared_ptr<CompilerNode> parameter : parameters)
+		pure = pure && parameter != nullptr && impure.count(parameter.get()) == 0;
+
+	if (!pure)
+	{
+		if (changed)
+			node->SetNodeParameters(parameters);
+		impure.insert(node.get());
+		return node;
+	}
+
+	expressions++;
+
+	NodeKey key;
+	key.expression = node->GetExpression();
+	key.value = node->GetValue();
+	key.integral = node->IsIntegral();
+	for (std::shared_ptr<CompilerNode> parameter : parameters)
+		key.children.push_back(parameter.get());
+
+	auto found = table.find(key);
+	if (found != table.end())
+	{
+		if (found->second != node)
+		{
+			replaced.push_back(std::make_pair(std::weak_ptr<CompilerNode>(node), GetNodeSize(node)));
+			shared++;
+		}
+		return found->second;
+	}
+
+	if (changed)
+		node->SetNodeParameters(parameters);
+	table[key] = node;
+	return node;
+}
+
+// The statements, a call can run anything, an $identifier is the variable an assignment writes to
+bool ExpressionInterner::HasSideEffects(std::shared_ptr<CompilerNode> node)
+{
+	static const std::set<std::string> statements = {
+		"$assignment", "$identifier", "$functionCall", "$prnt", "$stop", "$ret", "$doNothing",
+		"$if", "$ifCompare", "$whileLoop", "$whileCompare", "$forLoop",
+		"$increment", "$decrement", "$addConstant", "$subtractConstant"
+	};
+
+	return node->GetJumpTo() != nullptr || statements.count(node->GetExpression()) > 0;
+}
+
+// About the memory of a node, the characters of its strings and its parameters
+size_t ExpressionInterner::GetNodeSize(std::shared_ptr<CompilerNode> node)
+{
+	return sizeof(CompilerNode) + node->GetExpression().size() + node->GetValue().size()
+		+ node->GetNodeparameters().size() * sizeof(std::shared_ptr<CompilerNode>);
+}
+
+int ExpressionInterner::GetSharedCount()
+{
+	return shared;
+}
+
+std::string ExpressionInterner::GetReport()
+{
+	// A replaced node another node still points to stays alive
+	int released = 0;
+	size_t releasedBytes = 0;
+	for (auto node : replaced)
+	{
+		if (node.first.expired())
+		{
+			released++;
+			releasedBytes += node.second;
+		}
+	}
+
+	int unique = (int)table.size();
+	double ratio = unique > 0 ? (double)expressions / unique : 1.0;
+	char ratioText[32];
+	snprintf(ratioText, sizeof(ratioText), "%.2f", ratio);
+
+	return "Hash-consing: " + std::to_string(expressions) + " expression nodes, "
+		+ std::to_string(unique) + " unique (sharing ratio " + ratioText + "), "
+		+ std::to_string(shared) + " replaced by a shared node, "
+		+ std::to_string(released) + " released (about " + std::to_string(releasedBytes / 1024) + " KB)";
+}
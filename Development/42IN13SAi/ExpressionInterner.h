@@ -0,0 +1,75 @@
+#pragma once
+
+#include <list>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "CompilerNode.h"
+#include "LinkedList.h"
+#include "Subroutine.h"
+#include "SubroutineTable.h"
+
+// Shares the structurally identical expressions of the whole program, so
+// every one of them is a single node:
+//
+//   dx = x - ox;                  $getVariable x, $getVariable ox: one node each
+//   dy = y - oy;                  sqr(dx) + sqr(dy): the two $getVariable dx are one node,
+//   d = sqrt(sqr(dx) + sqr(dy));  and so are the two $getVariable dy and the two sqr(dx)
+//   e = sqr(dx) + 1;
+//
+// The children are interned first, so a hash table on the expression, the
+// value, the integral flag and the addresses of the children finds the node
+// an identical subtree already has. Only expressions without side effects
+// are shared, a call, an assignment or a statement keeps its own node and
+// only gets the shared nodes as its parameters. The statements keep their
+// identity, the jumps and the JIT loops point to them.
+//
+// Runs after the IntegerTypeInference, a shared node has to be integral for
+// every statement it is in, and structurally identical ones always are.
+class ExpressionInterner
+{
+public:
+	ExpressionInterner(SubroutineTable* p_subroutines);
+	virtual ~ExpressionInterner();
+
+	// Intern the global statements and every subroutine, returns the number of replaced nodes
+	int Intern(std::list<std::shared_ptr<CompilerNode>>& globalNodes);
+
+	int GetSharedCount();
+	std::string GetReport();
+
+private:
+	struct NodeKey
+	{
+		std::string expression;
+		std::string value;
+		bool integral;
+		std::vector<CompilerNode*> children;
+
+		bool operator==(const NodeKey& other) const;
+	};
+
+	struct NodeKeyHash
+	{
+		size_t operator()(const NodeKey& key) const;
+	};
+
+	SubroutineTable* subroutines;
+	std::unordered_map<NodeKey, std::shared_ptr<CompilerNode>, NodeKeyHash> table;
+
+	// The replaced nodes and their size, to count the ones that are gone after the pass
+	std::vector<std::pair<std::weak_ptr<CompilerNode>, size_t>> replaced;
+
+	int expressions = 0;
+	int shared = 0;
+
+	void InternStatement(std::shared_ptr<CompilerNode> node);
+	std::shared_ptr<CompilerNode> InternExpression(std::shared_ptr<CompilerNode> node, std::vector<std::shared_ptr<CompilerNode>>& parameters, bool changed, std::set<CompilerNode*>& impure);
+
+	static bool HasSideEffects(std::shared_ptr<CompilerNode> node);
+	static size_t GetNodeSize(std::shared_ptr<CompilerNode> node);
+};
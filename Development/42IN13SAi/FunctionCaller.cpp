@@ -7,6 +7,7 @@
 
 #include "FunctionCaller.h"
 #include "VirtualMachine.h"
+#include "Builtins.h"
 
 FunctionCaller::FunctionCaller() {}
 
@@ -18,10 +19,32 @@ FunctionCaller::FunctionCaller(VirtualMachine* virtualMachine)
 
 std::shared_ptr<CompilerNode> FunctionCaller::Call(const std::string& functionName, CompilerNode compilerNode)
 {
+	if (compilerNode.IsIntegral())
+	{
+		functionMap::iterator integerFunction = integerFunctions.find(functionName);
+		if (integerFunction != integerFunctions.end())
+			return (virtualMachine->*integerFunction->second)(compilerNode);
+	}
+
+	functionMap::iterator function = functions.find(functionName);
+	if (function == functions.end())
+	{
+		std::map<std::string, int>::iterator builtin = builtins.find(functionName);
+		if (builtin != builtins.end())
+			return (virtualMachine->*builtinOperation)(builtin->second, compilerNode);
+	}
+
 	MFP functionPointer = functions[functionName];
 	return (virtualMachine->*functionPointer)(compilerNode);
 }
 
+void FunctionCaller::SetNumericMode(NumericMode mode)
+{
+	for (auto operation : VirtualMachine::GetMathOperations(mode))
+		functions[operation.first] = operation.second;
+	builtinOperation = VirtualMachine::GetBuiltinOperation(mode);
+}
+
 void FunctionCaller::fillFunctionMap()
 {
 	// Function Operations
@@ -42,6 +65,11 @@ void FunctionCaller::fillFunctionMap()
 
 	// Conditional operations
 	functions.insert(functionMap::value_type("$if", &VirtualMachine::ExecuteIf));
+
+	// Fused operations
+	functions.insert(functionMap::value_type("$ifCompare", &VirtualMachine::ExecuteCompareBranch));
+	functions.insert(functionMap::value_type("$whileCompare", &VirtualMachine::ExecuteCompareBranch));
+	functions.insert(functionMap::value_type("$compare", &VirtualMachine::ExecuteCompare));
 	
 	// Conditional statements
 	functions.insert(functionMap::value_type("$less", &VirtualMachine::ExecuteLessCondition));
@@ -53,55 +81,42 @@ void FunctionCaller::fillFunctionMap()
     functions.insert(functionMap::value_type("$and", &VirtualMachine::ExecuteAnd));
     functions.insert(functionMap::value_type("$or", &VirtualMachine::ExecuteOr));
     
-	// Simple Math Operations
-	functions.insert(functionMap::value_type("$add", &VirtualMachine::ExecuteAddOperation));
-	functions.insert(functionMap::value_type("$min", &VirtualMachine::ExecuteMinusOperation));
-	functions.insert(functionMap::value_type("$mul", &VirtualMachine::ExecuteMultiplyOperation));
-	functions.insert(functionMap::value_type("$div", &VirtualMachine::ExecuteDivideOperation));
-	functions.insert(functionMap::value_type("$uniMin", &VirtualMachine::ExecuteUniMinOperation));
-	functions.insert(functionMap::value_type("$uniPlus", &VirtualMachine::ExecuteUniPlusOperation));
-
-	// Complex Math Operations
-	functions.insert(functionMap::value_type("$sin", &VirtualMachine::ExecuteSinOperation));
-	functions.insert(functionMap::value_type("$sinr", &VirtualMachine::ExecuteSinrOperation));
-	functions.insert(functionMap::value_type("$cos", &VirtualMachine::ExecuteCosOperation));
-	functions.insert(functionMap::value_type("$cosr", &VirtualMachine::ExecuteCosrOperation));
-	functions.insert(functionMap::value_type("$tan", &VirtualMachine::ExecuteTanOperation));
-	functions.insert(functionMap::value_type("$tanr", &VirtualMachine::ExecuteTanrOperation));
-
-	functions.insert(functionMap::value_type("$sqr", &VirtualMachine::ExecuteSqrOperation));
-	functions.insert(functionMap::value_type("$cbc", &VirtualMachine::ExecuteCbcOperation));
-	functions.insert(functionMap::value_type("$pow", &VirtualMachine::ExecutePowOperation));
-	functions.insert(functionMap::value_type("$sqrt", &VirtualMachine::ExecuteSqrtOperation));
-	functions.insert(functionMap::value_type("$cbrt", &VirtualMachine::ExecuteCbrtOperation));
-
-	functions.insert(functionMap::value_type("$rad", &VirtualMachine::ExecuteRadiantOperation));
-	functions.insert(functionMap::value_type("$deg", &VirtualMachine::ExecuteDegreeOperation));
-
-	functions.insert(functionMap::value_type("$perc", &VirtualMachine::ExecutePercentOperation));
-	functions.insert(functionMap::value_type("$perm", &VirtualMachine::ExecutePermillageOperation));
-
-	functions.insert(functionMap::value_type("$log10", &VirtualMachine::ExecuteCommonLogOperation));
-	functions.insert(functionMap::value_type("$log2", &VirtualMachine::ExecuteBinaryLogOperation));
-	functions.insert(functionMap::value_type("$ln", &VirtualMachine::ExecuteNaturalLogOperation));
-	functions.insert(functionMap::value_type("$log", &VirtualMachine::ExecuteLogOperation));
-
-	functions.insert(functionMap::value_type("$mod", &VirtualMachine::ExecuteModuloOperation));
+	// Math operations, in long double until the virtual machine asks for another precision
+	SetNumericMode(NumericMode::LongDouble);
+
+	for (int i = 0; i < Builtins::Count(); i++)
+	{
+		if (Builtins::Get(i).typed)
+			builtins[Builtins::Get(i).expression] = i;
+	}
 
 	functions.insert(functionMap::value_type("$gcd", &VirtualMachine::ExecuteGcdOperation));
-	functions.insert(functionMap::value_type("$dis", &VirtualMachine::ExecuteDiscriminantOperation));
 	functions.insert(functionMap::value_type("$abc", &VirtualMachine::ExecuteAbcOperation)); 
 	functions.insert(functionMap::value_type("$fib", &VirtualMachine::ExecuteFibonacciOperation));
-	functions.insert(functionMap::value_type("$pyt", &VirtualMachine::ExecutePythagoreanOperation));
-	functions.insert(functionMap::value_type("$pyth", &VirtualMachine::ExecutePythagoreanHOperation));
-	
 
-	// Physics functions
-	functions.insert(functionMap::value_type("$dist", &VirtualMachine::ExecuteDistanceOperation));
-	functions.insert(functionMap::value_type("$velo", &VirtualMachine::ExecuteVelocityOperation));
-	functions.insert(functionMap::value_type("$time", &VirtualMachine::ExecuteTimeOperation));
-	functions.insert(functionMap::value_type("$avgv", &VirtualMachine::ExecuteAverageVelocityOperation));
-	functions.insert(functionMap::value_type("$accl", &VirtualMachine::ExecuteAccelerationOperation));
+	// Integer operations, they give the same text without going through long double strings
+	integerFunctions.insert(functionMap::value_type("$getVariable", &VirtualMachine::ExecuteIntegerGetVariable));
+	integerFunctions.insert(functionMap::value_type("$add", &VirtualMachine::ExecuteIntegerOperation));
+	integerFunctions.insert(functionMap::value_type("$min", &VirtualMachine::ExecuteIntegerOperation));
+	integerFunctions.insert(functionMap::value_type("$mul", &VirtualMachine::ExecuteIntegerOperation));
+	integerFunctions.insert(functionMap::value_type("$uniPlus", &VirtualMachine::ExecuteIntegerOperation));
+	integerFunctions.insert(functionMap::value_type("$uniMin", &VirtualMachine::ExecuteIntegerOperation));
+	integerFunctions.insert(functionMap::value_type("$mod", &VirtualMachine::ExecuteIntegerOperation));
+	integerFunctions.insert(functionMap::value_type("$less", &VirtualMachine::ExecuteIntegerCompare));
+	integerFunctions.insert(functionMap::value_type("$lessOrEq", &VirtualMachine::ExecuteIntegerCompare));
+	integerFunctions.insert(functionMap::value_type("$greater", &VirtualMachine::ExecuteIntegerCompare));
+	integerFunctions.insert(functionMap::value_type("$greaterOrEq", &VirtualMachine::ExecuteIntegerCompare));
+	integerFunctions.insert(functionMap::value_type("$equals", &VirtualMachine::ExecuteIntegerCompare));
+	integerFunctions.insert(functionMap::value_type("$notEquals", &VirtualMachine::ExecuteIntegerCompare));
+	integerFunctions.insert(functionMap::value_type("$compare", &VirtualMachine::ExecuteIntegerCompare));
+	integerFunctions.insert(functionMap::value_type("$ifCompare", &VirtualMachine::ExecuteIntegerCompareBranch));
+	integerFunctions.insert(functionMap::value_type("$whileCompare", &VirtualMachine::ExecuteIntegerCompareBranch));
+	integerFunctions.insert(functionMap::value_type("$increment", &VirtualMachine::ExecuteIntegerIncrement));
+	integerFunctions.insert(functionMap::value_type("$decrement", &VirtualMachine::ExecuteIntegerIncrement));
+	integerFunctions.insert(functionMap::value_type("$addConstant", &VirtualMachine::ExecuteIntegerIncrement));
+	integerFunctions.insert(functionMap::value_type("$subtractConstant", &VirtualMachine::ExecuteIntegerIncrement));
+	integerFunctions.insert(functionMap::value_type("$gcd", &VirtualMachine::ExecuteIntegerGcd));
+	integerFunctions.insert(functionMap::value_type("$fib", &VirtualMachine::ExecuteIntegerFibonacci));
 
 	// Math Constants
 	functions.insert(functionMap::value_type("$mathpi", &VirtualMachine::ExecutePiConstant));
@@ -10,6 +10,7 @@
 #include <map>
 #include <string>
 #include "CompilerNode.h"
+#include "NumericPolicy.h"
 class VirtualMachine;
 
 class FunctionCaller {
@@ -19,6 +20,14 @@ private:
     typedef std::shared_ptr<CompilerNode> (VirtualMachine::*MFP)(CompilerNode);
     typedef std::map<std::string, MFP> functionMap;
     functionMap functions;
+
+    // Handlers for the nodes the IntegerTypeInference marked as integral
+    functionMap integerFunctions;
+
+    // The builtins of BuiltinMath by their index, run by the operation of the precision
+    typedef std::shared_ptr<CompilerNode> (VirtualMachine::*BuiltinMFP)(int, CompilerNode&);
+    std::map<std::string, int> builtins;
+    BuiltinMFP builtinOperation;
     
     void fillFunctionMap();
     
@@ -28,4 +37,7 @@ public:
     virtual ~FunctionCaller();
 	CompilerNode compilerNode;
     std::shared_ptr<CompilerNode> Call(const std::string& functionName, CompilerNode compilerNode);
+
+	// Use the math operations that compute in the given precision
+	void SetNumericMode(NumericMode mode);
 };
\ No newline at end of file
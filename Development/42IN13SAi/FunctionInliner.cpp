@@ -0,0 +1,397 @@
+#include "FunctionInliner.h"
+#include "IrInstruction.h"
+#include "JitRuntime.h"
+#include "Symbol.h"
+#include <cstdlib>
+#include <set>
+
+FunctionInliner::FunctionInliner(SymbolTable* p_globals, SubroutineTable* p_subroutines, int p_sizeLimit) : globals(p_globals), subroutines(p_subroutines), sizeLimit(p_sizeLimit)
+{
+}
+
+FunctionInliner::~FunctionInliner()
+{
+}
+
+int FunctionInliner::Inline()
+{
+	std::vector<Subroutine*> subroutineVector = subroutines->GetSubroutineVector();
+
+	// A caller that no longer calls anything can be inlined in the next round
+	bool changed = true;
+	for (size_t round = 0; changed && round <= subroutineVector.size(); round++)
+	{
+		changed = false;
+		rejections.clear();
+
+		for (Subroutine* caller : subroutineVector)
+		{
+			if (InlineCalls(caller))
+				changed = true;
+		}
+	}
+	return inlined;
+}
+
+bool FunctionInliner::InlineCalls(Subroutine* caller)
+{
+	bool changed = false;
+	std::shared_ptr<LinkedList> nodes = caller->GetCompilerNodeCollection();
+
+	for (std::shared_ptr<ListNode> listNode : GetListNodes(nodes))
+	{
+		std::shared_ptr<CompilerNode> statement = listNode->GetData();
+		std::vector<CallSite> calls;
+		FindCalls(statement, false, calls);
+		if (calls.empty())
+			continue;
+
+		std::vector<std::shared_ptr<CompilerNode>> parameters = calls.at(0).call->GetNodeparameters();
+		Subroutine* callee = !parameters.empty() && parameters.at(0) != nullptr ? subroutines->GetSubroutine(parameters.at(0)->GetValue()) : nullptr;
+		if (callee == nullptr)
+			continue;
+
+		std::string reason = CheckCallee(callee);
+		if (reason.empty())
+			reason = CheckCallSite(caller, statement, calls, callee);
+
+		if (!reason.empty())
+		{
+			std::string key = callee->name + " into " + caller->name;
+			if (rejections.count(key) == 0)
+				rejections[key] = reason;
+			continue;
+		}
+
+		InlineCall(caller, nodes, listNode, calls.at(0).call, callee);
+		inlinedCalls[caller->name][callee->name]++;
+		changed = true;
+	}
+	return changed;
+}
+
+void FunctionInliner::InlineCall(Subroutine* caller, std::shared_ptr<LinkedList> nodes, std::shared_ptr<ListNode> statementNode, std::shared_ptr<CompilerNode> call, Subroutine* callee)
+{
+	inlined++;
+	std::string result = "$" + callee->name + std::to_string(inlined);
+	caller->AddLocal(Symbol(result, MyTokenType::Float, SymbolKind::Local));
+
+	std::vector<std::shared_ptr<ListNode>> body = GetListNodes(callee->GetCompilerNodeCollection());
+	std::vector<Symbol*> parameters = callee->GetSymbolTable()->GetSymbolVector();
+
+	// The parameters and locals of the callee become locals of the caller
+	std::vector<std::string> variables;
+	for (Symbol* parameter : parameters)
+		variables.push_back(parameter->name);
+	for (std::shared_ptr<ListNode> listNode : body)
+		CollectVariables(listNode->GetData(), variables);
+
+	std::map<std::string, std::string> names;
+	for (std::string variable : variables)
+	{
+		if (callee->HasLocal(variable) && names.count(variable) == 0)
+		{
+			names[variable] = result + "_" + variable;
+			caller->AddLocal(Symbol(names[variable], MyTokenType::Float, SymbolKind::Local));
+		}
+	}
+
+	// Bind the arguments the way ExecuteFunction does, atof and set
+	std::vector<std::shared_ptr<CompilerNode>> inserted;
+	std::vector<std::shared_ptr<CompilerNode>> arguments = call->GetNodeparameters();
+	for (size_t i = 0; i < parameters.size(); i++)
+	{
+		std::vector<std::shared_ptr<CompilerNode>> assignment;
+		assignment.push_back(std::make_shared<CompilerNode>("$identifier", names[parameters.at(i)->name], false));
+		assignment.push_back(arguments.at(i + 1));
+		inserted.push_back(std::make_shared<CompilerNode>("$assignment", assignment, nullptr, false));
+	}
+
+	// Every ret assigns the result and jumps to the end
+	std::shared_ptr<CompilerNode> end = std::make_shared<CompilerNode>("$doNothing", "", false);
+	std::map<CompilerNode*, std::shared_ptr<CompilerNode>> clones;
+	for (size_t i = 0; i < body.size(); i++)
+	{
+		std::shared_ptr<CompilerNode> node = body.at(i)->GetData();
+		std::shared_ptr<CompilerNode> clone;
+		if (node->GetExpression() == "$ret")
+		{
+			std::vector<std::shared_ptr<CompilerNode>> assignment;
+			assignment.push_back(std::make_shared<CompilerNode>("$identifier", result, false));
+			assignment.push_back(Clone(node->GetNodeparameters().at(0), names));
+			clone = std::make_shared<CompilerNode>("$assignment", assignment, nullptr, false);
+		}
+		else
+			clone = Clone(node, names);
+
+		clones[node.get()] = clone;
+		inserted.push_back(clone);
+
+		if (node->GetExpression() == "$ret" && i + 1 < body.size())
+			inserted.push_back(std::make_shared<CompilerNode>("$doNothing", "", end, false));
+	}
+
+	for (std::shared_ptr<ListNode> listNode : body)
+	{
+		std::shared_ptr<CompilerNode> jumpTo = listNode->GetData()->GetJumpTo();
+		if (jumpTo != nullptr)
+			clones[listNode->GetData().get()]->SetJumpTo(clones[jumpTo.get()]);
+	}
+
+	// A call on its own becomes the end, otherwise the statement reads the result
+	std::shared_ptr<CompilerNode> statement = statementNode->GetData();
+	std::shared_ptr<CompilerNode> replacement = end;
+	if (statement != call)
+	{
+		replacement = Replace(statement, call, std::make_shared<CompilerNode>("$getVariable", result, false));
+		inserted.push_back(end);
+	}
+
+	// $if and the loops continue after their target, a $doNothing at it
+	for (std::shared_ptr<ListNode> listNode : GetListNodes(nodes))
+	{
+		if (listNode->GetData()->GetJumpTo() != statement)
+			continue;
+
+		if (IsJumpAfterTarget(listNode->GetData()->GetExpression()))
+			listNode->GetData()->SetJumpTo(replacement);
+		else
+			listNode->GetData()->SetJumpTo(inserted.front());
+	}
+
+	statementNode->SetData(replacement);
+	for (std::shared_ptr<CompilerNode> node : inserted)
+		nodes->InsertBefore(statementNode, node);
+}
+
+// Empty when the body can be copied into any caller
+std::string FunctionInliner::CheckCallee(Subroutine* callee)
+{
+	std::vector<std::shared_ptr<ListNode>> body = GetListNodes(callee->GetCompilerNodeCollection());
+	if (body.empty())
+		return "it is empty";
+	if ((int)body.size() > sizeLimit)
+		return "it has " + std::to_string(body.size()) + " statements, the limit is " + std::to_string(sizeLimit);
+	// The end has to be a ret or a jump back, a tail call for example
+	std::shared_ptr<CompilerNode> last = body.back()->GetData();
+	if (last->GetExpression() != "$ret" && (last->GetExpression() != "$doNothing" || last->GetJumpTo() == nullptr))
+		return "it can end without ret";
+
+	// The locals that are always assigned before the first branch
+	std::set<std::string> assigned;
+	for (Symbol* parameter : callee->GetSymbolTable()->GetSymbolVector())
+		assigned.insert(parameter->name);
+	bool straight = true;
+
+	for (std::shared_ptr<ListNode> listNode : body)
+	{
+		std::shared_ptr<CompilerNode> node = listNode->GetData();
+		std::string expression = node->GetExpression();
+		std::vector<std::shared_ptr<CompilerNode>> parameters = node->GetNodeparameters();
+
+		std::vector<CallSite> calls;
+		FindCalls(node, false, calls);
+		if (!calls.empty())
+		{
+			std::string name = calls.at(0).call->GetNodeparameters().empty() ? "" : calls.at(0).call->GetNodeparameters().at(0)->GetValue();
+			return name == callee->name ? "it is recursive" : "it calls " + name;
+		}
+
+		if (expression != "$assignment" && expression != "$if" && expression != "$whileLoop" && expression != "$doNothing" && expression != "$ret")
+			return "it has a " + expression.substr(1);
+		if (expression == "$assignment" && (parameters.size() != 2 || parameters.at(0) == nullptr))
+			return "it has an assignment without a value";
+
+		std::vector<std::string> variables;
+		CollectVariables(expression == "$assignment" ? parameters.at(1) : node, variables);
+		for (std::string variable : variables)
+		{
+			if (callee->HasLocal(variable))
+			{
+				if (assigned.count(variable) == 0)
+					return "it can read " + variable + " before assigning it";
+			}
+			else if (!globals->HasSymbol(variable))
+				return "it reads " + variable + ", which isn't a local or a global";
+		}
+
+		if (expression == "$assignment")
+		{
+			std::string target = parameters.at(0)->GetValue();
+			if (!callee->HasLocal(target))
+				return "it assigns the global " + target;
+			if (straight)
+				assigned.insert(target);
+		}
+
+		// The caller reads the result as a number, a literal has to give the same number back
+		if (expression == "$ret" && !parameters.empty() && parameters.at(0) != nullptr && parameters.at(0)->GetExpression() == "$value")
+		{
+			std::string text = parameters.at(0)->GetValue();
+			if (atof(JitRuntime::ToString(atof(text.c_str())).c_str()) != atof(text.c_str()))
+				return "it returns the literal " + text;
+		}
+
+		if (expression != "$assignment" && (expression != "$doNothing" || node->GetJumpTo() != nullptr))
+			straight = false;
+	}
+	return "";
+}
+
+// Empty when the call in this statement can be replaced by the body
+std::string FunctionInliner::CheckCallSite(Subroutine* caller, std::shared_ptr<CompilerNode> statement, std::vector<CallSite>& calls, Subroutine* callee)
+{
+	if (calls.size() > 1)
+		return "the statement has more than one call";
+
+	CallSite call = calls.at(0);
+	std::string expression = statement->GetExpression();
+	if (expression == "$whileLoop" || expression == "$forLoop")
+		return "the call is in a loop header";
+	if (call.call != statement && !call.numeric)
+		return "the result isn't read as a number";
+	if ((int)call.call->GetNodeparameters().size() - 1 != callee->GetSymbolTable()->ParameterSize())
+		return "the number of arguments is wrong";
+	if (CanThrow(statement, call.call))
+		return "the rest of the statement can throw";
+
+	// The globals the callee reads can't be hidden by a local of the caller
+	std::vector<std::string> variables;
+	for (std::shared_ptr<ListNode> listNode : GetListNodes(callee->GetCompilerNodeCollection()))
+		CollectVariables(listNode->GetData(), variables);
+
+	for (std::string variable : variables)
+	{
+		if (!callee->HasLocal(variable) && caller->HasLocal(variable))
+			return caller->name + " has a local " + variable;
+	}
+	return "";
+}
+
+void FunctionInliner::FindCalls(std::shared_ptr<CompilerNode> node, bool numeric, std::vector<CallSite>& calls)
+{
+	// With whether the node above reads it as a number, in the order a recursive walk finds the calls
+	std::vector<std::pair<std::shared_ptr<CompilerNode>, bool>> work;
+	work.push_back(std::make_pair(node, numeric));
+	while (!work.empty())
+	{
+		node = work.back().first;
+		numeric = work.back().second;
+		work.pop_back();
+		if (node == nullptr)
+			continue;
+
+		std::string expression = node->GetExpression();
+		if (expression == "$functionCall")
+		{
+			calls.push_back({ node, numeric });
+			numeric = false;
+		}
+		else
+			numeric = ReadsNumbers(expression);
+
+		std::vector<std::shared_ptr<CompilerNode>> parameters = node->GetNodeparameters();
+		for (auto parameter = parameters.rbegin(); parameter != parameters.rend(); parameter++)
+			work.push_back(std::make_pair(*parameter, numeric));
+	}
+}
+
+void FunctionInliner::CollectVariables(std::shared_ptr<CompilerNode> node, std::vector<std::string>& variables)
+{
+	std::vector<std::shared_ptr<CompilerNode>> work;
+	work.push_back(node);
+	while (!work.empty())
+	{
+		node = work.back();
+		work.pop_back();
+		if (node == nullptr)
+			continue;
+
+		if (node->GetExpression() == "$getVariable" || node->GetExpression() == "$identifier")
+			variables.push_back(node->GetValue());
+
+		std::vector<std::shared_ptr<CompilerNode>> parameters = node->GetNodeparameters();
+		work.insert(work.end(), parameters.rbegin(), parameters.rend());
+	}
+}
+
+bool FunctionInliner::CanThrow(std::shared_ptr<CompilerNode> node, std::shared_ptr<CompilerNode> skip)
+{
+	std::vector<std::shared_ptr<CompilerNode>> work;
+	work.push_back(node);
+	while (!work.empty())
+	{
+		node = work.back();
+		work.pop_back();
+		if (node == nullptr || node == skip)
+			continue;
+
+		std::string expression = node->GetExpression();
+		if (IrInstruction::IsBuiltin(expression) && IrInstruction::CanBuiltinFail(expression))
+			return true;
+
+		std::vector<std::shared_ptr<CompilerNode>> parameters = node->GetNodeparameters();
+		work.insert(work.end(), parameters.begin(), parameters.end());
+	}
+	return false;
+}
+
+// A copy with the variables renamed, the jumps are set afterwards
+std::shared_ptr<CompilerNode> FunctionInliner::Clone(std::shared_ptr<CompilerNode> node, std::map<std::string, std::string>& names)
+{
+	return CompilerNode::Rewrite(node, nullptr, [&](std::shared_ptr<CompilerNode> part, std::vector<std::shared_ptr<CompilerNode>>& parameters, bool) {
+		std::string value = part->GetValue();
+		if ((part->GetExpression() == "$getVariable" || part->GetExpression() == "$identifier") && names.count(value) > 0)
+			value = names[value];
+
+		return std::make_shared<CompilerNode>(part->GetExpression(), value, parameters, nullptr, false);
+	});
+}
+
+std::shared_ptr<CompilerNode> FunctionInliner::Replace(std::shared_ptr<CompilerNode> node, std::shared_ptr<CompilerNode> target, std::shared_ptr<CompilerNode> replacement)
+{
+	return CompilerNode::Rewrite(node, [&](std::shared_ptr<CompilerNode> part, std::shared_ptr<CompilerNode>) {
+		return part == target ? replacement : nullptr;
+	});
+}
+
+// The nodes that atof their parameters, the text of the value doesn't matter
+bool FunctionInliner::ReadsNumbers(std::string expression)
+{
+	return expression == "$assignment" || expression == "$less" || expression == "$lessOrEq" || expression == "$greater"
+		|| expression == "$greaterOrEq" || expression == "$equals" || expression == "$notEquals" || IrInstruction::IsBuiltin(expression);
+}
+
+bool FunctionInliner::IsJumpAfterTarget(std::string expression)
+{
+	return expression != "$doNothing";
+}
+
+std::vector<std::shared_ptr<ListNode>> FunctionInliner::GetListNodes(std::shared_ptr<LinkedList> nodes)
+{
+	std::vector<std::shared_ptr<ListNode>> listNodes;
+	for (std::shared_ptr<ListNode> listNode = nodes->GetHead(); listNode && listNode->GetData(); listNode = listNode->GetNext())
+		listNodes.push_back(listNode);
+	return listNodes;
+}
+
+int FunctionInliner::GetInlineCount()
+{
+	return inlined;
+}
+
+std::vector<std::string> FunctionInliner::GetLog()
+{
+	std::vector<std::string> log;
+	for (auto& caller : inlinedCalls)
+	{
+		for (auto& callee : caller.second)
+			log.push_back("Inlined " + callee.first + " into " + caller.first + " (" + std::to_string(callee.second) + (callee.second == 1 ? " call)" : " calls)"));
+	}
+
+	for (auto& rejection : rejections)
+		log.push_back("Not inlining " + rejection.first + ": " + rejection.second);
+
+	log.push_back("Inlining: " + std::to_string(inlined) + " calls inlined");
+	return log;
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "CompilerNode.h"
+#include "LinkedList.h"
+#include "SymbolTable.h"
+#include "Subroutine.h"
+#include "SubroutineTable.h"
+
+// Copies the body of small functions that don't call anything into their
+// callers:
+//
+//   x = y + square(a + 1);          $square1_n = a + 1
+//                                   $square1 = $square1_n * $square1_n
+//                              ->   $doNothing
+//                                   x = y + $square1
+//
+// The locals and parameters get a name of their own in the caller and every
+// ret assigns the result and jumps to the $doNothing at the end. Every call
+// starts with unset locals while the inlined ones keep the value of the last
+// time, so a function is only inlined when it assigns every local before
+// reading it and doesn't assign globals, print or stop. The body runs in front of the
+// statement, so the statement may only have that one call, nothing else in it
+// may throw and the result has to be read as a number, a prnt or ret would
+// print the text of the variable instead of the text of the ret.
+class FunctionInliner
+{
+public:
+	FunctionInliner(SymbolTable* p_globals, SubroutineTable* p_subroutines, int p_sizeLimit);
+	virtual ~FunctionInliner();
+
+	// Inline into every subroutine, the inlined callers can be inlined in turn
+	int Inline();
+
+	int GetInlineCount();
+	std::vector<std::string> GetLog();
+
+private:
+	struct CallSite
+	{
+		std::shared_ptr<CompilerNode> call;
+		bool numeric;
+	};
+
+	SymbolTable* globals;
+	SubroutineTable* subroutines;
+	int sizeLimit;
+	int inlined = 0;
+
+	// Call sites inlined per caller and callee, and why the others weren't
+	std::map<std::string, std::map<std::string, int>> inlinedCalls;
+	std::map<std::string, std::string> rejections;
+
+	bool InlineCalls(Subroutine* caller);
+	void InlineCall(Subroutine* caller, std::shared_ptr<LinkedList> nodes, std::shared_ptr<ListNode> statementNode, std::shared_ptr<CompilerNode> call, Subroutine* callee);
+	std::string CheckCallee(Subroutine* callee);
+	std::string CheckCallSite(Subroutine* caller, std::shared_ptr<CompilerNode> statement, std::vector<CallSite>& calls, Subroutine* callee);
+
+	void FindCalls(std::shared_ptr<CompilerNode> node, bool numeric, std::vector<CallSite>& calls);
+	void CollectVariables(std::shared_ptr<CompilerNode> node, std::vector<std::string>& variables);
+	bool CanThrow(std::shared_ptr<CompilerNode> node, std::shared_ptr<CompilerNode> skip);
+	std::shared_ptr<CompilerNode> Clone(std::shared_ptr<CompilerNode> node, std::map<std::string, std::string>& names);
+	std::shared_ptr<CompilerNode> Replace(std::shared_ptr<CompilerNode> node, std::shared_ptr<CompilerNode> target, std::shared_ptr<CompilerNode> replacement);
+
+	static bool ReadsNumbers(std::string expression);
+	static bool IsJumpAfterTarget(std::string expression);
+	static std::vector<std::shared_ptr<ListNode>> GetListNodes(std::shared_ptr<LinkedList> nodes);
+};
@@ -28,6 +28,7 @@ Highlighter::Highlighter(std::map<std::string, QColor> colors, QTextDocument *pa
             case MyTokenType::ElseIf:
             case MyTokenType::While:
             case MyTokenType::ForLoop:
+            case MyTokenType::Import:
 
                 setCurrentFormat(currentFormat, rule, QRegExp(QString::fromUtf8(iter->matcher.GetRegexString().c_str())), QFont::Normal, colors["identifiers"]);
                 break;
@@ -0,0 +1,200 @@
+#include "IncrementalCache.h"
+#include <chrono>
+#include <cstdio>
+#include "LinkedList.h"
+
+IncrementalCache::IncrementalCache()
+{
+}
+
+IncrementalCache::~IncrementalCache()
+{
+}
+
+// What the last run used can be used by this one, the rest is dropped
+void IncrementalCache::StartRun()
+{
+	previousLines.clear();
+	previousLines.swap(lines);
+	previousFunctions.clear();
+	previousFunctions.swap(functions);
+
+	linesReused = 0;
+	linesTokenized = 0;
+	functionsReused.clear();
+	functionsParsed.clear();
+	secondsSaved = 0;
+	runs++;
+}
+
+const std::vector<IncrementalCache::LineToken>* IncrementalCache::FindLine(const std::string& text)
+{
+	auto found = lines.find(text);
+	if (found == lines.end())
+	{
+		auto previous = previousLines.find(text);
+		if (previous == previousLines.end())
+			return nullptr;
+		found = lines.insert(std::make_pair(text, std::move(previous->second))).first;
+		previousLines.erase(previous);
+	}
+
+	linesReused++;
+	secondsSaved += found->second.seconds;
+	return &found->second.tokens;
+}
+
+void IncrementalCache::StoreLine(const std::string& text, std::vector<LineToken> tokens, double seconds)
+{
+	linesTokenized++;
+	CachedLine& line = lines[text];
+	line.tokens = std::move(tokens);
+	line.seconds = seconds;
+}
+
+// FNV-1a, like the key of the ProgramCache
+uint64_t IncrementalCache::Hash(uint64_t hash, const void* data, size_t size)
+{
+	const unsigned char* bytes = (const unsigned char*)data;
+	for (size_t i = 0; i < size; i++)
+	{
+		hash ^= bytes[i];
+		hash *= 1099511628211ull;
+	}
+	return hash;
+}
+
+uint64_t IncrementalCache::HashSymbol(uint64_t hash, Symbol* symbol)
+{
+	int type = (int)symbol->type;
+	int kind = (int)symbol->kind;
+	hash = Hash(hash, symbol->name.c_str(), symbol->name.size() + 1);
+	hash = Hash(hash, &type, sizeof(type));
+	return Hash(hash, &kind, sizeof(kind));
+}
+
+// The tokens from start to end with their lines counted from the first, and the hash of the globals
+uint64_t IncrementalCache::GetFingerprint(const std::vector<std::shared_ptr<Token>>& tokens, int start, int end, uint64_t globals)
+{
+	uint64_t hash = Hash(14695981039346656037ull, &globals, sizeof(globals));
+	int firstLine = tokens[start]->LineNumber;
+	for (int i = start; i <= end; i++)
+	{
+		Token* token = tokens[i].get();
+		int numbers[] = { (int)token->Type, token->Level, token->LineNumber - firstLine, token->LinePosition };
+		hash = Hash(hash, numbers, sizeof(numbers));
+		hash = Hash(hash, token->Value.c_str(), token->Value.size() + 1);
+	}
+	return hash;
+}
+
+std::shared_ptr<Subroutine> IncrementalCache::FindFunction(uint64_t fingerprint, int line, std::map<CompilerNode*, int>& copyLines)
+{
+	auto found = functions.find(fingerprint);
+	if (found == functions.end())
+	{
+		auto previous = previousFunctions.find(fingerprint);
+		if (previous == previousFunctions.end())
+			return nullptr;
+		found = functions.insert(std::make_pair(fingerprint, std::move(previous->second))).first;
+		previousFunctions.erase(previous);
+	}
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	std::shared_ptr<Subroutine> subroutine = Copy(found->second.subroutine.get(), found->second.lines, line, copyLines);
+	double copySeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	functionsReused.push_back(subroutine->name);
+	secondsSaved += found->second.seconds - copySeconds;
+	return subroutine;
+}
+
+// Keeps a copy of the function as it was parsed, with its lines counted from line
+void IncrementalCache::StoreFunction(uint64_t fingerprint, Subroutine* subroutine, int line, const std::map<CompilerNode*, int>& functionLines, double seconds)
+{
+	functionsParsed.push_back(subroutine->name);
+	CachedFunction& function = functions[fingerprint];
+	function.lines.clear();
+	function.subroutine = Copy(subroutine, functionLines, -line, function.lines);
+	function.seconds = seconds;
+}
+
+// A copy of the nodes of the body, a shared node and the target of a jump stay one node
+std::shared_ptr<Subroutine> IncrementalCache::Copy(Subroutine* subroutine, const std::map<CompilerNode*, int>& lines, int lineOffset, std::map<CompilerNode*, int>& copyLines)
+{
+	std::vector<std::shared_ptr<CompilerNode>> body;
+	for (std::shared_ptr<ListNode> listNode = subroutine->GetCompilerNodeCollection()->GetHead(); listNode && listNode->GetData(); listNode = listNode->GetNext())
+		body.push_back(listNode->GetData());
+
+	// A stack instead of recursion, an expression is as deep as it is long
+	std::unordered_map<CompilerNode*, std::shared_ptr<CompilerNode>> copies;
+	std::vector<std::shared_ptr<CompilerNode>> nodes;
+	std::vector<std::shared_ptr<CompilerNode>> pending(body.rbegin(), body.rend());
+	while (!pending.empty())
+	{
+		std::shared_ptr<CompilerNode> node = pending.back();
+		pending.pop_back();
+		if (node == nullptr || copies.count(node.get()) > 0)
+			continue;
+
+		copies[node.get()] = std::make_shared<CompilerNode>(*node);
+		nodes.push_back(node);
+
+		std::shared_ptr<CompilerNode> jump = node->GetJumpTo();
+		if (jump != nullptr)
+			pending.push_back(jump);
+
+		std::vector<std::shared_ptr<CompilerNode>> parameters = node->GetNodeparameters();
+		pending.insert(pending.end(), parameters.rbegin(), parameters.rend());
+	}
+
+	// The copies still point at the originals
+	for (std::shared_ptr<CompilerNode> node : nodes)
+	{
+		std::shared_ptr<CompilerNode> copy = copies[node.get()];
+		std::vector<std::shared_ptr<CompilerNode>> parameters = node->GetNodeparameters();
+		for (std::shared_ptr<CompilerNode>& parameter : parameters)
+			parameter = parameter != nullptr ? copies[parameter.get()] : nullptr;
+		copy->SetNodeParameters(parameters);
+
+		std::shared_ptr<CompilerNode> jump = node->GetJumpTo();
+		copy->SetJumpTo(jump != nullptr ? copies[jump.get()] : nullptr);
+
+		auto line = lines.find(node.get());
+		if (line != lines.end())
+			copyLines[copy.get()] = line->second + lineOffset;
+	}
+
+	std::shared_ptr<Subroutine> copy = std::make_shared<Subroutine>(subroutine->name, subroutine->returnType, subroutine->kind, *subroutine->GetSymbolTable());
+	copy->isPure = subroutine->isPure;
+	for (std::shared_ptr<CompilerNode> node : body)
+		copy->AddCompilerNode(copies[node.get()]);
+	return copy;
+}
+
+std::string IncrementalCache::GetNames(const std::vector<std::string>& names)
+{
+	std::string text;
+	for (size_t i = 0; i < names.size() && i < 8; i++)
+		text += (i > 0 ? ", " : "") + names[i];
+	if (names.size() > 8)
+		text += " and " + std::to_string(names.size() - 8) + " more";
+	return text;
+}
+
+std::string IncrementalCache::GetReport()
+{
+	if (runs < 2)
+		return "";
+
+	char saved[32];
+	snprintf(saved, sizeof(saved), "%.3f", secondsSaved > 0 ? secondsSaved : 0.0);
+
+	std::string report = "Incremental: " + std::to_string(linesReused) + " of " + std::to_string(linesReused + linesTokenized) + " lines and "
+		+ std::to_string(functionsReused.size()) + " of " + std::to_string(functionsReused.size() + functionsParsed.size()) + " functions reused";
+	if (!functionsReused.empty())
+		report += ", reused " + GetNames(functionsReused);
+	if (!functionsParsed.empty())
+		report += ", parsed " + GetNames(functionsParsed);
+	return report + ", " + saved + "s saved";
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "CompilerNode.h"
+#include "MyTokenType.h"
+#include "Subroutine.h"
+#include "Symbol.h"
+#include "Token.h"
+
+// What a compile keeps for the next one, an edit of one function tokenizes
+// its lines and parses its body again and takes the rest from the last run:
+//
+//   "var x = a + 1;"            ->  Var "var", Identifier "x", ... (no regex)
+//   fingerprint(func f) = hash(tokens of the block, globals before it)
+//                               ->  a copy of the Subroutine as it was parsed
+//
+// The tokens of a line only depend on its text, the level and the partners
+// are set again while they are added. The fingerprint of a body holds its
+// tokens with their lines counted from the func token, so a function that
+// only moved is reused too, and the names and types of the globals it can
+// see. A body is parsed on its own, the calls of other functions are
+// resolved by name, the optimization passes run over the whole program
+// every time. A changed signature or global reaches every caller that way.
+//
+// The parsed Subroutines are copied in and out, the passes change the
+// nodes of the compile. What a run didn't use is dropped at the next one.
+// The time saved is what the reused lines and bodies took the first time,
+// less the copies.
+class IncrementalCache
+{
+public:
+	struct LineToken
+	{
+		MyTokenType type;
+		std::string value;
+		int linePosition;
+	};
+
+	IncrementalCache();
+	virtual ~IncrementalCache();
+
+	// Called before the tokenizer of every compile
+	void StartRun();
+
+	// The tokens of a line with this text, nullptr when it wasn't tokenized before
+	const std::vector<LineToken>* FindLine(const std::string& text);
+	void StoreLine(const std::string& text, std::vector<LineToken> tokens, double seconds);
+
+	static uint64_t HashSymbol(uint64_t hash, Symbol* symbol);
+	static uint64_t GetFingerprint(const std::vector<std::shared_ptr<Token>>& tokens, int start, int end, uint64_t globals);
+
+	// A copy of the function, its lines are added to lines, nullptr when it isn't in the cache
+	std::shared_ptr<Subroutine> FindFunction(uint64_t fingerprint, int line, std::map<CompilerNode*, int>& lines);
+	void StoreFunction(uint64_t fingerprint, Subroutine* subroutine, int line, const std::map<CompilerNode*, int>& lines, double seconds);
+
+	// What the last compile reused, empty for the first one
+	std::string GetReport();
+
+private:
+	struct CachedLine
+	{
+		std::vector<LineToken> tokens;
+		double seconds;
+	};
+
+	struct CachedFunction
+	{
+		std::shared_ptr<Subroutine> subroutine;
+		std::map<CompilerNode*, int> lines;
+		double seconds;
+	};
+
+	// The current run and the one before it
+	std::unordered_map<std::string, CachedLine> lines;
+	std::unordered_map<std::string, CachedLine> previousLines;
+	std::unordered_map<uint64_t, CachedFunction> functions;
+	std::unordered_map<uint64_t, CachedFunction> previousFunctions;
+
+	int runs = 0;
+	int linesReused = 0;
+	int linesTokenized = 0;
+	std::vector<std::string> functionsReused;
+	std::vector<std::string> functionsParsed;
+	double secondsSaved = 0;
+
+	static uint64_t Hash(uint64_t hash, const void* data, size_t size);
+	static std::shared_ptr<Subroutine> Copy(Subroutine* subroutine, const std::map<CompilerNode*, int>& lines, int lineOffset, std::map<CompilerNode*, int>& copyLines);
+	static std::string GetNames(const std::vector<std::string>& names);
+};
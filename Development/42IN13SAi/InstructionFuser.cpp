@@ -0,0 +1,192 @@
+#include "InstructionFuser.h"
+#include <map>
+
+InstructionFuser::InstructionFuser()
+{
+}
+
+InstructionFuser::~InstructionFuser()
+{
+}
+
+int InstructionFuser::Fuse(std::shared_ptr<LinkedList> nodes)
+{
+	int fusionsBefore = GetFusionCount();
+
+	// Keep the replaced nodes alive, jumps only hold a weak pointer to them
+	std::map<CompilerNode*, std::shared_ptr<CompilerNode>> replacements;
+	std::vector<std::shared_ptr<CompilerNode>> replacedNodes;
+
+	for (std::shared_ptr<ListNode> listNode = nodes->GetHead(); listNode && listNode->GetData(); listNode = listNode->GetNext())
+	{
+		std::shared_ptr<CompilerNode> node = listNode->GetData();
+		std::shared_ptr<CompilerNode> fused = FuseStatement(node);
+
+		if (fused != node)
+		{
+			listNode->SetData(fused);
+			replacements[node.get()] = fused;
+			replacedNodes.push_back(node);
+		}
+	}
+
+	// Loop ends jump back to their header, point them to the fused header
+	if (!replacements.empty())
+	{
+		for (std::shared_ptr<ListNode> listNode = nodes->GetHead(); listNode && listNode->GetData(); listNode = listNode->GetNext())
+		{
+			std::shared_ptr<CompilerNode> jumpTo = listNode->GetData()->GetJumpTo();
+			if (jumpTo == nullptr)
+				continue;
+
+			auto replacement = replacements.find(jumpTo.get());
+			if (replacement != replacements.end())
+				listNode->GetData()->SetJumpTo(replacement->second);
+		}
+	}
+
+	return GetFusionCount() - fusionsBefore;
+}
+
+std::shared_ptr<CompilerNode> InstructionFuser::FuseStatement(std::shared_ptr<CompilerNode> node)
+{
+	if (node == nullptr)
+		return node;
+
+	std::string expression = node->GetExpression();
+	std::vector<std::shared_ptr<CompilerNode>> parameters = node->GetNodeparameters();
+
+	if ((expression == "$if" || expression == "$whileLoop") && parameters.size() == 1 && IsCompare(parameters.at(0)))
+	{
+		// Compare and branch in one node
+		std::shared_ptr<CompilerNode> condition = parameters.at(0);
+		std::string fusedExpression = expression == "$if" ? "$ifCompare" : "$whileCompare";
+
+		compareBranches++;
+		return std::make_shared<CompilerNode>(fusedExpression, condition->GetExpression(), condition->GetNodeparameters(), node->GetJumpTo(), false);
+	}
+	else if (expression == "$assignment")
+	{
+		std::shared_ptr<CompilerNode> fused = FuseAssignment(node);
+		if (fused != node)
+			return fused;
+	}
+	else if (expression == "$forLoop" && parameters.size() == 3)
+	{
+		// The first parameter has to stay an assignment, the VM reads the identifier from it
+		std::vector<std::shared_ptr<CompilerNode>> fusedParameters;
+		fusedParameters.push_back(FuseExpression(parameters.at(0)));
+		fusedParameters.push_back(FuseExpression(parameters.at(1)));
+		fusedParameters.push_back(FuseStatement(parameters.at(2)));
+
+		if (fusedParameters != parameters)
+			return std::make_shared<CompilerNode>(expression, node->GetValue(), fusedParameters, node->GetJumpTo(), false);
+		return node;
+	}
+
+	// Fuse the expressions used by the statement
+	return FuseExpression(node);
+}
+
+std::shared_ptr<CompilerNode> InstructionFuser::FuseAssignment(std::shared_ptr<CompilerNode> node)
+{
+	std::vector<std::shared_ptr<CompilerNode>> parameters = node->GetNodeparameters();
+	if (parameters.size() != 2 || parameters.at(0) == nullptr || parameters.at(1) == nullptr || parameters.at(0)->GetExpression() != "$identifier")
+		return node;
+
+	std::string name = parameters.at(0)->GetValue();
+	std::shared_ptr<CompilerNode> value = parameters.at(1);
+	std::string operation = value->GetExpression();
+	std::vector<std::shared_ptr<CompilerNode>> operands = value->GetNodeparameters();
+
+	// x++ and x--
+	if ((operation == "$uniPlus" || operation == "$uniMin") && operands.size() == 1 && IsVariable(operands.at(0), name))
+	{
+		increments++;
+		return std::make_shared<CompilerNode>(operation == "$uniPlus" ? "$increment" : "$decrement", name, false);
+	}
+
+	if (operands.size() != 2)
+		return node;
+
+	// x = x + c, x = c + x and x += c
+	if (operation == "$add")
+	{
+		std::shared_ptr<CompilerNode> constant = nullptr;
+		if (IsVariable(operands.at(0), name) && IsConstant(operands.at(1)))
+			constant = operands.at(1);
+		else if (IsConstant(operands.at(0)) && IsVariable(operands.at(1), name))
+			constant = operands.at(0);
+
+		if (constant != nullptr)
+		{
+			constantAdds++;
+			return std::make_shared<CompilerNode>("$addConstant", name, std::vector<std::shared_ptr<CompilerNode>>{ constant }, nullptr, false);
+		}
+	}
+
+	// x = x - c and x -= c
+	if (operation == "$min" && IsVariable(operands.at(0), name) && IsConstant(operands.at(1)))
+	{
+		constantAdds++;
+		return std::make_shared<CompilerNode>("$subtractConstant", name, std::vector<std::shared_ptr<CompilerNode>>{ operands.at(1) }, nullptr, false);
+	}
+
+	return node;
+}
+
+std::shared_ptr<CompilerNode> InstructionFuser::FuseExpression(std::shared_ptr<CompilerNode> node)
+{
+	return CompilerNode::Rewrite(node, nullptr, [&](std::shared_ptr<CompilerNode> part, std::vector<std::shared_ptr<CompilerNode>>& parameters, bool changed) {
+		if (IsCompare(part))
+		{
+			compares++;
+			return std::make_shared<CompilerNode>("$compare", part->GetExpression(), parameters, nullptr, false);
+		}
+		return CompilerNode::Copy(part, parameters, changed);
+	});
+}
+
+// A compare between two plain operands
+bool InstructionFuser::IsCompare(std::shared_ptr<CompilerNode> node)
+{
+	if (node == nullptr)
+		return false;
+
+	std::string expression = node->GetExpression();
+	if (expression != "$less" && expression != "$lessOrEq" && expression != "$greater"
+		&& expression != "$greaterOrEq" && expression != "$equals" && expression != "$notEquals")
+		return false;
+
+	std::vector<std::shared_ptr<CompilerNode>> parameters = node->GetNodeparameters();
+	return parameters.size() == 2 && IsOperand(parameters.at(0)) && IsOperand(parameters.at(1));
+}
+
+bool InstructionFuser::IsOperand(std::shared_ptr<CompilerNode> node)
+{
+	return node != nullptr && (node->GetExpression() == "$getVariable" || node->GetExpression() == "$value");
+}
+
+bool InstructionFuser::IsVariable(std::shared_ptr<CompilerNode> node, std::string name)
+{
+	return node != nullptr && node->GetExpression() == "$getVariable" && node->GetValue() == name;
+}
+
+bool InstructionFuser::IsConstant(std::shared_ptr<CompilerNode> node)
+{
+	return node != nullptr && node->GetExpression() == "$value";
+}
+
+int InstructionFuser::GetFusionCount()
+{
+	return compareBranches + compares + increments + constantAdds;
+}
+
+std::string InstructionFuser::GetReport()
+{
+	return "Instruction fusion: " + std::to_string(GetFusionCount()) + " superinstructions ("
+		+ std::to_string(compareBranches) + " compare-branch, "
+		+ std::to_string(compares) + " compare, "
+		+ std::to_string(increments) + " increment, "
+		+ std::to_string(constantAdds) + " add-constant)";
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <string>
+#include <memory>
+#include <vector>
+
+#include "CompilerNode.h"
+#include "LinkedList.h"
+
+// Rewrites the most executed node sequences into superinstructions:
+//
+//   $if / $whileLoop (a < b)       -> $ifCompare / $whileCompare  value: "$less"   params: a, b
+//   a < b (variables / values)     -> $compare                    value: "$less"   params: a, b
+//   x++ / x--                      -> $increment / $decrement     value: "x"
+//   x = x + c / x += c             -> $addConstant                value: "x"       params: c
+//   x = x - c / x -= c             -> $subtractConstant           value: "x"       params: c
+//
+// The fused handlers in the VirtualMachine round every intermediate result
+// the same way the unfused nodes do, so both paths print the same output.
+class InstructionFuser
+{
+public:
+	InstructionFuser();
+	virtual ~InstructionFuser();
+
+	// Fuse all statements in the list and repoint jumps to the new nodes
+	int Fuse(std::shared_ptr<LinkedList> nodes);
+	std::shared_ptr<CompilerNode> FuseStatement(std::shared_ptr<CompilerNode> node);
+
+	int GetFusionCount();
+	std::string GetReport();
+
+private:
+	int compareBranches = 0;
+	int compares = 0;
+	int increments = 0;
+	int constantAdds = 0;
+
+	std::shared_ptr<CompilerNode> FuseExpression(std::shared_ptr<CompilerNode> node);
+	std::shared_ptr<CompilerNode> FuseAssignment(std::shared_ptr<CompilerNode> node);
+
+	bool IsCompare(std::shared_ptr<CompilerNode> node);
+	bool IsOperand(std::shared_ptr<CompilerNode> node);
+	bool IsVariable(std::shared_ptr<CompilerNode> node, std::string name);
+	bool IsConstant(std::shared_ptr<CompilerNode> node);
+};
@@ -0,0 +1,253 @@
+#include "IntegerTypeInference.h"
+#include "Symbol.h"
+#include <cmath>
+#include <cstdlib>
+
+IntegerTypeInference::IntegerTypeInference(SubroutineTable* p_subroutines) : subroutines(p_subroutines)
+{
+}
+
+IntegerTypeInference::~IntegerTypeInference()
+{
+}
+
+int IntegerTypeInference::Infer(std::list<std::shared_ptr<CompilerNode>>& globalNodes)
+{
+	std::vector<Subroutine*> subroutineVector = subroutines->GetSubroutineVector();
+
+	// A function that can end without a ret doesn't give a number
+	for (Subroutine* subroutine : subroutineVector)
+	{
+		bool returns = false;
+		for (std::shared_ptr<CompilerNode> node : GetStatements(subroutine))
+			returns = returns || (node != nullptr && node->GetExpression() == "$ret");
+		if (!returns)
+			fractionalReturns.insert(subroutine->name);
+	}
+
+	// Every name starts out whole, a fraction written to one can make others fractional
+	changed = true;
+	while (changed)
+	{
+		changed = false;
+		for (std::shared_ptr<CompilerNode> node : globalNodes)
+			Collect(node, nullptr);
+
+		for (Subroutine* subroutine : subroutineVector)
+		{
+			for (std::shared_ptr<CompilerNode> node : GetStatements(subroutine))
+				Collect(node, subroutine);
+		}
+	}
+
+	for (std::shared_ptr<CompilerNode> node : globalNodes)
+		Mark(node);
+
+	for (Subroutine* subroutine : subroutineVector)
+	{
+		for (std::shared_ptr<CompilerNode> node : GetStatements(subroutine))
+			Mark(node);
+	}
+
+	return reads + arithmetic + compares + increments + builtins;
+}
+
+void IntegerTypeInference::AddExternal(std::string name)
+{
+	variables.insert(name);
+	fractional.insert(name);
+}
+
+bool IntegerTypeInference::IsIntegralVariable(std::string name)
+{
+	return fractional.count(name) == 0;
+}
+
+void IntegerTypeInference::Collect(std::shared_ptr<CompilerNode> node, Subroutine* subroutine)
+{
+	std::vector<std::shared_ptr<CompilerNode>> work;
+	work.push_back(node);
+	while (!work.empty())
+	{
+		node = work.back();
+		work.pop_back();
+		if (node == nullptr)
+			continue;
+
+		std::string expression = node->GetExpression();
+		std::vector<std::shared_ptr<CompilerNode>> parameters = node->GetNodeparameters();
+
+		if (expression == "$assignment" && parameters.size() == 2 && parameters.at(0) != nullptr && parameters.at(0)->GetExpression() == "$identifier")
+		{
+			Write(parameters.at(0)->GetValue(), IsIntegral(parameters.at(1)));
+			work.push_back(parameters.at(1));
+			continue;
+		}
+
+		size_t first = 0;
+		if (expression == "$addConstant" || expression == "$subtractConstant")
+			Write(node->GetValue(), parameters.size() == 1 && IsIntegral(parameters.at(0)));
+		else if (expression == "$increment" || expression == "$decrement")
+			Write(node->GetValue(), true);
+		else if (expression == "$identifier")
+			Write(node->GetValue(), false);
+		else if (expression == "$ret" && subroutine != nullptr && (parameters.size() != 1 || !IsIntegral(parameters.at(0))))
+			SetFractionalReturn(subroutine->name);
+		else if (expression == "$functionCall")
+		{
+			if (parameters.empty() || parameters.at(0) == nullptr)
+				continue;
+
+			// The arguments are written to the parameters of the callee in the order the VirtualMachine uses
+			Subroutine* callee = subroutines->GetSubroutine(parameters.at(0)->GetValue());
+			if (callee != nullptr)
+			{
+				std::vector<Symbol*> calleeParameters = callee->GetSymbolTable()->GetSymbolVector();
+				for (size_t i = 0; i < calleeParameters.size(); i++)
+					Write(calleeParameters.at(i)->name, i + 1 < parameters.size() && IsIntegral(parameters.at(i + 1)));
+			}
+			first = 1;
+		}
+
+		work.insert(work.end(), parameters.rbegin(), parameters.rend() - first);
+	}
+}
+
+void IntegerTypeInference::Write(std::string name, bool integral)
+{
+	variables.insert(name);
+	if (!integral && fractional.insert(name).second)
+		changed = true;
+}
+
+void IntegerTypeInference::SetFractionalReturn(std::string name)
+{
+	if (fractionalReturns.insert(name).second)
+		changed = true;
+}
+
+bool IntegerTypeInference::IsIntegral(std::shared_ptr<CompilerNode> node)
+{
+	std::set<CompilerNode*> integral;
+	CompilerNode::Rewrite(node, nullptr, [&](std::shared_ptr<CompilerNode> part, std::vector<std::shared_ptr<CompilerNode>>& parameters, bool) {
+		if (IsIntegral(part, parameters, integral))
+			integral.insert(part.get());
+		return part;
+	});
+	return node != nullptr && integral.count(node.get()) > 0;
+}
+
+// One node, the parameters that are whole numbers are in integral
+bool IntegerTypeInference::IsIntegral(std::shared_ptr<CompilerNode> node, const std::vector<std::shared_ptr<CompilerNode>>& parameters, const std::set<CompilerNode*>& integral)
+{
+	std::string expression = node->GetExpression();
+	if (expression == "$value")
+	{
+		// The VirtualMachine atof's the text
+		std::string text = node->GetValue();
+		char* end;
+		double value = strtod(text.c_str(), &end);
+		return !text.empty() && *end == '\0' && std::isfinite(value) && std::floor(value) == value;
+	}
+	if (expression == "$getVariable")
+		return IsIntegralVariable(node->GetValue());
+	if (IsArithmetic(expression))
+		return parameters.size() == (expression == "$uniPlus" || expression == "$uniMin" ? 1 : 2) && AreIntegral(parameters, integral);
+	// Both throw on a fraction
+	if (expression == "$gcd" || expression == "$fib")
+		return true;
+	if (IsCompare(expression) || expression == "$compare" || expression == "$and" || expression == "$or")
+		return true;
+	if (expression == "$functionCall")
+		return !parameters.empty() && parameters.at(0) != nullptr && subroutines->HasSubroutine(parameters.at(0)->GetValue())
+			&& fractionalReturns.count(parameters.at(0)->GetValue()) == 0;
+
+	return false;
+}
+
+bool IntegerTypeInference::AreIntegral(const std::vector<std::shared_ptr<CompilerNode>>& nodes, const std::set<CompilerNode*>& integral)
+{
+	for (std::shared_ptr<CompilerNode> node : nodes)
+	{
+		if (node == nullptr || integral.count(node.get()) == 0)
+			return false;
+	}
+	return true;
+}
+
+// The parameters first, whether a node is whole follows from its parameters
+void IntegerTypeInference::Mark(std::shared_ptr<CompilerNode> node)
+{
+	std::set<CompilerNode*> integral;
+	CompilerNode::Rewrite(node, nullptr, [&](std::shared_ptr<CompilerNode> part, std::vector<std::shared_ptr<CompilerNode>>& parameters, bool) {
+		bool whole = IsIntegral(part, parameters, integral);
+		if (whole)
+			integral.insert(part.get());
+
+		// A node can be shared by several statements
+		if (part->IsIntegral())
+			return part;
+
+		std::string expression = part->GetExpression();
+		if (expression == "$getVariable" && IsIntegralVariable(part->GetValue()))
+		{
+			part->SetIntegral(true);
+			reads++;
+		}
+		else if (IsArithmetic(expression) && whole)
+		{
+			part->SetIntegral(true);
+			arithmetic++;
+		}
+		else if ((IsCompare(expression) || expression == "$compare" || expression == "$ifCompare" || expression == "$whileCompare")
+			&& parameters.size() == 2 && AreIntegral(parameters, integral))
+		{
+			part->SetIntegral(true);
+			compares++;
+		}
+		else if (((expression == "$increment" || expression == "$decrement") && IsIntegralVariable(part->GetValue()))
+			|| ((expression == "$addConstant" || expression == "$subtractConstant") && IsIntegralVariable(part->GetValue()) && AreIntegral(parameters, integral)))
+		{
+			part->SetIntegral(true);
+			increments++;
+		}
+		else if ((expression == "$gcd" || expression == "$fib") && !parameters.empty() && AreIntegral(parameters, integral))
+		{
+			// Whole operands skip the type check
+			part->SetIntegral(true);
+			builtins++;
+		}
+		return part;
+	});
+}
+
+std::vector<std::shared_ptr<CompilerNode>> IntegerTypeInference::GetStatements(Subroutine* subroutine)
+{
+	std::vector<std::shared_ptr<CompilerNode>> statements;
+	for (std::shared_ptr<ListNode> listNode = subroutine->GetCompilerNodeCollection()->GetHead(); listNode && listNode->GetData(); listNode = listNode->GetNext())
+		statements.push_back(listNode->GetData());
+	return statements;
+}
+
+bool IntegerTypeInference::IsCompare(std::string expression)
+{
+	return expression == "$less" || expression == "$lessOrEq" || expression == "$greater"
+		|| expression == "$greaterOrEq" || expression == "$equals" || expression == "$notEquals";
+}
+
+bool IntegerTypeInference::IsArithmetic(std::string expression)
+{
+	return expression == "$add" || expression == "$min" || expression == "$mul" || expression == "$mod"
+		|| expression == "$uniPlus" || expression == "$uniMin";
+}
+
+std::string IntegerTypeInference::GetReport()
+{
+	return "Integer types: " + std::to_string(variables.size() - fractional.size()) + " of " + std::to_string(variables.size())
+		+ " variables always hold whole numbers, " + std::to_string(reads + arithmetic + compares + increments + builtins)
+		+ " operations use the int64 handlers (" + std::to_string(reads) + " reads, "
+		+ std::to_string(arithmetic) + " arithmetic, "
+		+ std::to_string(compares) + " compares, "
+		+ std::to_string(increments) + " increments, "
+		+ std::to_string(builtins) + " gcd and fib)";
+}
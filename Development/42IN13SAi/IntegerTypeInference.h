@@ -0,0 +1,78 @@
+#pragma once
+
+#include <list>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "CompilerNode.h"
+#include "LinkedList.h"
+#include "Subroutine.h"
+#include "SubroutineTable.h"
+
+// Finds the variables and expressions that always hold whole numbers and
+// marks their nodes integral, the VirtualMachine runs those with the int64
+// handlers:
+//
+//   var total = 0;                       total, i: integral
+//   frl (var i = 1 | i <= 100 | i++)     i <= 100, i++: int64 compare and increment
+//   [
+//       total = total + i % 7;           +, %: int64 arithmetic
+//       half = total / 2;                half: not integral, a / can give a fraction
+//   ]
+//
+// Whole literals, ++ and --, +, -, * and % of whole numbers, gcd, fib and the
+// compares are whole. A variable is whole when every value written to it is,
+// by an assignment, a += or -= and every argument of a call for a parameter.
+// The VirtualMachine reads a variable in the symboltable of the last function
+// it called, so a name is whole in the entire program or not at all. The
+// analysis starts out with every name whole and drops the ones a fraction is
+// written to until nothing changes. The int64 handlers check for overflow and
+// for -0 and give the result of the long double handlers then.
+class IntegerTypeInference
+{
+public:
+	IntegerTypeInference(SubroutineTable* p_subroutines);
+	virtual ~IntegerTypeInference();
+
+	// Mark the global statements and every subroutine, returns the number of marked nodes
+	int Infer(std::list<std::shared_ptr<CompilerNode>>& globalNodes);
+
+	// A name another compile can write to, a module and the programs that import it
+	// are inferred apart, it is never whole
+	void AddExternal(std::string name);
+
+	bool IsIntegralVariable(std::string name);
+	std::string GetReport();
+
+private:
+	SubroutineTable* subroutines;
+
+	// Every variable written to and the ones that can hold a fraction
+	std::set<std::string> variables;
+	std::set<std::string> fractional;
+
+	// The functions that can return a fraction, or return without a value
+	std::set<std::string> fractionalReturns;
+	bool changed = false;
+
+	int reads = 0;
+	int arithmetic = 0;
+	int compares = 0;
+	int increments = 0;
+	int builtins = 0;
+
+	void Collect(std::shared_ptr<CompilerNode> node, Subroutine* subroutine);
+	void Write(std::string name, bool integral);
+	void SetFractionalReturn(std::string name);
+
+	bool IsIntegral(std::shared_ptr<CompilerNode> node);
+	bool IsIntegral(std::shared_ptr<CompilerNode> node, const std::vector<std::shared_ptr<CompilerNode>>& parameters, const std::set<CompilerNode*>& integral);
+	bool AreIntegral(const std::vector<std::shared_ptr<CompilerNode>>& nodes, const std::set<CompilerNode*>& integral);
+	void Mark(std::shared_ptr<CompilerNode> node);
+
+	static std::vector<std::shared_ptr<CompilerNode>> GetStatements(Subroutine* subroutine);
+	static bool IsCompare(std::string expression);
+	static bool IsArithmetic(std::string expression);
+};
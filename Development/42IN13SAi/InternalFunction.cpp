@@ -1,4 +1,5 @@
 #include "InternalFunction.h"
+#include "Builtins.h"
 
 InternalFunction::InternalFunction(Compiler* compiler) : compiler(compiler)
 {
@@ -11,84 +12,14 @@ InternalFunction::~InternalFunction()
 
 std::shared_ptr<CompilerNode> InternalFunction::GetInternalFunction(MyTokenType type)
 {
-	switch (type)
-	{
-		// Default functions
-	case MyTokenType::Stop:
-        compiler->Match(MyTokenType::Stop);
-		return getCompilerNode("$stop", 0);
-	case  MyTokenType::PrintLine:
-        compiler->Match(MyTokenType::PrintLine);
-		return getCompilerNode("$prnt", 1);
+	const Builtin* builtin = Builtins::Find(type);
+	if (builtin == nullptr)
+		return nullptr;
 
-		// Math functions
-	case MyTokenType::Cosine:
-		return getCompilerNode("$cos", 1);
-	case MyTokenType::Sine:
-		return getCompilerNode("$sin", 1);
-	case MyTokenType::Tangent:
-		return getCompilerNode("$tan", 1);
-	case MyTokenType::CosineR:
-		return getCompilerNode("$cosr", 1);
-	case MyTokenType::SineR:
-		return getCompilerNode("$sinr", 1);
-	case MyTokenType::TangentR:
-		return getCompilerNode("$tanr", 1);
-	case MyTokenType::Square:
-		return getCompilerNode("$sqr", 1);
-	case MyTokenType::Cube:
-		return getCompilerNode("$cbc", 1);
-	case MyTokenType::Power:
-		return getCompilerNode("$pow", 2);
-	case MyTokenType::SquareRoot:
-		return getCompilerNode("$sqrt", 1);
-	case MyTokenType::CubeRoot:
-		return getCompilerNode("$cbrt", 1);
-	case MyTokenType::Degree:
-		return getCompilerNode("$deg", 1);
-	case MyTokenType::Radiant:
-		return getCompilerNode("$rad", 1);
-	case MyTokenType::Percent:
-		return getCompilerNode("$perc", 2);
-	case  MyTokenType::Permillage:
-		return getCompilerNode("$perm", 2);
-	case MyTokenType::CommonLog:
-		return getCompilerNode("$log10", 1); 
-	case MyTokenType::BinaryLog:
-		return getCompilerNode("$log2", 1);
-	case MyTokenType::NaturalLog:
-		return getCompilerNode("$ln", 1);
-	case MyTokenType::Log:
-		return getCompilerNode("$log", 2);
-	case MyTokenType::Modulo:
-		return getCompilerNode("$mod", 2);
-	case MyTokenType::Gcd:
-		return getCompilerNode("$gcd", 2);
-	case MyTokenType::Discriminant:
-		return getCompilerNode("$dis", 3);
-	case MyTokenType::AbcFormula:
-		compiler->Match(MyTokenType::AbcFormula);
-		return getCompilerNode("$abc", 3);
-	case MyTokenType::Fibonacci:
-		return getCompilerNode("$fib", 1);
-	case MyTokenType::Pythagoras:
-		return getCompilerNode("$pyt", 2); 
-	case MyTokenType::PythagorasH:
-		return getCompilerNode("$pyth", 2); 
-	case MyTokenType::Distance:
-		return getCompilerNode("$dist", 2);
-	case MyTokenType::Velocity:
-		return getCompilerNode("$velo", 2);
-	case MyTokenType::Time:
-		return getCompilerNode("$time", 2);
-	case MyTokenType::AverageVelocity:
-		return getCompilerNode("$avgv", 2);
-	case MyTokenType::Acceleration:
-		return getCompilerNode("$accl", 2);
-	default:
-		break;
-	}
-	return nullptr;
+	// A statement starts with its own token, in an expression the parser took it
+	if (builtin->statement)
+		compiler->Match(type);
+	return getCompilerNode(builtin->expression, builtin->arity);
 }
 
 std::vector<std::shared_ptr<CompilerNode>> InternalFunction::parseParameters(int expectedParams)
@@ -110,7 +41,7 @@ std::vector<std::shared_ptr<CompilerNode>> InternalFunction::parseParameters(int
         }
         else
         {
-            compiler->Diag(ExceptionEnum::err_expected_parameter) << compiler->GetCurrent().LineNumber << compiler->GetCurrent().LinePosition;
+            compiler->Diag(ExceptionEnum::err_expected_parameter, compiler->GetCurrent().LineNumber, compiler->GetCurrent().LinePosition);
             
             compiler->SkipUntil(MyTokenType::CloseBracket);
             break;
@@ -123,5 +54,7 @@ std::vector<std::shared_ptr<CompilerNode>> InternalFunction::parseParameters(int
 
 std::shared_ptr<CompilerNode> InternalFunction::getCompilerNode(std::string functionName, int params) {
 	std::vector<std::shared_ptr<CompilerNode>> compiler_nodes = parseParameters(params);
+	if (compiler->IsChecking())
+		return Parser::GetCheckedTerm("$checked", "");
 	return std::make_shared<CompilerNode>(functionName, compiler_nodes, nullptr, false);
 }
\ No newline at end of file
@@ -0,0 +1,99 @@
+#include "IrBlock.h"
+
+IrBlock::IrBlock(int p_id) : id(p_id)
+{
+}
+
+IrBlock::~IrBlock()
+{
+}
+
+IrInstruction* IrBlock::GetTerminator()
+{
+	if (instructions.empty() || !instructions.back()->IsTerminator())
+		return nullptr;
+	return instructions.back().get();
+}
+
+std::vector<IrBlock*> IrBlock::GetSuccessors()
+{
+	IrInstruction* terminator = GetTerminator();
+	if (terminator == nullptr)
+		return std::vector<IrBlock*>();
+	return terminator->blocks;
+}
+
+IrInstruction* IrBlock::Append(IrInstruction* instruction)
+{
+	return InsertAt((int)instructions.size(), instruction);
+}
+
+IrInstruction* IrBlock::InsertBeforeTerminator(IrInstruction* instruction)
+{
+	int index = (int)instructions.size();
+	if (GetTerminator() != nullptr)
+		index--;
+	return InsertAt(index, instruction);
+}
+
+IrInstruction* IrBlock::InsertAfterPhis(IrInstruction* instruction)
+{
+	int index = 0;
+	while (index < (int)instructions.size() && instructions[index]->opcode == IrOpcode::Phi)
+		index++;
+	return InsertAt(index, instruction);
+}
+
+IrInstruction* IrBlock::InsertAt(int index, IrInstruction* instruction)
+{
+	instruction->block = this;
+	instructions.insert(instructions.begin() + index, std::unique_ptr<IrInstruction>(instruction));
+	return instruction;
+}
+
+void IrBlock::Remove(IrInstruction* instruction)
+{
+	for (auto it = instructions.begin(); it != instructions.end(); ++it)
+	{
+		if (it->get() == instruction)
+		{
+			instructions.erase(it);
+			return;
+		}
+	}
+}
+
+void IrBlock::RemovePhiOperands(IrBlock* predecessor)
+{
+	for (std::unique_ptr<IrInstruction>& instruction : instructions)
+	{
+		if (instruction->opcode != IrOpcode::Phi)
+			break;
+
+		for (size_t i = 0; i < instruction->blocks.size(); i++)
+		{
+			if (instruction->blocks[i] == predecessor)
+			{
+				instruction->blocks.erase(instruction->blocks.begin() + i);
+				instruction->operands.erase(instruction->operands.begin() + i);
+				break;
+			}
+		}
+	}
+}
+
+std::string IrBlock::ToString()
+{
+	std::string text = "b" + std::to_string(id) + ":";
+	if (!predecessors.empty())
+	{
+		text += "\t; preds";
+		for (size_t i = 0; i < predecessors.size(); i++)
+			text += (i == 0 ? " b" : ", b") + std::to_string(predecessors[i]->id);
+	}
+	text += "\n";
+
+	for (std::unique_ptr<IrInstruction>& instruction : instructions)
+		text += "\t" + instruction->ToString() + "\n";
+	return text;
+}
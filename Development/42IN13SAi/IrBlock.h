@@ -0,0 +1,35 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "IrInstruction.h"
+
+// A basic block: phis first, then the instructions and one terminator at the end
+class IrBlock
+{
+public:
+	IrBlock(int id);
+	virtual ~IrBlock();
+
+	int id;
+	std::vector<std::unique_ptr<IrInstruction>> instructions;
+	std::vector<IrBlock*> predecessors;
+
+	IrInstruction* GetTerminator();
+	std::vector<IrBlock*> GetSuccessors();
+
+	// Add an instruction at the end, in front of the terminator or after the phis
+	IrInstruction* Append(IrInstruction* instruction);
+	IrInstruction* InsertBeforeTerminator(IrInstruction* instruction);
+	IrInstruction* InsertAfterPhis(IrInstruction* instruction);
+	IrInstruction* InsertAt(int index, IrInstruction* instruction);
+
+	void Remove(IrInstruction* instruction);
+
+	// Drop the operand of every phi that comes in from predecessor
+	void RemovePhiOperands(IrBlock* predecessor);
+
+	std::string ToString();
+};
@@ -0,0 +1,664 @@
+#include "IrBuilder.h"
+#include <algorithm>
+
+IrBuilder::IrBuilder(SymbolTable* p_globals, SubroutineTable* p_subroutines, std::list<std::shared_ptr<CompilerNode>> p_globalNodes)
+: globals(p_globals), subroutines(p_subroutines), globalNodes(p_globalNodes)
+{
+}
+
+IrBuilder::~IrBuilder()
+{
+}
+
+std::shared_ptr<IrModule> IrBuilder::Build()
+{
+	std::shared_ptr<IrModule> module = std::make_shared<IrModule>();
+
+	for (Symbol* symbol : globals->GetSymbolVector())
+		module->globals.push_back(symbol->name);
+
+	// The global statements
+	function = module->AddFunction("$globals", std::vector<std::string>());
+	subroutine = nullptr;
+	BuildFunction(std::vector<std::shared_ptr<CompilerNode>>(globalNodes.begin(), globalNodes.end()));
+
+	// Build the same IR every time, the SubroutineTable is unordered
+	std::vector<Subroutine*> subroutineVector = subroutines->GetSubroutineVector();
+	std::sort(subroutineVector.begin(), subroutineVector.end(), [](Subroutine* a, Subroutine* b) { return a->name < b->name; });
+
+	for (Subroutine* p_subroutine : subroutineVector)
+	{
+		std::vector<std::string> parameters;
+		for (Symbol* symbol : p_subroutine->GetSymbolTable()->GetSymbolVector())
+			parameters.push_back(symbol->name);
+
+		function = module->AddFunction(p_subroutine->name, parameters);
+		subroutine = p_subroutine;
+		BuildFunction(GetNodes(p_subroutine));
+	}
+
+	function = nullptr;
+	subroutine = nullptr;
+
+	if (!errors.empty())
+		return nullptr;
+	return module;
+}
+
+std::vector<std::string> IrBuilder::GetErrors()
+{
+	return errors;
+}
+
+void IrBuilder::BuildFunction(std::vector<std::shared_ptr<CompilerNode>> functionNodes)
+{
+	nodes = functionNodes;
+	nodeIndexes.clear();
+	nodeBlocks.clear();
+	missingPredecessors.clear();
+	definitions.clear();
+	incompletePhis.clear();
+	sealedBlocks.clear();
+	forLoopVariables.clear();
+
+	int count = (int)nodes.size();
+	for (int i = 0; i < count; i++)
+		nodeIndexes[nodes[i].get()] = i;
+
+	// A block starts at the first node, at every jump target and after every jump
+	std::set<int> leaders = { 0, count };
+	for (int i = 0; i < count; i++)
+	{
+		std::string expression = nodes[i]->GetExpression();
+		std::shared_ptr<CompilerNode> jumpTo = nodes[i]->GetJumpTo();
+		auto target = jumpTo ? nodeIndexes.find(jumpTo.get()) : nodeIndexes.end();
+
+		if (IsBranch(expression) || (expression == "$doNothing" && jumpTo))
+		{
+			if (target == nodeIndexes.end())
+			{
+				Error("jump to a missing node");
+				return;
+			}
+
+			// A $doNothing continues at the target, a false condition after it
+			leaders.insert(i + 1);
+			leaders.insert(expression == "$doNothing" ? target->second : target->second + 1);
+		}
+		else if (expression == "$ret" || expression == "$stop")
+			leaders.insert(i + 1);
+
+		if (expression == "$forLoop" && nodes[i]->GetNodeparameters().size() == 3 && nodes[i]->GetNodeparameters().at(0) != nullptr
+			&& !nodes[i]->GetNodeparameters().at(0)->GetNodeparameters().empty())
+			forLoopVariables.insert(nodes[i]->GetNodeparameters().at(0)->GetNodeparameters().at(0)->GetValue());
+	}
+
+	// The successors of every block, the block at count returns
+	std::map<int, int> ends;
+	std::map<int, std::vector<int>> successors;
+	for (auto leader = leaders.begin(); leader != leaders.end(); ++leader)
+	{
+		auto next = std::next(leader);
+		int end = next == leaders.end() ? count : *next;
+		ends[*leader] = end;
+		if (*leader >= count)
+			continue;
+
+		std::shared_ptr<CompilerNode> last = nodes[end - 1];
+		std::string expression = last->GetExpression();
+		if (IsBranch(expression))
+			successors[*leader] = { end, nodeIndexes[last->GetJumpTo().get()] + 1 };
+		else if (expression == "$doNothing" && last->GetJumpTo())
+			successors[*leader] = { nodeIndexes[last->GetJumpTo().get()] };
+		else if (expression != "$ret" && expression != "$stop")
+			successors[*leader] = { end };
+	}
+
+	// Only build the blocks the first node reaches, count their edges to know when they are sealed
+	std::vector<int> work = { 0 };
+	while (!work.empty())
+	{
+		int leader = work.back();
+		work.pop_back();
+		if (nodeBlocks.count(leader) > 0)
+			continue;
+
+		nodeBlocks[leader] = nullptr;
+		for (int successor : successors[leader])
+			work.push_back(successor);
+	}
+
+	IrBlock* entry = function->NewBlock();
+	sealedBlocks.insert(entry);
+	for (auto& nodeBlock : nodeBlocks)
+		nodeBlock.second = function->NewBlock();
+
+	missingPredecessors[nodeBlocks[0]]++;
+	for (auto& nodeBlock : nodeBlocks)
+	{
+		for (int successor : successors[nodeBlock.first])
+			missingPredecessors[nodeBlocks[successor]]++;
+	}
+
+	// The caller stores the arguments in the parameters
+	current = entry;
+	if (subroutine != nullptr)
+	{
+		for (std::string parameter : function->parameters)
+			WriteLocal(parameter, Emit(IrOpcode::Parameter, parameter, std::vector<IrInstruction*>()));
+	}
+	Terminate(IrOpcode::Jump, nullptr, { nodeBlocks[0] });
+
+	for (auto& nodeBlock : nodeBlocks)
+	{
+		current = nodeBlock.second;
+		int end = ends[nodeBlock.first];
+		for (int i = nodeBlock.first; i < end; i++)
+		{
+			if (i == end - 1)
+				BuildLastStatement(nodes[i], successors[nodeBlock.first]);
+			else
+				BuildStatement(nodes[i]);
+		}
+
+		// Falling off the end of the function returns nothing
+		if (nodeBlock.first >= count)
+			Terminate(IrOpcode::Return, nullptr, std::vector<IrBlock*>());
+	}
+
+	RemoveTrivialPhis();
+	current = nullptr;
+}
+
+void IrBuilder::BuildStatement(std::shared_ptr<CompilerNode> node)
+{
+	std::string expression = node->GetExpression();
+	std::vector<std::shared_ptr<CompilerNode>> parameters = node->GetNodeparameters();
+
+	if (expression == "$assignment")
+	{
+		if (parameters.size() != 2 || parameters.at(0) == nullptr)
+			return Error("unexpected assignment");
+		if (parameters.at(0)->GetExpression() != "$identifier")
+			return;
+
+		WriteVariable(parameters.at(0)->GetValue(), BuildExpression(parameters.at(1)));
+	}
+	else if (expression == "$prnt")
+	{
+		if (parameters.size() != 1)
+			return Error("prnt expects 1 parameter");
+		Emit(IrOpcode::Print, "", { BuildExpression(parameters.at(0)) });
+	}
+	else if (expression == "$abc")
+	{
+		if (parameters.size() != 3)
+			return Error("abc expects 3 parameters");
+
+		std::vector<IrInstruction*> operands;
+		for (std::shared_ptr<CompilerNode> parameter : parameters)
+			operands.push_back(BuildExpression(parameter));
+		Emit(IrOpcode::Abc, "", operands);
+	}
+	else if (expression == "$increment" || expression == "$decrement")
+	{
+		IrInstruction* one = Emit(IrOpcode::Constant, "1", std::vector<IrInstruction*>());
+		WriteVariable(node->GetValue(), Emit(IrOpcode::Builtin, expression == "$increment" ? "$add" : "$min", { ReadVariable(node->GetValue()), one }));
+	}
+	else if (expression == "$addConstant" || expression == "$subtractConstant")
+	{
+		if (parameters.size() != 1)
+			return Error(expression + " expects 1 parameter");
+
+		IrInstruction* variable = ReadVariable(node->GetValue());
+		IrInstruction* constant = BuildExpression(parameters.at(0));
+		WriteVariable(node->GetValue(), Emit(IrOpcode::Builtin, expression == "$addConstant" ? "$add" : "$min", { variable, constant }));
+	}
+	else if (expression == "$doNothing")
+		return;
+	else if (expression == "$ret" || expression == "$stop" || IsBranch(expression))
+		Error(expression + " in the middle of a block");
+	else
+		BuildExpression(node);
+}
+
+void IrBuilder::BuildLastStatement(std::shared_ptr<CompilerNode> node, std::vector<int> successors)
+{
+	std::string expression = node->GetExpression();
+	std::vector<std::shared_ptr<CompilerNode>> parameters = node->GetNodeparameters();
+
+	if (expression == "$doNothing" && node->GetJumpTo())
+		Terminate(IrOpcode::Jump, nullptr, { GetNodeBlock(successors.at(0)) });
+	else if (expression == "$if" || expression == "$whileLoop")
+	{
+		if (parameters.size() != 1)
+			return Error(expression + " expects 1 parameter");
+
+		IrInstruction* condition = BuildExpression(parameters.at(0));
+		Terminate(IrOpcode::Branch, condition, { GetNodeBlock(successors.at(0)), GetNodeBlock(successors.at(1)) });
+	}
+	else if (expression == "$ifCompare" || expression == "$whileCompare")
+	{
+		IrInstruction* condition = BuildCompare(node->GetValue(), parameters);
+		Terminate(IrOpcode::Branch, condition, { GetNodeBlock(successors.at(0)), GetNodeBlock(successors.at(1)) });
+	}
+	else if (expression == "$forLoop")
+		BuildForLoop(node, successors);
+	else if (expression == "$ret")
+	{
+		if (parameters.size() != 1)
+			return Error("ret expects 1 parameter");
+		Terminate(IrOpcode::Return, BuildExpression(parameters.at(0)), std::vector<IrBlock*>());
+	}
+	else if (expression == "$stop")
+		Terminate(IrOpcode::Stop, nullptr, std::vector<IrBlock*>());
+	else
+	{
+		BuildStatement(node);
+		Terminate(IrOpcode::Jump, nullptr, { GetNodeBlock(successors.at(0)) });
+	}
+}
+
+// The VirtualMachine runs the step when the variable is set and the assignment
+// when it isn't, so a frl that runs again continues with the step
+void IrBuilder::BuildForLoop(std::shared_ptr<CompilerNode> node, std::vector<int> successors)
+{
+	std::vector<std::shared_ptr<CompilerNode>> parameters = node->GetNodeparameters();
+	if (parameters.size() != 3 || parameters.at(0) == nullptr || parameters.at(0)->GetExpression() != "$assignment"
+		|| parameters.at(0)->GetNodeparameters().empty() || parameters.at(1) == nullptr || parameters.at(2) == nullptr)
+		return Error("unexpected frl");
+
+	std::string variable = parameters.at(0)->GetNodeparameters().at(0)->GetValue();
+	if (!IsLocal(variable))
+		return Error("frl outside a function");
+
+	IrBlock* step = function->NewBlock();
+	IrBlock* assignment = function->NewBlock();
+	IrBlock* condition = function->NewBlock();
+
+	Terminate(IrOpcode::Branch, ReadLocal(variable + ".set"), { step, assignment });
+	SealBlock(step);
+	SealBlock(assignment);
+
+	current = step;
+	if (parameters.at(2)->GetExpression() != "$value")
+		BuildStatement(parameters.at(2));
+	Terminate(IrOpcode::Jump, nullptr, { condition });
+
+	current = assignment;
+	BuildStatement(parameters.at(0));
+	Terminate(IrOpcode::Jump, nullptr, { condition });
+	SealBlock(condition);
+
+	current = condition;
+	IrInstruction* value = BuildExpression(parameters.at(1));
+	Terminate(IrOpcode::Branch, value, { GetNodeBlock(successors.at(0)), GetNodeBlock(successors.at(1)) });
+}
+
+// The operands are built in order from a stack of the instructions that wait for them,
+// a long expression doesn't run out of stack
+IrInstruction* IrBuilder::BuildExpression(std::shared_ptr<CompilerNode> node)
+{
+	std::vector<PendingInstruction> pending;
+	while (true)
+	{
+		PendingInstruction instruction;
+		IrInstruction* value = StartExpression(node, instruction);
+		if (value == nullptr && instruction.operands.empty())
+			value = Emit(instruction.opcode, instruction.name, instruction.values);
+		else if (value == nullptr)
+		{
+			pending.push_back(instruction);
+			node = instruction.operands.at(0);
+			continue;
+		}
+
+		// The value goes to the instruction that waits for it, until one needs its next operand
+		bool next = false;
+		while (!pending.empty() && !next)
+		{
+			PendingInstruction& waiting = pending.back();
+			if (waiting.opcode == IrOpcode::Phi && waiting.values.empty())
+			{
+				// The right side of || only runs when the left side isn't 1
+				IrInstruction* left = Emit(IrOpcode::IsOne, "", { value });
+				waiting.values.push_back(left);
+				waiting.leftBlock = current;
+				IrBlock* right = function->NewBlock();
+				waiting.join = function->NewBlock();
+
+				Terminate(IrOpcode::Branch, left, { waiting.join, right });
+				SealBlock(right);
+				current = right;
+			}
+			else if (waiting.opcode == IrOpcode::Phi)
+			{
+				IrInstruction* rightValue = Emit(IrOpcode::IsOne, "", { value });
+				IrBlock* rightBlock = current;
+				Terminate(IrOpcode::Jump, nullptr, { waiting.join });
+				SealBlock(waiting.join);
+
+				current = waiting.join;
+				IrInstruction* phi = NewPhi(waiting.join);
+				phi->operands = { waiting.values.at(0), rightValue };
+				phi->blocks = { waiting.leftBlock, rightBlock };
+				waiting.values.push_back(phi);
+			}
+			else
+				waiting.values.push_back(value);
+
+			if (waiting.values.size() < waiting.operands.size())
+			{
+				node = waiting.operands.at(waiting.values.size());
+				next = true;
+			}
+			else
+			{
+				value = waiting.opcode == IrOpcode::Phi ? waiting.values.back() : Emit(waiting.opcode, waiting.name, waiting.values);
+				pending.pop_back();
+			}
+		}
+
+		if (!next)
+			return value;
+	}
+}
+
+// The value of a node without operands, or nullptr and the instruction that waits for the operands
+IrInstruction* IrBuilder::StartExpression(std::shared_ptr<CompilerNode> node, PendingInstruction& instruction)
+{
+	if (node == nullptr)
+	{
+		Error("missing expression");
+		return Emit(IrOpcode::Constant, "0", std::vector<IrInstruction*>());
+	}
+
+	std::string expression = node->GetExpression();
+	std::vector<std::shared_ptr<CompilerNode>> parameters = node->GetNodeparameters();
+
+	if (expression == "$value")
+		return Emit(IrOpcode::Constant, node->GetValue(), std::vector<IrInstruction*>());
+	if (expression == "$getVariable")
+		return ReadVariable(node->GetValue());
+	if (expression == "$less" || expression == "$lessOrEq" || expression == "$greater" || expression == "$greaterOrEq"
+		|| expression == "$equals" || expression == "$notEquals" || expression == "$compare")
+	{
+		std::string operation = expression == "$compare" ? node->GetValue() : expression;
+		if (parameters.size() != 2)
+		{
+			Error("unexpected compare " + operation);
+			return Emit(IrOpcode::Constant, "0", std::vector<IrInstruction*>());
+		}
+
+		instruction = { IrOpcode::Compare, operation, parameters, {}, nullptr, nullptr };
+		return nullptr;
+	}
+	if (expression == "$and" || expression == "$or")
+	{
+		if (parameters.size() < 2)
+		{
+			Error(expression + " expects 2 parameters");
+			return Emit(IrOpcode::Constant, "0", std::vector<IrInstruction*>());
+		}
+
+		// Both sides of && are evaluated, || becomes a phi of the blocks of both sides
+		instruction = { expression == "$and" ? IrOpcode::And : IrOpcode::Phi, "", { parameters.at(0), parameters.at(1) }, {}, nullptr, nullptr };
+		return nullptr;
+	}
+	if (expression == "$functionCall")
+	{
+		if (parameters.empty() || parameters.at(0) == nullptr || parameters.at(0)->GetExpression() != "$functionName")
+		{
+			Error("expected function name");
+			return Emit(IrOpcode::Constant, "0", std::vector<IrInstruction*>());
+		}
+
+		std::string name = parameters.at(0)->GetValue();
+		Subroutine* callee = subroutines->GetSubroutine(name);
+		if (callee == nullptr)
+		{
+			Error("function " + name + " does not exist");
+			return Emit(IrOpcode::Constant, "0", std::vector<IrInstruction*>());
+		}
+
+		size_t parameterCount = callee->GetSymbolTable()->GetSymbolVector().size();
+		if (parameters.size() - 1 != parameterCount)
+		{
+			Error("function " + name + " expects " + std::to_string(parameterCount) + " parameters");
+			return Emit(IrOpcode::Constant, "0", std::vector<IrInstruction*>());
+		}
+
+		instruction = { IrOpcode::Call, name, std::vector<std::shared_ptr<CompilerNode>>(parameters.begin() + 1, parameters.end()), {}, nullptr, nullptr };
+		return nullptr;
+	}
+	if (IrInstruction::IsBuiltin(expression))
+	{
+		if ((int)parameters.size() != IrInstruction::GetBuiltinArity(expression))
+		{
+			Error(expression + " expects " + std::to_string(IrInstruction::GetBuiltinArity(expression)) + " parameters");
+			return Emit(IrOpcode::Constant, "0", std::vector<IrInstruction*>());
+		}
+
+		instruction = { IrOpcode::Builtin, expression, parameters, {}, nullptr, nullptr };
+		return nullptr;
+	}
+
+	Error(expression == "$abc" ? "abc has no value" : expression + " is not supported");
+	return Emit(IrOpcode::Constant, "0", std::vector<IrInstruction*>());
+}
+
+IrInstruction* IrBuilder::BuildCompare(std::string operation, std::vector<std::shared_ptr<CompilerNode>> operands)
+{
+	if (operands.size() != 2)
+	{
+		Error("unexpected compare " + operation);
+		return Emit(IrOpcode::Constant, "0", std::vector<IrInstruction*>());
+	}
+
+	IrInstruction* left = BuildExpression(operands.at(0));
+	IrInstruction* right = BuildExpression(operands.at(1));
+	return Emit(IrOpcode::Compare, operation, { left, right });
+}
+
+#pragma region Variables
+
+// Locals first, then the globals, like the VirtualMachine looks them up
+bool IrBuilder::IsLocal(std::string name)
+{
+	if (subroutine == nullptr)
+		return false;
+	return subroutine->GetSymbolTable()->HasSymbol(name) || forLoopVariables.count(name) > 0;
+}
+
+IrInstruction* IrBuilder::ReadVariable(std::string name)
+{
+	if (IsLocal(name))
+		return ReadLocal(name);
+
+	if (!globals->HasSymbol(name))
+		Error("unknown variable " + name);
+	return Emit(IrOpcode::LoadGlobal, name, std::vector<IrInstruction*>());
+}
+
+// An assigned variable holds the number, reading it back gives the rounded text
+void IrBuilder::WriteVariable(std::string name, IrInstruction* value)
+{
+	IrInstruction* rounded = Emit(IrOpcode::Round, "", { value });
+	if (IsLocal(name))
+	{
+		WriteLocal(name, rounded);
+		if (forLoopVariables.count(name) > 0)
+			WriteLocal(name + ".set", Emit(IrOpcode::Constant, "1", std::vector<IrInstruction*>()));
+		return;
+	}
+
+	if (!globals->HasSymbol(name))
+		Error("unknown variable " + name);
+	Emit(IrOpcode::StoreGlobal, name, { rounded });
+}
+
+IrInstruction* IrBuilder::ReadLocal(std::string name)
+{
+	return ReadLocal(name, current);
+}
+
+void IrBuilder::WriteLocal(std::string name, IrInstruction* value)
+{
+	definitions[current][name] = value;
+}
+
+#pragma endregion Variables
+
+#pragma region SsaConstruction
+
+IrInstruction* IrBuilder::ReadLocal(std::string name, IrBlock* block)
+{
+	auto definition = definitions[block].find(name);
+	if (definition != definitions[block].end())
+		return definition->second;
+	return ReadLocalRecursive(name, block);
+}
+
+IrInstruction* IrBuilder::ReadLocalRecursive(std::string name, IrBlock* block)
+{
+	IrInstruction* value;
+	if (sealedBlocks.count(block) == 0)
+	{
+		// Not all predecessors are known yet, the operands follow when the block is sealed
+		value = NewPhi(block);
+		incompletePhis[block][name] = value;
+	}
+	else if (block->predecessors.empty())
+	{
+		value = function->Number(new IrInstruction(IrOpcode::Entry, name, std::vector<IrInstruction*>()));
+		block->InsertAt(0, value);
+	}
+	else if (block->predecessors.size() == 1)
+		value = ReadLocal(name, block->predecessors.front());
+	else
+	{
+		// Break the cycles of loops with the phi first
+		value = NewPhi(block);
+		definitions[block][name] = value;
+		value = AddPhiOperands(name, value);
+	}
+
+	definitions[block][name] = value;
+	return value;
+}
+
+IrInstruction* IrBuilder::AddPhiOperands(std::string name, IrInstruction* phi)
+{
+	for (IrBlock* predecessor : phi->block->predecessors)
+	{
+		phi->operands.push_back(ReadLocal(name, predecessor));
+		phi->blocks.push_back(predecessor);
+	}
+	return phi;
+}
+
+IrInstruction* IrBuilder::NewPhi(IrBlock* block)
+{
+	return block->InsertAt(0, function->Number(new IrInstruction(IrOpcode::Phi, "", std::vector<IrInstruction*>())));
+}
+
+void IrBuilder::SealBlock(IrBlock* block)
+{
+	for (auto& phi : incompletePhis[block])
+		AddPhiOperands(phi.first, phi.second);
+
+	incompletePhis.erase(block);
+	sealedBlocks.insert(block);
+}
+
+// Phis that only merge one value, the builder places them on every join
+void IrBuilder::RemoveTrivialPhis()
+{
+	bool changed = true;
+	while (changed)
+	{
+		changed = false;
+		for (std::unique_ptr<IrBlock>& block : function->blocks)
+		{
+			for (size_t i = 0; i < block->instructions.size(); i++)
+			{
+				IrInstruction* phi = block->instructions[i].get();
+				if (phi->opcode != IrOpcode::Phi)
+					break;
+
+				IrInstruction* same = nullptr;
+				bool trivial = true;
+				for (IrInstruction* operand : phi->operands)
+				{
+					if (operand == phi || operand == same)
+						continue;
+					if (same != nullptr)
+					{
+						trivial = false;
+						break;
+					}
+					same = operand;
+				}
+
+				if (!trivial || same == nullptr)
+					continue;
+
+				function->ReplaceAllUses(phi, same);
+				block->Remove(phi);
+				changed = true;
+				i--;
+			}
+		}
+	}
+}
+
+#pragma endregion SsaConstruction
+
+IrInstruction* IrBuilder::Emit(IrOpcode opcode, std::string name, std::vector<IrInstruction*> operands)
+{
+	return current->Append(function->Number(new IrInstruction(opcode, name, operands)));
+}
+
+void IrBuilder::Terminate(IrOpcode opcode, IrInstruction* operand, std::vector<IrBlock*> targets)
+{
+	std::vector<IrInstruction*> operands;
+	if (operand != nullptr)
+		operands.push_back(operand);
+
+	IrInstruction* terminator = Emit(opcode, "", operands);
+	terminator->blocks = targets;
+
+	for (IrBlock* target : targets)
+	{
+		target->predecessors.push_back(current);
+
+		// A block of the node list is sealed with its last edge
+		auto missing = missingPredecessors.find(target);
+		if (missing != missingPredecessors.end() && --missing->second == 0)
+			SealBlock(target);
+	}
+}
+
+IrBlock* IrBuilder::GetNodeBlock(int index)
+{
+	return nodeBlocks.at(index);
+}
+
+std::vector<std::shared_ptr<CompilerNode>> IrBuilder::GetNodes(Subroutine* p_subroutine)
+{
+	std::vector<std::shared_ptr<CompilerNode>> subroutineNodes;
+	std::shared_ptr<LinkedList> nodeList = p_subroutine->GetCompilerNodeCollection();
+	for (std::shared_ptr<ListNode> listNode = nodeList->GetHead(); listNode && listNode->GetData(); listNode = listNode->GetNext())
+		subroutineNodes.push_back(listNode->GetData());
+	return subroutineNodes;
+}
+
+bool IrBuilder::IsBranch(std::string expression)
+{
+	return expression == "$if" || expression == "$whileLoop" || expression == "$ifCompare" || expression == "$whileCompare" || expression == "$forLoop";
+}
+
+void IrBuilder::Error(std::string message)
+{
+	errors.push_back("In function " + (function != nullptr ? function->name : std::string("?")) + ": " + message);
+}
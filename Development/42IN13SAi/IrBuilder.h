@@ -0,0 +1,101 @@
+#pragma once
+
+#include <list>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "CompilerNode.h"
+#include "SymbolTable.h"
+#include "Subroutine.h"
+#include "SubroutineTable.h"
+#include "IrModule.h"
+
+// Builds the IR from the Compiler output, fused nodes included.
+//
+// The node list of every Subroutine is split into basic blocks at the jump
+// targets, frl and || get their own blocks, and the locals become SSA values
+// while the blocks are filled (Braun et al., "Simple and Efficient
+// Construction of Static Single Assignment Form"). Globals are loaded and
+// stored, a call can change them.
+//
+// Every call of a Subroutine gets its own copy of the locals, a local read
+// before it is assigned is an Entry value.
+class IrBuilder
+{
+public:
+	IrBuilder(SymbolTable* globals, SubroutineTable* subroutines, std::list<std::shared_ptr<CompilerNode>> globalNodes);
+	virtual ~IrBuilder();
+
+	// nullptr when a node can't be translated, see GetErrors
+	std::shared_ptr<IrModule> Build();
+	std::vector<std::string> GetErrors();
+
+private:
+	SymbolTable* globals;
+	SubroutineTable* subroutines;
+	std::list<std::shared_ptr<CompilerNode>> globalNodes;
+	std::vector<std::string> errors;
+
+	// The function being built
+	IrFunction* function = nullptr;
+	Subroutine* subroutine = nullptr;
+	IrBlock* current = nullptr;
+	std::set<std::string> forLoopVariables;
+
+	// The blocks of the node list, by the index of their first node
+	std::vector<std::shared_ptr<CompilerNode>> nodes;
+	std::map<CompilerNode*, int> nodeIndexes;
+	std::map<int, IrBlock*> nodeBlocks;
+	std::map<IrBlock*, int> missingPredecessors;
+
+	// The value of every local at the end of a block
+	std::map<IrBlock*, std::map<std::string, IrInstruction*>> definitions;
+	std::map<IrBlock*, std::map<std::string, IrInstruction*>> incompletePhis;
+	std::set<IrBlock*> sealedBlocks;
+
+	// An instruction of an expression that waits for the values of its operands, || is a
+	// Phi with the block of its left side and the block after it
+	struct PendingInstruction
+	{
+		IrOpcode opcode;
+		std::string name;
+		std::vector<std::shared_ptr<CompilerNode>> operands;
+		std::vector<IrInstruction*> values;
+		IrBlock* leftBlock;
+		IrBlock* join;
+	};
+
+	void BuildFunction(std::vector<std::shared_ptr<CompilerNode>> functionNodes);
+	void BuildStatement(std::shared_ptr<CompilerNode> node);
+	void BuildLastStatement(std::shared_ptr<CompilerNode> node, std::vector<int> successors);
+	void BuildForLoop(std::shared_ptr<CompilerNode> node, std::vector<int> successors);
+	IrInstruction* BuildExpression(std::shared_ptr<CompilerNode> node);
+	IrInstruction* StartExpression(std::shared_ptr<CompilerNode> node, PendingInstruction& instruction);
+	IrInstruction* BuildCompare(std::string operation, std::vector<std::shared_ptr<CompilerNode>> operands);
+
+	// Variables
+	bool IsLocal(std::string name);
+	IrInstruction* ReadVariable(std::string name);
+	void WriteVariable(std::string name, IrInstruction* value);
+	IrInstruction* ReadLocal(std::string name);
+	void WriteLocal(std::string name, IrInstruction* value);
+
+	// SSA construction
+	IrInstruction* ReadLocal(std::string name, IrBlock* block);
+	IrInstruction* ReadLocalRecursive(std::string name, IrBlock* block);
+	IrInstruction* AddPhiOperands(std::string name, IrInstruction* phi);
+	IrInstruction* NewPhi(IrBlock* block);
+	void SealBlock(IrBlock* block);
+	void RemoveTrivialPhis();
+
+	IrInstruction* Emit(IrOpcode opcode, std::string name, std::vector<IrInstruction*> operands);
+	void Terminate(IrOpcode opcode, IrInstruction* operand, std::vector<IrBlock*> targets);
+	IrBlock* GetNodeBlock(int index);
+
+	static std::vector<std::shared_ptr<CompilerNode>> GetNodes(Subroutine* subroutine);
+	static bool IsBranch(std::string expression);
+	void Error(std::string message);
+};
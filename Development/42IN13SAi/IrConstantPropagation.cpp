@@ -0,0 +1,177 @@
+#include "IrConstantPropagation.h"
+#include "JitRuntime.h"
+#include <cmath>
+#include <cstdlib>
+
+IrConstantPropagation::IrConstantPropagation(NumericMode p_numericMode) : numericMode(p_numericMode)
+{
+}
+
+IrConstantPropagation::~IrConstantPropagation()
+{
+}
+
+std::string IrConstantPropagation::GetName()
+{
+	return "constant-propagation";
+}
+
+int IrConstantPropagation::Run(IrFunction& function)
+{
+	int changes = 0;
+	bool changed = true;
+	while (changed)
+	{
+		changed = false;
+		for (IrBlock* block : function.GetReversePostOrder())
+		{
+			for (size_t i = 0; i < block->instructions.size(); i++)
+			{
+				IrInstruction* instruction = block->instructions[i].get();
+				int folded = 0;
+
+				std::string text;
+				if (instruction->opcode == IrOpcode::Phi)
+				{
+					folded = FoldPhi(function, instruction);
+					if (folded > 0)
+						i--;
+				}
+				else if (instruction->opcode == IrOpcode::Branch)
+					folded = FoldBranch(instruction);
+				else if (instruction->opcode != IrOpcode::Constant && Fold(instruction, text))
+				{
+					// Turn it into the constant in place, the users stay the same
+					instruction->opcode = IrOpcode::Constant;
+					instruction->name = text;
+					instruction->operands.clear();
+					folded = 1;
+				}
+
+				if (folded > 0)
+				{
+					changes += folded;
+					changed = true;
+				}
+			}
+		}
+
+		if (changed)
+		{
+			function.ComputePredecessors();
+			function.RemoveUnreachableBlocks();
+		}
+	}
+	return changes;
+}
+
+bool IrConstantPropagation::Fold(IrInstruction* instruction, std::string& text)
+{
+	if (!instruction->HasValue())
+		return false;
+
+	std::vector<std::string> texts;
+	for (IrInstruction* operand : instruction->operands)
+	{
+		if (operand->opcode != IrOpcode::Constant)
+			return false;
+		texts.push_back(operand->name);
+	}
+
+	std::vector<double> numbers;
+	for (std::string operand : texts)
+		numbers.push_back(atof(operand.c_str()));
+
+	switch (instruction->opcode)
+	{
+	case IrOpcode::Round:
+		text = JitRuntime::ToString(numbers[0]);
+		return true;
+	case IrOpcode::IsOne:
+		text = JitRuntime::ToString(texts[0] == "1");
+		return true;
+	case IrOpcode::And:
+		text = JitRuntime::ToString(texts[0] == "1" && texts[1] == "1");
+		return true;
+	case IrOpcode::Compare:
+	{
+		bool result;
+		if (instruction->name == "$less")
+			result = numbers[0] < numbers[1];
+		else if (instruction->name == "$lessOrEq")
+			result = numbers[0] <= numbers[1];
+		else if (instruction->name == "$greater")
+			result = numbers[0] > numbers[1];
+		else if (instruction->name == "$greaterOrEq")
+			result = numbers[0] >= numbers[1];
+		else if (instruction->name == "$equals")
+			result = numbers[0] == numbers[1];
+		else if (instruction->name == "$notEquals")
+			result = numbers[0] != numbers[1];
+		else
+			return false;
+
+		text = JitRuntime::ToString(result);
+		return true;
+	}
+	case IrOpcode::Builtin:
+		return FoldBuiltin(instruction->name, numbers, text);
+	default:
+		return false;
+	}
+}
+
+bool IrConstantPropagation::FoldBuiltin(std::string name, std::vector<double> numbers, std::string& text)
+{
+	// Builtins that would throw are left for the VirtualMachine
+	JitError error;
+	return JitRuntime::Evaluate(name, numbers, numericMode, text, error) && error == JitError::None;
+}
+
+int IrConstantPropagation::FoldPhi(IrFunction& function, IrInstruction* phi)
+{
+	IrInstruction* same = nullptr;
+	bool sameInstruction = true;
+	bool sameConstant = !phi->operands.empty();
+	for (IrInstruction* operand : phi->operands)
+	{
+		if (operand == phi)
+			continue;
+		if (same != nullptr && operand != same)
+			sameInstruction = false;
+		if (operand->opcode != IrOpcode::Constant || (same != nullptr && operand->name != same->name))
+			sameConstant = false;
+		if (same == nullptr)
+			same = operand;
+	}
+
+	if (same == nullptr || (!sameInstruction && !sameConstant))
+		return 0;
+
+	// The constants come from different blocks, a copy in this block dominates every use
+	if (!sameInstruction)
+		same = phi->block->InsertAfterPhis(function.Number(new IrInstruction(IrOpcode::Constant, same->name, std::vector<IrInstruction*>())));
+
+	function.ReplaceAllUses(phi, same);
+	phi->block->Remove(phi);
+	return 1;
+}
+
+int IrConstantPropagation::FoldBranch(IrInstruction* branch)
+{
+	IrInstruction* condition = branch->operands.at(0);
+	if (condition->opcode != IrOpcode::Constant)
+		return 0;
+
+	bool taken = !condition->name.empty() && condition->name[0] == '1';
+	IrBlock* target = branch->blocks.at(taken ? 0 : 1);
+	IrBlock* other = branch->blocks.at(taken ? 1 : 0);
+
+	// The other block loses this edge, when both are the same it keeps one
+	other->RemovePhiOperands(branch->block);
+
+	branch->opcode = IrOpcode::Jump;
+	branch->operands.clear();
+	branch->blocks = { target };
+	return 1;
+}
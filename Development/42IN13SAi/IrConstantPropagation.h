@@ -0,0 +1,29 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "IrPass.h"
+#include "NumericPolicy.h"
+
+// Folds instructions whose operands are all constants into a constant with
+// the text the VirtualMachine would produce, removes phis that merge the same
+// value and turns branches on a constant into jumps. Builtins that would throw
+// are left alone, the program has to throw when it gets there.
+class IrConstantPropagation : public IrPass
+{
+public:
+	IrConstantPropagation(NumericMode p_numericMode);
+	virtual ~IrConstantPropagation();
+
+	std::string GetName() override;
+	int Run(IrFunction& function) override;
+
+private:
+	NumericMode numericMode;
+
+	bool Fold(IrInstruction* instruction, std::string& text);
+	bool FoldBuiltin(std::string name, std::vector<double> numbers, std::string& text);
+	int FoldPhi(IrFunction& function, IrInstruction* phi);
+	int FoldBranch(IrInstruction* branch);
+};
@@ -0,0 +1,59 @@
+#include "IrDeadCodeElimination.h"
+#include <set>
+#include <vector>
+
+IrDeadCodeElimination::IrDeadCodeElimination()
+{
+}
+
+IrDeadCodeElimination::~IrDeadCodeElimination()
+{
+}
+
+std::string IrDeadCodeElimination::GetName()
+{
+	return "dead-code-elimination";
+}
+
+int IrDeadCodeElimination::Run(IrFunction& function)
+{
+	int changes = function.RemoveUnreachableBlocks();
+
+	// Everything with a side effect is live, and so is everything it uses
+	std::set<IrInstruction*> live;
+	std::vector<IrInstruction*> work;
+	for (std::unique_ptr<IrBlock>& block : function.blocks)
+	{
+		for (std::unique_ptr<IrInstruction>& instruction : block->instructions)
+		{
+			if (instruction->HasSideEffects())
+				work.push_back(instruction.get());
+		}
+	}
+
+	while (!work.empty())
+	{
+		IrInstruction* instruction = work.back();
+		work.pop_back();
+		if (!live.insert(instruction).second)
+			continue;
+
+		for (IrInstruction* operand : instruction->operands)
+			work.push_back(operand);
+	}
+
+	for (std::unique_ptr<IrBlock>& block : function.blocks)
+	{
+		std::vector<IrInstruction*> dead;
+		for (std::unique_ptr<IrInstruction>& instruction : block->instructions)
+		{
+			if (live.count(instruction.get()) == 0)
+				dead.push_back(instruction.get());
+		}
+
+		for (IrInstruction* instruction : dead)
+			block->Remove(instruction);
+		changes += (int)dead.size();
+	}
+	return changes;
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <string>
+
+#include "IrPass.h"
+
+// Removes the blocks the entry can't reach and every instruction whose value
+// no side effect, branch or return ends up using
+class IrDeadCodeElimination : public IrPass
+{
+public:
+	IrDeadCodeElimination();
+	virtual ~IrDeadCodeElimination();
+
+	std::string GetName() override;
+	int Run(IrFunction& function) override;
+};
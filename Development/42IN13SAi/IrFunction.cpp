@@ -0,0 +1,213 @@
+#include "IrFunction.h"
+#include <algorithm>
+#include <set>
+
+IrFunction::IrFunction(std::string p_name, std::vector<std::string> p_parameters) : name(p_name), parameters(p_parameters)
+{
+}
+
+IrFunction::~IrFunction()
+{
+}
+
+IrBlock* IrFunction::GetEntry()
+{
+	return blocks.empty() ? nullptr : blocks.front().get();
+}
+
+IrBlock* IrFunction::NewBlock()
+{
+	blocks.push_back(std::unique_ptr<IrBlock>(new IrBlock(nextBlockId++)));
+	return blocks.back().get();
+}
+
+IrInstruction* IrFunction::Number(IrInstruction* instruction)
+{
+	instruction->id = nextValueId++;
+	return instruction;
+}
+
+void IrFunction::ComputePredecessors()
+{
+	for (std::unique_ptr<IrBlock>& block : blocks)
+		block->predecessors.clear();
+
+	for (std::unique_ptr<IrBlock>& block : blocks)
+	{
+		for (IrBlock* successor : block->GetSuccessors())
+			successor->predecessors.push_back(block.get());
+	}
+}
+
+int IrFunction::RemoveUnreachableBlocks()
+{
+	if (blocks.empty())
+		return 0;
+
+	std::set<IrBlock*> reachable;
+	std::vector<IrBlock*> work = { GetEntry() };
+	while (!work.empty())
+	{
+		IrBlock* block = work.back();
+		work.pop_back();
+		if (!reachable.insert(block).second)
+			continue;
+
+		for (IrBlock* successor : block->GetSuccessors())
+			work.push_back(successor);
+	}
+
+	if (reachable.size() == blocks.size())
+		return 0;
+
+	// The phis of the blocks that stay lose the edges from the removed blocks
+	for (std::unique_ptr<IrBlock>& block : blocks)
+	{
+		if (reachable.count(block.get()) > 0)
+			continue;
+
+		for (IrBlock* successor : block->GetSuccessors())
+		{
+			if (reachable.count(successor) > 0)
+				successor->RemovePhiOperands(block.get());
+		}
+	}
+
+	int removed = (int)blocks.size() - (int)reachable.size();
+	blocks.erase(std::remove_if(blocks.begin(), blocks.end(), [&reachable](const std::unique_ptr<IrBlock>& block) {
+		return reachable.count(block.get()) == 0;
+	}), blocks.end());
+
+	ComputePredecessors();
+	return removed;
+}
+
+void IrFunction::ReplaceAllUses(IrInstruction* from, IrInstruction* to)
+{
+	for (std::unique_ptr<IrBlock>& block : blocks)
+	{
+		for (std::unique_ptr<IrInstruction>& instruction : block->instructions)
+			std::replace(instruction->operands.begin(), instruction->operands.end(), from, to);
+	}
+}
+
+int IrFunction::CountInstructions()
+{
+	int count = 0;
+	for (std::unique_ptr<IrBlock>& block : blocks)
+		count += (int)block->instructions.size();
+	return count;
+}
+
+std::vector<IrBlock*> IrFunction::GetReversePostOrder()
+{
+	std::vector<IrBlock*> order;
+	if (blocks.empty())
+		return order;
+
+	// Depth first without recursion, long functions have deep graphs
+	std::set<IrBlock*> visited;
+	std::vector<std::pair<IrBlock*, size_t>> stack;
+	stack.push_back(std::make_pair(GetEntry(), (size_t)0));
+	visited.insert(GetEntry());
+
+	while (!stack.empty())
+	{
+		IrBlock* block = stack.back().first;
+		std::vector<IrBlock*> successors = block->GetSuccessors();
+		if (stack.back().second < successors.size())
+		{
+			IrBlock* successor = successors[stack.back().second++];
+			if (visited.insert(successor).second)
+				stack.push_back(std::make_pair(successor, (size_t)0));
+		}
+		else
+		{
+			order.push_back(block);
+			stack.pop_back();
+		}
+	}
+
+	std::reverse(order.begin(), order.end());
+	return order;
+}
+
+// Cooper, Harvey and Kennedy: iterate over the reverse postorder until the
+// immediate dominators don't change. The entry dominates itself.
+std::map<IrBlock*, IrBlock*> IrFunction::GetImmediateDominators()
+{
+	std::vector<IrBlock*> order = GetReversePostOrder();
+	std::map<IrBlock*, int> orderIndex;
+	for (size_t i = 0; i < order.size(); i++)
+		orderIndex[order[i]] = (int)i;
+
+	std::map<IrBlock*, IrBlock*> dominators;
+	if (order.empty())
+		return dominators;
+	dominators[order[0]] = order[0];
+
+	bool changed = true;
+	while (changed)
+	{
+		changed = false;
+		for (size_t i = 1; i < order.size(); i++)
+		{
+			IrBlock* newDominator = nullptr;
+			for (IrBlock* predecessor : order[i]->predecessors)
+			{
+				if (dominators.count(predecessor) == 0)
+					continue;
+				if (newDominator == nullptr)
+				{
+					newDominator = predecessor;
+					continue;
+				}
+
+				// Walk both up to the common dominator
+				IrBlock* a = predecessor;
+				IrBlock* b = newDominator;
+				while (a != b)
+				{
+					while (orderIndex[a] > orderIndex[b])
+						a = dominators[a];
+					while (orderIndex[b] > orderIndex[a])
+						b = dominators[b];
+				}
+				newDominator = a;
+			}
+
+			if (newDominator != nullptr && dominators[order[i]] != newDominator)
+			{
+				dominators[order[i]] = newDominator;
+				changed = true;
+			}
+		}
+	}
+	return dominators;
+}
+
+bool IrFunction::Dominates(std::map<IrBlock*, IrBlock*>& dominators, IrBlock* dominator, IrBlock* block)
+{
+	while (true)
+	{
+		if (block == dominator)
+			return true;
+
+		auto parent = dominators.find(block);
+		if (parent == dominators.end() || parent->second == block)
+			return false;
+		block = parent->second;
+	}
+}
+
+std::string IrFunction::ToString()
+{
+	std::string text = "function " + name + "(";
+	for (size_t i = 0; i < parameters.size(); i++)
+		text += (i == 0 ? "" : ", ") + parameters[i];
+	text += ")\n";
+
+	for (std::unique_ptr<IrBlock>& block : blocks)
+		text += block->ToString();
+	return text;
+}
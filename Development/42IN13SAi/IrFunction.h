@@ -0,0 +1,47 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "IrBlock.h"
+#include "IrInstruction.h"
+
+// The control flow graph of a Subroutine, or of the global statements.
+// The first block is the entry and has no predecessors.
+class IrFunction
+{
+public:
+	IrFunction(std::string name, std::vector<std::string> parameters);
+	virtual ~IrFunction();
+
+	std::string name;
+	std::vector<std::string> parameters;
+	std::vector<std::unique_ptr<IrBlock>> blocks;
+
+	IrBlock* GetEntry();
+	IrBlock* NewBlock();
+
+	// Give an instruction the next value number
+	IrInstruction* Number(IrInstruction* instruction);
+
+	// Rebuild the predecessors from the terminators
+	void ComputePredecessors();
+
+	// Remove the blocks the entry can't reach, returns the number of removed blocks
+	int RemoveUnreachableBlocks();
+
+	void ReplaceAllUses(IrInstruction* from, IrInstruction* to);
+	int CountInstructions();
+
+	std::vector<IrBlock*> GetReversePostOrder();
+	std::map<IrBlock*, IrBlock*> GetImmediateDominators();
+	static bool Dominates(std::map<IrBlock*, IrBlock*>& dominators, IrBlock* dominator, IrBlock* block);
+
+	std::string ToString();
+
+private:
+	int nextBlockId = 0;
+	int nextValueId = 0;
+};
@@ -0,0 +1,144 @@
+#include "IrInstruction.h"
+#include "IrBlock.h"
+#include "Builtins.h"
+#include <map>
+
+namespace
+{
+	struct IrBuiltin
+	{
+		int arity;
+		bool canFail;	// throws for some inputs, like $div by zero
+	};
+
+	const std::map<std::string, IrBuiltin>& GetBuiltins()
+	{
+		static std::map<std::string, IrBuiltin> builtins;
+		if (builtins.empty())
+		{
+			builtins["$add"] = { 2, false };
+			builtins["$min"] = { 2, false };
+			builtins["$mul"] = { 2, false };
+			builtins["$div"] = { 2, true };
+			builtins["$uniPlus"] = { 1, false };
+			builtins["$uniMin"] = { 1, false };
+			builtins["$powInt"] = { 2, false };
+
+			// The builtins with a value, as the table has them
+			for (int i = 0; i < Builtins::Count(); i++)
+			{
+				const Builtin& builtin = Builtins::Get(i);
+				if (!builtin.statement)
+					builtins[builtin.expression] = { builtin.arity, builtin.canFail };
+			}
+
+			builtins["$mathpi"] = { 0, false };
+			builtins["$mathe"] = { 0, false };
+		}
+		return builtins;
+	}
+}
+
+IrInstruction::IrInstruction(IrOpcode p_opcode, std::string p_name, std::vector<IrInstruction*> p_operands)
+: opcode(p_opcode), name(p_name), operands(p_operands)
+{
+}
+
+IrInstruction::~IrInstruction()
+{
+}
+
+bool IrInstruction::IsTerminator()
+{
+	return opcode == IrOpcode::Jump || opcode == IrOpcode::Branch || opcode == IrOpcode::Return || opcode == IrOpcode::Stop;
+}
+
+bool IrInstruction::HasValue()
+{
+	return opcode < IrOpcode::StoreGlobal;
+}
+
+bool IrInstruction::HasSideEffects()
+{
+	switch (opcode)
+	{
+	case IrOpcode::Builtin:
+		return CanBuiltinFail(name);
+	case IrOpcode::Call:
+		return true;
+	default:
+		return !HasValue();
+	}
+}
+
+std::string IrInstruction::ToString()
+{
+	std::string text;
+	if (HasValue())
+		text = "v" + std::to_string(id) + " = ";
+	text += GetOpcodeName(opcode);
+
+	if (opcode == IrOpcode::Constant)
+		return text + " \"" + name + "\"";
+	if (!name.empty())
+		text += " " + name;
+
+	for (size_t i = 0; i < operands.size(); i++)
+	{
+		text += (i == 0 ? " " : ", ");
+		if (opcode == IrOpcode::Phi)
+			text += "[v" + std::to_string(operands[i]->id) + ", b" + std::to_string(blocks[i]->id) + "]";
+		else
+			text += "v" + std::to_string(operands[i]->id);
+	}
+
+	if (opcode != IrOpcode::Phi)
+	{
+		for (size_t i = 0; i < blocks.size(); i++)
+			text += (i == 0 && operands.empty() ? " " : ", ") + std::string("b") + std::to_string(blocks[i]->id);
+	}
+	return text;
+}
+
+std::string IrInstruction::GetOpcodeName(IrOpcode opcode)
+{
+	switch (opcode)
+	{
+	case IrOpcode::Constant: return "constant";
+	case IrOpcode::Parameter: return "parameter";
+	case IrOpcode::Entry: return "entry";
+	case IrOpcode::Phi: return "phi";
+	case IrOpcode::Round: return "round";
+	case IrOpcode::Builtin: return "builtin";
+	case IrOpcode::Compare: return "compare";
+	case IrOpcode::IsOne: return "isone";
+	case IrOpcode::And: return "and";
+	case IrOpcode::Call: return "call";
+	case IrOpcode::LoadGlobal: return "loadglobal";
+	case IrOpcode::StoreGlobal: return "storeglobal";
+	case IrOpcode::Print: return "print";
+	case IrOpcode::Abc: return "abc";
+	case IrOpcode::Jump: return "jump";
+	case IrOpcode::Branch: return "branch";
+	case IrOpcode::Return: return "return";
+	case IrOpcode::Stop: return "stop";
+	}
+	return "unknown";
+}
+
+bool IrInstruction::IsBuiltin(std::string name)
+{
+	return GetBuiltins().count(name) > 0;
+}
+
+int IrInstruction::GetBuiltinArity(std::string name)
+{
+	auto builtin = GetBuiltins().find(name);
+	return builtin != GetBuiltins().end() ? builtin->second.arity : -1;
+}
+
+bool IrInstruction::CanBuiltinFail(std::string name)
+{
+	auto builtin = GetBuiltins().find(name);
+	return builtin == GetBuiltins().end() || builtin->second.canFail;
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+class IrBlock;
+
+// Every value in the IR is the text the VirtualMachine would pass on in a
+// $value node, so folding and comparing values gives the same results.
+enum class IrOpcode
+{
+	// Values
+	Constant,		// name: the literal text
+	Parameter,		// name: the parameter, holds the argument of the caller
+	Entry,			// name: the local, read before the call assigns it
+	Phi,			// blocks: the incoming block of every operand
+	Round,			// the text a variable gives back after assigning the operand to it
+	Builtin,		// name: the math operation or builtin ($add, $sqrt, $mathpi, ...)
+	Compare,		// name: $less, $lessOrEq, $greater, $greaterOrEq, $equals or $notEquals
+	IsOne,			// 1 when the text of the operand is exactly 1, like && and || check it
+	And,			// 1 when the text of both operands is exactly 1
+	Call,			// name: the function, operands: the arguments
+	LoadGlobal,		// name: the global
+
+	// Side effects
+	StoreGlobal,	// name: the global, operand: the rounded value
+	Print,
+	Abc,
+
+	// Terminators
+	Jump,			// blocks: the target
+	Branch,			// operand: the condition, blocks: the true and the false target
+	Return,			// optional operand: the returned value
+	Stop
+};
+
+class IrInstruction
+{
+public:
+	IrInstruction(IrOpcode opcode, std::string name, std::vector<IrInstruction*> operands);
+	virtual ~IrInstruction();
+
+	IrOpcode opcode;
+	std::string name;
+	std::vector<IrInstruction*> operands;
+	std::vector<IrBlock*> blocks;
+	IrBlock* block = nullptr;
+	int id = -1;
+
+	bool IsTerminator();
+	bool HasValue();
+
+	// Instructions that can't be removed when nobody uses their value
+	bool HasSideEffects();
+
+	std::string ToString();
+	static std::string GetOpcodeName(IrOpcode opcode);
+
+	// The math operations and builtins a Builtin instruction can call
+	static bool IsBuiltin(std::string name);
+	static int GetBuiltinArity(std::string name);
+	static bool CanBuiltinFail(std::string name);
+};
@@ -0,0 +1,41 @@
+#include "IrModule.h"
+
+IrModule::IrModule()
+{
+}
+
+IrModule::~IrModule()
+{
+}
+
+IrFunction* IrModule::AddFunction(std::string name, std::vector<std::string> parameters)
+{
+	functions.push_back(std::unique_ptr<IrFunction>(new IrFunction(name, parameters)));
+	return functions.back().get();
+}
+
+IrFunction* IrModule::GetFunction(std::string name)
+{
+	for (std::unique_ptr<IrFunction>& function : functions)
+	{
+		if (function->name == name)
+			return function.get();
+	}
+	return nullptr;
+}
+
+std::string IrModule::ToString()
+{
+	std::string text;
+	if (!globals.empty())
+	{
+		text += "globals";
+		for (size_t i = 0; i < globals.size(); i++)
+			text += (i == 0 ? " " : ", ") + globals[i];
+		text += "\n\n";
+	}
+
+	for (size_t i = 0; i < functions.size(); i++)
+		text += (i == 0 ? "" : "\n") + functions[i]->ToString();
+	return text;
+}
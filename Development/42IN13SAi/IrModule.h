@@ -0,0 +1,24 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "IrFunction.h"
+
+// The IR of a whole program: the global statements run as the function
+// $globals before main
+class IrModule
+{
+public:
+	IrModule();
+	virtual ~IrModule();
+
+	std::vector<std::string> globals;
+	std::vector<std::unique_ptr<IrFunction>> functions;
+
+	IrFunction* AddFunction(std::string name, std::vector<std::string> parameters);
+	IrFunction* GetFunction(std::string name);
+
+	std::string ToString();
+};
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <string>
+
+#include "IrFunction.h"
+
+// A transformation over one function, run by the IrPassManager
+class IrPass
+{
+public:
+	virtual ~IrPass() {}
+
+	virtual std::string GetName() = 0;
+
+	// Returns the number of changes, 0 when the function is untouched
+	virtual int Run(IrFunction& function) = 0;
+};
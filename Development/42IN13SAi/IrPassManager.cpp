@@ -0,0 +1,65 @@
+#include "IrPassManager.h"
+#include "IrVerifier.h"
+
+IrPassManager::IrPassManager()
+{
+}
+
+IrPassManager::~IrPassManager()
+{
+}
+
+void IrPassManager::AddPass(std::unique_ptr<IrPass> pass)
+{
+	passes.push_back(std::move(pass));
+}
+
+void IrPassManager::SetVerify(bool p_verify)
+{
+	verify = p_verify;
+}
+
+bool IrPassManager::Run(IrModule& module)
+{
+	if (verify)
+	{
+		IrVerifier verifier;
+		if (!verifier.Verify(module))
+		{
+			errors = verifier.GetErrors();
+			errors.insert(errors.begin(), "The IR is invalid before the first pass");
+			return false;
+		}
+	}
+
+	for (std::unique_ptr<IrPass>& pass : passes)
+	{
+		int changes = 0;
+		for (std::unique_ptr<IrFunction>& function : module.functions)
+			changes += pass->Run(*function);
+
+		log.push_back(pass->GetName() + ": " + std::to_string(changes) + " changes");
+
+		if (verify)
+		{
+			IrVerifier verifier;
+			if (!verifier.Verify(module))
+			{
+				errors = verifier.GetErrors();
+				errors.insert(errors.begin(), "The IR is invalid after " + pass->GetName());
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+std::vector<std::string> IrPassManager::GetLog()
+{
+	return log;
+}
+
+std::vector<std::string> IrPassManager::GetErrors()
+{
+	return errors;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "IrModule.h"
+#include "IrPass.h"
+
+// Runs the passes in order over every function of a module and verifies the
+// IR after every pass, so a broken pass is caught where it happens
+class IrPassManager
+{
+public:
+	IrPassManager();
+	virtual ~IrPassManager();
+
+	void AddPass(std::unique_ptr<IrPass> pass);
+	void SetVerify(bool verify);
+
+	// Stops at the first pass that leaves invalid IR behind
+	bool Run(IrModule& module);
+
+	std::vector<std::string> GetLog();
+	std::vector<std::string> GetErrors();
+
+private:
+	std::vector<std::unique_ptr<IrPass>> passes;
+	bool verify = true;
+	std::vector<std::string> log;
+	std::vector<std::string> errors;
+};
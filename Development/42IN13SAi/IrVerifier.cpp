@@ -0,0 +1,219 @@
+#include "IrVerifier.h"
+#include <algorithm>
+#include <map>
+#include <set>
+
+IrVerifier::IrVerifier()
+{
+}
+
+IrVerifier::~IrVerifier()
+{
+}
+
+bool IrVerifier::Verify(IrModule& module)
+{
+	bool valid = true;
+	for (std::unique_ptr<IrFunction>& p_function : module.functions)
+	{
+		if (!Verify(*p_function))
+			valid = false;
+	}
+	return valid;
+}
+
+bool IrVerifier::Verify(IrFunction& p_function)
+{
+	size_t errorCount = errors.size();
+	function = &p_function;
+
+	if (function->blocks.empty())
+		Error(nullptr, "has no blocks");
+	else if (!function->GetEntry()->predecessors.empty())
+		Error(function->GetEntry(), "the entry has predecessors");
+
+	for (std::unique_ptr<IrBlock>& block : function->blocks)
+		VerifyBlock(block.get());
+
+	// Dominance only means something when the graph itself is right
+	if (errors.size() == errorCount)
+		VerifyDominance();
+
+	function = nullptr;
+	return errors.size() == errorCount;
+}
+
+std::vector<std::string> IrVerifier::GetErrors()
+{
+	return errors;
+}
+
+void IrVerifier::VerifyBlock(IrBlock* block)
+{
+	if (block->GetTerminator() == nullptr)
+		Error(block, "doesn't end with a terminator");
+
+	std::set<IrBlock*> blocks;
+	for (std::unique_ptr<IrBlock>& other : function->blocks)
+		blocks.insert(other.get());
+
+	// The predecessors have to be exactly the blocks that jump here
+	std::vector<IrBlock*> jumps;
+	for (std::unique_ptr<IrBlock>& other : function->blocks)
+	{
+		for (IrBlock* successor : other->GetSuccessors())
+		{
+			if (successor == block)
+				jumps.push_back(other.get());
+		}
+	}
+
+	std::vector<IrBlock*> predecessors = block->predecessors;
+	std::sort(jumps.begin(), jumps.end());
+	std::sort(predecessors.begin(), predecessors.end());
+	if (jumps != predecessors)
+		Error(block, "the predecessors don't match the terminators");
+
+	bool phis = true;
+	for (size_t i = 0; i < block->instructions.size(); i++)
+	{
+		IrInstruction* instruction = block->instructions[i].get();
+		if (instruction->block != block)
+			Error(block, "v" + std::to_string(instruction->id) + " belongs to another block");
+		if (instruction->IsTerminator() && i + 1 != block->instructions.size())
+			Error(block, "has a terminator in the middle");
+
+		if (instruction->opcode == IrOpcode::Phi)
+		{
+			if (!phis)
+				Error(block, "phi v" + std::to_string(instruction->id) + " comes after other instructions");
+
+			std::vector<IrBlock*> incoming = instruction->blocks;
+			std::sort(incoming.begin(), incoming.end());
+			if (incoming != predecessors)
+				Error(block, "phi v" + std::to_string(instruction->id) + " doesn't have one operand per predecessor");
+		}
+		else
+			phis = false;
+
+		for (IrBlock* target : instruction->blocks)
+		{
+			if (blocks.count(target) == 0)
+				Error(block, "v" + std::to_string(instruction->id) + " refers to a block of another function");
+		}
+
+		VerifyInstruction(instruction);
+	}
+}
+
+void IrVerifier::VerifyInstruction(IrInstruction* instruction)
+{
+	size_t operands = instruction->operands.size();
+	size_t blocks = instruction->blocks.size();
+	bool valid = true;
+
+	switch (instruction->opcode)
+	{
+	case IrOpcode::Constant:
+	case IrOpcode::Parameter:
+	case IrOpcode::Entry:
+	case IrOpcode::LoadGlobal:
+	case IrOpcode::Stop:
+		valid = operands == 0 && blocks == 0;
+		break;
+	case IrOpcode::Phi:
+		valid = operands == blocks;
+		break;
+	case IrOpcode::Round:
+	case IrOpcode::IsOne:
+	case IrOpcode::StoreGlobal:
+	case IrOpcode::Print:
+		valid = operands == 1 && blocks == 0;
+		break;
+	case IrOpcode::Compare:
+	case IrOpcode::And:
+		valid = operands == 2 && blocks == 0;
+		break;
+	case IrOpcode::Abc:
+		valid = operands == 3 && blocks == 0;
+		break;
+	case IrOpcode::Builtin:
+		valid = (int)operands == IrInstruction::GetBuiltinArity(instruction->name) && blocks == 0;
+		break;
+	case IrOpcode::Call:
+		valid = blocks == 0;
+		break;
+	case IrOpcode::Jump:
+		valid = operands == 0 && blocks == 1;
+		break;
+	case IrOpcode::Branch:
+		valid = operands == 1 && blocks == 2;
+		break;
+	case IrOpcode::Return:
+		valid = operands <= 1 && blocks == 0;
+		break;
+	}
+
+	if (!valid)
+		Error(instruction->block, "v" + std::to_string(instruction->id) + " has the wrong operands for " + IrInstruction::GetOpcodeName(instruction->opcode));
+
+	for (IrInstruction* operand : instruction->operands)
+	{
+		if (operand == nullptr)
+			Error(instruction->block, "v" + std::to_string(instruction->id) + " has a missing operand");
+		else if (!operand->HasValue())
+			Error(instruction->block, "v" + std::to_string(instruction->id) + " uses an instruction without a value");
+	}
+}
+
+void IrVerifier::VerifyDominance()
+{
+	std::map<IrInstruction*, std::pair<IrBlock*, int>> definitions;
+	for (std::unique_ptr<IrBlock>& block : function->blocks)
+	{
+		for (size_t i = 0; i < block->instructions.size(); i++)
+			definitions[block->instructions[i].get()] = std::make_pair(block.get(), (int)i);
+	}
+
+	std::map<IrBlock*, IrBlock*> dominators = function->GetImmediateDominators();
+	for (std::unique_ptr<IrBlock>& block : function->blocks)
+	{
+		// Unreachable blocks have no dominators to check against
+		if (dominators.count(block.get()) == 0)
+			continue;
+
+		for (size_t i = 0; i < block->instructions.size(); i++)
+		{
+			IrInstruction* instruction = block->instructions[i].get();
+			for (size_t j = 0; j < instruction->operands.size(); j++)
+			{
+				auto definition = definitions.find(instruction->operands[j]);
+				if (definition == definitions.end())
+				{
+					Error(block.get(), "v" + std::to_string(instruction->id) + " uses a value that isn't in the function");
+					continue;
+				}
+
+				// A phi operand has to be available at the end of its predecessor
+				bool dominates;
+				if (instruction->opcode == IrOpcode::Phi)
+					dominates = IrFunction::Dominates(dominators, definition->second.first, instruction->blocks[j]);
+				else if (definition->second.first == block.get())
+					dominates = definition->second.second < (int)i;
+				else
+					dominates = IrFunction::Dominates(dominators, definition->second.first, block.get());
+
+				if (!dominates)
+					Error(block.get(), "v" + std::to_string(instruction->id) + " uses v" + std::to_string(instruction->operands[j]->id) + " before it is defined");
+			}
+		}
+	}
+}
+
+void IrVerifier::Error(IrBlock* block, std::string message)
+{
+	std::string location = "In function " + (function != nullptr ? function->name : std::string("?"));
+	if (block != nullptr)
+		location += ", block b" + std::to_string(block->id);
+	errors.push_back(location + ": " + message);
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "IrModule.h"
+
+// Checks the invariants every pass has to keep:
+//
+//   - every block ends with exactly one terminator and starts with its phis
+//   - the predecessors match the terminators and every phi has one operand per predecessor
+//   - every operand is defined in the function and its definition dominates the use
+//   - every instruction has the operands and targets its opcode needs
+class IrVerifier
+{
+public:
+	IrVerifier();
+	virtual ~IrVerifier();
+
+	bool Verify(IrModule& module);
+	bool Verify(IrFunction& function);
+	std::vector<std::string> GetErrors();
+
+private:
+	std::vector<std::string> errors;
+	IrFunction* function = nullptr;
+
+	void VerifyBlock(IrBlock* block);
+	void VerifyInstruction(IrInstruction* instruction);
+	void VerifyDominance();
+	void Error(IrBlock* block, std::string message);
+};
@@ -0,0 +1,507 @@
+#define _USE_MATH_DEFINES
+#include "JitCompiler.h"
+#include "Builtins.h"
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+
+namespace
+{
+	// Runtime helper for a math operation or builtin, JitRuntime::GetHelper gives the function for the precision
+	struct JitHelper
+	{
+		int arity;
+		bool canFail;
+	};
+
+	JitHelper MakeHelper(int arity, bool canFail)
+	{
+		JitHelper helper = { arity, canFail };
+		return helper;
+	}
+
+	const std::map<std::string, JitHelper>& GetHelpers()
+	{
+		static std::map<std::string, JitHelper> helpers;
+		if (helpers.empty())
+		{
+			helpers["$add"] = MakeHelper(2, false);
+			helpers["$min"] = MakeHelper(2, false);
+			helpers["$mul"] = MakeHelper(2, false);
+			helpers["$div"] = MakeHelper(2, true);
+			helpers["$uniPlus"] = MakeHelper(1, false);
+			helpers["$uniMin"] = MakeHelper(1, false);
+			helpers["$powInt"] = MakeHelper(2, false);
+
+			// The builtins JitRuntime runs with the handler of the table, one or two numbers
+			for (int i = 0; i < Builtins::Count(); i++)
+			{
+				const Builtin& builtin = Builtins::Get(i);
+				if (builtin.typed && (builtin.arity == 1 || builtin.arity == 2))
+					helpers[builtin.expression] = MakeHelper(builtin.arity, builtin.canFail);
+			}
+		}
+		return helpers;
+	}
+}
+
+JitCompiler::JitCompiler(SymbolTable* p_locals, SymbolTable* p_globals, NumericMode p_numericMode) : locals(p_locals), globals(p_globals), numericMode(p_numericMode)
+{
+}
+
+JitCompiler::~JitCompiler()
+{
+}
+
+std::shared_ptr<JitFunction> JitCompiler::Compile(std::shared_ptr<ListNode> first, std::shared_ptr<ListNode> last)
+{
+#ifndef JIT_AVAILABLE
+	Bail("the JIT is not available on this platform");
+	return nullptr;
+#else
+	// Number the nodes so jumps can be resolved to labels
+	std::vector<std::shared_ptr<CompilerNode>> nodes;
+	bool foundLast = last == nullptr;
+	for (std::shared_ptr<ListNode> listNode = first; listNode && listNode->GetData(); listNode = listNode->GetNext())
+	{
+		nodeIndexes[listNode->GetData().get()] = (int)nodes.size();
+		nodes.push_back(listNode->GetData());
+
+		if (listNode == last)
+		{
+			foundLast = true;
+			if (last->GetNext())
+				followingNode = last->GetNext()->GetData().get();
+			break;
+		}
+	}
+
+	if (!foundLast)
+	{
+		Bail("the last node does not follow the first node");
+		return nullptr;
+	}
+
+	// One label per node and one for the end
+	for (size_t i = 0; i <= nodes.size(); i++)
+		nodeLabels.push_back(emitter.CreateLabel());
+	stoppedLabel = emitter.CreateLabel();
+	failedLabel = emitter.CreateLabel();
+	exitLabel = emitter.CreateLabel();
+
+	emitter.Prologue(offsetof(JitContext, variables), offsetof(JitContext, temps));
+
+	for (size_t i = 0; i < nodes.size(); i++)
+	{
+		emitter.BindLabel(nodeLabels[i]);
+		if (!CompileStatement(nodes[i], (int)i))
+			return nullptr;
+	}
+
+	emitter.BindLabel(nodeLabels[nodes.size()]);
+	emitter.SetResult((int)JitExit::Finished);
+	emitter.Jump(exitLabel);
+
+	emitter.BindLabel(stoppedLabel);
+	emitter.SetResult((int)JitExit::Stopped);
+	emitter.Jump(exitLabel);
+
+	emitter.BindLabel(failedLabel);
+	emitter.SetResult((int)JitExit::Failed);
+
+	emitter.BindLabel(exitLabel);
+	emitter.Epilogue();
+
+	std::shared_ptr<JitFunction> function = std::make_shared<JitFunction>(emitter.Finish(), slotNames, assignedSlots, returns, maxTempCount);
+	if (!function->IsExecutable())
+	{
+		Bail("could not allocate executable memory");
+		return nullptr;
+	}
+	return function;
+#endif
+}
+
+std::string JitCompiler::GetBailoutReason()
+{
+	return bailoutReason;
+}
+
+bool JitCompiler::CompileStatement(std::shared_ptr<CompilerNode> node, int index)
+{
+	std::string expression = node->GetExpression();
+	std::vector<std::shared_ptr<CompilerNode>> parameters = node->GetNodeparameters();
+
+	for (std::shared_ptr<CompilerNode> parameter : parameters)
+	{
+		if (parameter == nullptr)
+			return Bail(expression + " has an empty parameter");
+	}
+
+	if (expression == "$assignment")
+	{
+		if (parameters.size() != 2 || parameters.at(0)->GetExpression() != "$identifier")
+			return Bail("unexpected assignment");
+
+		int slot = GetSlot(parameters.at(0)->GetValue(), true);
+		if (slot < 0)
+			return false;
+
+		// Variables always hold the rounded value, reads of a variable round it anyway
+		std::shared_ptr<CompilerNode> value = parameters.at(1);
+		if (value->GetExpression() == "$value")
+			emitter.LoadConstant(JitRuntime::RoundValue(atof(value->GetValue().c_str())));
+		else if (!CompileExpression(value))
+			return false;
+
+		emitter.StoreSlot(slot);
+		return true;
+	}
+
+	if (expression == "$increment" || expression == "$decrement")
+	{
+		int slot = GetSlot(node->GetValue(), true);
+		if (slot < 0)
+			return false;
+
+		emitter.LoadSlot(slot);
+		emitter.CallHelper(JitRuntime::GetHelper(expression == "$increment" ? "$uniPlus" : "$uniMin", numericMode));
+		emitter.StoreSlot(slot);
+		return true;
+	}
+
+	if (expression == "$addConstant" || expression == "$subtractConstant")
+	{
+		int slot = GetSlot(node->GetValue(), true);
+		if (slot < 0 || parameters.size() != 1)
+			return Bail("unexpected " + expression);
+
+		if (!CompileExpression(parameters.at(0)))
+			return false;
+		emitter.MoveToSecondOperand();
+		emitter.LoadSlot(slot);
+		emitter.CallHelper(JitRuntime::GetHelper(expression == "$addConstant" ? "$add" : "$min", numericMode));
+		emitter.StoreSlot(slot);
+		return true;
+	}
+
+	if (expression == "$if" || expression == "$whileLoop" || expression == "$ifCompare" || expression == "$whileCompare")
+	{
+		// A false condition continues after the jumpTo node
+		int target = GetTargetIndex(node->GetJumpTo());
+		if (target < 0)
+			return false;
+
+		int falseLabel = nodeLabels[target + 1];
+		if (expression == "$ifCompare" || expression == "$whileCompare")
+			return CompileCompare(node->GetValue(), parameters, falseLabel);
+
+		if (parameters.size() != 1)
+			return Bail("unexpected " + expression);
+		return CompileCondition(parameters.at(0), falseLabel);
+	}
+
+	if (expression == "$doNothing")
+	{
+		if (node->GetJumpTo() == nullptr)
+			return true;
+
+		// Continuing at the node after the compiled ones is finishing, an inlined ret does that
+		if (followingNode != nullptr && node->GetJumpTo().get() == followingNode)
+		{
+			emitter.Jump(nodeLabels[nodeLabels.size() - 1]);
+			return true;
+		}
+
+		int target = GetTargetIndex(node->GetJumpTo());
+		if (target < 0)
+			return false;
+
+		// Check on every loop iteration whether the VirtualMachine was stopped
+		if (target <= index)
+			emitter.JumpIfContextFlagCleared(offsetof(JitContext, running), stoppedLabel);
+
+		emitter.Jump(nodeLabels[target]);
+		return true;
+	}
+
+	if (expression == "$ret")
+	{
+		if (parameters.size() != 1)
+			return Bail("unexpected ret");
+
+		std::shared_ptr<CompilerNode> value = parameters.at(0);
+		JitReturn jitReturn = { false, false, "" };
+
+		if (value->GetExpression() == "$value")
+		{
+			jitReturn.isLiteral = true;
+			jitReturn.literal = value->GetValue();
+		}
+		else
+		{
+			if (!CompileExpression(value))
+				return false;
+
+			jitReturn.isLastResult = IsHelper(value->GetExpression());
+			emitter.StoreContextDouble(offsetof(JitContext, returnValue));
+		}
+
+		emitter.StoreContextInt(offsetof(JitContext, returnIndex), (int32_t)returns.size());
+		returns.push_back(jitReturn);
+
+		emitter.SetResult((int)JitExit::Returned);
+		emitter.Jump(exitLabel);
+		return true;
+	}
+
+	return Bail(expression + " is not supported");
+}
+
+// Leaves the value of the expression in xmm0
+bool JitCompiler::CompileExpression(std::shared_ptr<CompilerNode> node)
+{
+	if (node == nullptr)
+		return Bail("empty expression");
+
+	std::string expression = node->GetExpression();
+
+	if (expression == "$value")
+	{
+		emitter.LoadConstant(atof(node->GetValue().c_str()));
+		return true;
+	}
+
+	if (expression == "$getVariable")
+	{
+		int slot = GetSlot(node->GetValue(), false);
+		if (slot < 0)
+			return false;
+
+		emitter.LoadSlot(slot);
+		return true;
+	}
+
+	if (expression == "$mathpi")
+	{
+		emitter.LoadConstant(JitRuntime::RoundValue(M_PI));
+		return true;
+	}
+
+	if (expression == "$mathe")
+	{
+		emitter.LoadConstant(JitRuntime::RoundValue(M_E));
+		return true;
+	}
+
+	if (IsCompare(expression) || expression == "$compare")
+	{
+		// Compares result in 1 or 0
+		int falseLabel = emitter.CreateLabel();
+		int endLabel = emitter.CreateLabel();
+		std::string operation = expression == "$compare" ? node->GetValue() : expression;
+
+		if (!CompileCompare(operation, node->GetNodeparameters(), falseLabel))
+			return false;
+
+		emitter.LoadConstant(1);
+		emitter.Jump(endLabel);
+		emitter.BindLabel(falseLabel);
+		emitter.LoadConstant(0);
+		emitter.BindLabel(endLabel);
+		return true;
+	}
+
+	if (IsHelper(expression))
+		return CompileHelper(node);
+
+	return Bail(expression + " is not supported");
+}
+
+// Leaves the left operand in xmm0 and the right operand in xmm1
+bool JitCompiler::CompileOperands(std::shared_ptr<CompilerNode> left, std::shared_ptr<CompilerNode> right)
+{
+	if (left == nullptr || right == nullptr)
+		return Bail("empty operand");
+
+	// Loading a value or variable can't change the right operand, no temporary needed
+	if (left->GetExpression() == "$value" || left->GetExpression() == "$getVariable")
+	{
+		if (!CompileExpression(right))
+			return false;
+		emitter.MoveToSecondOperand();
+		return CompileExpression(left);
+	}
+
+	int temp = tempCount++;
+	if (tempCount > maxTempCount)
+		maxTempCount = tempCount;
+
+	if (!CompileExpression(left))
+		return false;
+	emitter.StoreTemp(temp);
+
+	if (!CompileExpression(right))
+		return false;
+	emitter.MoveToSecondOperand();
+	emitter.LoadTemp(temp);
+
+	tempCount--;
+	return true;
+}
+
+bool JitCompiler::CompileCondition(std::shared_ptr<CompilerNode> condition, int falseLabel)
+{
+	if (condition == nullptr)
+		return Bail("empty condition");
+
+	std::string expression = condition->GetExpression();
+
+	if (IsCompare(expression))
+		return CompileCompare(expression, condition->GetNodeparameters(), falseLabel);
+	if (expression == "$compare")
+		return CompileCompare(condition->GetValue(), condition->GetNodeparameters(), falseLabel);
+
+	// The interpreter checks whether the text of the value starts with a 1
+	if (expression == "$value")
+	{
+		if (condition->GetValue()[0] != '1')
+			emitter.Jump(falseLabel);
+		return true;
+	}
+
+	if (!CompileExpression(condition))
+		return false;
+
+	if (IsHelper(expression))
+		emitter.CallHelper(reinterpret_cast<const void*>(&JitRuntime::IsLastResultTrue));
+	else
+		emitter.CallHelper(reinterpret_cast<const void*>(&JitRuntime::IsTrue));
+
+	emitter.TestResult();
+	emitter.JumpIf(JitEmitter::Equal, falseLabel);
+	return true;
+}
+
+bool JitCompiler::CompileCompare(std::string operation, std::vector<std::shared_ptr<CompilerNode>> operands, int falseLabel)
+{
+	if (operands.size() != 2)
+		return Bail("unexpected compare");
+
+	if (!CompileOperands(operands.at(0), operands.at(1)))
+		return false;
+
+	// ucomisd sets the parity flag for NaN, which makes every compare false
+	// except not equals, the same as the C++ compares in the interpreter
+	if (operation == "$less")
+	{
+		emitter.CompareOperandsReversed();
+		emitter.JumpIf(JitEmitter::BelowOrEqual, falseLabel);
+	}
+	else if (operation == "$lessOrEq")
+	{
+		emitter.CompareOperandsReversed();
+		emitter.JumpIf(JitEmitter::Below, falseLabel);
+	}
+	else if (operation == "$greater")
+	{
+		emitter.CompareOperands();
+		emitter.JumpIf(JitEmitter::BelowOrEqual, falseLabel);
+	}
+	else if (operation == "$greaterOrEq")
+	{
+		emitter.CompareOperands();
+		emitter.JumpIf(JitEmitter::Below, falseLabel);
+	}
+	else if (operation == "$equals")
+	{
+		emitter.CompareOperands();
+		emitter.JumpIf(JitEmitter::NotEqual, falseLabel);
+		emitter.JumpIf(JitEmitter::Parity, falseLabel);
+	}
+	else if (operation == "$notEquals")
+	{
+		emitter.CompareOperands();
+		emitter.SkipNextJumpIf(JitEmitter::Parity);
+		emitter.JumpIf(JitEmitter::Equal, falseLabel);
+	}
+	else
+		return Bail("unknown compare " + operation);
+
+	return true;
+}
+
+bool JitCompiler::CompileHelper(std::shared_ptr<CompilerNode> node)
+{
+	JitHelper helper = GetHelpers().at(node->GetExpression());
+	std::vector<std::shared_ptr<CompilerNode>> parameters = node->GetNodeparameters();
+
+	// Let the interpreter throw the parameter exceptions
+	if ((int)parameters.size() != helper.arity)
+		return Bail(node->GetExpression() + " has the wrong amount of parameters");
+
+	if (helper.arity == 1)
+	{
+		if (!CompileExpression(parameters.at(0)))
+			return false;
+	}
+	else if (!CompileOperands(parameters.at(0), parameters.at(1)))
+		return false;
+
+	emitter.CallHelper(JitRuntime::GetHelper(node->GetExpression(), numericMode));
+	if (helper.canFail)
+		emitter.JumpIfContextIntSet(offsetof(JitContext, error), failedLabel);
+
+	return true;
+}
+
+bool JitCompiler::IsCompare(std::string expression)
+{
+	return expression == "$less" || expression == "$lessOrEq" || expression == "$greater"
+		|| expression == "$greaterOrEq" || expression == "$equals" || expression == "$notEquals";
+}
+
+bool JitCompiler::IsHelper(std::string expression)
+{
+	return GetHelpers().count(expression) > 0;
+}
+
+int JitCompiler::GetSlot(std::string name, bool assign)
+{
+	auto slotIndex = slotIndexes.find(name);
+	if (slotIndex == slotIndexes.end())
+	{
+		if (!(locals != nullptr && locals->HasSymbol(name)) && !globals->HasSymbol(name))
+		{
+			Bail("unknown variable " + name);
+			return -1;
+		}
+
+		slotIndex = slotIndexes.insert(std::make_pair(name, (int)slotNames.size())).first;
+		slotNames.push_back(name);
+		assignedSlots.push_back(false);
+	}
+
+	if (assign)
+		assignedSlots[slotIndex->second] = true;
+
+	return slotIndex->second;
+}
+
+int JitCompiler::GetTargetIndex(std::shared_ptr<CompilerNode> target)
+{
+	auto nodeIndex = nodeIndexes.find(target.get());
+	if (target == nullptr || nodeIndex == nodeIndexes.end())
+	{
+		Bail("jump out of the compiled nodes");
+		return -1;
+	}
+	return nodeIndex->second;
+}
+
+bool JitCompiler::Bail(std::string reason)
+{
+	if (bailoutReason.empty())
+		bailoutReason = reason;
+	return false;
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "CompilerNode.h"
+#include "ListNode.h"
+#include "SymbolTable.h"
+#include "JitEmitter.h"
+#include "JitFunction.h"
+
+// Compiles a run of compilernodes (a whole Subroutine or a single loop) to
+// x86-64 machine code.
+//
+// Only numeric code is supported: assignments, the math operations and
+// builtins, compares, if/while and ret. Anything else (prnt, stop, user
+// function calls, frl, && and ||) makes Compile return nullptr so the
+// VirtualMachine keeps interpreting those nodes.
+class JitCompiler
+{
+public:
+	JitCompiler(SymbolTable* locals, SymbolTable* globals, NumericMode numericMode);
+	virtual ~JitCompiler();
+
+	// Compile the nodes from first up to and including last
+	std::shared_ptr<JitFunction> Compile(std::shared_ptr<ListNode> first, std::shared_ptr<ListNode> last);
+	std::string GetBailoutReason();
+
+private:
+	SymbolTable* locals;
+	SymbolTable* globals;
+	NumericMode numericMode;
+	JitEmitter emitter;
+
+	// Variables
+	std::map<std::string, int> slotIndexes;
+	std::vector<std::string> slotNames;
+	std::vector<bool> assignedSlots;
+
+	// Temporaries for the left operand of binary operations
+	int tempCount = 0;
+	int maxTempCount = 0;
+
+	// Jump targets
+	std::map<CompilerNode*, int> nodeIndexes;
+	std::vector<int> nodeLabels;
+	CompilerNode* followingNode = nullptr;
+	int stoppedLabel = -1;
+	int failedLabel = -1;
+	int exitLabel = -1;
+
+	std::vector<JitReturn> returns;
+	std::string bailoutReason;
+
+	bool CompileStatement(std::shared_ptr<CompilerNode> node, int index);
+	bool CompileExpression(std::shared_ptr<CompilerNode> node);
+	bool CompileOperands(std::shared_ptr<CompilerNode> left, std::shared_ptr<CompilerNode> right);
+	bool CompileCondition(std::shared_ptr<CompilerNode> condition, int falseLabel);
+	bool CompileCompare(std::string operation, std::vector<std::shared_ptr<CompilerNode>> operands, int falseLabel);
+	bool CompileHelper(std::shared_ptr<CompilerNode> node);
+
+	bool IsCompare(std::string expression);
+	bool IsHelper(std::string expression);
+	int GetSlot(std::string name, bool assign);
+	int GetTargetIndex(std::shared_ptr<CompilerNode> target);
+	bool Bail(std::string reason);
+};
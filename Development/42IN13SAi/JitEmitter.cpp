@@ -0,0 +1,206 @@
+#include "JitEmitter.h"
+#include <cstring>
+
+JitEmitter::JitEmitter()
+{
+}
+
+JitEmitter::~JitEmitter()
+{
+}
+
+int JitEmitter::CreateLabel()
+{
+	labels.push_back(-1);
+	return (int)labels.size() - 1;
+}
+
+void JitEmitter::BindLabel(int label)
+{
+	labels.at(label) = (int)code.size();
+}
+
+// push rbx, r12, r13 keeps the stack 16 byte aligned for the helper calls
+void JitEmitter::Prologue(int slotsOffset, int tempsOffset)
+{
+	Emit({ 0x53 });						// push rbx
+	Emit({ 0x41, 0x54 });				// push r12
+	Emit({ 0x41, 0x55 });				// push r13
+	Emit({ 0x49, 0x89, 0xFC });			// mov r12, rdi
+	Emit({ 0x49, 0x8B, 0x9C, 0x24 });	// mov rbx, [r12 + variables]
+	Emit32(slotsOffset);
+	Emit({ 0x4D, 0x8B, 0xAC, 0x24 });	// mov r13, [r12 + temps]
+	Emit32(tempsOffset);
+}
+
+void JitEmitter::Epilogue()
+{
+	Emit({ 0x41, 0x5D });				// pop r13
+	Emit({ 0x41, 0x5C });				// pop r12
+	Emit({ 0x5B });						// pop rbx
+	Emit({ 0xC3 });						// ret
+}
+
+void JitEmitter::LoadSlot(int slot)
+{
+	Emit({ 0xF2, 0x0F, 0x10, 0x83 });	// movsd xmm0, [rbx + slot]
+	Emit32(slot * 8);
+}
+
+void JitEmitter::StoreSlot(int slot)
+{
+	Emit({ 0xF2, 0x0F, 0x11, 0x83 });	// movsd [rbx + slot], xmm0
+	Emit32(slot * 8);
+}
+
+void JitEmitter::LoadTemp(int temp)
+{
+	Emit({ 0xF2, 0x41, 0x0F, 0x10, 0x85 });	// movsd xmm0, [r13 + temp]
+	Emit32(temp * 8);
+}
+
+void JitEmitter::StoreTemp(int temp)
+{
+	Emit({ 0xF2, 0x41, 0x0F, 0x11, 0x85 });	// movsd [r13 + temp], xmm0
+	Emit32(temp * 8);
+}
+
+void JitEmitter::LoadConstant(double value)
+{
+	uint64_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+
+	Emit({ 0x48, 0xB8 });				// mov rax, imm64
+	Emit64(bits);
+	Emit({ 0x66, 0x48, 0x0F, 0x6E, 0xC0 });	// movq xmm0, rax
+}
+
+void JitEmitter::MoveToSecondOperand()
+{
+	Emit({ 0xF2, 0x0F, 0x10, 0xC8 });	// movsd xmm1, xmm0
+}
+
+void JitEmitter::StoreContextDouble(int offset)
+{
+	Emit({ 0xF2, 0x41, 0x0F, 0x11, 0x84, 0x24 });	// movsd [r12 + offset], xmm0
+	Emit32(offset);
+}
+
+void JitEmitter::StoreContextInt(int offset, int32_t value)
+{
+	Emit({ 0x41, 0xC7, 0x84, 0x24 });	// mov dword [r12 + offset], imm32
+	Emit32(offset);
+	Emit32(value);
+}
+
+// Helpers take the JitContext as first argument, the operands in xmm0 and xmm1
+void JitEmitter::CallHelper(const void* function)
+{
+	uint64_t address = (uint64_t)(uintptr_t)function;
+
+	Emit({ 0x4C, 0x89, 0xE7 });			// mov rdi, r12
+	Emit({ 0x48, 0xB8 });				// mov rax, imm64
+	Emit64(address);
+	Emit({ 0xFF, 0xD0 });				// call rax
+}
+
+void JitEmitter::CompareOperands()
+{
+	Emit({ 0x66, 0x0F, 0x2E, 0xC1 });	// ucomisd xmm0, xmm1
+}
+
+void JitEmitter::CompareOperandsReversed()
+{
+	Emit({ 0x66, 0x0F, 0x2E, 0xC8 });	// ucomisd xmm1, xmm0
+}
+
+void JitEmitter::TestResult()
+{
+	Emit({ 0x85, 0xC0 });				// test eax, eax
+}
+
+void JitEmitter::JumpIfContextIntSet(int offset, int label)
+{
+	Emit({ 0x41, 0x83, 0xBC, 0x24 });	// cmp dword [r12 + offset], 0
+	Emit32(offset);
+	Emit(0x00);
+	JumpIf(NotEqual, label);
+}
+
+void JitEmitter::JumpIfContextFlagCleared(int offset, int label)
+{
+	Emit({ 0x49, 0x8B, 0x84, 0x24 });	// mov rax, [r12 + offset]
+	Emit32(offset);
+	Emit({ 0x80, 0x38, 0x00 });			// cmp byte [rax], 0
+	JumpIf(Equal, label);
+}
+
+void JitEmitter::Jump(int label)
+{
+	Emit(0xE9);							// jmp rel32
+	EmitRelative(label);
+}
+
+void JitEmitter::JumpIf(Condition condition, int label)
+{
+	Emit({ 0x0F, (uint8_t)condition });	// jcc rel32
+	EmitRelative(label);
+}
+
+// Skips the conditional jump emitted right after this one
+void JitEmitter::SkipNextJumpIf(Condition condition)
+{
+	Emit({ 0x0F, (uint8_t)condition });
+	Emit32(6);
+}
+
+void JitEmitter::SetResult(int32_t value)
+{
+	Emit(0xB8);							// mov eax, imm32
+	Emit32(value);
+}
+
+size_t JitEmitter::Size()
+{
+	return code.size();
+}
+
+std::vector<uint8_t> JitEmitter::Finish()
+{
+	for (std::pair<size_t, int> fixup : fixups)
+	{
+		int32_t relative = labels.at(fixup.second) - (int32_t)(fixup.first + 4);
+		memcpy(&code[fixup.first], &relative, sizeof(relative));
+	}
+	return code;
+}
+
+void JitEmitter::Emit(uint8_t byte)
+{
+	code.push_back(byte);
+}
+
+void JitEmitter::Emit(std::initializer_list<uint8_t> bytes)
+{
+	code.insert(code.end(), bytes.begin(), bytes.end());
+}
+
+void JitEmitter::Emit32(int32_t value)
+{
+	uint8_t bytes[4];
+	memcpy(bytes, &value, sizeof(bytes));
+	code.insert(code.end(), bytes, bytes + 4);
+}
+
+void JitEmitter::Emit64(uint64_t value)
+{
+	uint8_t bytes[8];
+	memcpy(bytes, &value, sizeof(bytes));
+	code.insert(code.end(), bytes, bytes + 8);
+}
+
+void JitEmitter::EmitRelative(int label)
+{
+	fixups.push_back(std::make_pair(code.size(), label));
+	Emit32(0);
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <initializer_list>
+
+// Small x86-64 (System V) machine code emitter for the JIT.
+//
+// Only the handful of instructions the JitCompiler needs are supported.
+// Registers used by the generated code:
+//   rbx  pointer to the variable slots (double)
+//   r12  pointer to the JitContext
+//   r13  pointer to the temporary slots (double)
+//   xmm0 result of an expression, xmm1 second operand
+class JitEmitter
+{
+public:
+	enum Condition
+	{
+		Below = 0x82,
+		AboveOrEqual = 0x83,
+		Equal = 0x84,
+		NotEqual = 0x85,
+		BelowOrEqual = 0x86,
+		Above = 0x87,
+		Parity = 0x8A,
+		NoParity = 0x8B
+	};
+
+	JitEmitter();
+	virtual ~JitEmitter();
+
+	// Labels
+	int CreateLabel();
+	void BindLabel(int label);
+
+	// Function frame
+	void Prologue(int slotsOffset, int tempsOffset);
+	void Epilogue();
+
+	// Loads and stores of doubles
+	void LoadSlot(int slot);
+	void StoreSlot(int slot);
+	void LoadTemp(int temp);
+	void StoreTemp(int temp);
+	void LoadConstant(double value);
+	void MoveToSecondOperand();
+	void StoreContextDouble(int offset);
+	void StoreContextInt(int offset, int32_t value);
+
+	// Calls, compares and jumps
+	void CallHelper(const void* function);
+	void CompareOperands();
+	void CompareOperandsReversed();
+	void TestResult();
+	void JumpIfContextIntSet(int offset, int label);
+	void JumpIfContextFlagCleared(int offset, int label);
+	void Jump(int label);
+	void JumpIf(Condition condition, int label);
+	void SkipNextJumpIf(Condition condition);
+	void SetResult(int32_t value);
+
+	size_t Size();
+	// Resolves the labels and returns the machine code
+	std::vector<uint8_t> Finish();
+
+private:
+	std::vector<uint8_t> code;
+	std::vector<int> labels;
+	std::vector<std::pair<size_t, int>> fixups;
+
+	void Emit(uint8_t byte);
+	void Emit(std::initializer_list<uint8_t> bytes);
+	void Emit32(int32_t value);
+	void Emit64(uint64_t value);
+	void EmitRelative(int label);
+};
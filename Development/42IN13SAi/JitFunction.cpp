@@ -0,0 +1,122 @@
+#include "JitFunction.h"
+#include <cstring>
+
+#ifdef JIT_AVAILABLE
+#include <sys/mman.h>
+#endif
+
+typedef int (*JitEntry)(JitContext* context);
+
+JitFunction::JitFunction(std::vector<uint8_t> code, std::vector<std::string> p_slotNames, std::vector<bool> p_assignedSlots, std::vector<JitReturn> p_returns, int tempCount)
+: memory(nullptr), size(0), assignedSlots(p_assignedSlots), returns(p_returns)
+{
+	for (std::string name : p_slotNames)
+		slotAtoms.push_back(AtomTable::Intern(name));
+
+	variables.resize(slotAtoms.size() + 1);
+	temps.resize(tempCount + 1);
+
+#ifdef JIT_AVAILABLE
+	// Write the code in a writable page, then make the page executable
+	void* pages = mmap(nullptr, code.size(), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (pages != MAP_FAILED)
+	{
+		memcpy(pages, code.data(), code.size());
+		if (mprotect(pages, code.size(), PROT_READ | PROT_EXEC) == 0)
+		{
+			memory = pages;
+			size = code.size();
+		}
+		else
+			munmap(pages, code.size());
+	}
+#endif
+}
+
+JitFunction::~JitFunction()
+{
+#ifdef JIT_AVAILABLE
+	if (memory != nullptr)
+		munmap(memory, size);
+#endif
+}
+
+bool JitFunction::IsExecutable()
+{
+	return memory != nullptr;
+}
+
+size_t JitFunction::CodeSize()
+{
+	return size;
+}
+
+JitExit JitFunction::Run(SymbolTable* locals, SymbolTable* globals, const bool* running)
+{
+	if (memory == nullptr)
+		return JitExit::Unavailable;
+
+	// Find the symbols the same way the interpreter does, locals first
+	std::vector<Symbol*> symbols;
+	for (Atom name : slotAtoms)
+	{
+		Symbol* symbol = nullptr;
+		if (locals != nullptr)
+			symbol = locals->GetSymbol(name);
+		if (symbol == nullptr)
+			symbol = globals->GetSymbol(name);
+		if (symbol == nullptr)
+			return JitExit::Unavailable;
+
+		symbols.push_back(symbol);
+	}
+
+	// Variables are only read through $getVariable, which rounds them
+	std::vector<double> loaded(symbols.size());
+	for (size_t i = 0; i < symbols.size(); i++)
+	{
+		variables[i] = JitRuntime::RoundValue(symbols[i]->GetValue());
+		loaded[i] = variables[i];
+	}
+
+	context.variables = variables.data();
+	context.temps = temps.data();
+	context.running = running;
+	context.lastResult = 0;
+	context.returnValue = 0;
+	context.returnIndex = -1;
+	context.error = (int)JitError::None;
+	context.builtin = -1;
+
+	JitExit exit = (JitExit)((JitEntry)memory)(&context);
+
+	// An unset variable that was not written keeps its unset state
+	for (size_t i = 0; i < symbols.size(); i++)
+	{
+		bool changed = memcmp(&variables[i], &loaded[i], sizeof(double)) != 0;
+		if (assignedSlots[i] && (changed || symbols[i]->IsSet()))
+			symbols[i]->SetValue(variables[i]);
+	}
+
+	return exit;
+}
+
+std::string JitFunction::GetReturnValue()
+{
+	JitReturn jitReturn = returns.at(context.returnIndex);
+	if (jitReturn.isLiteral)
+		return jitReturn.literal;
+	if (jitReturn.isLastResult)
+		return JitRuntime::ToString(context.lastResult);
+	return JitRuntime::ToString(context.returnValue);
+}
+
+JitError JitFunction::GetError()
+{
+	return (JitError)context.error;
+}
+
+void JitFunction::ThrowBuiltinError(NumericMode mode)
+{
+	JitRuntime::ThrowBuiltinError(&context, mode);
+}
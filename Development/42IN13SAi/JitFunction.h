@@ -0,0 +1,58 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+
+#include "JitRuntime.h"
+#include "SymbolTable.h"
+
+// How the machine code left the compiled nodes
+enum class JitExit
+{
+	Finished,	// ran past the last compiled node
+	Returned,	// executed a $ret
+	Stopped,	// the VirtualMachine was stopped
+	Failed,		// a helper reported a JitError
+	Unavailable	// a variable could not be found, run the interpreter instead
+};
+
+// How a $ret builds its value node
+struct JitReturn
+{
+	bool isLiteral;			// $ret of a $value, returns the literal text
+	bool isLastResult;		// $ret of an operation, returns the unrounded result
+	std::string literal;
+};
+
+// Machine code for a Subroutine or a loop, in executable memory
+class JitFunction
+{
+public:
+	JitFunction(std::vector<uint8_t> code, std::vector<std::string> slotNames, std::vector<bool> assignedSlots, std::vector<JitReturn> returns, int tempCount);
+	virtual ~JitFunction();
+
+	bool IsExecutable();
+	size_t CodeSize();
+
+	// Load the variables, run the machine code and store the assigned variables
+	JitExit Run(SymbolTable* locals, SymbolTable* globals, const bool* running);
+	std::string GetReturnValue();
+	JitError GetError();
+	// Throw the exception of the builtin that failed, if it was one
+	void ThrowBuiltinError(NumericMode mode);
+
+private:
+	void* memory;
+	size_t size;
+
+	std::vector<Atom> slotAtoms;
+	std::vector<bool> assignedSlots;
+	std::vector<JitReturn> returns;
+	std::vector<double> variables;
+	std::vector<double> temps;
+	JitContext context;
+
+	JitFunction(const JitFunction& other);
+	JitFunction& operator=(const JitFunction& other);
+};
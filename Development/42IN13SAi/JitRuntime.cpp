@@ -0,0 +1,282 @@
+#define _USE_MATH_DEFINES
+#include "JitRuntime.h"
+#include "Builtins.h"
+#include "ZeroDivideException.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <map>
+#include <sstream>
+
+namespace
+{
+	typedef double(*UnaryOperation)(JitContext*, double);
+	typedef double(*BinaryOperation)(JitContext*, double, double);
+
+	struct Operations
+	{
+		std::map<std::string, UnaryOperation> unary;
+		std::map<std::string, BinaryOperation> binary;
+	};
+
+	// Adds the helpers of the builtins of the table from index on that BuiltinMath computes
+	template <typename Policy, int index>
+	struct BuiltinHelpers
+	{
+		static void Add(Operations& operations)
+		{
+			const Builtin& builtin = Builtins::Get(index);
+			if (builtin.typed && builtin.arity == 1)
+				operations.unary[builtin.expression] = &JitRuntime::CallBuiltin<Policy, index>;
+			else if (builtin.typed && builtin.arity == 2)
+				operations.binary[builtin.expression] = &JitRuntime::CallBuiltin<Policy, index>;
+			BuiltinHelpers<Policy, index + 1>::Add(operations);
+		}
+	};
+
+	template <typename Policy>
+	struct BuiltinHelpers<Policy, BuiltinMath<long double>::count>
+	{
+		static void Add(Operations&)
+		{
+		}
+	};
+
+	template <typename Policy>
+	const Operations& GetOperations()
+	{
+		static Operations operations;
+		if (operations.unary.empty())
+		{
+			operations.unary["$uniPlus"] = &JitRuntime::Increment<Policy>;
+			operations.unary["$uniMin"] = &JitRuntime::Decrement<Policy>;
+			operations.binary["$add"] = &JitRuntime::Add<Policy>;
+			operations.binary["$min"] = &JitRuntime::Subtract<Policy>;
+			operations.binary["$mul"] = &JitRuntime::Multiply<Policy>;
+			operations.binary["$div"] = &JitRuntime::Divide<Policy>;
+			operations.binary["$powInt"] = &JitRuntime::PowInt<Policy>;
+			BuiltinHelpers<Policy, 0>::Add(operations);
+		}
+		return operations;
+	}
+
+	template <typename Policy>
+	const void* FindHelper(std::string name)
+	{
+		auto unary = GetOperations<Policy>().unary.find(name);
+		if (unary != GetOperations<Policy>().unary.end())
+			return reinterpret_cast<const void*>(unary->second);
+
+		auto binary = GetOperations<Policy>().binary.find(name);
+		if (binary != GetOperations<Policy>().binary.end())
+			return reinterpret_cast<const void*>(binary->second);
+		return nullptr;
+	}
+
+	// Run the helper for the operands, false when there is none for this many operands
+	template <typename Policy>
+	bool Call(JitContext* context, std::string name, const std::vector<double>& numbers)
+	{
+		auto unary = GetOperations<Policy>().unary.find(name);
+		auto binary = GetOperations<Policy>().binary.find(name);
+		if (unary != GetOperations<Policy>().unary.end() && numbers.size() == 1)
+			unary->second(context, numbers[0]);
+		else if (binary != GetOperations<Policy>().binary.end() && numbers.size() == 2)
+			binary->second(context, numbers[0], numbers[1]);
+		else
+			return false;
+		return true;
+	}
+
+	// Runs a builtin of the table, for the exception it throws
+	template <typename Policy>
+	void RunBuiltin(int index, const double* numbers)
+	{
+		const BuiltinEntry<typename Policy::Value>& builtin = BuiltinMath<typename Policy::Value>::table[index];
+		if (builtin.arity == 1)
+			builtin.handler.unary(numbers[0]);
+		else if (builtin.arity == 2)
+			builtin.handler.binary(numbers[0], numbers[1]);
+	}
+}
+
+double JitRuntime::RoundValue(long double value)
+{
+	// Whole numbers print as "n.00000000000000" and read back unchanged
+	if (std::floor(value) == value && std::fabs(value) < 9007199254740992.0L)
+		return (double)value;
+
+	char buffer[64];
+	int length = snprintf(buffer, sizeof(buffer), "%.14Lf", value);
+	if (length > 0 && length < (int)sizeof(buffer))
+		return strtod(buffer, NULL);
+
+	return atof(ToString(value).c_str());
+}
+
+// Same formatting as VirtualMachine::toString
+std::string JitRuntime::ToString(long double value)
+{
+	std::ostringstream strs;
+	strs << std::fixed << std::setprecision(14) << value;
+	return strs.str();
+}
+
+double JitRuntime::Result(JitContext* context, long double value)
+{
+	context->lastResult = value;
+	return RoundValue(value);
+}
+
+double JitRuntime::Fail(JitContext* context, JitError error)
+{
+	context->error = (int)error;
+	return 0;
+}
+
+// In the catch of a builtin, keeps the builtin and its numbers for ThrowBuiltinError
+double JitRuntime::FailBuiltin(JitContext* context, int index, double num1, double num2)
+{
+	context->builtin = index;
+	context->numbers[0] = num1;
+	context->numbers[1] = num2;
+	try
+	{
+		throw;
+	}
+	catch (const ZeroDivideException&)
+	{
+		return Fail(context, JitError::DivisionByZero);
+	}
+	catch (...)
+	{
+		return Fail(context, JitError::InvalidInput);
+	}
+}
+
+#pragma region SimpleMath
+
+template <typename Policy>
+double JitRuntime::Add(JitContext* context, double num1, double num2)
+{
+	return Result(context, (typename Policy::Value)num1 + (typename Policy::Value)num2);
+}
+
+template <typename Policy>
+double JitRuntime::Subtract(JitContext* context, double num1, double num2)
+{
+	return Result(context, (typename Policy::Value)num1 - (typename Policy::Value)num2);
+}
+
+template <typename Policy>
+double JitRuntime::Multiply(JitContext* context, double num1, double num2)
+{
+	return Result(context, (typename Policy::Value)num1 * (typename Policy::Value)num2);
+}
+
+template <typename Policy>
+double JitRuntime::Divide(JitContext* context, double num1, double num2)
+{
+	if (num2 == 0)
+		return Fail(context, JitError::DivideByZero);
+	return Result(context, (typename Policy::Value)num1 / (typename Policy::Value)num2);
+}
+
+template <typename Policy>
+double JitRuntime::Increment(JitContext* context, double num1)
+{
+	return Result(context, (typename Policy::Value)num1 + 1);
+}
+
+template <typename Policy>
+double JitRuntime::Decrement(JitContext* context, double num1)
+{
+	return Result(context, (typename Policy::Value)num1 - 1);
+}
+
+#pragma endregion SimpleMath
+
+#pragma region ComplexMath
+
+template <typename Policy>
+double JitRuntime::PowInt(JitContext* context, double num1, double num2)
+{
+	return Result(context, Policy::IntegerPower(num1, num2));
+}
+
+template <typename Policy, int index>
+double JitRuntime::CallBuiltin(JitContext* context, double num1)
+{
+	try
+	{
+		return Result(context, BuiltinMath<typename Policy::Value>::table[index].handler.unary(num1));
+	}
+	catch (...)
+	{
+		return FailBuiltin(context, index, num1, 0);
+	}
+}
+
+template <typename Policy, int index>
+double JitRuntime::CallBuiltin(JitContext* context, double num1, double num2)
+{
+	try
+	{
+		return Result(context, BuiltinMath<typename Policy::Value>::table[index].handler.binary(num1, num2));
+	}
+	catch (...)
+	{
+		return FailBuiltin(context, index, num1, num2);
+	}
+}
+
+#pragma endregion ComplexMath
+
+int JitRuntime::IsTrue(JitContext*, double value)
+{
+	return ToString(value)[0] == '1';
+}
+
+int JitRuntime::IsLastResultTrue(JitContext* context)
+{
+	return ToString(context->lastResult)[0] == '1';
+}
+
+void JitRuntime::ThrowBuiltinError(JitContext* context, NumericMode mode)
+{
+	if (context->builtin < 0)
+		return;
+	if (mode == NumericMode::Double)
+		RunBuiltin<DoublePolicy>(context->builtin, context->numbers);
+	else
+		RunBuiltin<LongDoublePolicy>(context->builtin, context->numbers);
+}
+
+const void* JitRuntime::GetHelper(std::string name, NumericMode mode)
+{
+	if (mode == NumericMode::Double)
+		return FindHelper<DoublePolicy>(name);
+	return FindHelper<LongDoublePolicy>(name);
+}
+
+bool JitRuntime::Evaluate(std::string name, const std::vector<double>& numbers, NumericMode mode, std::string& text, JitError& error)
+{
+	error = JitError::None;
+	if (name == "$mathpi" || name == "$mathe")
+	{
+		text = ToString(name == "$mathpi" ? M_PI : M_E);
+		return numbers.empty();
+	}
+
+	JitContext context = {};
+	context.builtin = -1;
+	bool found = mode == NumericMode::Double ? Call<DoublePolicy>(&context, name, numbers) : Call<LongDoublePolicy>(&context, name, numbers);
+	if (!found)
+		return false;
+
+	error = (JitError)context.error;
+	if (error == JitError::None)
+		text = ToString(context.lastResult);
+	return true;
+}
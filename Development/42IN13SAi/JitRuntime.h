@@ -0,0 +1,86 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "NumericPolicy.h"
+
+// The JIT emits x86-64 System V code into mmap'ed pages, other platforms
+// always run the interpreter
+#if defined(__x86_64__) && !defined(_WIN32)
+#define JIT_AVAILABLE
+#endif
+
+// Errors the machine code reports back, the VirtualMachine throws the
+// same exception the interpreter would throw for them
+enum class JitError
+{
+	None,
+	DivideByZero,		// $div
+	DivisionByZero,		// a builtin threw a ZeroDivideException, $perc, $mod, $velo
+	InvalidInput		// a builtin threw an InvalidInputException, $sqrt, $log, $pyt
+};
+
+// State shared between the VirtualMachine and the generated machine code
+struct JitContext
+{
+	double* variables;
+	double* temps;
+	const bool* running;
+	long double lastResult;
+	double returnValue;
+	int returnIndex;
+	int error;
+
+	// The builtin of the table that failed and its numbers, -1 when it was an operation
+	int builtin;
+	double numbers[2];
+};
+
+// Helpers called from the generated machine code.
+//
+// Every helper does exactly what the VirtualMachine operation does, including
+// rounding the result through toString, so the JIT and the interpreter give
+// the same results. The unrounded result is kept in JitContext::lastResult.
+// The math helpers compute in the Value type of a NumericPolicy, the same
+// type the VirtualMachine handlers use in that NumericMode.
+class JitRuntime
+{
+public:
+	// Round a value the way passing it through a $value node does
+	static double RoundValue(long double value);
+	static std::string ToString(long double value);
+
+	template <typename Policy> static double Add(JitContext* context, double num1, double num2);
+	template <typename Policy> static double Subtract(JitContext* context, double num1, double num2);
+	template <typename Policy> static double Multiply(JitContext* context, double num1, double num2);
+	template <typename Policy> static double Divide(JitContext* context, double num1, double num2);
+	template <typename Policy> static double Increment(JitContext* context, double num1);
+	template <typename Policy> static double Decrement(JitContext* context, double num1);
+
+	template <typename Policy> static double PowInt(JitContext* context, double num1, double num2);
+
+	// A builtin of BuiltinMath with one or two numbers, its handler computes it and
+	// the exception it throws becomes the JitError
+	template <typename Policy, int index> static double CallBuiltin(JitContext* context, double num1);
+	template <typename Policy, int index> static double CallBuiltin(JitContext* context, double num1, double num2);
+
+	// Run the builtin that failed again, it throws the exception the interpreter throws
+	static void ThrowBuiltinError(JitContext* context, NumericMode mode);
+
+	// The helper of a builtin for the precision, nullptr when there is none
+	static const void* GetHelper(std::string name, NumericMode mode);
+
+	// Condition check of $if and $whileLoop on a value or on the last result
+	static int IsTrue(JitContext* context, double value);
+	static int IsLastResultTrue(JitContext* context);
+
+	// The text a builtin gives for constant operands, false when there is no
+	// helper for it. When it would throw the error is set instead.
+	static bool Evaluate(std::string name, const std::vector<double>& numbers, NumericMode mode, std::string& text, JitError& error);
+
+private:
+	static double Result(JitContext* context, long double value);
+	static double Fail(JitContext* context, JitError error);
+	static double FailBuiltin(JitContext* context, int index, double num1, double num2);
+};
@@ -130,6 +130,50 @@ void LinkedList::PushBack(std::shared_ptr<CompilerNode> node)
 	count++;
 }
 
+void LinkedList::InsertBefore(std::shared_ptr<ListNode> position, std::shared_ptr<CompilerNode> node)
+{
+	std::shared_ptr<ListNode> sNode = std::make_shared<ListNode>();
+	sNode->SetData(node);
+	sNode->SetNext(position);
+
+	std::shared_ptr<ListNode> previous = position->GetPrev();
+	if (previous)
+	{
+		sNode->SetPrev(previous);
+		previous->SetNext(sNode);
+	}
+	position->SetPrev(sNode);
+
+	// A new first node, start there as well
+	if (position == head)
+	{
+		if (current == head)
+			current = sNode;
+		head = sNode;
+	}
+	count++;
+}
+
+void LinkedList::Remove(std::shared_ptr<ListNode> node)
+{
+	std::shared_ptr<ListNode> previous = node->GetPrev();
+	std::shared_ptr<ListNode> next = node->GetNext();
+	if (previous)
+		previous->SetNext(next);
+	if (next && next->GetData())
+		next->SetPrev(previous);
+
+	// The list ends with an empty node, that one is never the head
+	bool hasNext = next && next->GetData();
+	if (node == head)
+		head = hasNext ? next : nullptr;
+	if (node == tail)
+		tail = previous;
+	if (node == current)
+		current = hasNext ? next : previous;
+	count--;
+}
+
 ListIterator LinkedList::begin()
 {
 	if (!head)
@@ -28,6 +28,8 @@ public:
 	std::shared_ptr<CompilerNode> GetTailData();
 
 	void PushBack(std::shared_ptr<CompilerNode> node);
+	void InsertBefore(std::shared_ptr<ListNode> position, std::shared_ptr<CompilerNode> node);
+	void Remove(std::shared_ptr<ListNode> node);
 	void SetCurrent(std::shared_ptr<ListNode> node);
 	void SetCurrent(std::shared_ptr<CompilerNode> node);
 	void SetCurrent(std::shared_ptr<CompilerNode> node, bool isLoopEnd);
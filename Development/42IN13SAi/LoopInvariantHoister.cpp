@@ -0,0 +1,371 @@
+#include "LoopInvariantHoister.h"
+#include "IrInstruction.h"
+#include "Symbol.h"
+
+LoopInvariantHoister::LoopInvariantHoister(SubroutineTable* p_subroutines) : subroutines(p_subroutines)
+{
+	// Who calls who, a loop that can call its own function can't keep anything
+	for (Subroutine* p_subroutine : subroutines->GetSubroutineVector())
+	{
+		for (std::shared_ptr<ListNode> listNode : GetListNodes(p_subroutine->GetCompilerNodeCollection()))
+			CollectCalls(listNode->GetData(), calls[p_subroutine->name]);
+	}
+}
+
+LoopInvariantHoister::~LoopInvariantHoister()
+{
+}
+
+int LoopInvariantHoister::Hoist(Subroutine* p_subroutine)
+{
+	int expressionsBefore = expressions;
+	subroutine = p_subroutine;
+
+	std::shared_ptr<LinkedList> nodes = subroutine->GetCompilerNodeCollection();
+	std::set<CompilerNode*> loopEnds;
+
+	// Every hoist changes the list, look for the next loop in the new one
+	while (true)
+	{
+		std::vector<std::shared_ptr<ListNode>> listNodes = GetListNodes(nodes);
+		std::map<CompilerNode*, int> indexes;
+		for (size_t i = 0; i < listNodes.size(); i++)
+			indexes[listNodes.at(i)->GetData().get()] = (int)i;
+
+		// A loop ends with a $doNothing that jumps back to the header, take the smallest one left
+		int header = -1;
+		int end = -1;
+		for (size_t i = 0; i < listNodes.size(); i++)
+		{
+			std::shared_ptr<CompilerNode> node = listNodes.at(i)->GetData();
+			std::shared_ptr<CompilerNode> jumpTo = node->GetJumpTo();
+			if (node->GetExpression() != "$doNothing" || jumpTo == nullptr || loopEnds.count(node.get()) > 0)
+				continue;
+
+			auto target = indexes.find(jumpTo.get());
+			if (target == indexes.end() || target->second > (int)i)
+				continue;
+
+			if (header == -1 || (int)i - target->second < end - header)
+			{
+				header = target->second;
+				end = (int)i;
+			}
+		}
+
+		if (header == -1)
+			break;
+
+		loopEnds.insert(listNodes.at(end)->GetData().get());
+
+		std::string headerExpression = listNodes.at(header)->GetData()->GetExpression();
+		if (headerExpression == "$whileLoop" || headerExpression == "$whileCompare" || headerExpression == "$forLoop")
+			HoistLoop(nodes, listNodes, header, end);
+	}
+
+	subroutine = nullptr;
+	return expressions - expressionsBefore;
+}
+
+bool LoopInvariantHoister::HoistLoop(std::shared_ptr<LinkedList> nodes, std::vector<std::shared_ptr<ListNode>>& listNodes, int header, int end)
+{
+	std::map<CompilerNode*, int> indexes;
+	for (size_t i = 0; i < listNodes.size(); i++)
+		indexes[listNodes.at(i)->GetData().get()] = (int)i;
+
+	// A jump from outside into the loop would skip the hoisted code
+	for (size_t i = 0; i < listNodes.size(); i++)
+	{
+		if ((int)i >= header && (int)i <= end)
+			continue;
+
+		std::shared_ptr<CompilerNode> jumpTo = listNodes.at(i)->GetData()->GetJumpTo();
+		auto target = jumpTo != nullptr ? indexes.find(jumpTo.get()) : indexes.end();
+		if (target != indexes.end() && target->second >= header && target->second <= end)
+			return false;
+	}
+
+	assigned.clear();
+	callsFunctions = false;
+	hoistedNames.clear();
+	hoisted.clear();
+
+	for (int i = header; i <= end; i++)
+		CollectAssignments(listNodes.at(i)->GetData());
+
+	// The called functions share the locals of this one when they can call it again
+	if (callsFunctions)
+	{
+		std::set<std::string> functions;
+		for (int i = header; i <= end; i++)
+			CollectCalls(listNodes.at(i)->GetData(), functions);
+
+		if (CanReach(functions, subroutine->name))
+			return false;
+	}
+
+	// Keep the replaced nodes alive, jumps only hold a weak pointer to them
+	std::map<CompilerNode*, std::shared_ptr<CompilerNode>> replacements;
+	std::vector<std::shared_ptr<CompilerNode>> replacedNodes;
+	for (int i = header; i <= end; i++)
+	{
+		std::shared_ptr<CompilerNode> node = listNodes.at(i)->GetData();
+		std::shared_ptr<CompilerNode> replacement = HoistStatement(node);
+		if (replacement != node)
+		{
+			listNodes.at(i)->SetData(replacement);
+			replacements[node.get()] = replacement;
+			replacedNodes.push_back(node);
+		}
+	}
+
+	if (hoisted.empty())
+		return false;
+
+	for (std::shared_ptr<ListNode> listNode : listNodes)
+	{
+		std::shared_ptr<CompilerNode> jumpTo = listNode->GetData()->GetJumpTo();
+		if (jumpTo == nullptr)
+			continue;
+
+		auto replacement = replacements.find(jumpTo.get());
+		if (replacement != replacements.end())
+			listNode->GetData()->SetJumpTo(replacement->second);
+	}
+
+	// The back edge jumps to the header, the hoisted code only runs when the loop is entered
+	for (std::shared_ptr<CompilerNode> assignment : hoisted)
+		nodes->InsertBefore(listNodes.at(header), assignment);
+
+	loops++;
+	return true;
+}
+
+std::shared_ptr<CompilerNode> LoopInvariantHoister::HoistStatement(std::shared_ptr<CompilerNode> node)
+{
+	if (node == nullptr)
+		return node;
+
+	// After a call the VirtualMachine reads the rest of the statement from the symboltable of the callee
+	std::set<std::string> functions;
+	CollectCalls(node, functions);
+	if (!functions.empty())
+		return node;
+
+	// The first assignment of a frl only runs when the loop starts
+	if (node->GetExpression() == "$forLoop")
+		return HoistParameters(node, 1);
+
+	return HoistExpression(node, false);
+}
+
+std::shared_ptr<CompilerNode> LoopInvariantHoister::HoistExpression(std::shared_ptr<CompilerNode> node, bool numeric)
+{
+	std::set<CompilerNode*> invariants;
+	CollectInvariants(node, invariants);
+
+	// A part is read as a number when the node above it reads numbers
+	return CompilerNode::Rewrite(node, [&](std::shared_ptr<CompilerNode> part, std::shared_ptr<CompilerNode> parent) -> std::shared_ptr<CompilerNode> {
+		if (part->GetNodeparameters().empty())
+			return part;
+		if (!(parent != nullptr ? ReadsNumbers(parent->GetExpression()) : numeric) || invariants.count(part.get()) == 0)
+			return nullptr;
+
+		// The same expression twice in a loop is computed once
+		std::string key = GetKey(part);
+		auto hoistedName = hoistedNames.find(key);
+		std::string name;
+		if (hoistedName != hoistedNames.end())
+			name = hoistedName->second;
+		else
+		{
+			name = "$licm" + std::to_string(temporaries++);
+			subroutine->AddLocal(Symbol(name, MyTokenType::Float, SymbolKind::Local));
+
+			std::vector<std::shared_ptr<CompilerNode>> parameters;
+			parameters.push_back(std::make_shared<CompilerNode>("$identifier", name, false));
+			parameters.push_back(part);
+			hoisted.push_back(std::make_shared<CompilerNode>("$assignment", parameters, nullptr, false));
+			hoistedNames[key] = name;
+		}
+
+		expressions++;
+		return std::make_shared<CompilerNode>("$getVariable", name, false);
+	});
+}
+
+std::shared_ptr<CompilerNode> LoopInvariantHoister::HoistParameters(std::shared_ptr<CompilerNode> node, size_t first)
+{
+	std::vector<std::shared_ptr<CompilerNode>> parameters = node->GetNodeparameters();
+	bool numeric = ReadsNumbers(node->GetExpression());
+	bool changed = false;
+
+	for (size_t i = first; i < parameters.size(); i++)
+	{
+		std::shared_ptr<CompilerNode> parameter = HoistExpression(parameters.at(i), numeric);
+		if (parameter != parameters.at(i))
+		{
+			parameters.at(i) = parameter;
+			changed = true;
+		}
+	}
+
+	return CompilerNode::Copy(node, parameters, changed);
+}
+
+// An expression is invariant when none of its variables is assigned in the loop and its
+// builtins can't throw, from the leaves up
+void LoopInvariantHoister::CollectInvariants(std::shared_ptr<CompilerNode> node, std::set<CompilerNode*>& invariants)
+{
+	CompilerNode::Rewrite(node, nullptr, [&](std::shared_ptr<CompilerNode> part, std::vector<std::shared_ptr<CompilerNode>>& parameters, bool) {
+		std::string expression = part->GetExpression();
+		bool invariant;
+		if (expression == "$value")
+			invariant = true;
+		else if (expression == "$getVariable")
+			invariant = IsInvariantVariable(part->GetValue());
+		else if (IsCompare(expression))
+			invariant = parameters.size() == 2;
+		else
+			invariant = IrInstruction::IsBuiltin(expression) && !IrInstruction::CanBuiltinFail(expression)
+				&& IrInstruction::GetBuiltinArity(expression) == (int)parameters.size();
+
+		for (std::shared_ptr<CompilerNode> parameter : parameters)
+			invariant = invariant && parameter != nullptr && invariants.count(parameter.get()) > 0;
+
+		if (invariant)
+			invariants.insert(part.get());
+		return part;
+	});
+}
+
+bool LoopInvariantHoister::IsInvariantVariable(std::string name)
+{
+	if (assigned.count(name) > 0)
+		return false;
+
+	// A called function can assign every global
+	return !callsFunctions || subroutine->HasLocal(name);
+}
+
+// The nodes that atof their parameters, the text of the value doesn't matter
+bool LoopInvariantHoister::ReadsNumbers(std::string expression)
+{
+	return expression == "$assignment" || IsCompare(expression) || IrInstruction::IsBuiltin(expression);
+}
+
+void LoopInvariantHoister::CollectAssignments(std::shared_ptr<CompilerNode> node)
+{
+	std::vector<std::shared_ptr<CompilerNode>> work;
+	work.push_back(node);
+	while (!work.empty())
+	{
+		node = work.back();
+		work.pop_back();
+		if (node == nullptr)
+			continue;
+
+		std::string expression = node->GetExpression();
+		std::vector<std::shared_ptr<CompilerNode>> parameters = node->GetNodeparameters();
+		if (expression == "$assignment" && !parameters.empty() && parameters.at(0) != nullptr)
+			assigned.insert(parameters.at(0)->GetValue());
+		else if (expression == "$increment" || expression == "$decrement" || expression == "$addConstant" || expression == "$subtractConstant")
+			assigned.insert(node->GetValue());
+		else if (expression == "$functionCall")
+			callsFunctions = true;
+
+		work.insert(work.end(), parameters.begin(), parameters.end());
+	}
+}
+
+void LoopInvariantHoister::CollectCalls(std::shared_ptr<CompilerNode> node, std::set<std::string>& functions)
+{
+	std::vector<std::shared_ptr<CompilerNode>> work;
+	work.push_back(node);
+	while (!work.empty())
+	{
+		node = work.back();
+		work.pop_back();
+		if (node == nullptr)
+			continue;
+
+		std::vector<std::shared_ptr<CompilerNode>> parameters = node->GetNodeparameters();
+		if (node->GetExpression() == "$functionCall" && !parameters.empty() && parameters.at(0) != nullptr)
+			functions.insert(parameters.at(0)->GetValue());
+
+		work.insert(work.end(), parameters.begin(), parameters.end());
+	}
+}
+
+bool LoopInvariantHoister::CanReach(std::set<std::string> functions, std::string name)
+{
+	std::set<std::string> visited;
+	std::vector<std::string> work(functions.begin(), functions.end());
+	while (!work.empty())
+	{
+		std::string callee = work.back();
+		work.pop_back();
+		if (callee == name)
+			return true;
+		if (!visited.insert(callee).second)
+			continue;
+
+		work.insert(work.end(), calls[callee].begin(), calls[callee].end());
+	}
+	return false;
+}
+
+// Written out from a stack of the nodes and the text that closes them, a node without one is text
+std::string LoopInvariantHoister::GetKey(std::shared_ptr<CompilerNode> node)
+{
+	std::string key;
+	std::vector<std::pair<std::shared_ptr<CompilerNode>, std::string>> work;
+	work.push_back(std::make_pair(node, std::string()));
+	while (!work.empty())
+	{
+		std::pair<std::shared_ptr<CompilerNode>, std::string> item = work.back();
+		work.pop_back();
+		if (item.first == nullptr)
+		{
+			key += item.second;
+			continue;
+		}
+
+		key += item.first->GetExpression() + " " + item.first->GetValue() + "(";
+		work.push_back(std::make_pair(nullptr, std::string(")")));
+
+		std::vector<std::shared_ptr<CompilerNode>> parameters = item.first->GetNodeparameters();
+		for (auto parameter = parameters.rbegin(); parameter != parameters.rend(); parameter++)
+		{
+			work.push_back(std::make_pair(nullptr, std::string(",")));
+			if (*parameter != nullptr)
+				work.push_back(std::make_pair(*parameter, std::string()));
+		}
+	}
+	return key;
+}
+
+std::vector<std::shared_ptr<ListNode>> LoopInvariantHoister::GetListNodes(std::shared_ptr<LinkedList> nodes)
+{
+	std::vector<std::shared_ptr<ListNode>> listNodes;
+	for (std::shared_ptr<ListNode> listNode = nodes->GetHead(); listNode && listNode->GetData(); listNode = listNode->GetNext())
+		listNodes.push_back(listNode);
+	return listNodes;
+}
+
+bool LoopInvariantHoister::IsCompare(std::string expression)
+{
+	return expression == "$less" || expression == "$lessOrEq" || expression == "$greater"
+		|| expression == "$greaterOrEq" || expression == "$equals" || expression == "$notEquals";
+}
+
+int LoopInvariantHoister::GetHoistCount()
+{
+	return expressions;
+}
+
+std::string LoopInvariantHoister::GetReport()
+{
+	return "Loop-invariant code motion: " + std::to_string(expressions) + " expressions hoisted out of "
+		+ std::to_string(loops) + " loops (" + std::to_string(temporaries) + " temporaries)";
+}
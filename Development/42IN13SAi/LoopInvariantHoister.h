@@ -0,0 +1,71 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "CompilerNode.h"
+#include "LinkedList.h"
+#include "Subroutine.h"
+#include "SubroutineTable.h"
+
+// Moves the expressions a while or frl loop computes the same way every
+// iteration in front of the loop:
+//
+//   while (i < n)                  $licm0 = sqrt(a) * b
+//   [                              while (i < n)
+//       x = x + sqrt(a) * b;  ->   [
+//       i++;                           x = x + $licm0;
+//   ]                                  i++;
+//                                  ]
+//
+// An expression is invariant when none of its variables is assigned in the
+// loop and its builtins can't throw, the hoisted copy runs even when the loop
+// doesn't. Only the values an assignment or another builtin reads as a number
+// are replaced, a prnt or ret prints the text of a value and a variable
+// can't always give that text back. A user function call can change every
+// global, statements that call one are left alone.
+class LoopInvariantHoister
+{
+public:
+	LoopInvariantHoister(SubroutineTable* p_subroutines);
+	virtual ~LoopInvariantHoister();
+
+	// Hoist out of every loop of the subroutine, inner loops first
+	int Hoist(Subroutine* subroutine);
+
+	int GetHoistCount();
+	std::string GetReport();
+
+private:
+	SubroutineTable* subroutines;
+	std::map<std::string, std::set<std::string>> calls;
+	int loops = 0;
+	int expressions = 0;
+	int temporaries = 0;
+
+	// The loop being hoisted from
+	Subroutine* subroutine = nullptr;
+	std::set<std::string> assigned;
+	bool callsFunctions = false;
+	std::map<std::string, std::string> hoistedNames;
+	std::vector<std::shared_ptr<CompilerNode>> hoisted;
+
+	bool HoistLoop(std::shared_ptr<LinkedList> nodes, std::vector<std::shared_ptr<ListNode>>& listNodes, int header, int end);
+	std::shared_ptr<CompilerNode> HoistStatement(std::shared_ptr<CompilerNode> node);
+	std::shared_ptr<CompilerNode> HoistExpression(std::shared_ptr<CompilerNode> node, bool numeric);
+	std::shared_ptr<CompilerNode> HoistParameters(std::shared_ptr<CompilerNode> node, size_t first);
+
+	void CollectInvariants(std::shared_ptr<CompilerNode> node, std::set<CompilerNode*>& invariants);
+	bool IsInvariantVariable(std::string name);
+	bool ReadsNumbers(std::string expression);
+	void CollectAssignments(std::shared_ptr<CompilerNode> node);
+	void CollectCalls(std::shared_ptr<CompilerNode> node, std::set<std::string>& functions);
+	bool CanReach(std::set<std::string> functions, std::string name);
+
+	static std::string GetKey(std::shared_ptr<CompilerNode> node);
+	static std::vector<std::shared_ptr<ListNode>> GetListNodes(std::shared_ptr<LinkedList> nodes);
+	static bool IsCompare(std::string expression);
+};
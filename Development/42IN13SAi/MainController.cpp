@@ -1,6 +1,6 @@
 #include "MainController.h"
 
-MainController::MainController() : QObject()
+MainController::MainController() : QObject(), programCache(ProgramCache::GetUserDirectory(), 64 * 1024 * 1024)
 {
     mainWindow.setWindowTitle(QObject::tr("Short C Editor"));
     mainWindow.showMaximized();
@@ -53,49 +53,120 @@ void MainController::Execute()
         sb.open(ExceptionOutput(this));
         std::clog.rdbuf(&sb);
 
-        // Excute typed code
-        // Get the file from the stream and convert to std::string
-        std::string input(GetFileFromStream());
-        tokenizer_controller = std::make_shared<TokenizerController>(input);
+        // The constant folding uses the precision the program runs in
+        CompilerOptions options;
+        if (mainWindow.GetDoublePrecisionAction()->isChecked())
+            options.numericMode = NumericMode::Double;
 
-        try
-        {
-            // Tokenize
-            tokenizer_controller->Tokenize();
-        }
-        catch (const std::exception& e)
-        {
-            mainWindow.addException(e.what());
-            return;
-        }
-
-        // Tokenizer has exceptions stop the build
-        if (tokenizer_controller->HasExceptions())
-            return;
-
-        // Run the compiler
-        compiler = std::make_shared<Compiler>(tokenizer_controller->GetCompilerTokens());
+        // The stages are only there when the program is compiled
+        bool dumpStages = mainWindow.GetDumpStagesAction()->isChecked();
+        std::shared_ptr<CompilationDump> dump = dumpStages ? std::make_shared<CompilationDump>() : nullptr;
+        options.buildIr = options.buildIr || dumpStages;
+        options.analyzePurity = options.analyzePurity || dumpStages;
+        CompilerNode::SetCounting(dumpStages);
 
-        try
-        {
-            // Compile
-            compiler->Compile();
-        }
-        catch (const std::exception& e)
+        // Get the file from the stream and convert to std::string, the imports are next to it
+        std::string input(GetFileFromStream());
+        std::string source = mainWindow.GetText().toStdString();
+        std::string directory = ModuleLoader::GetDirectory(input);
+
+        // An unchanged program with unchanged imports comes from the cache without tokenizing and compiling it
+        std::string key = ProgramCache::GetKey(ModuleLoader::GetSourceWithImports(source, directory), options);
+        program = dumpStages ? nullptr : programCache.Load(key);
+        if (program != nullptr)
+            mainWindow.SetStages("Loaded the compiled program from the cache");
+        else
         {
-            mainWindow.addException(e.what());
-            return;
+            // Excute typed code
+            // The lines and functions that didn't change since the last run are reused
+            incrementalCache.StartRun();
+            tokenizer_controller = std::make_shared<TokenizerController>(input, &incrementalCache);
+            tokenizer_controller->SetDiagnostics(&diagnostics);
+
+            try
+            {
+                // Tokenize
+                std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+                tokenizer_controller->Tokenize();
+                if (dump != nullptr)
+                    dump->AddTiming({ "Tokenizer", std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count(), 0 });
+            }
+            catch (const std::exception& e)
+            {
+                ShowDiagnostics();
+                mainWindow.addException(e.what());
+                return;
+            }
+
+            // Tokenizer has exceptions stop the build
+            ShowDiagnostics();
+            if (tokenizer_controller->HasExceptions())
+                return;
+            if (dump != nullptr)
+                dump->AddTokens(tokenizer_controller->GetCompilerTokens());
+
+            // Run the compiler
+            compiler = std::make_shared<Compiler>(tokenizer_controller->GetCompilerTokens(), options);
+            compiler->SetIncrementalCache(&incrementalCache);
+            compiler->SetDiagnostics(&diagnostics);
+
+            // A module compiled for an earlier run comes from the program cache
+            ModuleLoader moduleLoader(options, &programCache);
+            compiler->SetModules(moduleLoader.LoadImports(source, directory));
+
+            try
+            {
+                // Compile
+                compiler->Compile();
+            }
+            catch (const std::exception& e)
+            {
+                ShowDiagnostics();
+                mainWindow.addException(e.what());
+                return;
+            }
+
+            // Compiler has exceptions stop the build
+            ShowDiagnostics();
+            if (compiler->HasExceptions())
+                return;
+            if (dump != nullptr)
+                dump->AddNodes("parsed", compiler.get());
+
+            // Run the optimization passes and show what they did
+            compiler->Optimize();
+            ShowDiagnostics();
+
+            // What the compiler did goes to the Stages, before the stages themselves when they are dumped
+            std::string compileLog;
+            for (std::string message : compiler->GetCompileLog())
+                compileLog += message + "\n";
+            std::string report = moduleLoader.GetReport();
+            if (!report.empty())
+                compileLog += report + "\n";
+            if (dump != nullptr)
+            {
+                dump->AddNodes("optimized", compiler.get());
+                dump->AddTimings(compiler->GetPassTimings());
+                if (compiler->GetIrModule() != nullptr)
+                    dump->SetIr(compiler->GetIrModule()->ToString());
+                compileLog += "\n" + dump->ToText();
+            }
+            mainWindow.SetStages(compileLog);
+
+            // A global that can't be evaluated without an exception stops the build
+            if (compiler->HasExceptions())
+                return;
+
+            program = std::make_shared<CompiledProgram>(compiler->GetSymbolTable(), compiler->GetSubroutineTable(), compiler->GetCompilerNodes());
+            programCache.Store(key, *program);
         }
 
-        // Compiler has exceptions stop the build
-        if (compiler->HasExceptions())
-            return;
-
         // Run the virtual machine with the compilernodes
-        std::list<std::shared_ptr<CompilerNode>> nodesList = compiler->GetCompilerNodes();
-        std::shared_ptr<LinkedList> nodesLinkedList = std::make_shared<LinkedList>(nodesList);
+        std::shared_ptr<LinkedList> nodesLinkedList = std::make_shared<LinkedList>(program->compilerNodes);
 
-        virtual_machine = std::make_shared<VirtualMachine>(compiler->GetSymbolTable(), compiler->GetSubroutineTable(), nodesLinkedList);
+        virtual_machine = std::make_shared<VirtualMachine>(&program->symbolTable, &program->subroutineTable, nodesLinkedList);
+        virtual_machine->SetNumericMode(options.numericMode);
         connect(virtual_machine.get(), &VirtualMachine::PrintOutput, this, &MainController::PrintOutput);
         connect(virtual_machine.get(), &VirtualMachine::PrintException, this, &MainController::PrintException);
         connect(virtual_machine.get(), &VirtualMachine::Finished, this, &MainController::VirtualMachineFinished);
@@ -174,6 +245,7 @@ void MainController::VirtualMachineFinished()
     tokenizer_controller = nullptr;
     compiler = nullptr;
     virtual_machine = nullptr;
+    program = nullptr;
     mainWindow.CodeIsExecuting(false);
 
     // Stop the output thread and print output
@@ -203,11 +275,15 @@ void MainController::CloseErrorDialog()
 
 void MainController::WriteException(const char* output, std::streamsize size)
 {
-    std::string exception_text;
-    for (int i = 0; i < size; i++)
-        exception_text.append(1, output[i]);
-    mainWindow.addException(exception_text);
-    //this->output.append(QString::fromUtf8(exception_text.c_str()));
+    mainWindow.addException(std::string(output, (size_t)size));
+}
+
+// The diagnostics of the phase that just ended go to the exception window at once
+void MainController::ShowDiagnostics()
+{
+    std::vector<std::string> batch = diagnostics.TakeBatch();
+    if (!batch.empty())
+        mainWindow.addExceptions(batch);
 }
 
 void MainController::ClearConsole()
@@ -17,6 +17,11 @@
 #include "TokenizerController.h"
 #include "Compiler.h"
 #include "VirtualMachine.h"
+#include "DiagnosticsEngine.h"
+#include "IncrementalCache.h"
+#include "ProgramCache.h"
+#include "ModuleLoader.h"
+#include "CompilationDump.h"
 #include "FileIO.h"
 #include "ExceptionOutput.h"
 #include "StopExecuteDialog.h"
@@ -42,6 +47,10 @@ class MainController : public QObject
 		std::shared_ptr<TokenizerController> tokenizer_controller;
 		std::shared_ptr<Compiler> compiler;
 		std::shared_ptr<VirtualMachine> virtual_machine;
+		std::shared_ptr<CompiledProgram> program;
+		ProgramCache programCache;
+		IncrementalCache incrementalCache;
+		DiagnosticsEngine diagnostics;
 		std::vector<std::shared_ptr<QFile>> currentFiles;
 		boost::thread* workerThread;
 		StopExecuteDialog* dialog;
@@ -57,6 +66,7 @@ class MainController : public QObject
 		// Functions
 		std::string GetFileFromStream();
 		void Setup();
+		void ShowDiagnostics();
 
 	private slots:
 		void Execute();
@@ -15,6 +15,13 @@ MainWindow::MainWindow(QWidget *parent)
 	outputTab->addTab(outputWindow, "Output");
 	outputTab->addTab(exceptionWindow, "Exceptions");
 
+	// The compile log of the last run, with its stages when Options > Dump stages is on
+	stagesWindow = new QPlainTextEdit();
+	stagesWindow->setReadOnly(true);
+	stagesWindow->setLineWrapMode(QPlainTextEdit::NoWrap);
+	stagesWindow->setFont(QFont("Consolas", 9));
+	outputTab->addTab(stagesWindow, "Stages");
+
 	themer.SetMainWindow(this);
 	themer.SetOutputWindow(outputWindow);
 	themer.SetExceptionWindow(exceptionWindow);
@@ -52,6 +59,11 @@ void MainWindow::ShowMenuBar()
 	quitAction = fileMenu->addAction("Quit");
 	viewMenu = menu->addMenu("View");
 	clearAction = viewMenu->addAction("Clear console");
+	optionsMenu = menu->addMenu("Options");
+	doublePrecisionAction = optionsMenu->addAction("Double precision");
+	doublePrecisionAction->setCheckable(true);
+	dumpStagesAction = optionsMenu->addAction("Dump stages");
+	dumpStagesAction->setCheckable(true);
 	runAction = menu->addAction("Run");
 
 	// Add shortcuts to the actions
@@ -151,6 +163,16 @@ QAction* MainWindow::GetRunAction()
 	return runAction;
 }
 
+QAction* MainWindow::GetDoublePrecisionAction()
+{
+	return doublePrecisionAction;
+}
+
+QAction* MainWindow::GetDumpStagesAction()
+{
+	return dumpStagesAction;
+}
+
 QAction* MainWindow::GetClearAction()
 {
 	return clearAction;
@@ -220,6 +242,12 @@ void MainWindow::addException(std::string exception)
 	exceptionWindow->addException(exception);
 }
 
+void MainWindow::addExceptions(std::vector<std::string> exceptions)
+{
+	outputTab->setCurrentIndex(1);
+	exceptionWindow->addExceptions(exceptions);
+}
+
 void MainWindow::clearExceptions()
 {
 	exceptionWindow->clearExceptions();
@@ -230,6 +258,11 @@ void MainWindow::clearOutput()
 	outputWindow->clearOutput();
 }
 
+void MainWindow::SetStages(std::string stages)
+{
+	stagesWindow->setPlainText(QString::fromStdString(stages));
+}
+
 void MainWindow::SetTabTitle(QFileInfo* info)
 {
 	tabs->setTabText(tabs->currentIndex(), info->baseName());
@@ -43,8 +43,10 @@ public:
     void AddNewTab();
     void addOutput(std::string output);
     void addException(std::string exception);
+    void addExceptions(std::vector<std::string> exceptions);
     void clearExceptions();
     void clearOutput();
+    void SetStages(std::string stages);
     void AddFile(QFileInfo* info, QString text);
     void SetTabTitle(QFileInfo* info);
 	void CodeIsExecuting(bool status);
@@ -52,6 +54,8 @@ public:
     QString GetText();
     QAction* GetRunAction();
     QAction* GetClearAction();
+    QAction* GetDoublePrecisionAction();
+    QAction* GetDumpStagesAction();
     QAction* GetNewAction();
     QAction* GetLoadAction();
     QAction* GetSaveAction();
@@ -65,6 +69,7 @@ private:
     int position;
     OutputWindow* outputWindow;
     ExceptionWindow* exceptionWindow;
+    QPlainTextEdit* stagesWindow;
     std::vector<CodeEditor*> codeEditorVector;
     Highlighter* highlighter;
     QCompleter* completer;
@@ -84,11 +89,14 @@ private:
 
     QMenu *fileMenu,
 		  *viewMenu,
+          *optionsMenu,
           *themeMenu,
           *macDebugMenu;
 
     QAction *runAction, 
             *clearAction, 
+            *doublePrecisionAction, 
+            *dumpStagesAction, 
             *newAction, 
             *openAction, 
             *saveAction,
@@ -0,0 +1,100 @@
+#include "MemoCache.h"
+#include <algorithm>
+#include <cstring>
+
+MemoCache::MemoCache(int p_arity, int p_capacity) : arity(p_arity), capacity(2)
+{
+	// Sets of two slots, a power of two of them so the set is the low bits of the hash
+	while (capacity < p_capacity)
+		capacity *= 2;
+
+	keys.resize((size_t)capacity * arity);
+	used.resize(capacity, false);
+	results.resize(capacity);
+	recent.resize(capacity / 2, 0);
+}
+
+MemoCache::~MemoCache()
+{
+}
+
+std::vector<uint64_t> MemoCache::GetKey(SymbolTable* symbolTable)
+{
+	// The parameters are atof'd, a double holds them exactly
+	std::vector<uint64_t> key;
+	for (Symbol* parameter : symbolTable->GetSymbolVector())
+	{
+		double value = (double)parameter->GetValue();
+		uint64_t bits;
+		memcpy(&bits, &value, sizeof(bits));
+		key.push_back(bits);
+	}
+	return key;
+}
+
+bool MemoCache::Find(const std::vector<uint64_t>& key, std::string &result)
+{
+	int slot = FindSlot(key);
+	if (slot < 0)
+	{
+		misses++;
+		return false;
+	}
+
+	recent[slot / 2] = slot % 2;
+	hits++;
+	result = results[slot];
+	return true;
+}
+
+void MemoCache::Store(const std::vector<uint64_t>& key, std::string result)
+{
+	// An empty slot of the set, or the one that wasn't used last
+	size_t set = GetSet(key);
+	size_t slot = set * 2 + (used[set * 2] ? 1 - recent[set] : 0);
+	std::copy(key.begin(), key.end(), keys.begin() + slot * arity);
+	recent[set] = slot % 2;
+	used[slot] = true;
+	results[slot] = result;
+}
+
+int MemoCache::FindSlot(const std::vector<uint64_t>& key)
+{
+	size_t set = GetSet(key);
+	for (size_t slot = set * 2; slot < set * 2 + 2; slot++)
+	{
+		if (used[slot] && std::equal(key.begin(), key.end(), keys.begin() + slot * arity))
+			return (int)slot;
+	}
+	return -1;
+}
+
+size_t MemoCache::GetSet(const std::vector<uint64_t>& key)
+{
+	uint64_t hash = 0x9E3779B97F4A7C15ull;
+	for (uint64_t bits : key)
+		hash = (hash ^ bits) * 0x9E3779B97F4A7C15ull;
+
+	// The low bits of a double are mostly zero, mix the high ones down
+	hash ^= hash >> 33;
+	hash *= 0xFF51AFD7ED558CCDull;
+	hash ^= hash >> 33;
+	hash *= 0xC4CEB9FE1A85EC53ull;
+	hash ^= hash >> 33;
+	return (size_t)(hash & (uint64_t)(capacity / 2 - 1));
+}
+
+int MemoCache::GetHits()
+{
+	return hits;
+}
+
+int MemoCache::GetMisses()
+{
+	return misses;
+}
+
+int MemoCache::GetCapacity()
+{
+	return capacity;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "SymbolTable.h"
+
+// The results of one pure function, keyed on the bits of its arguments:
+//
+//   fib(20)  ->  hash(bits of 20)  ->  set of two slots  ->  "6765"
+//
+// The keys of all slots are kept next to each other in one array, a lookup
+// only reads the two keys of its set and the entry itself when it hits. A new
+// result takes the slot in its set that wasn't used last, so two arguments
+// with the same hash don't push each other out and the cache never grows past
+// its capacity.
+class MemoCache
+{
+public:
+	MemoCache(int p_arity, int p_capacity);
+	virtual ~MemoCache();
+
+	// The bits of the parameters, read right after they are set
+	std::vector<uint64_t> GetKey(SymbolTable* symbolTable);
+
+	// On a hit the text of the ret is returned
+	bool Find(const std::vector<uint64_t>& key, std::string &result);
+	void Store(const std::vector<uint64_t>& key, std::string result);
+
+	int GetHits();
+	int GetMisses();
+	int GetCapacity();
+
+private:
+	int arity;
+	int capacity;
+	int hits = 0;
+	int misses = 0;
+
+	std::vector<uint64_t> keys;
+	std::vector<bool> used;
+	std::vector<std::string> results;
+
+	// Per set, the slot that was used last
+	std::vector<char> recent;
+
+	int FindSlot(const std::vector<uint64_t>& key);
+	size_t GetSet(const std::vector<uint64_t>& key);
+};
@@ -0,0 +1,231 @@
+#include "ModuleLoader.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <boost/algorithm/string.hpp>
+#include <boost/filesystem.hpp>
+#include "Compiler.h"
+#include "DiagnosticsEngine.h"
+#include "TokenizerController.h"
+
+ModuleLoader::ModuleLoader(CompilerOptions p_options, ProgramCache* p_cache) : options(p_options), cache(p_cache)
+{
+	// A module is linked into the nodes of the program, the IR is built for the program
+	options.buildIr = false;
+}
+
+ModuleLoader::~ModuleLoader()
+{
+	// The compiles that were started for a program that stopped first
+	for (auto module : modules)
+		module.second.wait();
+}
+
+std::map<std::string, std::shared_ptr<Module>> ModuleLoader::LoadImports(const std::string& source, const std::string& directory)
+{
+	std::map<std::string, std::shared_future<std::shared_ptr<Module>>> imports;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		std::vector<std::string> loading;
+		for (std::string file : FindImports(source))
+			imports[file] = Find(GetPath(directory, file), loading);
+	}
+
+	std::map<std::string, std::shared_ptr<Module>> loaded;
+	for (auto import : imports)
+		loaded[import.first] = import.second.get();
+	imported += (int)loaded.size();
+	return loaded;
+}
+
+// The module of a path, a new one is started after the modules it imports are.
+// Called with the mutex locked, loading holds the files that import this one.
+std::shared_future<std::shared_ptr<Module>> ModuleLoader::Find(const std::string& path, std::vector<std::string>& loading)
+{
+	auto found = modules.find(path);
+	if (found != modules.end())
+		return found->second;
+
+	std::shared_ptr<Module> module = std::make_shared<Module>();
+	module->path = path;
+
+	std::string source;
+	if (std::find(loading.begin(), loading.end(), path) != loading.end())
+		module->error = "it imports itself";
+	else if (!ReadFile(path, source))
+		module->error = "the file can't be read";
+
+	if (!module->error.empty())
+	{
+		std::promise<std::shared_ptr<Module>> failed;
+		failed.set_value(module);
+		return failed.get_future().share();
+	}
+
+	loading.push_back(path);
+	std::map<std::string, std::shared_future<std::shared_ptr<Module>>> imports;
+	for (std::string file : FindImports(source))
+		imports[file] = Find(GetPath(GetDirectory(path), file), loading);
+	loading.pop_back();
+
+	std::shared_future<std::shared_ptr<Module>> future = std::async(std::launch::async, [this, module, source, imports]() {
+		return Compile(module, source, imports);
+	}).share();
+	modules[path] = future;
+	return future;
+}
+
+// Tokenize, compile and optimize a module on its own, or take it from the cache
+std::shared_ptr<Module> ModuleLoader::Compile(std::shared_ptr<Module> module, std::string source, std::map<std::string, std::shared_future<std::shared_ptr<Module>>> imports)
+{
+	// A module that can't import one of its modules can't be imported itself, the first one says why
+	for (auto import : imports)
+	{
+		module->imports[import.first] = import.second.get();
+		if (module->imports[import.first]->program == nullptr && module->error.empty())
+			module->error = "'" + import.first + "' can't be imported, " + module->imports[import.first]->error;
+	}
+	if (!module->error.empty())
+		return module;
+
+	// Not the key of a program of the same file, that has its imports linked into it
+	std::string key = ProgramCache::GetKey("module\n" + GetSourceWithImports(source, GetDirectory(module->path)), options);
+	if (cache != nullptr)
+	{
+		std::lock_guard<std::mutex> lock(cacheMutex);
+		module->program = cache->Load(key);
+		if (module->program != nullptr)
+		{
+			cached++;
+			return module;
+		}
+	}
+
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	DiagnosticsEngine diagnostics;
+	std::string exception;
+	try
+	{
+		TokenizerController tokenizer_controller(module->path);
+		tokenizer_controller.SetDiagnostics(&diagnostics);
+		tokenizer_controller.Tokenize();
+
+		if (!tokenizer_controller.HasExceptions())
+		{
+			Compiler compiler(tokenizer_controller.GetCompilerTokens(), options);
+			compiler.SetDiagnostics(&diagnostics);
+			compiler.SetModules(module->imports);
+			compiler.SetExported(true);
+			compiler.Compile();
+			if (!compiler.HasExceptions())
+				compiler.Optimize();
+			if (!compiler.HasExceptions())
+				module->program = std::make_shared<CompiledProgram>(compiler.GetSymbolTable(), compiler.GetSubroutineTable(), compiler.GetCompilerNodes());
+		}
+	}
+	catch (const std::exception& e)
+	{
+		exception = e.what();
+	}
+
+	// The first message says where to look, the importing program shows it
+	std::vector<std::string> messages = diagnostics.TakeBatch();
+	if (module->program == nullptr)
+	{
+		module->error = !messages.empty() ? messages[0] : (!exception.empty() ? exception : "it doesn't compile");
+		if (messages.size() > 1)
+			module->error += " and " + std::to_string(messages.size() - 1) + " more";
+		return module;
+	}
+
+	std::lock_guard<std::mutex> lock(cacheMutex);
+	compiled++;
+	compileSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	if (cache != nullptr)
+		cache->Store(key, *module->program);
+	return module;
+}
+
+// The file of every line that starts with import, like the tokenizer reads import "lib.sc";
+std::vector<std::string> ModuleLoader::FindImports(const std::string& source)
+{
+	std::vector<std::string> files;
+	std::istringstream lines(source);
+	std::string line;
+	while (std::getline(lines, line))
+	{
+		boost::algorithm::trim(line);
+		if (line.compare(0, 6, "import") != 0 || line.size() < 7 || (line[6] != '"' && !isspace((unsigned char)line[6])))
+			continue;
+
+		size_t open = line.find('"');
+		size_t close = open != std::string::npos ? line.find('"', open + 1) : std::string::npos;
+		if (close != std::string::npos)
+			files.push_back(line.substr(open + 1, close - open - 1));
+	}
+	return files;
+}
+
+std::string ModuleLoader::GetSourceWithImports(const std::string& source, const std::string& directory)
+{
+	std::vector<std::string> visited;
+	std::string text = source;
+	AddSources(source, directory, visited, text);
+	return text;
+}
+
+void ModuleLoader::AddSources(const std::string& source, const std::string& directory, std::vector<std::string>& visited, std::string& text)
+{
+	for (std::string file : FindImports(source))
+	{
+		std::string path = GetPath(directory, file);
+		if (std::find(visited.begin(), visited.end(), path) != visited.end())
+			continue;
+		visited.push_back(path);
+
+		std::string importSource;
+		ReadFile(path, importSource);
+		text += '\0' + path + '\0' + importSource;
+		AddSources(importSource, GetDirectory(path), visited, text);
+	}
+}
+
+std::string ModuleLoader::GetDirectory(const std::string& file)
+{
+	return boost::filesystem::path(file).parent_path().string();
+}
+
+// The full path of a file, so a module imported as "lib.sc" and as "../src/lib.sc" is one module
+std::string ModuleLoader::GetPath(const std::string& directory, const std::string& file)
+{
+	boost::filesystem::path path(file);
+	if (path.is_relative())
+		path = boost::filesystem::absolute(path, directory.empty() ? boost::filesystem::current_path() : boost::filesystem::path(directory));
+
+	boost::system::error_code error;
+	boost::filesystem::path canonical = boost::filesystem::canonical(path, error);
+	return error ? path.string() : canonical.string();
+}
+
+bool ModuleLoader::ReadFile(const std::string& path, std::string& text)
+{
+	std::ifstream stream(path, std::ios::binary);
+	if (!stream)
+		return false;
+
+	text.assign((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+	return true;
+}
+
+std::string ModuleLoader::GetReport()
+{
+	if (imported == 0)
+		return "";
+
+	char seconds[32];
+	snprintf(seconds, sizeof(seconds), "%.3f", compileSeconds);
+	return "Modules: " + std::to_string(imported) + " imports, " + std::to_string(compiled) + " modules compiled in " + seconds + "s, "
+		+ std::to_string(cached) + " from the program cache";
+}
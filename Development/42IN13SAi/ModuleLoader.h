@@ -0,0 +1,83 @@
+#pragma once
+
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "CompilerOptions.h"
+#include "ProgramCache.h"
+
+// A file as it is imported, its own globals, functions and global statements
+struct Module
+{
+	std::string path;
+
+	// nullptr when it can't be imported, error says why
+	std::shared_ptr<CompiledProgram> program;
+	std::string error;
+
+	// The modules it imports itself, by the file as it is written in the import
+	std::map<std::string, std::shared_ptr<Module>> imports;
+};
+
+// Loads the modules of the programs of a run, a file is compiled once however
+// many programs import it:
+//
+//   a.sc  import "lib/math.sc";  ->  /home/me/lib/math.sc  tokenize, compile, optimize
+//   b.sc  import "lib/math.sc";  ->  /home/me/lib/math.sc  the same Module
+//
+// The imports are found in the text of a source before it is tokenized, a
+// path is relative to the file that imports it. Every new module is compiled
+// on a thread of its own, after the modules it imports. Those are found first,
+// so a module never waits for one that waits for it and a file that imports
+// itself gets an error instead.
+//
+// A module is compiled on its own, the names of what it imports are known to
+// it but their nodes aren't part of it, the program links every module once.
+// Its globals and parameters can be written by the programs that import it.
+// With a ProgramCache the compiled module is kept across runs, the key holds
+// the text of the module and of the files it imports.
+class ModuleLoader
+{
+public:
+	ModuleLoader(CompilerOptions p_options, ProgramCache* p_cache);
+	virtual ~ModuleLoader();
+
+	// The modules the source imports by the file as it is written, directory is where the paths start
+	std::map<std::string, std::shared_ptr<Module>> LoadImports(const std::string& source, const std::string& directory);
+
+	// The files of the import lines of a source, in order
+	static std::vector<std::string> FindImports(const std::string& source);
+
+	// The source with the text of every file it imports, a compile that links them depends on all of it
+	static std::string GetSourceWithImports(const std::string& source, const std::string& directory);
+
+	static std::string GetDirectory(const std::string& file);
+
+	// What the loads took, empty when nothing was imported
+	std::string GetReport();
+
+private:
+	CompilerOptions options;
+	ProgramCache* cache;
+
+	// Every module of the run by its full path, the ones still compiling too
+	std::map<std::string, std::shared_future<std::shared_ptr<Module>>> modules;
+	std::mutex mutex;
+	std::mutex cacheMutex;
+
+	int compiled = 0;
+	int cached = 0;
+	int imported = 0;
+	double compileSeconds = 0;
+
+	std::shared_future<std::shared_ptr<Module>> Find(const std::string& path, std::vector<std::string>& loading);
+	std::shared_ptr<Module> Compile(std::shared_ptr<Module> module, std::string source, std::map<std::string, std::shared_future<std::shared_ptr<Module>>> imports);
+
+	static std::string GetPath(const std::string& directory, const std::string& file);
+	static bool ReadFile(const std::string& path, std::string& text);
+	static void AddSources(const std::string& source, const std::string& directory, std::vector<std::string>& visited, std::string& text);
+};
@@ -93,6 +93,10 @@ enum class MyTokenType : int {
 	// Constants
 	Math_PI,
 	Math_E,
+
+	// Modules
+	Import,
+	ModulePath,
     
     // extra
     Extended_ASCII
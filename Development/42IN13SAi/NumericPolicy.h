@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cmath>
+
+// The precision the math operations compute in:
+//
+//   x = sin(30) + sqrt(2);     LongDouble: sin and sqrt in 80 bit long double
+//                              Double:     sin and sqrt in 64 bit double, SSE instead of the x87 unit
+//
+// Variables are stored and printed the same way in both modes, only the
+// intermediate result of an operation differs. A double result can differ
+// from the long double one in the last printed digits, but the double
+// functions of the C library are a lot faster than the long double ones.
+enum class NumericMode
+{
+	LongDouble,
+	Double
+};
+
+// The math handlers of the VirtualMachine and the JitRuntime are templates on
+// a policy, one instance per NumericMode
+template <typename T>
+struct NumericPolicy
+{
+	typedef T Value;
+
+	// A power with a whole exponent by square and multiply, std::pow for any other exponent
+	static Value IntegerPower(Value base, Value exponent)
+	{
+		if (std::floor(exponent) != exponent || std::fabs(exponent) > 64)
+			return std::pow(base, exponent);
+
+		Value result = 1;
+		Value factor = base;
+		for (long long remaining = (long long)std::fabs(exponent); remaining > 0; remaining /= 2)
+		{
+			if (remaining % 2 == 1)
+				result *= factor;
+			factor *= factor;
+		}
+		return exponent < 0 ? 1 / result : result;
+	}
+};
+
+typedef NumericPolicy<long double> LongDoublePolicy;
+typedef NumericPolicy<double> DoublePolicy;
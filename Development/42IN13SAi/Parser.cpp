@@ -1,10 +1,11 @@
 #include "Parser.h"
+#include <map>
 
-Parser::Parser(Compiler* compiler) : compiler(compiler)
+Parser::Parser(Compiler* compiler) : compiler(compiler), checking(compiler->IsChecking())
 {
 }
 
-Parser::Parser(Compiler* compiler, std::vector<std::shared_ptr<Token>> tokens) : compiler(compiler)
+Parser::Parser(Compiler* compiler, std::vector<std::shared_ptr<Token>> tokens) : compiler(compiler), checking(compiler->IsChecking())
 {
 	compiler->SetTokenList(tokens);
 }
@@ -29,6 +30,7 @@ void Parser::ParseFunction()
 		{
 			returnType = Token(0, 0, 0, "", MyTokenType::Void, nullptr);
 			functionName = Token(0, 0, 0, "main", MyTokenType::MainFunction, nullptr);
+			functionName.Id = AtomTable::Intern(functionName.Value);
 		}
 		else
 		{
@@ -36,9 +38,9 @@ void Parser::ParseFunction()
 			functionName = compiler->GetNext();
 		}
         
-        if (compiler->GetSubroutineTable()->GetSubroutine(functionName.Value) != nullptr)
+        if (compiler->GetSubroutineTable()->GetSubroutine(functionName.Id) != nullptr)
         {
-            compiler->Diag(ExceptionEnum::err_function_been_defined) << currentToken.Value << currentToken.LineNumber;
+            compiler->Diag(ExceptionEnum::err_function_been_defined, currentToken.LineNumber, currentToken.LinePosition) << currentToken.Value;
             compiler->SkipUntil(MyTokenType::CloseMethod);
             return;
         }
@@ -48,7 +50,7 @@ void Parser::ParseFunction()
 		// Set the parameters
 		if (currentToken.Type == MyTokenType::MainFunction && compiler->PeekNext()->Type != MyTokenType::CloseBracket)
         {
-            compiler->Diag(ExceptionEnum::err_main_parameters) << currentToken.LineNumber;
+            compiler->Diag(ExceptionEnum::err_main_parameters, currentToken.LineNumber, currentToken.LinePosition);
             compiler->SkipUntil(MyTokenType::CloseBracket);
             return;
         }
@@ -66,15 +68,15 @@ void Parser::ParseFunction()
 				if (IsTokenReturnVarType(parameter))
 					kind = SymbolKind::ParameterType;
 
-				Symbol parameterSymbol = Symbol(parameter.Value, parameter.Type, kind);
+				Symbol parameterSymbol = Symbol(parameter.Value, parameter.Id, parameter.Type, kind);
 
-				if (!symbolTable.HasSymbol(parameterSymbol.name))
+				if (!symbolTable.HasSymbol(parameterSymbol.atom))
 				{
 					symbolTable.AddSymbol(parameterSymbol);
 				}
                 else
                 {
-                    compiler->Diag(ExceptionEnum::err_parameter_in_use) << parameter.Value << currentToken.LineNumber;
+                    compiler->Diag(ExceptionEnum::err_parameter_in_use, currentToken.LineNumber, currentToken.LinePosition) << parameter.Value;
                     compiler->SkipUntil(MyTokenType::CloseBracket);
                 }
 			}
@@ -85,7 +87,7 @@ void Parser::ParseFunction()
 
 		// Check if the functions starts and create a subroutine
 		compiler->Match(MyTokenType::OpenMethod);
-		compiler->SetSubroutine(Subroutine(functionName.Value, returnType.Type, SubroutineKind::Function, symbolTable));
+		compiler->SetSubroutine(Subroutine(functionName.Value, functionName.Id, returnType.Type, SubroutineKind::Function, symbolTable));
         
         bool shouldHaveReturn = false;
         bool hasReturn = false;
@@ -98,7 +100,7 @@ void Parser::ParseFunction()
             // Catch function in function exception
             if (compiler->PeekNext()->Type == MyTokenType::Function || compiler->PeekNext()->Type == MyTokenType::MainFunction)
             {
-                compiler->Diag(ExceptionEnum::err_function_in_function) << compiler->PeekNext()->LineNumber;
+                compiler->Diag(ExceptionEnum::err_function_in_function, compiler->PeekNext()->LineNumber, compiler->PeekNext()->LinePosition);
                 return;
             }
             
@@ -110,7 +112,7 @@ void Parser::ParseFunction()
         
         // Check if function has return if it needs one
         if (shouldHaveReturn && !hasReturn)
-            compiler->Diag(ExceptionEnum::err_expected_ret) << compiler->GetCurrent().LineNumber;
+            compiler->Diag(ExceptionEnum::err_expected_ret, compiler->GetCurrent().LineNumber, compiler->GetCurrent().LinePosition);
 
 		// Check if the subroutine is closed correctly
 		// And add the subroutine to the subroutine table
@@ -119,7 +121,7 @@ void Parser::ParseFunction()
 	}
     else
     {
-        compiler->Diag(ExceptionEnum::err_expected_ret) << currentToken.LineNumber;
+        compiler->Diag(ExceptionEnum::err_expected_ret, currentToken.LineNumber, currentToken.LinePosition);
         compiler->SkipUntil(MyTokenType::OpenMethod);
         compiler->SkipUntil(compiler->GetCurrent().Partner.lock());
         return;
@@ -130,22 +132,43 @@ void Parser::ParseReturn()
 {
     if (compiler->GetSubroutine()->returnType == MyTokenType::Void)
     {
-        compiler->Diag(ExceptionEnum::err_unexpected_return) << compiler->PeekNext()->LineNumber;
+        compiler->Diag(ExceptionEnum::err_unexpected_return, compiler->PeekNext()->LineNumber, compiler->PeekNext()->LinePosition);
         compiler->SkipUntil(MyTokenType::EOL);
         return;
     }
     
 	compiler->Match(MyTokenType::Return);
 	
-	std::vector<std::shared_ptr<CompilerNode>> nodeParameters;
-	nodeParameters.push_back(ParseExpression());
+	std::shared_ptr<CompilerNode> value = ParseExpression();
 	
 	compiler->Match(MyTokenType::EOL);
+	if (checking)
+		return;
 	
+	std::vector<std::shared_ptr<CompilerNode>> nodeParameters;
+	nodeParameters.push_back(value);
 	std::shared_ptr<CompilerNode> returnNode = std::make_shared<CompilerNode>("$ret", nodeParameters, nullptr, false);
 	compiler->GetSubroutine()->AddCompilerNode(returnNode);
 }
 
+// import "file.sc"; the Compiler adds what the module has, see Compiler::ImportModule
+void Parser::ParseImport()
+{
+	compiler->Match(MyTokenType::Import);
+
+	Token path = compiler->GetNext();
+	if (path.Type != MyTokenType::ModulePath)
+	{
+		compiler->Diag(ExceptionEnum::err_expected_module_path, path.LineNumber, path.LinePosition);
+		while (path.Type != MyTokenType::EOL)
+			path = compiler->GetNext();
+		return;
+	}
+
+	compiler->Match(MyTokenType::EOL);
+	compiler->ImportModule(path.Value.substr(1, path.Value.size() - 2), path.LineNumber);
+}
+
 //Also parse (standard) Arithmetical operations
 std::shared_ptr<CompilerNode> Parser::ParseAssignmentStatement(bool forLoop)
 {
@@ -171,13 +194,17 @@ std::shared_ptr<CompilerNode> Parser::ParseAssignmentStatement(bool forLoop)
 	// Check if the identifier is a identifier
     if (identifier.Type != MyTokenType::Identifier)
     {
-        compiler->Diag(ExceptionEnum::err_expected_identifier) << currentToken.LineNumber;
+        compiler->Diag(ExceptionEnum::err_expected_identifier, currentToken.LineNumber, currentToken.LinePosition);
         compiler->SkipUntil(MyTokenType::EOL);
         return std::make_shared<CompilerNode>();
     }
 
-	std::shared_ptr<CompilerNode> id = std::make_shared<CompilerNode>("$identifier", identifier.Value, nullptr);
-	nodeParameters.push_back(id);
+	// While checking only the identifiers and the expressions are looked at
+	if (!checking)
+	{
+		std::shared_ptr<CompilerNode> id = std::make_shared<CompilerNode>("$identifier", identifier.Value, identifier.Id, false);
+		nodeParameters.push_back(id);
+	}
 
 	// Check if it is an assignment or only a decleration.
 	if (compiler->PeekNext()->Type == MyTokenType::Equals)
@@ -192,33 +219,39 @@ std::shared_ptr<CompilerNode> Parser::ParseAssignmentStatement(bool forLoop)
 
 			if (before.size() + after.size() > 15 || after.size() > 15)
 			{
-                compiler->Diag(ExceptionEnum::err_float_precision) << compiler->PeekNext()->LineNumber;
+                compiler->Diag(ExceptionEnum::err_float_precision, compiler->PeekNext()->LineNumber, compiler->PeekNext()->LinePosition);
 			}
 		}
 
 		expression = "$assignment";
 		std::shared_ptr<CompilerNode> node = ParseExpression();
-		nodeParameters.push_back(node);
-		endNode = std::make_shared<CompilerNode>(expression, nodeParameters, nullptr, false);
+		if (!checking)
+		{
+			nodeParameters.push_back(node);
+			endNode = std::make_shared<CompilerNode>(expression, nodeParameters, nullptr, false);
+		}
 	}
 	else if (IsNextTokenUniOp())
 	{
 		currentToken = compiler->GetNext();
-		std::vector<std::shared_ptr<CompilerNode>> parameters;
-		switch (currentToken.Type)
+		expression = "$assignment";
+		if (!checking)
 		{
-		case MyTokenType::UniOperatorPlus:
-			parameters.push_back(std::make_shared<CompilerNode>("$getVariable", identifier.Value, false));
-			nodeParameters.push_back(std::make_shared<CompilerNode>("$uniPlus", parameters, nullptr, false));
-			break;
-		case MyTokenType::UniOperatorMinus:
-			parameters.push_back(std::make_shared<CompilerNode>("$getVariable", identifier.Value, false));
-			nodeParameters.push_back(std::make_shared<CompilerNode>("$uniMin", parameters, nullptr, false));
-			
-			break;
+			std::vector<std::shared_ptr<CompilerNode>> parameters;
+			switch (currentToken.Type)
+			{
+			case MyTokenType::UniOperatorPlus:
+				parameters.push_back(std::make_shared<CompilerNode>("$getVariable", identifier.Value, identifier.Id, false));
+				nodeParameters.push_back(std::make_shared<CompilerNode>("$uniPlus", parameters, nullptr, false));
+				break;
+			case MyTokenType::UniOperatorMinus:
+				parameters.push_back(std::make_shared<CompilerNode>("$getVariable", identifier.Value, identifier.Id, false));
+				nodeParameters.push_back(std::make_shared<CompilerNode>("$uniMin", parameters, nullptr, false));
+				
+				break;
+			}
+			endNode = std::make_shared<CompilerNode>(expression, nodeParameters, nullptr, false);
 		}
-		expression = "$assignment";
-		endNode = std::make_shared<CompilerNode>(expression, nodeParameters, nullptr, false);
 	}
 	else if (IsNextTokenUniOp())
 	{
@@ -226,7 +259,7 @@ std::shared_ptr<CompilerNode> Parser::ParseAssignmentStatement(bool forLoop)
 		std::shared_ptr<CompilerNode> node = ParseExpression();
 		nodeParameters.push_back(node);
 	}
-	else if (IsNextTokenAddOp() || IsNextTokenMulOp())
+	else if (GetPrecedence(compiler->PeekNext()->Type) >= GetPrecedence(MyTokenType::OperatorPlus))
 	{
 		std::string command;
 		std::vector<std::shared_ptr<CompilerNode>> parameters;
@@ -253,27 +286,32 @@ std::shared_ptr<CompilerNode> Parser::ParseAssignmentStatement(bool forLoop)
 		currentToken = compiler->GetNext();
 		if (currentToken.Type != MyTokenType::Equals)
         {
-            compiler->Diag(ExceptionEnum::err_expected_identifier) << currentToken.LineNumber;
+            compiler->Diag(ExceptionEnum::err_expected_identifier, currentToken.LineNumber, currentToken.LinePosition);
             compiler->SkipUntil(MyTokenType::EOL);
             return std::make_shared<CompilerNode>();
         }
 
 		// Add the parameters to the parameters list
 		expression = "$assignment";
-		parameters.push_back(std::make_shared<CompilerNode>("$getVariable", identifier.Value, false));
-		parameters.push_back(ParseExpression());
-		nodeParameters.push_back(std::make_shared<CompilerNode>(CompilerNode(command, parameters, nullptr, false)));
-		endNode = std::make_shared<CompilerNode>(expression, nodeParameters, nullptr, false);
+		if (checking)
+			ParseExpression();
+		else
+		{
+			parameters.push_back(std::make_shared<CompilerNode>("$getVariable", identifier.Value, identifier.Id, false));
+			parameters.push_back(ParseExpression());
+			nodeParameters.push_back(std::make_shared<CompilerNode>(CompilerNode(command, parameters, nullptr, false)));
+			endNode = std::make_shared<CompilerNode>(expression, nodeParameters, nullptr, false);
+		}
 	}
 
 	// Check if the identifier exists
 	if (!newIdentifier)
 	{
-		Symbol* symbol = GetSymbol(identifier.Value);
+		Symbol* symbol = GetSymbol(identifier.Id);
 
 		if (symbol == nullptr)
 		{
-			compiler->Diag(ExceptionEnum::err_unkown_identifier) << identifier.Value << currentToken.LineNumber;
+			compiler->Diag(ExceptionEnum::err_unkown_identifier, currentToken.LineNumber, currentToken.LinePosition) << identifier.Value;
 			compiler->SkipUntil(MyTokenType::EOL);
 			return std::make_shared<CompilerNode>();
 		}
@@ -284,11 +322,11 @@ std::shared_ptr<CompilerNode> Parser::ParseAssignmentStatement(bool forLoop)
 
 		if (subroutine->isEmpty)
 		{
-			identifierSymbol = new Symbol(identifier.Value, identifier.Type, SymbolKind::Global);
+			identifierSymbol = new Symbol(identifier.Value, identifier.Id, identifier.Type, SymbolKind::Global);
 		}
 		else
 		{
-			identifierSymbol = new Symbol(identifier.Value, identifier.Type, SymbolKind::Local);
+			identifierSymbol = new Symbol(identifier.Value, identifier.Id, identifier.Type, SymbolKind::Local);
 		}
 
 		if (!compiler->GetSubroutine()->isEmpty)
@@ -298,7 +336,7 @@ std::shared_ptr<CompilerNode> Parser::ParseAssignmentStatement(bool forLoop)
 			delete identifierSymbol;
 			identifierSymbol = nullptr;
 		}
-		else if (!compiler->HasSymbol(identifierSymbol->name))
+		else if (!compiler->HasSymbol(identifierSymbol->atom))
 		{
 			compiler->AddSymbol(*identifierSymbol);
 
@@ -311,7 +349,7 @@ std::shared_ptr<CompilerNode> Parser::ParseAssignmentStatement(bool forLoop)
 			delete identifierSymbol;
 			identifierSymbol = nullptr;
 
-			compiler->Diag(ExceptionEnum::err_identifier_in_use) << sym.GetValue() << currentToken.LineNumber;
+			compiler->Diag(ExceptionEnum::err_identifier_in_use, currentToken.LineNumber, currentToken.LinePosition) << sym.GetValue();
 			compiler->SkipUntil(MyTokenType::EOL);
 			return std::shared_ptr<CompilerNode>();
 		}
@@ -337,10 +375,14 @@ void Parser::ParseFunctionCall()
 {
 	std::vector<std::shared_ptr<CompilerNode>> nodeParameters;
 	Token currentToken = compiler->GetNext();
+	Token name = currentToken;
+	int arguments = 0;
 
-	std::shared_ptr<CompilerNode> node = std::make_shared<CompilerNode>("$functionName", currentToken.Value, false);
-
-	nodeParameters.push_back(node);
+	if (!checking)
+	{
+		std::shared_ptr<CompilerNode> node = std::make_shared<CompilerNode>("$functionName", currentToken.Value, currentToken.Id, false);
+		nodeParameters.push_back(node);
+	}
 
 	compiler->Match(MyTokenType::OpenBracket);
 	while (compiler->PeekNext()->Type != MyTokenType::CloseBracket)
@@ -352,12 +394,22 @@ void Parser::ParseFunctionCall()
 
 		std::shared_ptr<CompilerNode> node = ParseExpression();
 		if (node != nullptr)
-			nodeParameters.push_back(node);
+		{
+			arguments++;
+			if (!checking)
+				nodeParameters.push_back(node);
+		}
 	}
 
 	compiler->Match(MyTokenType::CloseBracket);
 	compiler->Match(MyTokenType::EOL);
 
+	if (checking)
+	{
+		compiler->AddCall(name.Value, arguments, name.LineNumber);
+		return;
+	}
+
 	// Create the finall node
 	std::shared_ptr<CompilerNode> endNode = std::make_shared<CompilerNode>("$functionCall", nodeParameters, nullptr, false);
 
@@ -388,7 +440,7 @@ void Parser::ParseIfStatement()
     }
     else
     {
-        compiler->Diag(ExceptionEnum::err_unexpected_keyword) << currentToken.LineNumber;
+        compiler->Diag(ExceptionEnum::err_unexpected_keyword, currentToken.LineNumber, currentToken.LinePosition);
         compiler->SkipUntil(MyTokenType::CloseMethod);
         return;
     }
@@ -401,7 +453,7 @@ void Parser::ParseIfStatement()
     // Check if conditions could be parsed
     if (statementNode == nullptr)
     {
-        compiler->Diag(ExceptionEnum::err_expected_parameter) << currentToken.LineNumber << currentToken.LinePosition;
+        compiler->Diag(ExceptionEnum::err_expected_parameter, currentToken.LineNumber, currentToken.LinePosition);
         compiler->SkipUntil(skipToOnEx); // close bracket
     }
     else
@@ -417,7 +469,7 @@ void Parser::ParseIfStatement()
                       || (node_params[0]->GetExpression() == "$getVariable" && node_params[1]->GetExpression() == "$value")
                       || (node_params[0]->GetExpression() == "$value" && node_params[1]->GetExpression() == "$value")))
                 {
-                    compiler->Diag(ExceptionEnum::err_expected_identifier) << currentToken.LineNumber;
+                    compiler->Diag(ExceptionEnum::err_expected_identifier, currentToken.LineNumber, currentToken.LinePosition);
                     compiler->SkipUntil(skipToOnEx); // close bracket
                 }
                 else
@@ -426,7 +478,7 @@ void Parser::ParseIfStatement()
         }
         else
         {
-            compiler->Diag(ExceptionEnum::err_expected_identifier) << currentToken.LineNumber;
+            compiler->Diag(ExceptionEnum::err_expected_identifier, currentToken.LineNumber, currentToken.LinePosition);
             compiler->SkipUntil(skipToOnEx); // close bracket
         }
     }
@@ -438,11 +490,15 @@ void Parser::ParseIfStatement()
     
     //Make a do nothing compilerNode to jump to if the statement is false
     std::vector<std::string> doNothing;
-    std::shared_ptr<CompilerNode> jumpTo = std::make_shared<CompilerNode>("$doNothing", "", false);
+    std::shared_ptr<CompilerNode> jumpTo;
     
     //Create the endNode before parsing the statements in the if/else
-    endNode = std::make_shared<CompilerNode>("$if", params, jumpTo, false);
-    compiler->GetSubroutine()->AddCompilerNode(endNode);
+    if (!checking)
+    {
+        jumpTo = std::make_shared<CompilerNode>("$doNothing", "", false);
+        endNode = std::make_shared<CompilerNode>("$if", params, jumpTo, false);
+        compiler->GetSubroutine()->AddCompilerNode(endNode);
+    }
 
     while (compiler->PeekNext()->Type != MyTokenType::CloseMethod)
     {
@@ -454,7 +510,7 @@ void Parser::ParseIfStatement()
     // Add a do nothing node to jump to if the 'if' has a partner and
     // is finished with the true condition statements
     std::shared_ptr<CompilerNode> finalDoNothing;
-    if (hasPartner)
+    if (hasPartner && !checking)
     {
         finalDoNothing = std::make_shared<CompilerNode>("$doNothing", "donothing-end", false);
         
@@ -465,7 +521,8 @@ void Parser::ParseIfStatement()
     }
     
     //Add the donothing to jump to if the condition is false
-    compiler->GetSubroutine()->AddCompilerNode(jumpTo);
+    if (!checking)
+        compiler->GetSubroutine()->AddCompilerNode(jumpTo);
     
     // If there is a else / else if parse that after the do nothing
     if (hasPartner)
@@ -481,7 +538,8 @@ void Parser::ParseIfStatement()
 		compiler->Match(MyTokenType::CloseMethod);
 
 		// Add the end doNothing
-		compiler->GetSubroutine()->AddCompilerNode(finalDoNothing);
+		if (!checking)
+			compiler->GetSubroutine()->AddCompilerNode(finalDoNothing);
     }
 }
 
@@ -508,7 +566,7 @@ void Parser::ParseLoopStatement()
 	}
 	else
 	{
-        compiler->Diag(ExceptionEnum::err_unexpected_keyword) << currentToken.LineNumber;
+        compiler->Diag(ExceptionEnum::err_unexpected_keyword, currentToken.LineNumber, currentToken.LinePosition);
         compiler->SkipUntil(MyTokenType::CloseMethod);
         return;
 	}
@@ -539,14 +597,18 @@ void Parser::ParseLoopStatement()
 	
 	// Create a do nothing, so you can jump to this when the statement is false
 	std::vector<std::string> doNothing;
-	std::shared_ptr<CompilerNode> jumpTo = std::make_shared<CompilerNode>("$doNothing", "", false);
+	std::shared_ptr<CompilerNode> jumpTo;
 	
 	//Make the endNode before parsing the statements in the loop
-	endNode = std::make_shared<CompilerNode>(statementExpression, nodeParameters, jumpTo, false);
-	compiler->GetSubroutine()->AddCompilerNode(endNode);
-	
-	// set the doNothing jumpto to the endNode so it can jump to it at the end of the while
-	jumpTo->SetJumpTo(endNode);
+	if (!checking)
+	{
+		jumpTo = std::make_shared<CompilerNode>("$doNothing", "", false);
+		endNode = std::make_shared<CompilerNode>(statementExpression, nodeParameters, jumpTo, false);
+		compiler->GetSubroutine()->AddCompilerNode(endNode);
+		
+		// set the doNothing jumpto to the endNode so it can jump to it at the end of the while
+		jumpTo->SetJumpTo(endNode);
+	}
 	
 	compiler->Match(MyTokenType::CloseBracket);
 	compiler->Match(MyTokenType::OpenMethod);
@@ -559,180 +621,156 @@ void Parser::ParseLoopStatement()
 	compiler->Match(MyTokenType::CloseMethod);
 	
 	//Finally add the jumpTo compilerNode
-	compiler->GetSubroutine()->AddCompilerNode(jumpTo);
+	if (!checking)
+		compiler->GetSubroutine()->AddCompilerNode(jumpTo);
 }
 
 #pragma endregion ParseStatementMethods
 
 #pragma region ParseExpressionMethods
+// An operator-precedence parser, the binary operators are in a table instead
+// of one function per level. The operands and operators are on explicit stacks
+// and an open parenthesis only remembers where its operators start, so neither
+// a long expression nor deep parentheses take stack space:
+//
+//   a + b * (c - d) < e      operands: a b c d        operators: + * ( -
+//                            at ):     a b (c - d)    operators: + *
+//                            at <:     (a + (b * (c - d)))
+//
+// Every operator is left associative and ++ and -- bind to the term in front
+// of them. The arguments of a call are parsed by a ParseExpression of their own.
 std::shared_ptr<CompilerNode> Parser::ParseExpression()
 {
-	std::shared_ptr<CompilerNode> parsedExpr = ParseRelationalExpression();
-	while (IsNextTokenLogicalOp())
+	std::vector<std::shared_ptr<CompilerNode>> operands;
+	std::vector<Token> operators;
+
+	// The number of operators in front of every open parenthesis
+	std::vector<size_t> groups;
+
+	while (true)
 	{
-		Token logicalOp = compiler->GetNext();
-		std::shared_ptr<CompilerNode> secondParsedExpr = ParseRelationalExpression();
-		std::vector<std::shared_ptr<CompilerNode>> parameters;
+		while (compiler->PeekNext()->Type == MyTokenType::OpenBracket)
+		{
+			compiler->GetNext();
+			groups.push_back(operators.size());
+		}
+		operands.push_back(ParsePostfix(ParseTerm()));
 
-		switch (logicalOp.Type)
+		// Anything that isn't a binary operator closes a parenthesis or ends the expression
+		int precedence = GetPrecedence(compiler->PeekNext()->Type);
+		while (precedence == 0 && !groups.empty())
 		{
-		case MyTokenType::And:
-			parameters.push_back(parsedExpr);
-			parameters.push_back(secondParsedExpr);
-			parsedExpr = std::make_shared<CompilerNode>("$and", parameters, nullptr, false);
-			break;
-		case MyTokenType::Or:
-			parameters.push_back(parsedExpr);
-			parameters.push_back(secondParsedExpr);
-			parsedExpr = std::make_shared<CompilerNode>("$or", parameters, nullptr, false);
-			break;
+			Reduce(operands, operators, groups.back());
+			groups.pop_back();
+			compiler->Match(MyTokenType::CloseBracket);
+			operands.back() = ParsePostfix(operands.back());
+			precedence = GetPrecedence(compiler->PeekNext()->Type);
 		}
+
+		if (precedence == 0)
+			break;
+
+		size_t group = groups.empty() ? 0 : groups.back();
+		while (operators.size() > group && GetPrecedence(operators.back().Type) >= precedence)
+			Reduce(operands, operators, operators.size() - 1);
+		operators.push_back(compiler->GetNext());
 	}
 
-	return parsedExpr;
+	Reduce(operands, operators, 0);
+	return operands.back();
 }
 
-std::shared_ptr<CompilerNode> Parser::ParseRelationalExpression()
+// Combine the operators from the top of the stack down to the first one of a group
+void Parser::Reduce(std::vector<std::shared_ptr<CompilerNode>>& operands, std::vector<Token>& operators, size_t group)
 {
-	std::shared_ptr<CompilerNode> parsedExpr = ParseAddExpression();
-	while (IsNextTokenRelationalOp())
+	while (operators.size() > group)
 	{
-		Token relOp = compiler->GetNext();
-		std::shared_ptr<CompilerNode> secondParsedExpr = ParseAddExpression();
-		std::vector<std::shared_ptr<CompilerNode>> parameters;
-
-		switch (relOp.Type)
-		{
-		case MyTokenType::LowerThan:
-			parameters.push_back(parsedExpr);
-			parameters.push_back(secondParsedExpr);
-			parsedExpr = std::make_shared<CompilerNode>(CompilerNode("$less", parameters, nullptr, false));
-			break;
-		case MyTokenType::LowerOrEqThan:
-			parameters.push_back(parsedExpr);
-			parameters.push_back(secondParsedExpr);
-			parsedExpr = std::make_shared<CompilerNode>(CompilerNode("$lessOrEq", parameters, nullptr, false));
-			break;
-		case MyTokenType::GreaterThan:
-			parameters.push_back(parsedExpr);
-			parameters.push_back(secondParsedExpr);
-			parsedExpr = std::make_shared<CompilerNode>(CompilerNode("$greater", parameters, nullptr, false));
-			break;
-		case MyTokenType::GreaterOrEqThan:
-			parameters.push_back(parsedExpr);
-			parameters.push_back(secondParsedExpr);
-			parsedExpr = std::make_shared<CompilerNode>(CompilerNode("$greaterOrEq", parameters, nullptr, false));
-			break;
-		case MyTokenType::Comparator:
-			parameters.push_back(parsedExpr);
-			parameters.push_back(secondParsedExpr);
-			if (relOp.Value == "==")
-				parsedExpr = std::make_shared<CompilerNode>(CompilerNode("$equals", parameters, nullptr, false));
-			else
-				parsedExpr = std::make_shared<CompilerNode>(CompilerNode("$notEquals", parameters, nullptr, false));
-			break;
-		}
+		Token binaryOp = operators.back();
+		operators.pop_back();
+		std::shared_ptr<CompilerNode> right = operands.back();
+		operands.pop_back();
+		operands.back() = MakeBinaryNode(binaryOp, operands.back(), right);
 	}
-
-	return parsedExpr;
 }
 
-std::shared_ptr<CompilerNode> Parser::ParseAddExpression()
+std::shared_ptr<CompilerNode> Parser::MakeBinaryNode(Token binaryOp, std::shared_ptr<CompilerNode> left, std::shared_ptr<CompilerNode> right)
 {
-	std::shared_ptr<CompilerNode> parsedExpr = ParseMulExpression();
-	while (IsNextTokenAddOp())
+	if (checking)
 	{
-		Token addOp = compiler->GetNext();
-		std::shared_ptr<CompilerNode> secondParsedExpr = ParseMulExpression();
-		std::vector<std::shared_ptr<CompilerNode>> parameters;
-
-		if (secondParsedExpr != nullptr)
-		{
-			switch (addOp.Type)
-			{
-			case MyTokenType::OperatorPlus:
-				parameters.push_back(parsedExpr);
-				parameters.push_back(secondParsedExpr);
-				parsedExpr = std::make_shared<CompilerNode>(CompilerNode("$add", parameters, nullptr, false));
-				break;
-			case MyTokenType::OperatorMinus:
-				parameters.push_back(parsedExpr);
-				parameters.push_back(secondParsedExpr);
-				parsedExpr = std::make_shared<CompilerNode>(CompilerNode("$min", parameters, nullptr, false));
-				break;
-			}
-		}
+		bool arithmetic = binaryOp.Type == MyTokenType::OperatorPlus || binaryOp.Type == MyTokenType::OperatorMinus || binaryOp.Type == MyTokenType::OperatorMultiply
+			|| binaryOp.Type == MyTokenType::OperatorDivide || binaryOp.Type == MyTokenType::OperatorRaised;
+		if (arithmetic && right == nullptr)
+			return left;
+		if (binaryOp.Type == MyTokenType::OperatorDivide && right->GetValue() == "0")
+			compiler->Diag(ExceptionEnum::err_zero_divide, binaryOp.LineNumber, binaryOp.LinePosition);
+		return GetCheckedNode(left, right);
 	}
 
-	return parsedExpr;
-}
+	std::vector<std::shared_ptr<CompilerNode>> parameters;
+	parameters.push_back(left);
+	parameters.push_back(right);
 
-std::shared_ptr<CompilerNode> Parser::ParseMulExpression()
-{
-	std::shared_ptr<CompilerNode> term = ParseUniExpression();
-	while (IsNextTokenMulOp())
+	switch (binaryOp.Type)
 	{
-		Token mullOp = compiler->GetNext();
-		std::shared_ptr<CompilerNode> secondTerm = ParseUniExpression();
-		std::vector<std::shared_ptr<CompilerNode>> parameters;
+	case MyTokenType::And:
+		return std::make_shared<CompilerNode>("$and", parameters, nullptr, false);
+	case MyTokenType::Or:
+		return std::make_shared<CompilerNode>("$or", parameters, nullptr, false);
+	case MyTokenType::LowerThan:
+		return std::make_shared<CompilerNode>("$less", parameters, nullptr, false);
+	case MyTokenType::LowerOrEqThan:
+		return std::make_shared<CompilerNode>("$lessOrEq", parameters, nullptr, false);
+	case MyTokenType::GreaterThan:
+		return std::make_shared<CompilerNode>("$greater", parameters, nullptr, false);
+	case MyTokenType::GreaterOrEqThan:
+		return std::make_shared<CompilerNode>("$greaterOrEq", parameters, nullptr, false);
+	case MyTokenType::Comparator:
+		if (binaryOp.Value == "==")
+			return std::make_shared<CompilerNode>("$equals", parameters, nullptr, false);
+		return std::make_shared<CompilerNode>("$notEquals", parameters, nullptr, false);
+	default:
+		break;
+	}
 
-		if (secondTerm != nullptr)
-		{
-			switch (mullOp.Type)
-			{
-			case MyTokenType::OperatorMultiply:
-				parameters.push_back(term);
-				parameters.push_back(secondTerm);
-				term = std::make_shared<CompilerNode>("$mul", parameters, nullptr, false);
-				break;
-			case MyTokenType::OperatorDivide:
-				parameters.push_back(term);
-				parameters.push_back(secondTerm);
-				if (secondTerm->GetValue() == "0")
-				{
-                    compiler->Diag(ExceptionEnum::err_zero_divide) << mullOp.LineNumber;
-                    secondTerm = nullptr;
-				}
-				term = std::make_shared<CompilerNode>("$div", parameters, nullptr, false);
-				break;
-			case MyTokenType::OperatorRaised:
-				parameters.push_back(term);
-				parameters.push_back(secondTerm);
-				term = std::make_shared<CompilerNode>("$raise", parameters, nullptr, false);
-				break;
-			}
-		}
+	// An arithmetic operator without a right operand is left out
+	if (right == nullptr)
+		return left;
+
+	switch (binaryOp.Type)
+	{
+	case MyTokenType::OperatorPlus:
+		return std::make_shared<CompilerNode>("$add", parameters, nullptr, false);
+	case MyTokenType::OperatorMinus:
+		return std::make_shared<CompilerNode>("$min", parameters, nullptr, false);
+	case MyTokenType::OperatorMultiply:
+		return std::make_shared<CompilerNode>("$mul", parameters, nullptr, false);
+	case MyTokenType::OperatorDivide:
+		if (right->GetValue() == "0")
+			compiler->Diag(ExceptionEnum::err_zero_divide, binaryOp.LineNumber, binaryOp.LinePosition);
+		return std::make_shared<CompilerNode>("$div", parameters, nullptr, false);
+	default:
+		return std::make_shared<CompilerNode>("$raise", parameters, nullptr, false);
 	}
-	return term;
 }
 
-std::shared_ptr<CompilerNode> Parser::ParseUniExpression()
+// The ++ and -- after a term, the end of the statement follows unless it is inside parentheses
+std::shared_ptr<CompilerNode> Parser::ParsePostfix(std::shared_ptr<CompilerNode> term)
 {
-	std::shared_ptr<CompilerNode> term = ParseTerm();
-
-	while (IsNextTokenUniOp())
+	while (term != nullptr && IsNextTokenUniOp())
 	{
-		if (term != nullptr)
-		{
-			Token uniOp = compiler->GetNext();
-			std::vector<std::shared_ptr<CompilerNode>> parameters;
+		Token uniOp = compiler->GetNext();
+		std::vector<std::shared_ptr<CompilerNode>> parameters;
+		parameters.push_back(term);
 
-			switch (uniOp.Type)
-			{
-			case MyTokenType::UniOperatorPlus:
-				parameters.push_back(term);
-				term = std::make_shared<CompilerNode>("$uniPlus", parameters, nullptr, false);
-				if (compiler->PeekNext()->Type != MyTokenType::CloseBracket)
-					compiler->Match(MyTokenType::EOL);
-				break;
-			case MyTokenType::UniOperatorMinus:
-				parameters.push_back(term);
-				term = std::make_shared<CompilerNode>("$uniMin", parameters, nullptr, false);
-				if (compiler->PeekNext()->Type != MyTokenType::CloseBracket)
-					compiler->Match(MyTokenType::EOL);
-				break;
-			}
-		}
+		if (checking)
+			term = GetCheckedTerm("$checked", "");
+		else if (uniOp.Type == MyTokenType::UniOperatorPlus)
+			term = std::make_shared<CompilerNode>("$uniPlus", parameters, nullptr, false);
+		else
+			term = std::make_shared<CompilerNode>("$uniMin", parameters, nullptr, false);
+
+		if (compiler->PeekNext()->Type != MyTokenType::CloseBracket)
+			compiler->Match(MyTokenType::EOL);
 	}
 
 	return term;
@@ -747,6 +785,8 @@ std::shared_ptr<CompilerNode> Parser::ParseTerm()
 	if (token.Type == MyTokenType::Float)
 	{
         token = compiler->GetNext();
+		if (checking)
+			return GetCheckedTerm("$value", token.Value);
 		node = std::make_shared<CompilerNode>("$value", token.Value, false);
 		return node;
 	}
@@ -759,34 +799,30 @@ std::shared_ptr<CompilerNode> Parser::ParseTerm()
 		}
 		else
 		{
-			std::string identifier = token.Value;
-
-			Symbol* symbol = GetSymbol(identifier);
+			Symbol* symbol = GetSymbol(token.Id);
 
             if (symbol == nullptr)
             {
-                compiler->Diag(ExceptionEnum::err_var_not_found) << identifier << token.LineNumber;
+                compiler->Diag(ExceptionEnum::err_var_not_found, token.LineNumber, token.LinePosition) << token.Value;
                 symbol = new Symbol("fault", MyTokenType::Identifier, SymbolKind::None);
             }
 
-			node = std::make_shared<CompilerNode>("$getVariable", symbol->name, false);
+			if (checking)
+				return GetCheckedTerm("$getVariable", "");
+
+			node = std::make_shared<CompilerNode>("$getVariable", symbol->name, symbol->atom, false);
 			return node;
 		}
 	}
-	else if (token.Type == MyTokenType::OpenBracket)
-	{
-        token = compiler->GetNext();
-		node = ParseExpression();
-		compiler->Match(MyTokenType::CloseBracket);
-		return node;
-	}
 	else if (token.Type == MyTokenType::OperatorMinus && compiler->PeekNext()->Type == MyTokenType::Float)
 	{
         compiler->GetNext();
 		token = compiler->GetNext();
+		if (checking)
+			return GetCheckedTerm("$value", "-" + token.Value);
 		node = std::make_shared<CompilerNode>("$value", "-" + token.Value, false);
 	}
-	else if (compiler->IsInternalFunction(token.Type) && !(token.Type==MyTokenType::PrintLine || token.Type==MyTokenType::Stop))
+	else if (compiler->IsInternalFunction(token.Type) && !compiler->IsInternalStatement(token.Type))
 	{
         token = compiler->GetNext();
 		node = std::shared_ptr<CompilerNode>(InternalFunction(compiler).GetInternalFunction(token.Type));
@@ -806,7 +842,7 @@ std::shared_ptr<CompilerNode> Parser::ParseTerm()
     else if (token.Type == MyTokenType::Return)
     {
         token = compiler->GetNext();
-        compiler->Diag(ExceptionEnum::err_ret_as_var) << token.LineNumber;
+        compiler->Diag(ExceptionEnum::err_ret_as_var, token.LineNumber, token.LinePosition);
     }
 
 	return node;
@@ -816,8 +852,12 @@ std::shared_ptr<CompilerNode> Parser::ParseTerm()
 std::shared_ptr<CompilerNode> Parser::ParseFunctionCall(Token token)
 {
 	std::vector<std::shared_ptr<CompilerNode>> nodeParameters;
-	std::shared_ptr<CompilerNode> node = std::make_shared<CompilerNode>("$functionName", token.Value, false);
-	nodeParameters.push_back(node);
+	int arguments = 0;
+	if (!checking)
+	{
+		std::shared_ptr<CompilerNode> node = std::make_shared<CompilerNode>("$functionName", token.Value, token.Id, false);
+		nodeParameters.push_back(node);
+	}
 	Token currentToken = compiler->GetNext();
 
 	while (compiler->PeekNext()->Type != MyTokenType::CloseBracket)
@@ -828,59 +868,93 @@ std::shared_ptr<CompilerNode> Parser::ParseFunctionCall(Token token)
 		}
 
 		std::shared_ptr<CompilerNode> node = ParseExpression();
-		nodeParameters.push_back(node);
+		arguments++;
+		if (!checking)
+			nodeParameters.push_back(node);
 	}
 
 	compiler->Match(MyTokenType::CloseBracket);
 
+	if (checking)
+	{
+		compiler->AddCall(token.Value, arguments, token.LineNumber);
+		return GetCheckedTerm("$checked", "");
+	}
+
 	std::shared_ptr<CompilerNode> finalNode = std::make_shared<CompilerNode>("$functionCall", nodeParameters, nullptr, false);
 	return finalNode;
 }
-#pragma endregion ParseExpressionMethods
-
-#pragma region IsNextTokenMethods
-bool Parser::IsNextTokenLogicalOp()
-{
-	MyTokenType type = compiler->PeekNext()->Type;
-	return type == MyTokenType::And ||
-		type == MyTokenType::Or;
-
-	/*std::vector<MyTokenType> operators{ MyTokenType::And, MyTokenType::Or };
-	return std::find(operators.begin(), operators.end(), compiler->PeekNext()->Type) != operators.end();*/
-}
 
-bool Parser::IsNextTokenRelationalOp()
+// The terms of a checked expression, the only things looked at are the
+// expressions of the operands of an if condition and a division by "0"
+std::shared_ptr<CompilerNode> Parser::GetCheckedTerm(std::string expression, std::string value)
 {
-	MyTokenType type = compiler->PeekNext()->Type;
-	return type == MyTokenType::GreaterThan ||
-		type == MyTokenType::GreaterOrEqThan ||
-		type == MyTokenType::LowerThan ||
-		type == MyTokenType::LowerOrEqThan ||
-		type == MyTokenType::Comparator;
-
-	/*std::vector<MyTokenType> operators{ MyTokenType::GreaterThan, MyTokenType::GreaterOrEqThan, MyTokenType::LowerThan, MyTokenType::LowerOrEqThan };
-	return std::find(operators.begin(), operators.end(), compiler->PeekNext()->Type) != operators.end();*/
+	static const std::shared_ptr<CompilerNode> terms[] = {
+		std::make_shared<CompilerNode>("$value", "", false),
+		std::make_shared<CompilerNode>("$value", "0", false),
+		std::make_shared<CompilerNode>("$getVariable", "", false),
+		std::make_shared<CompilerNode>("$checked", "", false)
+	};
+
+	if (expression == "$value")
+		return terms[value == "0" ? 1 : 0];
+	if (expression == "$getVariable")
+		return terms[2];
+	return terms[3];
 }
 
-bool Parser::IsNextTokenAddOp()
+// A binary operator of a checked expression, one node for every kind of left and right operand:
+// none, a value, a variable or anything else
+std::shared_ptr<CompilerNode> Parser::GetCheckedNode(std::shared_ptr<CompilerNode> left, std::shared_ptr<CompilerNode> right)
 {
-	MyTokenType type = compiler->PeekNext()->Type;
-	return type == MyTokenType::OperatorMinus ||
-		type == MyTokenType::OperatorPlus;
-
-	/*std::vector<MyTokenType> operators{ MyTokenType::OperatorPlus, MyTokenType::OperatorMinus };
-	return std::find(operators.begin(), operators.end(), compiler->PeekNext()->Type) != operators.end();*/
+	static const std::vector<std::shared_ptr<CompilerNode>> nodes = []() {
+		std::shared_ptr<CompilerNode> operands[] = { nullptr, GetCheckedTerm("$value", ""), GetCheckedTerm("$getVariable", ""), GetCheckedTerm("$checked", "") };
+		std::vector<std::shared_ptr<CompilerNode>> binaryNodes;
+		for (std::shared_ptr<CompilerNode> leftOperand : operands)
+		{
+			for (std::shared_ptr<CompilerNode> rightOperand : operands)
+			{
+				std::vector<std::shared_ptr<CompilerNode>> parameters;
+				parameters.push_back(leftOperand);
+				parameters.push_back(rightOperand);
+				binaryNodes.push_back(std::make_shared<CompilerNode>("$checked", parameters, nullptr, false));
+			}
+		}
+		return binaryNodes;
+	}();
+
+	auto kind = [](std::shared_ptr<CompilerNode> operand) {
+		if (operand == nullptr)
+			return 0;
+		if (operand->GetExpression() == "$value")
+			return 1;
+		return operand->GetExpression() == "$getVariable" ? 2 : 3;
+	};
+	return nodes[kind(left) * 4 + kind(right)];
 }
+#pragma endregion ParseExpressionMethods
 
-bool Parser::IsNextTokenMulOp()
+#pragma region IsNextTokenMethods
+// The binary operators from the loosest to the tightest binding, 0 for any other token
+int Parser::GetPrecedence(MyTokenType type)
 {
-	MyTokenType type = compiler->PeekNext()->Type;
-	return type == MyTokenType::OperatorMultiply ||
-		type == MyTokenType::OperatorDivide ||
-		type == MyTokenType::OperatorRaised;
-
-	/*std::vector<MyTokenType> operators{ MyTokenType::OperatorMultiply, MyTokenType::OperatorDivide, MyTokenType::OperatorRaised };
-	return std::find(operators.begin(), operators.end(), compiler->PeekNext()->Type) != operators.end();*/
+	static const std::map<MyTokenType, int> precedences = {
+		{ MyTokenType::And, 1 },
+		{ MyTokenType::Or, 1 },
+		{ MyTokenType::LowerThan, 2 },
+		{ MyTokenType::LowerOrEqThan, 2 },
+		{ MyTokenType::GreaterThan, 2 },
+		{ MyTokenType::GreaterOrEqThan, 2 },
+		{ MyTokenType::Comparator, 2 },
+		{ MyTokenType::OperatorPlus, 3 },
+		{ MyTokenType::OperatorMinus, 3 },
+		{ MyTokenType::OperatorMultiply, 4 },
+		{ MyTokenType::OperatorDivide, 4 },
+		{ MyTokenType::OperatorRaised, 4 }
+	};
+
+	auto precedence = precedences.find(type);
+	return precedence != precedences.end() ? precedence->second : 0;
 }
 
 bool Parser::IsNextTokenUniOp()
@@ -913,7 +987,7 @@ bool Parser::IsTokenReturnVarType(Token token)
 // This function will return a symbol based on the identifier parameter.
 // It will not just check the global symboltable but will first check the 
 // symboltable of the current subroutine.
-Symbol* Parser::GetSymbol(std::string identifier)
+Symbol* Parser::GetSymbol(Atom identifier)
 {
 	Symbol* symbol;
 	//std::unique_ptr<Subroutine> subroutine(compiler->GetSubroutine());
@@ -22,26 +22,29 @@ public:
 	void ParseLoopStatement();
 	void ParseFunctionCall();
 	void ParseReturn();
+	void ParseImport();
 	
 	std::shared_ptr<CompilerNode> ParseExpression();
-	std::shared_ptr<CompilerNode> ParseRelationalExpression();
-	std::shared_ptr<CompilerNode> ParseAddExpression();
-	std::shared_ptr<CompilerNode> ParseMulExpression();
-	std::shared_ptr<CompilerNode> ParseUniExpression();
 	std::shared_ptr<CompilerNode> ParseTerm();
 	std::shared_ptr<CompilerNode> ParseFunctionCall(Token token);
 
+	// The shared nodes a checked expression is made of, see Compiler::Check
+	static std::shared_ptr<CompilerNode> GetCheckedTerm(std::string expression, std::string value);
+	static std::shared_ptr<CompilerNode> GetCheckedNode(std::shared_ptr<CompilerNode> left, std::shared_ptr<CompilerNode> right);
+
 private:
 	Compiler* compiler;
+	bool checking;
+
+	void Reduce(std::vector<std::shared_ptr<CompilerNode>>& operands, std::vector<Token>& operators, size_t group);
+	std::shared_ptr<CompilerNode> MakeBinaryNode(Token binaryOp, std::shared_ptr<CompilerNode> left, std::shared_ptr<CompilerNode> right);
+	std::shared_ptr<CompilerNode> ParsePostfix(std::shared_ptr<CompilerNode> term);
 
+	static int GetPrecedence(MyTokenType type);
 	bool IsNextTokenUniOp();
-	bool IsNextTokenMulOp();
-	bool IsNextTokenAddOp();
-	bool IsNextTokenRelationalOp();
-	bool IsNextTokenLogicalOp();
 	bool IsNextTokenReturnType();
 	bool IsTokenReturnVarType(Token token);
 
-	Symbol* GetSymbol(std::string identifier);
+	Symbol* GetSymbol(Atom identifier);
 };
 
@@ -0,0 +1,440 @@
+#include "PartialEvaluator.h"
+#include "Symbol.h"
+#include <cstdlib>
+
+PartialEvaluator::PartialEvaluator(SubroutineTable* p_subroutines, PurityAnalysis* p_purity, int p_budget, NumericMode p_numericMode) : subroutines(p_subroutines), purity(p_purity), budget(p_budget), numericMode(p_numericMode)
+{
+}
+
+PartialEvaluator::~PartialEvaluator()
+{
+}
+
+std::shared_ptr<CompilerNode> PartialEvaluator::EvaluateStatement(std::shared_ptr<CompilerNode> statement, Subroutine* subroutine)
+{
+	std::vector<std::shared_ptr<CompilerNode>> parameters = statement->GetNodeparameters();
+	if (statement->GetExpression() != "$assignment" || parameters.size() != 2 || parameters.at(1) == nullptr || !HasCall(parameters.at(1)))
+		return statement;
+
+	std::shared_ptr<CompilerNode> value = Fold(parameters.at(1), subroutine, statement);
+	if (value == parameters.at(1))
+		return statement;
+
+	statements++;
+	parameters.at(1) = value;
+	return std::make_shared<CompilerNode>(statement->GetExpression(), statement->GetValue(), parameters, statement->GetJumpTo(), false);
+}
+
+int PartialEvaluator::Evaluate(Subroutine* subroutine, std::map<CompilerNode*, std::shared_ptr<CompilerNode>>& replacements)
+{
+	std::shared_ptr<LinkedList> nodes = subroutine->GetCompilerNodeCollection();
+	std::vector<std::shared_ptr<ListNode>> listNodes;
+	for (std::shared_ptr<ListNode> listNode = nodes->GetHead(); listNode && listNode->GetData(); listNode = listNode->GetNext())
+		listNodes.push_back(listNode);
+
+	int replaced = 0;
+	for (std::shared_ptr<ListNode> listNode : listNodes)
+	{
+		std::shared_ptr<CompilerNode> node = listNode->GetData();
+		std::shared_ptr<CompilerNode> replacement = EvaluateStatement(node, subroutine);
+		if (replacement != node)
+		{
+			listNode->SetData(replacement);
+			replacements[node.get()] = replacement;
+			replacedNodes.push_back(node);
+			replaced++;
+		}
+	}
+
+	for (std::shared_ptr<ListNode> listNode : listNodes)
+	{
+		std::shared_ptr<CompilerNode> jumpTo = listNode->GetData()->GetJumpTo();
+		auto replacement = jumpTo != nullptr ? replacements.find(jumpTo.get()) : replacements.end();
+		if (replacement != replacements.end())
+			listNode->GetData()->SetJumpTo(replacement->second);
+	}
+	return replaced;
+}
+
+// The largest constant parts with a call are run, the parts the sandbox can't run are split up
+std::shared_ptr<CompilerNode> PartialEvaluator::Fold(std::shared_ptr<CompilerNode> node, Subroutine* subroutine, std::shared_ptr<CompilerNode> statement)
+{
+	std::set<CompilerNode*> withCalls;
+	std::set<CompilerNode*> constants;
+	Classify(node, subroutine, withCalls, constants);
+
+	return CompilerNode::Rewrite(node, [&](std::shared_ptr<CompilerNode> part, std::shared_ptr<CompilerNode>) -> std::shared_ptr<CompilerNode> {
+		if (withCalls.count(part.get()) == 0)
+			return part;
+		if (constants.count(part.get()) == 0)
+			return nullptr;
+
+		frames.assign(1, std::map<std::string, long double>());
+		callStack.clear();
+		if (subroutine != nullptr)
+			callStack.push_back(subroutine->name);
+		steps = 0;
+		error = JitError::None;
+
+		std::string text;
+		Outcome outcome = Run(part, text);
+		if (outcome == Outcome::Value)
+		{
+			evaluated++;
+			return std::make_shared<CompilerNode>("$value", text, false);
+		}
+		if (outcome == Outcome::Failed)
+		{
+			failures.push_back({ statement, GetCallName(part), error });
+			return part;
+		}
+		return nullptr;
+	});
+}
+
+// From the leaves up, the nodes with a call and the constant ones: no variables and only
+// calls of pure functions that don't come back to this one
+void PartialEvaluator::Classify(std::shared_ptr<CompilerNode> node, Subroutine* subroutine, std::set<CompilerNode*>& withCalls, std::set<CompilerNode*>& constants)
+{
+	CompilerNode::Rewrite(node, nullptr, [&](std::shared_ptr<CompilerNode> part, std::vector<std::shared_ptr<CompilerNode>>& parameters, bool) {
+		std::string expression = part->GetExpression();
+		bool constant = expression != "$getVariable";
+		bool call = expression == "$functionCall";
+
+		size_t first = 0;
+		if (call)
+		{
+			Subroutine* callee = subroutines->GetSubroutine(GetCallName(part));
+			if (callee == nullptr || !callee->isPure || (int)parameters.size() - 1 != callee->GetSymbolTable()->ParameterSize())
+				constant = false;
+			else if (subroutine != nullptr && (callee->name == subroutine->name || purity->CanReach(callee->name, subroutine->name)))
+				constant = false;
+			first = 1;
+		}
+
+		for (size_t i = 0; i < parameters.size(); i++)
+		{
+			if (parameters.at(i) == nullptr)
+				continue;
+			call = call || withCalls.count(parameters.at(i).get()) > 0;
+			constant = constant && (i < first || constants.count(parameters.at(i).get()) > 0);
+		}
+
+		if (call)
+			withCalls.insert(part.get());
+		if (constant)
+			constants.insert(part.get());
+		return part;
+	});
+}
+
+bool PartialEvaluator::HasCall(std::shared_ptr<CompilerNode> node)
+{
+	std::vector<std::shared_ptr<CompilerNode>> work;
+	work.push_back(node);
+	while (!work.empty())
+	{
+		node = work.back();
+		work.pop_back();
+		if (node == nullptr)
+			continue;
+		if (node->GetExpression() == "$functionCall")
+			return true;
+
+		std::vector<std::shared_ptr<CompilerNode>> parameters = node->GetNodeparameters();
+		work.insert(work.end(), parameters.begin(), parameters.end());
+	}
+	return false;
+}
+
+// The operands are run in order like CheckParameters does, the operations that wait for
+// theirs are kept on a stack of their own
+PartialEvaluator::Outcome PartialEvaluator::Run(std::shared_ptr<CompilerNode> node, std::string& text)
+{
+	struct Operation
+	{
+		std::string expression;
+		std::vector<std::shared_ptr<CompilerNode>> parameters;
+		std::vector<std::string> texts;
+	};
+	std::vector<Operation> operations;
+
+	while (true)
+	{
+		std::string result;
+		Outcome outcome;
+		std::string expression = node != nullptr ? node->GetExpression() : "";
+		if (node == nullptr)
+			outcome = Outcome::Unknown;
+		else if (expression == "$value")
+		{
+			result = node->GetValue();
+			outcome = Outcome::Value;
+		}
+		else if (expression == "$getVariable")
+		{
+			auto local = frames.back().find(node->GetValue());
+			if (local == frames.back().end())
+				return Outcome::Unknown;
+
+			result = JitRuntime::ToString(local->second);
+			outcome = Outcome::Value;
+		}
+		else if (expression == "$functionCall")
+			outcome = RunCall(node, result);
+		else
+		{
+			operations.push_back({ expression, node->GetNodeparameters(), std::vector<std::string>() });
+			if (!operations.back().parameters.empty())
+			{
+				node = operations.back().parameters.at(0);
+				continue;
+			}
+			outcome = Apply(expression, operations.back().texts, result);
+			operations.pop_back();
+		}
+
+		// Give the value to the operations that wait for it, until one needs its next operand
+		while (true)
+		{
+			if (outcome != Outcome::Value || operations.empty())
+			{
+				if (outcome == Outcome::Value)
+					text = result;
+				return outcome;
+			}
+
+			Operation& operation = operations.back();
+			operation.texts.push_back(result);
+
+			// $or doesn't run the second operand when the first is true
+			bool shortCircuit = operation.expression == "$or" && result == "1";
+			if (!shortCircuit && operation.texts.size() < operation.parameters.size())
+			{
+				node = operation.parameters.at(operation.texts.size());
+				break;
+			}
+
+			outcome = Apply(operation.expression, operation.texts, result);
+			operations.pop_back();
+		}
+	}
+}
+
+// An operation on the texts of its operands
+PartialEvaluator::Outcome PartialEvaluator::Apply(std::string expression, const std::vector<std::string>& texts, std::string& text)
+{
+	if (expression == "$or" || expression == "$and")
+	{
+		if (texts.size() == 1 && expression == "$or")
+			text = JitRuntime::ToString(true);
+		else if (texts.size() == 2)
+			text = JitRuntime::ToString(expression == "$or" ? texts.at(1) == "1" : texts.at(0) == "1" && texts.at(1) == "1");
+		else
+			return Outcome::Unknown;
+		return Outcome::Value;
+	}
+
+	std::vector<double> numbers;
+	for (std::string operand : texts)
+		numbers.push_back(atof(operand.c_str()));
+
+	if (IsCompare(expression))
+	{
+		if (numbers.size() != 2)
+			return Outcome::Unknown;
+
+		bool result;
+		if (expression == "$less")
+			result = numbers.at(0) < numbers.at(1);
+		else if (expression == "$lessOrEq")
+			result = numbers.at(0) <= numbers.at(1);
+		else if (expression == "$greater")
+			result = numbers.at(0) > numbers.at(1);
+		else if (expression == "$greaterOrEq")
+			result = numbers.at(0) >= numbers.at(1);
+		else if (expression == "$equals")
+			result = numbers.at(0) == numbers.at(1);
+		else
+			result = numbers.at(0) != numbers.at(1);
+
+		text = JitRuntime::ToString(result);
+		return Outcome::Value;
+	}
+
+	JitError builtinError;
+	if (!JitRuntime::Evaluate(expression, numbers, numericMode, text, builtinError))
+		return Outcome::Unknown;
+	if (builtinError != JitError::None)
+	{
+		error = builtinError;
+		return Outcome::Failed;
+	}
+	return Outcome::Value;
+}
+
+// Evaluate the arguments in the frame of the caller and run the body in a new one, like ExecuteFunction
+PartialEvaluator::Outcome PartialEvaluator::RunCall(std::shared_ptr<CompilerNode> node, std::string& text)
+{
+	std::string name = GetCallName(node);
+	Subroutine* callee = subroutines->GetSubroutine(name);
+	std::vector<std::shared_ptr<CompilerNode>> arguments = node->GetNodeparameters();
+	if (callee == nullptr || !callee->isPure || (int)arguments.size() - 1 != callee->GetSymbolTable()->ParameterSize())
+		return Outcome::Unknown;
+
+	// Recursion is left to the VirtualMachine, it would mostly run out of budget here
+	for (std::string caller : callStack)
+	{
+		if (caller == name)
+			return Outcome::Unknown;
+	}
+
+	std::vector<Symbol*> parameters = callee->GetSymbolTable()->GetSymbolVector();
+	std::map<std::string, long double> frame;
+	for (size_t i = 0; i < parameters.size(); i++)
+	{
+		std::string argument;
+		Outcome outcome = Run(arguments.at(i + 1), argument);
+		if (outcome != Outcome::Value)
+			return outcome;
+		frame[parameters.at(i)->name] = atof(argument.c_str());
+	}
+
+	frames.push_back(frame);
+	callStack.push_back(name);
+	Outcome outcome = RunBody(callee, text);
+	callStack.pop_back();
+	frames.pop_back();
+	return outcome;
+}
+
+PartialEvaluator::Outcome PartialEvaluator::RunBody(Subroutine* subroutine, std::string& text)
+{
+	std::vector<std::shared_ptr<CompilerNode>> body;
+	std::map<CompilerNode*, size_t> indexes;
+	for (std::shared_ptr<ListNode> listNode = subroutine->GetCompilerNodeCollection()->GetHead(); listNode && listNode->GetData(); listNode = listNode->GetNext())
+	{
+		indexes[listNode->GetData().get()] = body.size();
+		body.push_back(listNode->GetData());
+	}
+
+	size_t i = 0;
+	while (i < body.size())
+	{
+		if (++steps > budget)
+			return Outcome::Unknown;
+
+		std::shared_ptr<CompilerNode> node = body.at(i);
+		std::string expression = node->GetExpression();
+		std::vector<std::shared_ptr<CompilerNode>> parameters = node->GetNodeparameters();
+		std::shared_ptr<CompilerNode> jumpTo = node->GetJumpTo();
+		auto target = jumpTo != nullptr ? indexes.find(jumpTo.get()) : indexes.end();
+		if (jumpTo != nullptr && target == indexes.end())
+			return Outcome::Unknown;
+
+		std::string result;
+		if (expression == "$assignment")
+		{
+			if (parameters.size() != 2 || parameters.at(0) == nullptr)
+				return Outcome::Unknown;
+
+			Outcome outcome = Run(parameters.at(1), result);
+			if (outcome != Outcome::Value)
+				return outcome;
+
+			if (!subroutine->HasLocal(parameters.at(0)->GetValue()))
+				return Outcome::Unknown;
+			frames.back()[parameters.at(0)->GetValue()] = atof(result.c_str());
+			i++;
+		}
+		else if (expression == "$if" || expression == "$whileLoop")
+		{
+			if (parameters.size() != 1)
+				return Outcome::Unknown;
+
+			Outcome outcome = Run(parameters.at(0), result);
+			if (outcome != Outcome::Value)
+				return outcome;
+
+			// On false both continue after the node they jump to
+			if (!result.empty() && result[0] == '1')
+				i++;
+			else if (jumpTo != nullptr)
+				i = target->second + 1;
+			else
+				return Outcome::Unknown;
+		}
+		else if (expression == "$doNothing")
+			i = jumpTo != nullptr ? target->second : i + 1;
+		else if (expression == "$ret")
+		{
+			if (parameters.size() != 1)
+				return Outcome::Unknown;
+			return Run(parameters.at(0), text);
+		}
+		else if (expression == "$functionCall")
+		{
+			Outcome outcome = Run(node, result);
+			if (outcome != Outcome::Value)
+				return outcome;
+			i++;
+		}
+		else
+			return Outcome::Unknown;
+	}
+
+	// Without a ret the VirtualMachine has no value for the caller
+	return Outcome::Unknown;
+}
+
+// The first call in the order the VirtualMachine runs them
+std::string PartialEvaluator::GetCallName(std::shared_ptr<CompilerNode> node)
+{
+	std::vector<std::shared_ptr<CompilerNode>> work;
+	work.push_back(node);
+	while (!work.empty())
+	{
+		node = work.back();
+		work.pop_back();
+		if (node == nullptr)
+			continue;
+
+		std::vector<std::shared_ptr<CompilerNode>> parameters = node->GetNodeparameters();
+		if (node->GetExpression() == "$functionCall")
+			return !parameters.empty() && parameters.at(0) != nullptr ? parameters.at(0)->GetValue() : "";
+
+		work.insert(work.end(), parameters.rbegin(), parameters.rend());
+	}
+	return "";
+}
+
+bool PartialEvaluator::IsCompare(std::string expression)
+{
+	return expression == "$less" || expression == "$lessOrEq" || expression == "$greater"
+		|| expression == "$greaterOrEq" || expression == "$equals" || expression == "$notEquals";
+}
+
+std::vector<PartialEvaluator::Failure> PartialEvaluator::GetFailures()
+{
+	return failures;
+}
+
+std::string PartialEvaluator::GetErrorText(JitError error)
+{
+	switch (error)
+	{
+	case JitError::DivideByZero:
+	case JitError::DivisionByZero:
+		return "it divides by zero";
+	case JitError::InvalidInput:
+		return "it gives a builtin an invalid number";
+	default:
+		return "it fails";
+	}
+}
+
+std::string PartialEvaluator::GetReport()
+{
+	return "Partial evaluation: " + std::to_string(evaluated) + " constant expressions with calls evaluated in "
+		+ std::to_string(statements) + " statements";
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "CompilerNode.h"
+#include "JitRuntime.h"
+#include "LinkedList.h"
+#include "PurityAnalysis.h"
+#include "Subroutine.h"
+#include "SubroutineTable.h"
+
+// Runs calls of pure functions with constant arguments while compiling:
+//
+//   func float poly(x | y)
+//   [
+//       ret sqr(x) + 2 * x * y + sqr(y);
+//   ]
+//
+//   var table = poly(3 | 4);    ->    var table = 49.00000000000000;
+//
+// The calls run in a sandbox: an interpreter of its own that does exactly
+// what the VirtualMachine does with the text of every value, but on its own
+// copy of the locals, without ever touching the symboltables. It gives up on
+// anything it doesn't know, a global, a builtin without a JitRuntime helper or
+// recursion, and after a budget of statements. Only the value of an
+// assignment is evaluated. A call that would throw is left in place and
+// reported.
+class PartialEvaluator
+{
+public:
+	// A call with constant arguments that would throw
+	struct Failure
+	{
+		std::shared_ptr<CompilerNode> statement;
+		std::string call;
+		JitError error;
+	};
+
+	PartialEvaluator(SubroutineTable* p_subroutines, PurityAnalysis* p_purity, int p_budget, NumericMode p_numericMode);
+	virtual ~PartialEvaluator();
+
+	// The statement with its constant calls replaced by their values, subroutine is nullptr for a global
+	std::shared_ptr<CompilerNode> EvaluateStatement(std::shared_ptr<CompilerNode> statement, Subroutine* subroutine);
+
+	// Evaluate every statement of a subroutine, the jumps follow the new statements
+	int Evaluate(Subroutine* subroutine, std::map<CompilerNode*, std::shared_ptr<CompilerNode>>& replacements);
+
+	std::vector<Failure> GetFailures();
+	std::string GetReport();
+
+	static std::string GetErrorText(JitError error);
+
+private:
+	enum class Outcome
+	{
+		Value,
+		Unknown,	// the sandbox can't run it, the VirtualMachine has to
+		Failed		// it would throw
+	};
+
+	SubroutineTable* subroutines;
+	PurityAnalysis* purity;
+	int budget;
+	NumericMode numericMode;
+	int evaluated = 0;
+	int statements = 0;
+
+	std::vector<Failure> failures;
+
+	// Keep the replaced statements alive, jumps only hold a weak pointer to them
+	std::vector<std::shared_ptr<CompilerNode>> replacedNodes;
+
+	// The sandbox, every call has its own locals like in the VirtualMachine
+	std::vector<std::map<std::string, long double>> frames;
+	std::vector<std::string> callStack;
+	int steps = 0;
+	JitError error = JitError::None;
+
+	std::shared_ptr<CompilerNode> Fold(std::shared_ptr<CompilerNode> node, Subroutine* subroutine, std::shared_ptr<CompilerNode> statement);
+	void Classify(std::shared_ptr<CompilerNode> node, Subroutine* subroutine, std::set<CompilerNode*>& withCalls, std::set<CompilerNode*>& constants);
+	bool HasCall(std::shared_ptr<CompilerNode> node);
+
+	Outcome Run(std::shared_ptr<CompilerNode> node, std::string& text);
+	Outcome Apply(std::string expression, const std::vector<std::string>& texts, std::string& text);
+	Outcome RunCall(std::shared_ptr<CompilerNode> node, std::string& text);
+	Outcome RunBody(Subroutine* subroutine, std::string& text);
+
+	static std::string GetCallName(std::shared_ptr<CompilerNode> node);
+	static bool IsCompare(std::string expression);
+};
@@ -0,0 +1,464 @@
+#include "ProgramCache.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <sstream>
+#include <boost/filesystem.hpp>
+#include <QDir>
+#include <QStandardPaths>
+
+const char* ProgramCache::DefaultDirectory = "Program cache";
+// 2: the parallel parse, the incremental cache, the modules and the builtin table
+const char* ProgramCache::CompilerVersion = "short-c 2";
+
+CompiledProgram::CompiledProgram()
+{
+}
+
+CompiledProgram::CompiledProgram(SymbolTable* p_symbolTable, SubroutineTable* p_subroutineTable, std::list<std::shared_ptr<CompilerNode>> p_compilerNodes) : symbolTable(*p_symbolTable), subroutineTable(*p_subroutineTable), compilerNodes(p_compilerNodes)
+{
+}
+
+ProgramCache::ProgramCache(std::string p_directory, uint64_t p_capacity) : directory(p_directory), capacity(p_capacity)
+{
+}
+
+ProgramCache::~ProgramCache()
+{
+}
+
+std::string ProgramCache::GetUserDirectory()
+{
+	QString directory = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+	if (directory.isEmpty())
+		return DefaultDirectory;
+	return QDir(directory).filePath(DefaultDirectory).toStdString();
+}
+
+// FNV-1a over the version, the options and the source
+std::string ProgramCache::GetKey(const std::string& source, const CompilerOptions& options)
+{
+	std::string text = std::string(CompilerVersion) + '\0' + GetOptionsText(options) + '\0' + source;
+
+	uint64_t hash = 14695981039346656037ull;
+	for (unsigned char character : text)
+	{
+		hash ^= character;
+		hash *= 1099511628211ull;
+	}
+
+	char key[17];
+	snprintf(key, sizeof(key), "%016llx", (unsigned long long)hash);
+	return key;
+}
+
+// Every option changes what the passes make of the nodes
+std::string ProgramCache::GetOptionsText(const CompilerOptions& options)
+{
+	std::ostringstream text;
+	text << options.evaluateCalls << options.evaluationBudget << options.analyzePurity << ' '
+		<< options.eliminateTailCalls << options.inlineFunctions << options.inlineLimit << ' '
+		<< options.hoistInvariants << options.reduceStrength << options.fastMath
+		<< (int)options.numericMode << options.fuseInstructions << options.simplifyControlFlow
+		<< options.inferIntegers << options.internExpressions << options.buildIr << options.verifyIr;
+	return text.str();
+}
+
+std::string ProgramCache::GetPath(const std::string& key)
+{
+	return (boost::filesystem::path(directory) / (key + ".scc")).string();
+}
+
+std::shared_ptr<CompiledProgram> ProgramCache::Load(const std::string& key)
+{
+	std::string path = GetPath(key);
+	std::ifstream file(path, std::ios::binary);
+	if (!file)
+		return nullptr;
+
+	std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	file.close();
+
+	boost::system::error_code error;
+	std::shared_ptr<CompiledProgram> program = Deserialize(data);
+	if (program == nullptr)
+	{
+		// Written by another version or cut off, it is never going to be read
+		boost::filesystem::remove(path, error);
+		return nullptr;
+	}
+
+	// Used now, so it is the last to be evicted
+	boost::filesystem::last_write_time(path, std::time(nullptr), error);
+	return program;
+}
+
+bool ProgramCache::Store(const std::string& key, CompiledProgram& program)
+{
+	boost::system::error_code error;
+	boost::filesystem::create_directories(directory, error);
+	if (error)
+		return false;
+
+	// Write to a file of its own first, another run can be reading the same key
+	std::string path = GetPath(key);
+	std::string temporary = (boost::filesystem::path(directory) / boost::filesystem::unique_path("%%%%-%%%%-%%%%.tmp")).string();
+	std::string data = Serialize(program);
+
+	std::ofstream file(temporary, std::ios::binary);
+	file.write(data.data(), data.size());
+	file.close();
+	if (!file)
+	{
+		boost::filesystem::remove(temporary, error);
+		return false;
+	}
+
+	boost::filesystem::rename(temporary, path, error);
+	if (error)
+	{
+		boost::filesystem::remove(temporary, error);
+		return false;
+	}
+
+	Evict();
+	return true;
+}
+
+// Remove the least recently used files until the rest fits the capacity
+void ProgramCache::Evict()
+{
+	std::vector<std::pair<std::time_t, boost::filesystem::path>> files;
+	uint64_t size = 0;
+
+	boost::system::error_code error;
+	for (boost::filesystem::directory_iterator it(directory, error), end; !error && it != end; it.increment(error))
+	{
+		boost::filesystem::path path = it->path();
+		if (path.extension() != ".scc")
+			continue;
+
+		boost::system::error_code fileError;
+		uint64_t fileSize = boost::filesystem::file_size(path, fileError);
+		std::time_t time = boost::filesystem::last_write_time(path, fileError);
+		if (fileError)
+			continue;
+
+		size += fileSize;
+		files.push_back(std::make_pair(time, path));
+	}
+
+	std::sort(files.begin(), files.end());
+	for (auto file : files)
+	{
+		if (size <= capacity)
+			break;
+
+		boost::system::error_code fileError;
+		uint64_t fileSize = boost::filesystem::file_size(file.second, fileError);
+		if (!fileError && boost::filesystem::remove(file.second, fileError))
+			size -= fileSize;
+	}
+}
+
+std::string ProgramCache::Serialize(CompiledProgram& program)
+{
+	std::vector<Subroutine*> subroutines = program.subroutineTable.GetSubroutineVector();
+
+	// Every node the program can reach gets a number
+	std::list<std::shared_ptr<CompilerNode>> roots = program.compilerNodes;
+	for (Subroutine* subroutine : subroutines)
+	{
+		std::list<std::shared_ptr<CompilerNode>> body = GetBody(subroutine);
+		roots.insert(roots.end(), body.begin(), body.end());
+	}
+
+	std::vector<std::shared_ptr<CompilerNode>> nodes;
+	std::unordered_map<CompilerNode*, uint32_t> numbers;
+	CollectNodes(roots, nodes, numbers);
+
+	// The texts of the nodes, most of them are the same few expressions
+	std::vector<std::string> strings;
+	std::unordered_map<std::string, uint32_t> stringNumbers;
+	auto getString = [&strings, &stringNumbers](const std::string& text) {
+		auto found = stringNumbers.find(text);
+		if (found != stringNumbers.end())
+			return found->second;
+		uint32_t number = (uint32_t)strings.size();
+		stringNumbers[text] = number;
+		strings.push_back(text);
+		return number;
+	};
+
+	std::vector<std::pair<uint32_t, uint32_t>> texts;
+	for (std::shared_ptr<CompilerNode> node : nodes)
+	{
+		uint32_t expression = getString(node->GetExpression());
+		texts.push_back(std::make_pair(expression, getString(node->GetValue())));
+	}
+
+	std::string data = "SCPC";
+	WriteInt(data, FormatVersion);
+	WriteString(data, CompilerVersion);
+	WriteInt(data, sizeof(long double));
+
+	WriteInt(data, (uint32_t)strings.size());
+	for (std::string text : strings)
+		WriteString(data, text);
+
+	WriteInt(data, (uint32_t)nodes.size());
+	for (size_t i = 0; i < nodes.size(); i++)
+	{
+		WriteInt(data, texts[i].first);
+		WriteInt(data, texts[i].second);
+		WriteInt(data, nodes[i]->IsIntegral() ? 1 : 0);
+
+		std::vector<std::shared_ptr<CompilerNode>> parameters = nodes[i]->GetNodeparameters();
+		WriteInt(data, (uint32_t)parameters.size());
+		for (std::shared_ptr<CompilerNode> parameter : parameters)
+			WriteInt(data, parameter != nullptr ? numbers[parameter.get()] + 1 : 0);
+
+		std::shared_ptr<CompilerNode> jump = nodes[i]->GetJumpTo();
+		WriteInt(data, jump != nullptr ? numbers[jump.get()] + 1 : 0);
+	}
+
+	WriteSymbols(data, &program.symbolTable);
+	WriteNodes(data, program.compilerNodes, numbers);
+
+	WriteInt(data, (uint32_t)subroutines.size());
+	for (Subroutine* subroutine : subroutines)
+	{
+		WriteString(data, subroutine->name);
+		WriteInt(data, (uint32_t)subroutine->kind);
+		WriteInt(data, (uint32_t)subroutine->returnType);
+		WriteInt(data, subroutine->isEmpty ? 1 : 0);
+		WriteInt(data, subroutine->isPure ? 1 : 0);
+		WriteSymbols(data, subroutine->GetSymbolTable());
+		WriteNodes(data, GetBody(subroutine), numbers);
+	}
+
+	return data;
+}
+
+std::shared_ptr<CompiledProgram> ProgramCache::Deserialize(const std::string& data)
+{
+	size_t position = 4;
+	uint32_t version;
+	std::string compilerVersion;
+	uint32_t longDoubleSize;
+	if (data.size() < 4 || data.compare(0, 4, "SCPC") != 0 || !ReadInt(data, position, version) || version != FormatVersion
+		|| !ReadString(data, position, compilerVersion) || compilerVersion != CompilerVersion
+		|| !ReadInt(data, position, longDoubleSize) || longDoubleSize != sizeof(long double))
+		return nullptr;
+
+	uint32_t count;
+	std::vector<std::string> strings;
+	if (!ReadInt(data, position, count))
+		return nullptr;
+	for (uint32_t i = 0; i < count; i++)
+	{
+		std::string text;
+		if (!ReadString(data, position, text))
+			return nullptr;
+		strings.push_back(text);
+	}
+
+	// A parameter or a jump can be a node that comes later, they are set when all nodes exist
+	std::vector<std::shared_ptr<CompilerNode>> nodes;
+	std::vector<std::vector<uint32_t>> parameters;
+	std::vector<uint32_t> jumps;
+	if (!ReadInt(data, position, count))
+		return nullptr;
+	for (uint32_t i = 0; i < count; i++)
+	{
+		uint32_t expression, value, integral, parameterCount, jump;
+		if (!ReadInt(data, position, expression) || !ReadInt(data, position, value) || !ReadInt(data, position, integral)
+			|| !ReadInt(data, position, parameterCount) || expression >= strings.size() || value >= strings.size())
+			return nullptr;
+
+		std::vector<uint32_t> nodeParameters;
+		for (uint32_t j = 0; j < parameterCount; j++)
+		{
+			uint32_t parameter;
+			if (!ReadInt(data, position, parameter) || parameter > count)
+				return nullptr;
+			nodeParameters.push_back(parameter);
+		}
+		if (!ReadInt(data, position, jump) || jump > count)
+			return nullptr;
+
+		std::shared_ptr<CompilerNode> node = std::make_shared<CompilerNode>(strings[expression], strings[value], false);
+		node->SetIntegral(integral != 0);
+		nodes.push_back(node);
+		parameters.push_back(nodeParameters);
+		jumps.push_back(jump);
+	}
+
+	for (size_t i = 0; i < nodes.size(); i++)
+	{
+		std::vector<std::shared_ptr<CompilerNode>> nodeParameters;
+		for (uint32_t parameter : parameters[i])
+			nodeParameters.push_back(parameter > 0 ? nodes[parameter - 1] : nullptr);
+		nodes[i]->SetNodeParameters(nodeParameters);
+
+		if (jumps[i] > 0)
+			nodes[i]->SetJumpTo(nodes[jumps[i] - 1]);
+	}
+
+	std::shared_ptr<CompiledProgram> program = std::make_shared<CompiledProgram>();
+	if (!ReadSymbols(data, position, program->symbolTable) || !ReadNodes(data, position, nodes, program->compilerNodes))
+		return nullptr;
+
+	if (!ReadInt(data, position, count))
+		return nullptr;
+	for (uint32_t i = 0; i < count; i++)
+	{
+		std::string name;
+		uint32_t kind, returnType, isEmpty, isPure;
+		SymbolTable symbolTable;
+		std::list<std::shared_ptr<CompilerNode>> body;
+		if (!ReadString(data, position, name) || !ReadInt(data, position, kind) || !ReadInt(data, position, returnType)
+			|| !ReadInt(data, position, isEmpty) || !ReadInt(data, position, isPure)
+			|| !ReadSymbols(data, position, symbolTable) || !ReadNodes(data, position, nodes, body))
+			return nullptr;
+
+		Subroutine subroutine(name, (MyTokenType)returnType, (SubroutineKind)kind, symbolTable);
+		subroutine.isEmpty = isEmpty != 0;
+		subroutine.isPure = isPure != 0;
+		for (std::shared_ptr<CompilerNode> node : body)
+			subroutine.AddCompilerNode(node);
+		program->subroutineTable.AddSubroutine(subroutine);
+	}
+
+	if (position != data.size())
+		return nullptr;
+	return program;
+}
+
+std::list<std::shared_ptr<CompilerNode>> ProgramCache::GetBody(Subroutine* subroutine)
+{
+	std::list<std::shared_ptr<CompilerNode>> body;
+	for (std::shared_ptr<ListNode> listNode = subroutine->GetCompilerNodeCollection()->GetHead(); listNode && listNode->GetData(); listNode = listNode->GetNext())
+		body.push_back(listNode->GetData());
+	return body;
+}
+
+// Numbers the nodes in the order they are found, the children and the jumps too
+void ProgramCache::CollectNodes(std::list<std::shared_ptr<CompilerNode>> roots, std::vector<std::shared_ptr<CompilerNode>>& nodes, std::unordered_map<CompilerNode*, uint32_t>& numbers)
+{
+	// A stack instead of recursion, an expression is as deep as it is long
+	std::vector<std::shared_ptr<CompilerNode>> pending(roots.rbegin(), roots.rend());
+	while (!pending.empty())
+	{
+		std::shared_ptr<CompilerNode> node = pending.back();
+		pending.pop_back();
+		if (node == nullptr || numbers.count(node.get()) > 0)
+			continue;
+
+		numbers[node.get()] = (uint32_t)nodes.size();
+		nodes.push_back(node);
+
+		std::shared_ptr<CompilerNode> jump = node->GetJumpTo();
+		if (jump != nullptr)
+			pending.push_back(jump);
+
+		std::vector<std::shared_ptr<CompilerNode>> parameters = node->GetNodeparameters();
+		pending.insert(pending.end(), parameters.rbegin(), parameters.rend());
+	}
+}
+
+void ProgramCache::WriteInt(std::string& data, uint32_t value)
+{
+	data.append((const char*)&value, sizeof(value));
+}
+
+void ProgramCache::WriteString(std::string& data, const std::string& text)
+{
+	WriteInt(data, (uint32_t)text.size());
+	data.append(text);
+}
+
+void ProgramCache::WriteSymbols(std::string& data, SymbolTable* symbolTable)
+{
+	std::vector<Symbol*> symbols = symbolTable->GetAllSymbolVector();
+	WriteInt(data, (uint32_t)symbols.size());
+	for (Symbol* symbol : symbols)
+	{
+		WriteString(data, symbol->name);
+		WriteInt(data, (uint32_t)symbol->type);
+		WriteInt(data, (uint32_t)symbol->kind);
+		WriteInt(data, symbol->IsSet() ? 1 : 0);
+
+		long double value = symbol->GetValue();
+		data.append((const char*)&value, sizeof(value));
+	}
+}
+
+void ProgramCache::WriteNodes(std::string& data, std::list<std::shared_ptr<CompilerNode>> nodes, std::unordered_map<CompilerNode*, uint32_t>& numbers)
+{
+	WriteInt(data, (uint32_t)nodes.size());
+	for (std::shared_ptr<CompilerNode> node : nodes)
+		WriteInt(data, node != nullptr ? numbers[node.get()] + 1 : 0);
+}
+
+bool ProgramCache::ReadInt(const std::string& data, size_t& position, uint32_t& value)
+{
+	if (data.size() - position < sizeof(value))
+		return false;
+	memcpy(&value, data.data() + position, sizeof(value));
+	position += sizeof(value);
+	return true;
+}
+
+bool ProgramCache::ReadString(const std::string& data, size_t& position, std::string& text)
+{
+	uint32_t length;
+	if (!ReadInt(data, position, length) || data.size() - position < length)
+		return false;
+	text = data.substr(position, length);
+	position += length;
+	return true;
+}
+
+bool ProgramCache::ReadSymbols(const std::string& data, size_t& position, SymbolTable& symbolTable)
+{
+	uint32_t count;
+	if (!ReadInt(data, position, count))
+		return false;
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		std::string name;
+		uint32_t type, kind, isSet;
+		long double value;
+		if (!ReadString(data, position, name) || !ReadInt(data, position, type) || !ReadInt(data, position, kind)
+			|| !ReadInt(data, position, isSet) || data.size() - position < sizeof(value))
+			return false;
+		memcpy(&value, data.data() + position, sizeof(value));
+		position += sizeof(value);
+
+		Symbol symbol(name, (MyTokenType)type, (SymbolKind)kind);
+		if (isSet != 0)
+			symbol.SetValue(value);
+		symbolTable.AddSymbol(symbol);
+	}
+	return true;
+}
+
+bool ProgramCache::ReadNodes(const std::string& data, size_t& position, const std::vector<std::shared_ptr<CompilerNode>>& nodes, std::list<std::shared_ptr<CompilerNode>>& list)
+{
+	uint32_t count;
+	if (!ReadInt(data, position, count))
+		return false;
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		uint32_t number;
+		if (!ReadInt(data, position, number) || number > nodes.size())
+			return false;
+		list.push_back(number > 0 ? nodes[number - 1] : nullptr);
+	}
+	return true;
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "CompilerNode.h"
+#include "CompilerOptions.h"
+#include "Subroutine.h"
+#include "SubroutineTable.h"
+#include "SymbolTable.h"
+
+// What the VirtualMachine needs of a compile, the tables and the global nodes
+struct CompiledProgram
+{
+	SymbolTable symbolTable;
+	SubroutineTable subroutineTable;
+	std::list<std::shared_ptr<CompilerNode>> compilerNodes;
+
+	CompiledProgram();
+	CompiledProgram(SymbolTable* p_symbolTable, SubroutineTable* p_subroutineTable, std::list<std::shared_ptr<CompilerNode>> p_compilerNodes);
+};
+
+// Compiled programs on disk, a Run of an unchanged source skips the tokenizer
+// and the compiler:
+//
+//   key = hash(CompilerVersion, options, source)  ->  Program cache/<key>.scc
+//
+//   header    "SCPC", FormatVersion, CompilerVersion, sizeof(long double)
+//   strings   every expression and value text once
+//   nodes     string of the expression, of the value, integral, parameters, jump
+//   globals   the symbols with their values, the global nodes
+//   functions name, kind, return type, pure, the symbols, the nodes
+//
+// The nodes refer to each other by their number, so a node the interner
+// shares and the target of a jump come back as one node. The names are
+// written as text and interned again when they are read. A file is read on
+// the machine that wrote it, the numbers are written as they are in memory.
+//
+// The key holds the CompilerVersion, a change of a pass that makes other
+// nodes of the same source bumps it and the old files are never read again.
+// They are the first to go, when the files together are larger than the
+// capacity the least recently used ones are removed.
+class ProgramCache
+{
+public:
+	static const char* DefaultDirectory;
+	static const char* CompilerVersion;
+	static const uint32_t FormatVersion = 1;
+
+	ProgramCache(std::string p_directory, uint64_t p_capacity);
+
+	// The DefaultDirectory in the cache location of the user, in the working directory when there is none
+	static std::string GetUserDirectory();
+	virtual ~ProgramCache();
+
+	static std::string GetKey(const std::string& source, const CompilerOptions& options);
+
+	// nullptr when the program isn't in the cache or its file can't be read
+	std::shared_ptr<CompiledProgram> Load(const std::string& key);
+	bool Store(const std::string& key, CompiledProgram& program);
+
+	static std::string Serialize(CompiledProgram& program);
+	static std::shared_ptr<CompiledProgram> Deserialize(const std::string& data);
+
+	// The options that change what the passes make of the nodes, as text
+	static std::string GetOptionsText(const CompilerOptions& options);
+
+private:
+	std::string directory;
+	uint64_t capacity;
+
+	std::string GetPath(const std::string& key);
+	void Evict();
+
+	static std::list<std::shared_ptr<CompilerNode>> GetBody(Subroutine* subroutine);
+	static void CollectNodes(std::list<std::shared_ptr<CompilerNode>> roots, std::vector<std::shared_ptr<CompilerNode>>& nodes, std::unordered_map<CompilerNode*, uint32_t>& numbers);
+	static void WriteInt(std::string& data, uint32_t value);
+	static void WriteString(std::string& data, const std::string& text);
+	static void WriteSymbols(std::string& data, SymbolTable* symbolTable);
+	static void WriteNodes(std::string& data, std::list<std::shared_ptr<CompilerNode>> nodes, std::unordered_map<CompilerNode*, uint32_t>& numbers);
+
+	static bool ReadInt(const std::string& data, size_t& position, uint32_t& value);
+	static bool ReadString(const std::string& data, size_t& position, std::string& text);
+	static bool ReadSymbols(const std::string& data, size_t& position, SymbolTable& symbolTable);
+	static bool ReadNodes(const std::string& data, size_t& position, const std::vector<std::shared_ptr<CompilerNode>>& nodes, std::list<std::shared_ptr<CompilerNode>>& list);
+};
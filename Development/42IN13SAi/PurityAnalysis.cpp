@@ -0,0 +1,208 @@
+#include "PurityAnalysis.h"
+#include "Builtins.h"
+#include "IrInstruction.h"
+#include "Symbol.h"
+
+PurityAnalysis::PurityAnalysis(SubroutineTable* p_subroutines) : subroutines(p_subroutines)
+{
+}
+
+PurityAnalysis::~PurityAnalysis()
+{
+}
+
+int PurityAnalysis::Analyze()
+{
+	std::vector<Subroutine*> subroutineVector = subroutines->GetSubroutineVector();
+	for (Subroutine* subroutine : subroutineVector)
+		reasons[subroutine->name] = CheckSubroutine(subroutine);
+
+	// A function is only pure when everything it calls is, check again until nothing changes
+	bool changed = true;
+	while (changed)
+	{
+		changed = false;
+		for (Subroutine* subroutine : subroutineVector)
+		{
+			if (!reasons[subroutine->name].empty())
+				continue;
+
+			for (std::string callee : calls[subroutine->name])
+			{
+				if (callee == subroutine->name)
+					continue;
+
+				std::string reason;
+				if (!subroutines->HasSubroutine(callee))
+					reason = "it calls " + callee + ", which doesn't exist";
+				else if (!reasons[callee].empty())
+					reason = "it calls " + callee + ", which isn't pure";
+
+				if (!reason.empty())
+				{
+					reasons[subroutine->name] = reason;
+					changed = true;
+					break;
+				}
+			}
+		}
+	}
+
+	int pure = 0;
+	for (Subroutine* subroutine : subroutineVector)
+	{
+		subroutine->isPure = reasons[subroutine->name].empty();
+		if (subroutine->isPure)
+			pure++;
+	}
+	return pure;
+}
+
+std::string PurityAnalysis::CheckSubroutine(Subroutine* subroutine)
+{
+	std::vector<std::shared_ptr<ListNode>> listNodes = GetListNodes(subroutine->GetCompilerNodeCollection());
+	if (listNodes.empty())
+		return "it is empty";
+
+	for (std::shared_ptr<ListNode> listNode : listNodes)
+	{
+		std::string reason = CheckStatement(subroutine, listNode->GetData());
+		if (!reason.empty())
+			return reason;
+	}
+	return "";
+}
+
+std::string PurityAnalysis::CheckStatement(Subroutine* subroutine, std::shared_ptr<CompilerNode> node)
+{
+	std::string expression = node->GetExpression();
+	std::vector<std::shared_ptr<CompilerNode>> parameters = node->GetNodeparameters();
+
+	const Builtin* builtin = Builtins::Find(expression);
+	if (builtin != nullptr && !builtin->pure)
+		return builtin->type == MyTokenType::Stop ? "it stops the program" : "it prints";
+	// The sandbox of the PartialEvaluator doesn't run a frl
+	if (expression == "$forLoop")
+		return "it has a frl";
+
+	if (expression == "$assignment")
+	{
+		if (parameters.size() != 2 || parameters.at(0) == nullptr || parameters.at(1) == nullptr)
+			return "it has an assignment without a value";
+		if (!subroutine->HasLocal(parameters.at(0)->GetValue()))
+			return "it assigns the global " + parameters.at(0)->GetValue();
+		return CheckExpression(subroutine, parameters.at(1));
+	}
+
+	if (expression == "$increment" || expression == "$decrement" || expression == "$addConstant" || expression == "$subtractConstant")
+	{
+		if (!subroutine->HasLocal(node->GetValue()))
+			return "it assigns the global " + node->GetValue();
+		return "";
+	}
+
+	if (expression != "$if" && expression != "$ifCompare" && expression != "$whileLoop" && expression != "$whileCompare"
+		&& expression != "$doNothing" && expression != "$ret")
+		return "it has a " + expression.substr(1);
+
+	for (std::shared_ptr<CompilerNode> parameter : parameters)
+	{
+		std::string reason = CheckExpression(subroutine, parameter);
+		if (!reason.empty())
+			return reason;
+	}
+	return "";
+}
+
+std::string PurityAnalysis::CheckExpression(Subroutine* subroutine, std::shared_ptr<CompilerNode> node)
+{
+	// A work list instead of recursion, a long expression is as deep as it has terms. The
+	// parameters go on in reverse so they come off in order and the first reason is the same
+	std::vector<std::shared_ptr<CompilerNode>> work;
+	work.push_back(node);
+	while (!work.empty())
+	{
+		node = work.back();
+		work.pop_back();
+		if (node == nullptr)
+			continue;
+
+		std::string expression = node->GetExpression();
+		std::vector<std::shared_ptr<CompilerNode>> parameters = node->GetNodeparameters();
+
+		if (expression == "$getVariable")
+		{
+			if (!subroutine->HasLocal(node->GetValue()))
+				return "it reads the global " + node->GetValue();
+			continue;
+		}
+
+		if (expression == "$functionCall")
+		{
+			if (parameters.empty() || parameters.at(0) == nullptr)
+				return "it has a call without a name";
+
+			calls[subroutine->name].insert(parameters.at(0)->GetValue());
+			work.insert(work.end(), parameters.rbegin(), parameters.rend() - 1);
+			continue;
+		}
+
+		// A pure builtin the IR has no instruction for is fine too
+		const Builtin* builtin = Builtins::Find(expression);
+		if (expression != "$value" && expression != "$mathe" && expression != "$mathpi" && expression != "$compare"
+			&& expression != "$and" && expression != "$or" && !IsCompare(expression) && !IrInstruction::IsBuiltin(expression) && !(builtin != nullptr && builtin->pure))
+			return "it uses " + expression.substr(1);
+
+		work.insert(work.end(), parameters.rbegin(), parameters.rend());
+	}
+	return "";
+}
+
+bool PurityAnalysis::CanReach(std::string from, std::string name)
+{
+	std::set<std::string> visited;
+	std::vector<std::string> work;
+	work.push_back(from);
+	while (!work.empty())
+	{
+		std::string callee = work.back();
+		work.pop_back();
+		if (callee == name)
+			return true;
+		if (!visited.insert(callee).second)
+			continue;
+
+		work.insert(work.end(), calls[callee].begin(), calls[callee].end());
+	}
+	return false;
+}
+
+bool PurityAnalysis::IsCompare(std::string expression)
+{
+	return expression == "$less" || expression == "$lessOrEq" || expression == "$greater"
+		|| expression == "$greaterOrEq" || expression == "$equals" || expression == "$notEquals";
+}
+
+std::vector<std::shared_ptr<ListNode>> PurityAnalysis::GetListNodes(std::shared_ptr<LinkedList> nodes)
+{
+	std::vector<std::shared_ptr<ListNode>> listNodes;
+	for (std::shared_ptr<ListNode> listNode = nodes->GetHead(); listNode && listNode->GetData(); listNode = listNode->GetNext())
+		listNodes.push_back(listNode);
+	return listNodes;
+}
+
+std::vector<std::string> PurityAnalysis::GetLog()
+{
+	std::vector<std::string> log;
+	std::string pure;
+	for (auto reason : reasons)
+	{
+		if (reason.second.empty())
+			pure += (pure.empty() ? "" : ", ") + reason.first;
+		else
+			log.push_back("Not pure: " + reason.first + ", " + reason.second);
+	}
+
+	log.push_back("Pure functions: " + (pure.empty() ? std::string("none") : pure));
+	return log;
+}
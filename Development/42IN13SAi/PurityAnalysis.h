@@ -0,0 +1,53 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "CompilerNode.h"
+#include "LinkedList.h"
+#include "Subroutine.h"
+#include "SubroutineTable.h"
+
+// Marks the functions whose result only depends on their arguments:
+//
+//   func float fib(n)                    pure, it reads n and calls itself
+//   [
+//       if (n < 2) [ ret n; ]
+//       ret fib(n - 1) + fib(n - 2);
+//   ]
+//
+// A pure function doesn't print, stop, read or assign globals or have a frl,
+// and it only calls builtins that always give the same result and other pure
+// functions. Every call starts with its own copy of the locals, so a call
+// with the same arguments always does the same.
+class PurityAnalysis
+{
+public:
+	PurityAnalysis(SubroutineTable* p_subroutines);
+	virtual ~PurityAnalysis();
+
+	// Set isPure on every subroutine, returns the number of pure ones
+	int Analyze();
+
+	std::vector<std::string> GetLog();
+
+	// Whether a call to from can end up calling name
+	bool CanReach(std::string from, std::string name);
+
+private:
+	SubroutineTable* subroutines;
+
+	// The functions called by every function and why a function isn't pure
+	std::map<std::string, std::set<std::string>> calls;
+	std::map<std::string, std::string> reasons;
+
+	std::string CheckSubroutine(Subroutine* subroutine);
+	std::string CheckStatement(Subroutine* subroutine, std::shared_ptr<CompilerNode> node);
+	std::string CheckExpression(Subroutine* subroutine, std::shared_ptr<CompilerNode> node);
+
+	static bool IsCompare(std::string expression);
+	static std::vector<std::shared_ptr<ListNode>> GetListNodes(std::shared_ptr<LinkedList> nodes);
+};
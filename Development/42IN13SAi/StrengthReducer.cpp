@@ -0,0 +1,194 @@
+#include "StrengthReducer.h"
+#include "JitRuntime.h"
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+
+StrengthReducer::StrengthReducer(bool p_fastMath, NumericMode p_numericMode) : fastMath(p_fastMath), numericMode(p_numericMode)
+{
+}
+
+StrengthReducer::~StrengthReducer()
+{
+}
+
+int StrengthReducer::Reduce(std::shared_ptr<LinkedList> nodes)
+{
+	int reductionsBefore = GetReductionCount();
+
+	// Keep the replaced nodes alive, jumps only hold a weak pointer to them
+	std::map<CompilerNode*, std::shared_ptr<CompilerNode>> replacements;
+	std::vector<std::shared_ptr<CompilerNode>> replacedNodes;
+
+	for (std::shared_ptr<ListNode> listNode = nodes->GetHead(); listNode && listNode->GetData(); listNode = listNode->GetNext())
+	{
+		std::shared_ptr<CompilerNode> node = listNode->GetData();
+		std::shared_ptr<CompilerNode> reduced = ReduceStatement(node);
+
+		if (reduced != node)
+		{
+			listNode->SetData(reduced);
+			replacements[node.get()] = reduced;
+			replacedNodes.push_back(node);
+		}
+	}
+
+	if (!replacements.empty())
+	{
+		for (std::shared_ptr<ListNode> listNode = nodes->GetHead(); listNode && listNode->GetData(); listNode = listNode->GetNext())
+		{
+			std::shared_ptr<CompilerNode> jumpTo = listNode->GetData()->GetJumpTo();
+			if (jumpTo == nullptr)
+				continue;
+
+			auto replacement = replacements.find(jumpTo.get());
+			if (replacement != replacements.end())
+				listNode->GetData()->SetJumpTo(replacement->second);
+		}
+	}
+
+	return GetReductionCount() - reductionsBefore;
+}
+
+// Statements keep their kind, only the expressions in them are rewritten. The operands
+// first, a folded operand can make the node above it constant
+std::shared_ptr<CompilerNode> StrengthReducer::ReduceStatement(std::shared_ptr<CompilerNode> node)
+{
+	return CompilerNode::Rewrite(node, nullptr, [&](std::shared_ptr<CompilerNode> part, std::vector<std::shared_ptr<CompilerNode>>& parameters, bool changed) {
+		std::shared_ptr<CompilerNode> reduced = CompilerNode::Copy(part, parameters, changed);
+		return part == node ? reduced : ReduceExpression(reduced);
+	});
+}
+
+// A node with its operands already reduced
+std::shared_ptr<CompilerNode> StrengthReducer::ReduceExpression(std::shared_ptr<CompilerNode> node)
+{
+	std::string expression = node->GetExpression();
+	std::vector<std::shared_ptr<CompilerNode>> operands = node->GetNodeparameters();
+
+	// A builtin with only constant operands gives the same text every time
+	std::vector<double> numbers;
+	for (std::shared_ptr<CompilerNode> operand : operands)
+	{
+		long double value;
+		if (!GetConstant(operand, value))
+			break;
+		numbers.push_back((double)value);
+	}
+
+	std::string text;
+	JitError error;
+	if (!operands.empty() && numbers.size() == operands.size() && JitRuntime::Evaluate(expression, numbers, numericMode, text, error) && error == JitError::None)
+	{
+		constantBuiltins++;
+		return std::make_shared<CompilerNode>("$value", text, false);
+	}
+
+	if (operands.size() == 1 && fastMath && (expression == "$sqr" || expression == "$cbc"))
+	{
+		multiplyChains++;
+		std::vector<std::shared_ptr<CompilerNode>> power = { operands.at(0), std::make_shared<CompilerNode>("$value", expression == "$sqr" ? "2" : "3", false) };
+		return std::make_shared<CompilerNode>("$powInt", "", power, nullptr, false);
+	}
+
+	long double constant;
+	if (operands.size() != 2 || !GetConstant(operands.at(1), constant))
+		return node;
+
+	if (expression == "$pow" && std::floor(constant) == constant)
+	{
+		// The exponent is already rounded to a long double, sqr and cbc pass the same one
+		if (fastMath && std::fabs(constant) <= 32)
+		{
+			multiplyChains++;
+			return std::make_shared<CompilerNode>("$powInt", "", operands, nullptr, false);
+		}
+		if (constant == 2 || constant == 3)
+		{
+			squares++;
+			std::vector<std::shared_ptr<CompilerNode>> operand = { operands.at(0) };
+			return std::make_shared<CompilerNode>(constant == 2 ? "$sqr" : "$cbc", "", operand, nullptr, false);
+		}
+	}
+
+	// A division by zero has to throw, it stays a division
+	if (constant == 0)
+		return node;
+
+	if (expression == "$div")
+	{
+		if (IsPowerOfTwo(constant))
+		{
+			exactReciprocals++;
+			return Multiply(operands.at(0), 1 / constant);
+		}
+		if (fastMath)
+		{
+			reciprocals++;
+			return Multiply(operands.at(0), 1 / constant);
+		}
+	}
+	else if (expression == "$perc" || expression == "$perm")
+	{
+		// (x / c) * 100 rounds once, like x * (100 / c) when 100 / c is exact
+		long double scale = expression == "$perc" ? 100 : 1000;
+		if (IsPowerOfTwo(constant) || fastMath)
+		{
+			percentages++;
+			return Multiply(operands.at(0), scale / constant);
+		}
+	}
+
+	return node;
+}
+
+std::shared_ptr<CompilerNode> StrengthReducer::Multiply(std::shared_ptr<CompilerNode> operand, long double factor)
+{
+	std::vector<std::shared_ptr<CompilerNode>> operands = { operand, std::make_shared<CompilerNode>("$value", ToText(factor), false) };
+	return std::make_shared<CompilerNode>("$mul", "", operands, nullptr, false);
+}
+
+bool StrengthReducer::GetConstant(std::shared_ptr<CompilerNode> node, long double &value)
+{
+	if (node == nullptr || node->GetExpression() != "$value" || node->GetValue().empty())
+		return false;
+
+	// The VirtualMachine atof's the text, so the value is a double
+	std::string text = node->GetValue();
+	char* end;
+	value = strtod(text.c_str(), &end);
+	return *end == '\0';
+}
+
+// Scaling by a power of two is exact, as long as the result doesn't leave the range of a double
+bool StrengthReducer::IsPowerOfTwo(long double value)
+{
+	int exponent;
+	return value != 0 && std::frexp(std::fabs(value), &exponent) == 0.5L && exponent > -60 && exponent < 60;
+}
+
+// Enough digits for atof to read back the same double
+std::string StrengthReducer::ToText(long double value)
+{
+	char buffer[64];
+	snprintf(buffer, sizeof(buffer), "%.17g", (double)value);
+	return buffer;
+}
+
+int StrengthReducer::GetReductionCount()
+{
+	return squares + multiplyChains + exactReciprocals + reciprocals + percentages + constantBuiltins;
+}
+
+std::string StrengthReducer::GetReport()
+{
+	return "Strength reduction: " + std::to_string(GetReductionCount()) + " rewrites ("
+		+ std::to_string(squares) + " pow to sqr or cbc, "
+		+ std::to_string(multiplyChains) + " multiply chains, "
+		+ std::to_string(exactReciprocals) + " exact reciprocals, "
+		+ std::to_string(reciprocals) + " rounded reciprocals, "
+		+ std::to_string(percentages) + " percentages, "
+		+ std::to_string(constantBuiltins) + " constant builtins)"
+		+ (fastMath ? ", fast math" : "");
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <string>
+#include <memory>
+#include <vector>
+
+#include "CompilerNode.h"
+#include "LinkedList.h"
+#include "NumericPolicy.h"
+
+// Rewrites builtins with constant operands into cheaper ones:
+//
+//   pow(x | 2), pow(x | 3)         -> sqr(x), cbc(x)
+//   x / 8                          -> x * 0.125
+//   perc(x | 4), perm(x | 2)       -> x * 25, x * 500
+//   sin(30), sqr(4)                -> 0.50000000000000, 16.00000000000000
+//
+// By default only rewrites that give exactly the same result are made: a
+// divisor that is a power of two has an exact reciprocal and std::pow already
+// gets an integer exponent for sqr and cbc. With fast math the reciprocal of
+// any divisor is used and integer powers become a chain of multiplies:
+//
+//   pow(x | 5), sqr(x), cbc(x)     -> $powInt(x | 5), $powInt(x | 2), $powInt(x | 3)
+//   x / 3                          -> x * 0.33333333333333331
+//
+// Those can differ from std::pow and a division in the last bit. Constant
+// builtins are folded in the NumericMode the program will run in.
+class StrengthReducer
+{
+public:
+	StrengthReducer(bool p_fastMath, NumericMode p_numericMode);
+	virtual ~StrengthReducer();
+
+	// Reduce all statements in the list and repoint jumps to the new nodes
+	int Reduce(std::shared_ptr<LinkedList> nodes);
+	std::shared_ptr<CompilerNode> ReduceStatement(std::shared_ptr<CompilerNode> node);
+
+	int GetReductionCount();
+	std::string GetReport();
+
+private:
+	bool fastMath;
+	NumericMode numericMode;
+
+	int squares = 0;
+	int multiplyChains = 0;
+	int exactReciprocals = 0;
+	int reciprocals = 0;
+	int percentages = 0;
+	int constantBuiltins = 0;
+
+	std::shared_ptr<CompilerNode> ReduceExpression(std::shared_ptr<CompilerNode> node);
+	std::shared_ptr<CompilerNode> Multiply(std::shared_ptr<CompilerNode> operand, long double factor);
+
+	bool GetConstant(std::shared_ptr<CompilerNode> node, long double &value);
+	static bool IsPowerOfTwo(long double value);
+	static std::string ToText(long double value);
+};
@@ -7,12 +7,17 @@
 
 #include "Subroutine.h"
 
-Subroutine::Subroutine() :name(""), returnType(MyTokenType::None), kind(SubroutineKind::None), isEmpty(true)
+Subroutine::Subroutine() :kind(SubroutineKind::None), returnType(MyTokenType::None), name(""), atom(0), isEmpty(true), isPure(false)
 {
 	subroutineCompilerNodes = std::make_shared<LinkedList>();
 }
 
-Subroutine::Subroutine(std::string p_name, MyTokenType p_return, SubroutineKind p_kind, SymbolTable p_parameters) : name(p_name), returnType(p_return), kind(p_kind), symbolTable(p_parameters), isEmpty(false)
+Subroutine::Subroutine(std::string p_name, MyTokenType p_return, SubroutineKind p_kind, SymbolTable p_parameters) : symbolTable(p_parameters), kind(p_kind), returnType(p_return), name(p_name), atom(AtomTable::Intern(p_name)), isEmpty(false), isPure(false)
+{
+	subroutineCompilerNodes = std::make_shared<LinkedList>();
+}
+
+Subroutine::Subroutine(std::string p_name, Atom p_atom, MyTokenType p_return, SubroutineKind p_kind, SymbolTable p_parameters) : symbolTable(p_parameters), kind(p_kind), returnType(p_return), name(p_name), atom(p_atom != 0 ? p_atom : AtomTable::Intern(p_name)), isEmpty(false), isPure(false)
 {
 	subroutineCompilerNodes = std::make_shared<LinkedList>();
 }
@@ -24,7 +29,9 @@ Subroutine& Subroutine::operator=(const Subroutine& other)
 		kind = other.kind;
 		returnType = other.returnType;
 		name = other.name;
+		atom = other.atom;
 		isEmpty = other.isEmpty;
+		isPure = other.isPure;
 		subroutineCompilerNodes = other.subroutineCompilerNodes;
 		symbolTable = other.symbolTable;
 	}
@@ -40,9 +47,14 @@ bool Subroutine::HasLocal(std::string name)
 	return symbolTable.HasSymbol(name);
 }
 
+bool Subroutine::HasLocal(Atom localAtom)
+{
+	return symbolTable.HasSymbol(localAtom);
+}
+
 void Subroutine::AddLocal(Symbol symbol)
 {
-	if (!HasLocal(symbol.name))
+	if (!symbolTable.HasSymbol(symbol.atom))
 	{
 		symbolTable.AddSymbol(symbol);
 	}
@@ -55,11 +67,12 @@ SymbolTable* Subroutine::GetSymbolTable()
 
 Symbol* Subroutine::GetLocal(std::string name)
 {
-	if (HasLocal(name))
-	{
-		return symbolTable.GetSymbol(name);
-	}
-	return nullptr;
+	return symbolTable.GetSymbol(name);
+}
+
+Symbol* Subroutine::GetLocal(Atom localAtom)
+{
+	return symbolTable.GetSymbol(localAtom);
 }
 
 void Subroutine::AddCompilerNode(std::shared_ptr<CompilerNode> node)
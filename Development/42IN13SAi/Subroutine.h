@@ -25,16 +25,25 @@ public:
 	SubroutineKind kind;
 	MyTokenType returnType;
 	std::string name;
+	Atom atom;
 	bool isEmpty;
+
+	// Only reads its parameters and locals, set by the PurityAnalysis
+	bool isPure;
 	
 	Subroutine();
 	Subroutine(std::string p_name, MyTokenType p_return, SubroutineKind p_kind, SymbolTable p_parameters);
+
+	// The atom the token of the name has, 0 to intern the name
+	Subroutine(std::string p_name, Atom p_atom, MyTokenType p_return, SubroutineKind p_kind, SymbolTable p_parameters);
 	Subroutine& operator=(const Subroutine& other);
 	virtual ~Subroutine();
 	
 	void AddLocal(Symbol symbol);
 	bool HasLocal(std::string name);
+	bool HasLocal(Atom localAtom);
 	Symbol* GetLocal(std::string name);
+	Symbol* GetLocal(Atom localAtom);
 	SymbolTable* GetSymbolTable();
 
 	std::shared_ptr<LinkedList> GetCompilerNodeCollection();
@@ -17,25 +17,33 @@ SubroutineTable::~SubroutineTable()
 
 void SubroutineTable::AddSubroutine(Subroutine subroutine)
 {
-    if (!HasSubroutine(subroutine.name)) {
-        subroutines.insert(std::make_pair(subroutine.name, subroutine));
-    }
+    subroutines.insert(std::make_pair(subroutine.atom, subroutine));
 }
 
 bool SubroutineTable::HasSubroutine(std::string name)
 {
-    auto subroutine = subroutines.find(name);
-    if (subroutine != subroutines.end())
-        return true;
-    return false;
+    return GetSubroutine(name) != nullptr;
 }
 
 Subroutine* SubroutineTable::GetSubroutine(std::string name)
 {
-    if (HasSubroutine(name))
-    {
-        return &(subroutines[name]);
-    }
+    return GetSubroutine(AtomTable::Intern(name));
+}
+
+Subroutine* SubroutineTable::GetSubroutine(Atom atom)
+{
+    auto subroutine = subroutines.find(atom);
+    if (subroutine != subroutines.end())
+        return &subroutine->second;
     return nullptr;
 }
 
+std::vector<Subroutine*> SubroutineTable::GetSubroutineVector()
+{
+    std::vector<Subroutine*> vSubroutines;
+    for (subroutineMap::iterator it = subroutines.begin(); it != subroutines.end(); ++it) {
+        vSubroutines.push_back(&it->second);
+    }
+    return vSubroutines;
+}
+
@@ -9,11 +9,12 @@
 
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include "Subroutine.h"
 
 class SubroutineTable {
 private:
-    typedef std::unordered_map<std::string, Subroutine> subroutineMap;
+    typedef std::unordered_map<Atom, Subroutine> subroutineMap;
     subroutineMap subroutines;
 public:
     SubroutineTable();
@@ -22,6 +23,8 @@ public:
     void AddSubroutine(Subroutine subroutine);
     bool HasSubroutine(std::string name);
     Subroutine* GetSubroutine(std::string name);
+    Subroutine* GetSubroutine(Atom atom);
+    std::vector<Subroutine*> GetSubroutineVector();
 };
 
 
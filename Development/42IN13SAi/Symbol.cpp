@@ -1,11 +1,15 @@
 #include "Symbol.h"
 
-Symbol::Symbol() :name(""), type(MyTokenType::None), kind(SymbolKind::None), is_set(false)
+Symbol::Symbol() :name(""), atom(0), type(MyTokenType::None), kind(SymbolKind::None), is_set(false)
 {
     
 }
 
-Symbol::Symbol(std::string p_name, MyTokenType p_type, SymbolKind p_kind) : name(p_name), type(p_type), kind(p_kind), is_set(false)
+Symbol::Symbol(std::string p_name, MyTokenType p_type, SymbolKind p_kind) : name(p_name), atom(AtomTable::Intern(p_name)), type(p_type), kind(p_kind), is_set(false)
+{
+}
+
+Symbol::Symbol(std::string p_name, Atom p_atom, MyTokenType p_type, SymbolKind p_kind) : name(p_name), atom(p_atom != 0 ? p_atom : AtomTable::Intern(p_name)), type(p_type), kind(p_kind), is_set(false)
 {
 }
 
@@ -1,21 +1,26 @@
 #pragma once
 
 #include <string>
+#include "AtomTable.h"
 #include "MyTokenType.h"
 #include "SymbolKind.h"
 
 class Symbol
 {
 private:
-	long double value;
+	long double value = 0;
 public:
     const std::string name;
+    const Atom atom;
     const MyTokenType type;
     const SymbolKind kind;
 	bool is_set = false;
 
     Symbol();
     Symbol(std::string p_name, MyTokenType p_type, SymbolKind p_kind);
+
+    // The atom the token of the name has, 0 to intern the name
+    Symbol(std::string p_name, Atom p_atom, MyTokenType p_type, SymbolKind p_kind);
     Symbol& operator=(const Symbol& other);
     virtual ~Symbol();
     
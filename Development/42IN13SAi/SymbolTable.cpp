@@ -2,71 +2,126 @@
 
 SymbolTable::SymbolTable()
 {
-    symbols = std::make_shared<symbolMap>(symbolMap());
 }
 
-std::vector<std::pair<std::string, Symbol>>::iterator SymbolTable::HasSymbolIt(std::string symbolName)
+SymbolTable::SymbolTable(const SymbolTable& other) : symbols(other.symbols), buckets(other.buckets), parameters(other.parameters)
 {
-    symbolMap::iterator it = std::find_if(symbols->begin(), symbols->end(),
-                                          [&](std::pair<std::string, Symbol>& pair){
-                                              return pair.first == symbolName;
-                                          });
-    return it;
 }
 
-bool SymbolTable::HasSymbol(std::string symbolName)
+// The constant members of a Symbol can't be assigned, the copies are swapped in
+SymbolTable& SymbolTable::operator=(const SymbolTable& other)
 {
-	if (symbols->size() > 0)
-	{
-        return HasSymbolIt(symbolName) != symbols->end();
-	}
-    
-    return false;
+    if (this != &other)
+    {
+        std::vector<Symbol> copy(other.symbols);
+        symbols.swap(copy);
+        buckets = other.buckets;
+        parameters = other.parameters;
+    }
+    return *this;
 }
 
-void SymbolTable::AddSymbol(Symbol symbol)
+// Fibonacci hashing, the atoms are numbered in order so the low bits alone would cluster
+size_t SymbolTable::GetBucket(Atom symbolAtom)
+{
+    uint32_t hash = symbolAtom * 2654435769u;
+    return (hash ^ (hash >> 16)) & (buckets.size() - 1);
+}
+
+int SymbolTable::FindIndex(Atom symbolAtom)
 {
-    if (!HasSymbol(symbol.name))
+    if (buckets.empty())
+        return -1;
+
+    for (size_t bucket = GetBucket(symbolAtom);; bucket = (bucket + 1) & (buckets.size() - 1))
     {
-        symbols->push_back(std::make_pair(symbol.name, symbol));
+        int index = buckets[bucket];
+        if (index < 0 || symbols[index].atom == symbolAtom)
+            return index;
     }
 }
 
+void SymbolTable::Rehash(size_t bucketCount)
+{
+    buckets.assign(bucketCount, -1);
+    for (int index = 0; index < (int)symbols.size(); index++)
+        Place(index);
+}
+
+void SymbolTable::Place(int index)
+{
+    size_t bucket = GetBucket(symbols[index].atom);
+    while (buckets[bucket] >= 0)
+        bucket = (bucket + 1) & (buckets.size() - 1);
+    buckets[bucket] = index;
+}
+
+bool SymbolTable::HasSymbol(std::string symbolName)
+{
+    return HasSymbol(AtomTable::Intern(symbolName));
+}
+
+bool SymbolTable::HasSymbol(Atom symbolAtom)
+{
+    return FindIndex(symbolAtom) >= 0;
+}
+
+void SymbolTable::AddSymbol(Symbol symbol)
+{
+    if (HasSymbol(symbol.atom))
+        return;
+
+    if (symbol.kind == SymbolKind::Parameter)
+        parameters.push_back((int)symbols.size());
+    symbols.push_back(symbol);
+
+    // Keep the buckets at most half full
+    if (symbols.size() * 2 > buckets.size())
+        Rehash(buckets.empty() ? 16 : buckets.size() * 2);
+    else
+        Place((int)symbols.size() - 1);
+}
+
 Symbol* SymbolTable::GetSymbol(std::string symbolName)
 {
-    symbolMap::iterator it = HasSymbolIt(symbolName);
-    if (it != symbols->end())
-        return &(it->second);
+    return GetSymbol(AtomTable::Intern(symbolName));
+}
+
+Symbol* SymbolTable::GetSymbol(Atom symbolAtom)
+{
+    int index = FindIndex(symbolAtom);
+    if (index >= 0)
+        return &symbols[index];
     return nullptr;
 }
 
 std::vector<Symbol*> SymbolTable::GetSymbolVector()
 {
     std::vector<Symbol*> vSymbols;
-    for( symbolMap::iterator it = symbols->begin(); it != symbols->end(); ++it ) {
-        if (it->second.kind == SymbolKind::Parameter)
-            vSymbols.push_back( &it->second );
-    }
+    for (int index : parameters)
+        vSymbols.push_back(&symbols[index]);
+    return vSymbols;
+}
+
+std::vector<Symbol*> SymbolTable::GetAllSymbolVector()
+{
+    std::vector<Symbol*> vSymbols;
+    for (Symbol& symbol : symbols)
+        vSymbols.push_back(&symbol);
     return vSymbols;
 }
 
 int SymbolTable::Size()
 {
-    return (int)symbols->size();
+    return (int)symbols.size();
 }
 
 int SymbolTable::ParameterSize()
 {
-    int parameterCount = 0;
-    
-    for( symbolMap::iterator it = symbols->begin(); it != symbols->end(); ++it ) {
-        if (it->second.kind == SymbolKind::Parameter)
-            parameterCount++;
-    }
-    return parameterCount;
+    return (int)parameters.size();
 }
 
 SymbolTable::~SymbolTable()
 {
-    
-}
\ No newline at end of file
+
+}
@@ -1,27 +1,41 @@
 #pragma once
 
-#include <unordered_map>
 #include <string>
-#include <algorithm>
 #include <vector>
-#include <memory>
 #include "Symbol.h"
-#include <memory>
 
+// The symbols in declaration order and an open addressing hash on their atom:
+//
+//   symbols:  [a] [b] [n] [i]        buckets:  -1  2  0  -1  3  -1  1  -1
+//   parameters: 0 1                          the index of the symbol, or -1
+//
+// A lookup hashes the atom to a bucket and probes the next ones until it finds
+// the symbol or an empty bucket, the buckets stay at most half full. A copy is a
+// copy of the values, every call of a function gets its own table.
 class SymbolTable {
 private:
-    typedef std::vector<std::pair<std::string, Symbol>> symbolMap;
-    std::shared_ptr<symbolMap> symbols;
+    std::vector<Symbol> symbols;
+    std::vector<int> buckets;
+    std::vector<int> parameters;
+
+    int FindIndex(Atom symbolAtom);
+    void Rehash(size_t bucketCount);
+    void Place(int index);
+    size_t GetBucket(Atom symbolAtom);
 
 public:
     SymbolTable();
+    SymbolTable(const SymbolTable& other);
+    SymbolTable& operator=(const SymbolTable& other);
     virtual ~SymbolTable();
-    
-    symbolMap::iterator HasSymbolIt(std::string symbolName);
+
     bool HasSymbol(std::string symbolName);
+    bool HasSymbol(Atom symbolAtom);
     void AddSymbol(Symbol symbol);
     Symbol* GetSymbol(std::string symbolName);
+    Symbol* GetSymbol(Atom symbolAtom);
     std::vector<Symbol*> GetSymbolVector();
+    std::vector<Symbol*> GetAllSymbolVector();
     int Size();
     int ParameterSize();
 };
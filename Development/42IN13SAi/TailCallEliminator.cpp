@@ -0,0 +1,189 @@
+#include "TailCallEliminator.h"
+#include "Symbol.h"
+
+TailCallEliminator::TailCallEliminator()
+{
+}
+
+TailCallEliminator::~TailCallEliminator()
+{
+}
+
+int TailCallEliminator::Eliminate(Subroutine* subroutine)
+{
+	std::shared_ptr<LinkedList> nodes = subroutine->GetCompilerNodeCollection();
+	std::vector<std::shared_ptr<ListNode>> listNodes;
+	for (std::shared_ptr<ListNode> listNode = nodes->GetHead(); listNode && listNode->GetData(); listNode = listNode->GetNext())
+		listNodes.push_back(listNode);
+
+	for (std::shared_ptr<ListNode> listNode : listNodes)
+	{
+		if (listNode->GetData()->GetExpression() == "$forLoop")
+			return 0;
+	}
+
+	// The jumps go to a node of their own, the first statement can be a loop header
+	std::shared_ptr<CompilerNode> start = nullptr;
+	// The names, the temporaries added to the symboltable move the symbols
+	std::vector<std::string> parameters;
+	for (Symbol* parameter : subroutine->GetSymbolTable()->GetSymbolVector())
+		parameters.push_back(parameter->name);
+	std::vector<std::string> resets = FindUnassignedReads(subroutine, listNodes);
+	int eliminated = 0;
+
+	for (std::shared_ptr<ListNode> listNode : listNodes)
+	{
+		std::shared_ptr<CompilerNode> node = listNode->GetData();
+		if (!IsTailCall(subroutine, node))
+			continue;
+
+		if (start == nullptr)
+		{
+			start = std::make_shared<CompilerNode>("$doNothing", "", false);
+			nodes->InsertBefore(nodes->GetHead(), start);
+		}
+
+		// A parameter a later argument reads keeps its old value until all arguments are evaluated
+		std::vector<std::shared_ptr<CompilerNode>> arguments = node->GetNodeparameters().at(0)->GetNodeparameters();
+		std::vector<std::shared_ptr<CompilerNode>> assignments;
+		std::vector<std::shared_ptr<CompilerNode>> delayed;
+		for (size_t i = 0; i < parameters.size(); i++)
+		{
+			std::set<std::string> laterReads;
+			for (size_t j = i + 1; j < parameters.size(); j++)
+				CollectVariables(arguments.at(j + 1), laterReads);
+
+			std::string name = parameters.at(i);
+			if (laterReads.count(name) == 0)
+			{
+				assignments.push_back(MakeAssignment(name, arguments.at(i + 1)));
+				continue;
+			}
+
+			std::string temp = "$" + subroutine->name + "_" + name;
+			subroutine->AddLocal(Symbol(temp, MyTokenType::Float, SymbolKind::Local));
+			assignments.push_back(MakeAssignment(temp, arguments.at(i + 1)));
+			delayed.push_back(MakeAssignment(name, std::make_shared<CompilerNode>("$getVariable", temp, false)));
+		}
+		assignments.insert(assignments.end(), delayed.begin(), delayed.end());
+
+		for (std::string local : resets)
+			assignments.push_back(MakeAssignment(local, std::make_shared<CompilerNode>("$value", "0", false)));
+
+		std::shared_ptr<CompilerNode> jump = std::make_shared<CompilerNode>("$doNothing", "", start, false);
+
+		// A $doNothing continues at its target, the others after it
+		for (std::shared_ptr<ListNode> other : listNodes)
+		{
+			if (other->GetData()->GetJumpTo() != node)
+				continue;
+
+			if (other->GetData()->GetExpression() == "$doNothing" && !assignments.empty())
+				other->GetData()->SetJumpTo(assignments.front());
+			else
+				other->GetData()->SetJumpTo(jump);
+		}
+
+		listNode->SetData(jump);
+		for (std::shared_ptr<CompilerNode> assignment : assignments)
+			nodes->InsertBefore(listNode, assignment);
+		eliminated++;
+	}
+
+	tailCalls += eliminated;
+	if (eliminated > 0)
+		functions++;
+	return eliminated;
+}
+
+// ret f(...) in f
+bool TailCallEliminator::IsTailCall(Subroutine* subroutine, std::shared_ptr<CompilerNode> node)
+{
+	std::vector<std::shared_ptr<CompilerNode>> parameters = node->GetNodeparameters();
+	if (node->GetExpression() != "$ret" || parameters.size() != 1 || parameters.at(0) == nullptr
+		|| parameters.at(0)->GetExpression() != "$functionCall")
+		return false;
+
+	// The VirtualMachine throws for the wrong number of arguments, leave that to it
+	std::vector<std::shared_ptr<CompilerNode>> call = parameters.at(0)->GetNodeparameters();
+	if (call.empty() || call.at(0) == nullptr || call.at(0)->GetValue() != subroutine->name
+		|| (int)call.size() - 1 != subroutine->GetSymbolTable()->ParameterSize())
+		return false;
+
+	for (size_t i = 1; i < call.size(); i++)
+	{
+		if (call.at(i) == nullptr)
+			return false;
+	}
+	return true;
+}
+
+// The locals that aren't assigned before the first branch but can be read
+std::vector<std::string> TailCallEliminator::FindUnassignedReads(Subroutine* subroutine, std::vector<std::shared_ptr<ListNode>>& listNodes)
+{
+	std::set<std::string> assigned;
+	for (Symbol* parameter : subroutine->GetSymbolTable()->GetSymbolVector())
+		assigned.insert(parameter->name);
+
+	std::set<std::string> unassigned;
+	bool straight = true;
+	for (std::shared_ptr<ListNode> listNode : listNodes)
+	{
+		std::shared_ptr<CompilerNode> node = listNode->GetData();
+		std::string expression = node->GetExpression();
+		std::vector<std::shared_ptr<CompilerNode>> parameters = node->GetNodeparameters();
+		bool assignment = expression == "$assignment" && parameters.size() == 2 && parameters.at(0) != nullptr;
+
+		std::set<std::string> variables;
+		CollectVariables(assignment ? parameters.at(1) : node, variables);
+		for (std::string variable : variables)
+		{
+			if (subroutine->HasLocal(variable) && assigned.count(variable) == 0)
+				unassigned.insert(variable);
+		}
+
+		if (assignment && straight)
+			assigned.insert(parameters.at(0)->GetValue());
+		if (!assignment && (expression != "$doNothing" || node->GetJumpTo() != nullptr))
+			straight = false;
+	}
+	return std::vector<std::string>(unassigned.begin(), unassigned.end());
+}
+
+std::shared_ptr<CompilerNode> TailCallEliminator::MakeAssignment(std::string name, std::shared_ptr<CompilerNode> value)
+{
+	std::vector<std::shared_ptr<CompilerNode>> assignment;
+	assignment.push_back(std::make_shared<CompilerNode>("$identifier", name, false));
+	assignment.push_back(value);
+	return std::make_shared<CompilerNode>("$assignment", assignment, nullptr, false);
+}
+
+void TailCallEliminator::CollectVariables(std::shared_ptr<CompilerNode> node, std::set<std::string>& variables)
+{
+	std::vector<std::shared_ptr<CompilerNode>> work;
+	work.push_back(node);
+	while (!work.empty())
+	{
+		node = work.back();
+		work.pop_back();
+		if (node == nullptr)
+			continue;
+
+		if (node->GetExpression() == "$getVariable" || node->GetExpression() == "$identifier")
+			variables.insert(node->GetValue());
+
+		std::vector<std::shared_ptr<CompilerNode>> parameters = node->GetNodeparameters();
+		work.insert(work.end(), parameters.begin(), parameters.end());
+	}
+}
+
+int TailCallEliminator::GetEliminationCount()
+{
+	return tailCalls;
+}
+
+std::string TailCallEliminator::GetReport()
+{
+	return "Tail calls: " + std::to_string(tailCalls) + " self calls turned into jumps in "
+		+ std::to_string(functions) + " functions";
+}
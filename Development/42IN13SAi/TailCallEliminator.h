@@ -0,0 +1,46 @@
+#pragma once
+
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "CompilerNode.h"
+#include "LinkedList.h"
+#include "Subroutine.h"
+
+// Turns a ret of a call to the function itself into a jump back to its start:
+//
+//   func float sum(n | acc)          $doNothing                  <-+
+//   [                                if (n < 1) [ ret acc; ]       |
+//       if (n < 1) [ ret acc; ]  ->  $sum_n = n - 1                |
+//       ret sum(n - 1 | acc + n);    acc = acc + n                 |
+//   ]                                n = $sum_n                    |
+//                                    $doNothing ------------------+
+//
+// The call evaluates every argument with the old values of the parameters, a
+// parameter a later argument still reads goes through a local of its own
+// first. A call starts with unset locals, so the locals the body can read
+// before assigning them are set back to 0 before the jump and a function
+// with a frl keeps its calls, the variable of a frl stays set after a jump.
+class TailCallEliminator
+{
+public:
+	TailCallEliminator();
+	virtual ~TailCallEliminator();
+
+	int Eliminate(Subroutine* subroutine);
+
+	int GetEliminationCount();
+	std::string GetReport();
+
+private:
+	int tailCalls = 0;
+	int functions = 0;
+
+	bool IsTailCall(Subroutine* subroutine, std::shared_ptr<CompilerNode> node);
+	std::vector<std::string> FindUnassignedReads(Subroutine* subroutine, std::vector<std::shared_ptr<ListNode>>& listNodes);
+
+	static std::shared_ptr<CompilerNode> MakeAssignment(std::string name, std::shared_ptr<CompilerNode> value);
+	static void CollectVariables(std::shared_ptr<CompilerNode> node, std::set<std::string>& variables);
+};
@@ -1,17 +1,21 @@
 #include <stdio.h>
 #include "Token.h"
 
-Token::Token(int lineNumber, int linePosition, int level, std::string value, MyTokenType myTokenType, std::shared_ptr<Token> partner) : LineNumber(lineNumber), LinePosition(linePosition), Level(level), Value(value), Type(myTokenType)
+Token::Token(int lineNumber, int linePosition, int level, std::string value, MyTokenType myTokenType, std::shared_ptr<Token> partner) : LineNumber(lineNumber), LinePosition(linePosition), Level(level), Value(value), Id(0), Type(myTokenType)
 {
 	Partner = partner;
+
+	// The names are interned while lexing, the later stages compare the atoms
+	if (myTokenType == MyTokenType::Identifier)
+		Id = AtomTable::Intern(value);
 }
 
-Token::Token(const Token & other): LineNumber(other.LineNumber), LinePosition(other.LinePosition), Level(other.Level), Value(other.Value), Type(other.Type), Partner(other.Partner)
+Token::Token(const Token & other): LineNumber(other.LineNumber), LinePosition(other.LinePosition), Level(other.Level), Value(other.Value), Id(other.Id), Type(other.Type), Partner(other.Partner)
 {
     
 }
 
-Token::Token() : LineNumber(0), LinePosition(0), Level(0), Value(""), Partner(std::shared_ptr<Token>())
+Token::Token() : LineNumber(0), LinePosition(0), Level(0), Value(""), Id(0), Partner(std::shared_ptr<Token>())
 {
 }
 
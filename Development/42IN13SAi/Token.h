@@ -9,6 +9,7 @@
 #pragma once
 #include <memory>
 #include <string>
+#include "AtomTable.h"
 #include "MyTokenType.h"
 
 
@@ -34,6 +35,10 @@ public:
     ///
 	std::string Value;
     
+    /// The atom of the value of an identifier, 0 for the other tokens
+    ///
+	Atom Id;
+    
     /// The MyTokenType type of the token
     ///
 	MyTokenType Type;
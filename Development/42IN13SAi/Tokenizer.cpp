@@ -1,6 +1,6 @@
 #include "Tokenizer.h"
 
-Tokenizer::Tokenizer(std::string fileLocation, std::list<TokenDefinition> definitions, std::vector<TokenPartner> partners)
+Tokenizer::Tokenizer(std::string fileLocation, std::list<TokenDefinition> definitions, std::vector<TokenPartner> partners, IncrementalCache* p_cache)
 {
     // set defaults
     lineNumber      = 0;
@@ -10,6 +10,7 @@ Tokenizer::Tokenizer(std::string fileLocation, std::list<TokenDefinition> defini
     
     tokenDefinitions = definitions;
     tokenPartners    = partners;
+    cache            = p_cache;
 
 	file.open(fileLocation);
     
@@ -20,6 +21,11 @@ void Tokenizer::Tokenize()
 {
 	while (lineRemaining.length() != 0)
 	{
+		// A line that was tokenized before gets the same tokens again
+		if (lineStart && ReplayLine())
+			continue;
+		lineStart = false;
+
 		bool match = false;
 		boost::algorithm::trim(lineRemaining);
 		if (lineRemaining.length() == 0)
@@ -40,8 +46,9 @@ void Tokenizer::Tokenize()
                 match = true;
                 if (definition.myTokenType == MyTokenType::Extended_ASCII)
                 {
-                    Diag(ExceptionEnum::err_unkown_char) << lineRemaining.substr(0, 1) << lineNumber << linePosition;
+                    Diag(ExceptionEnum::err_unkown_char, lineNumber, linePosition) << lineRemaining.substr(0, 1);
                     
+                    lineCached = false;
                     lineRemaining = "";
                     NextLine();
                     
@@ -55,33 +62,7 @@ void Tokenizer::Tokenize()
 					break;
 				}
 				
-				// Check if the level should be raised
-				if (definition.myTokenType == MyTokenType::OpenBracket || definition.myTokenType == MyTokenType::OpenCurlyBracket || definition.myTokenType == MyTokenType::OpenMethod)
-					level++;
-
-				// Find a partner
-				std::shared_ptr<Token> partner = nullptr;
-				if (ShouldFindPartner(definition.myTokenType))
-				{
-                    std::shared_ptr<Token> temp = FindPartner(definition.myTokenType, level);
-                    if (temp)
-                    {
-                        if (temp->Partner.lock() == nullptr)
-                            partner = temp;
-                    }
-				}
-
-				// Create token
-				std::string token_value = lineRemaining.substr(0, matched);
-                tokenVector.push_back(std::make_shared<Token>(lineNumber, linePosition, level, token_value, definition.myTokenType, partner));
-                
-                // if partner found, give this token to partner
-                if (partner)
-                    partner->Partner = std::shared_ptr<Token>(tokenVector.back());
-
-				// Check if the level should be lowered
-				if (definition.myTokenType == MyTokenType::CloseBracket || definition.myTokenType == MyTokenType::CloseCurlyBracket || definition.myTokenType == MyTokenType::CloseMethod)
-					level--;
+				AddToken(lineRemaining.substr(0, matched), definition.myTokenType);
 
 				// Change your position and line
 				linePosition += matched;
@@ -96,7 +77,8 @@ void Tokenizer::Tokenize()
         // Continue to next line, shouldn't tokenize anything after unkown character
         if (!match)
         {
-            Diag(ExceptionEnum::err_unkown_char) << lineRemaining.substr(0, 1) << lineNumber << linePosition;
+            Diag(ExceptionEnum::err_unkown_char, lineNumber, linePosition) << lineRemaining.substr(0, 1);
+            lineCached = false;
 			lineRemaining = "";
             NextLine();
         }
@@ -109,6 +91,56 @@ void Tokenizer::Tokenize()
 	file.close();
 }
 
+// Add a token at the current position, with its level and partner
+void Tokenizer::AddToken(std::string value, MyTokenType type)
+{
+	// Check if the level should be raised
+	if (type == MyTokenType::OpenBracket || type == MyTokenType::OpenCurlyBracket || type == MyTokenType::OpenMethod)
+		level++;
+
+	// Find a partner
+	std::shared_ptr<Token> partner = nullptr;
+	if (ShouldFindPartner(type))
+	{
+        std::shared_ptr<Token> temp = FindPartner(type, level);
+        if (temp)
+        {
+            if (temp->Partner.lock() == nullptr)
+                partner = temp;
+        }
+	}
+
+	// Create token
+    tokenVector.push_back(std::make_shared<Token>(lineNumber, linePosition, level, value, type, partner));
+    
+    // if partner found, give this token to partner
+    if (partner)
+        partner->Partner = std::shared_ptr<Token>(tokenVector.back());
+
+	// Check if the level should be lowered
+	if (type == MyTokenType::CloseBracket || type == MyTokenType::CloseCurlyBracket || type == MyTokenType::CloseMethod)
+		level--;
+}
+
+// Add the tokens the cache has for the current line, false when it has none
+bool Tokenizer::ReplayLine()
+{
+	const std::vector<IncrementalCache::LineToken>* tokens = cache != nullptr ? cache->FindLine(lineRemaining) : nullptr;
+	if (tokens == nullptr)
+		return false;
+
+	for (const IncrementalCache::LineToken& token : *tokens)
+	{
+		linePosition = token.linePosition;
+		AddToken(token.value, token.type);
+	}
+
+	lineCached = false;
+	lineRemaining = "";
+	NextLine();
+	return true;
+}
+
 void Tokenizer::CheckClosingPartners()
 {	
 	for (std::shared_ptr<Token> t : tokenVector)
@@ -136,7 +168,7 @@ std::shared_ptr<Token> Tokenizer::FindPartner(MyTokenType &type, int level)
         }
     }
 
-    Diag(ExceptionEnum::err_partner_not_found) << TokenToString(type) << lineNumber << linePosition;
+    Diag(ExceptionEnum::err_partner_not_found, lineNumber, linePosition) << TokenToString(type);
     return std::shared_ptr<Token>();
 }
 
@@ -158,7 +190,7 @@ void Tokenizer::TryFindPartner(std::shared_ptr<Token> token)
 	}
 
 	// Didn't find a partner:
-    Diag(ExceptionEnum::err_partner_not_found) << token->Value << token->LineNumber << token->LinePosition;
+    Diag(ExceptionEnum::err_partner_not_found, token->LineNumber, token->LinePosition) << token->Value;
 }
 
 bool Tokenizer::ShouldFindPartner(MyTokenType &type)
@@ -175,6 +207,15 @@ bool Tokenizer::ShouldFindPartnerR(MyTokenType &type)
 
 void Tokenizer::NextLine()
 {
+	// The tokens of the line that is done, for the next compile
+	if (lineCached)
+	{
+		std::vector<IncrementalCache::LineToken> tokens;
+		for (size_t i = lineTokens; i < tokenVector.size(); i++)
+			tokens.push_back(IncrementalCache::LineToken{ tokenVector[i]->Type, tokenVector[i]->Value, tokenVector[i]->LinePosition });
+		cache->StoreLine(lineText, tokens, std::chrono::duration<double>(std::chrono::steady_clock::now() - lineStarted).count());
+	}
+
 	while (std::getline(file, lineRemaining))
 	{
 		++lineNumber;
@@ -183,6 +224,15 @@ void Tokenizer::NextLine()
 		if (lineRemaining.length() > 0)
 			break;
 	}
+
+	lineStart = true;
+	lineCached = cache != nullptr && lineRemaining.length() > 0;
+	if (lineCached)
+	{
+		lineText = lineRemaining;
+		lineTokens = tokenVector.size();
+		lineStarted = std::chrono::steady_clock::now();
+	}
 }
 
 std::vector<std::shared_ptr<Token>> Tokenizer::GetTokenList()
@@ -218,10 +268,15 @@ bool Tokenizer::HasExceptions()
     return hasExceptions;
 }
 
-DiagnosticBuilder Tokenizer::Diag(ExceptionEnum exception)
+DiagnosticBuilder Tokenizer::Diag(ExceptionEnum exception, int line, int position)
 {
     hasExceptions = true;
-    return DiagnosticBuilder(exception);
+    return DiagnosticBuilder(exception, line, position, diagnostics);
+}
+
+void Tokenizer::SetDiagnostics(DiagnosticsEngine* p_diagnostics)
+{
+    diagnostics = p_diagnostics;
 }
 
 Tokenizer::~Tokenizer()
@@ -13,6 +13,7 @@
 #pragma once
 
 #include <boost/algorithm/string.hpp>
+#include <chrono>
 #include <fstream>
 #include <list>
 #include <vector>
@@ -31,6 +32,7 @@
 #include "ParseException.h"
 #include "ExceptionEnum.h"
 #include "DiagnosticsBuilder.h"
+#include "IncrementalCache.h"
 
 class Tokenizer
 {
@@ -46,8 +48,9 @@ public:
     /// @param fileLocation The path to the source code
     /// @param definitions The token definitions
     /// @param partners The token partners
+    /// @param p_cache The tokens of the lines of the last compile, nullptr for none
     ///
-	Tokenizer(std::string fileLocation, std::list<TokenDefinition> definitions, std::vector<TokenPartner> partners);
+	Tokenizer(std::string fileLocation, std::list<TokenDefinition> definitions, std::vector<TokenPartner> partners, IncrementalCache* p_cache);
     
     /// @brief The destructor for the tokenizer
     ///
@@ -76,6 +79,12 @@ public:
     /// @return True if there are exceptions
     ///
     bool HasExceptions();
+    
+    /// @brief Sets where the diagnostics go
+    ///
+    /// @param p_diagnostics The engine that collects them, nullptr to print every one to std::clog
+    ///
+    void SetDiagnostics(DiagnosticsEngine* p_diagnostics);
 private:
     /// The boolean keeping track of if there are any exceptions
     ///
@@ -123,10 +132,47 @@ private:
     ///
     std::vector<std::shared_ptr<Token>> tokenVector;
     
+    /// Where the diagnostics go, nullptr to print them to std::clog
+    ///
+    DiagnosticsEngine* diagnostics = nullptr;
+    
+    /// The tokens of the lines of the last compile, nullptr when they aren't kept
+    ///
+    IncrementalCache* cache;
+    
+    /// The current line is the one NextLine read, nothing of it is tokenized yet
+    ///
+    bool lineStart = false;
+    
+    /// The tokens of the current line go in the cache when it is done
+    ///
+    bool lineCached = false;
+    
+    /// The text of the current line, the first of its tokens and when it was read
+    ///
+    std::string lineText;
+    size_t lineTokens = 0;
+    std::chrono::steady_clock::time_point lineStarted;
+    
     /// The function to get the next line of the current file
     ///
     void NextLine();
     
+    /// @brief Adds a token on the current line and position
+    ///
+    /// Raises or lowers the level and links the token to its partner
+    ///
+    /// @param value The text of the token
+    /// @param type The MyTokenType of the token
+    ///
+    void AddToken(std::string value, MyTokenType type);
+    
+    /// @brief Adds the tokens the cache has for the current line
+    ///
+    /// @return False when the line isn't in the cache
+    ///
+    bool ReplayLine();
+    
     /// @brief Finds the partner for the given token type
     ///
     /// The function loops through all the tokenized tokens in reverse.
@@ -185,8 +231,9 @@ private:
     /// Returns a DiagnosticBuilder for the exception occuring
     ///
     /// @see ExceptionEnum.h
-    /// @param token The Token the exception happened on
     /// @param exception The exception that happened
+    /// @param line The line the exception happened on
+    /// @param position The position on the line
     ///
-    DiagnosticBuilder Diag(ExceptionEnum exception);
+    DiagnosticBuilder Diag(ExceptionEnum exception, int line, int position);
 };
\ No newline at end of file
@@ -1,11 +1,15 @@
 #include "TokenizerController.h"
 
-TokenizerController::TokenizerController(std::string filename)
+TokenizerController::TokenizerController(std::string filename) : TokenizerController(filename, nullptr)
+{
+}
+
+TokenizerController::TokenizerController(std::string filename, IncrementalCache* cache)
 {
 	std::list<TokenDefinition> definitions = Grammar::getGrammar();
 	std::vector<TokenPartner> partners = Grammar::getPartners();
 
-	tokenizer = new Tokenizer(filename, definitions, partners);
+	tokenizer = new Tokenizer(filename, definitions, partners, cache);
 }
 
 void TokenizerController::Tokenize()
@@ -23,6 +27,11 @@ bool TokenizerController::HasExceptions()
     return tokenizer->HasExceptions();
 }
 
+void TokenizerController::SetDiagnostics(DiagnosticsEngine* diagnostics)
+{
+    tokenizer->SetDiagnostics(diagnostics);
+}
+
 TokenizerController::~TokenizerController()
 {
 	delete tokenizer;
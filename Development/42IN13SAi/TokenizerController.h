@@ -13,6 +13,7 @@
 #include "Token.h"
 #include "Tokenizer.h"
 #include "Grammar.h"
+#include "IncrementalCache.h"
 
 class TokenizerController
 {
@@ -26,6 +27,13 @@ public:
     /// @param filename The path to the file that's going to be tokenized
     ///
 	TokenizerController(std::string filename);
+
+    /// The constructor that reuses the tokens of the lines of the last compile
+    ///
+    /// @param filename The path to the file that's going to be tokenized
+    /// @param cache The cache of the compiles of the source
+    ///
+	TokenizerController(std::string filename, IncrementalCache* cache);
 	virtual ~TokenizerController();
     
     /// Called to start the actual tokenizing
@@ -42,5 +50,11 @@ public:
     ///
     /// @return Returns true if exceptions were encountered
     bool HasExceptions();
+
+    /// Called before tokenizing to collect the diagnostics instead of printing them
+    ///
+    /// @param diagnostics The engine that collects them
+    ///
+    void SetDiagnostics(DiagnosticsEngine* diagnostics);
 };
 
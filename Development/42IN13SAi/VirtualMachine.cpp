@@ -43,6 +43,7 @@ std::string VirtualMachine::toString(long double number)
 VirtualMachine::VirtualMachine(const VirtualMachine &other) : globalsSymboltable(other.globalsSymboltable), currentSubroutine(other.currentSubroutine), currentSymbolTable(other.currentSymbolTable), subroutineTable(other.subroutineTable), globalsList(other.globalsList)
 {
 	function_caller = std::unique_ptr<FunctionCaller>(new FunctionCaller(this));
+	SetNumericMode(other.numericMode);
 }
 
 VirtualMachine& VirtualMachine::operator=(const VirtualMachine& other)
@@ -90,6 +91,7 @@ void VirtualMachine::ExecuteCode()
 		do
 		{
 			node = VirtualMachine::GetNext(std::shared_ptr<LinkedList>(globalsList));
+			executedNodes++;
 			std::string function_call = node->GetExpression();
 			function_caller->Call(function_call, *node);
 
@@ -115,13 +117,14 @@ void VirtualMachine::ExecuteCode()
 std::shared_ptr<CompilerNode> VirtualMachine::ExecuteNodes(std::shared_ptr<LinkedList> nodes)
 {
 	// Get the subroutine name
-	std::string subroutineName = currentSubroutine->name;
+	Atom subroutineName = currentSubroutine->atom;
 
 	// Insert the linkedlist for this subroutine
 	//nodeLists.insert(std::pair<std::string, std::shared_ptr<LinkedList>>(subroutineName, nodes));
-	nodeLists.push_back(std::pair<std::string, std::shared_ptr<LinkedList>>(subroutineName, nodes));
+	nodeLists.push_back(std::pair<Atom, std::shared_ptr<LinkedList>>(subroutineName, nodes));
 	//nodeLists.push_back(std::pair<std::string, LinkedList>(subroutineName, *nodes));
 
+	std::shared_ptr<CompilerNode> result;
 	if (nodes->size() > 0)
 	{
 		std::shared_ptr<CompilerNode> node;
@@ -133,23 +136,39 @@ std::shared_ptr<CompilerNode> VirtualMachine::ExecuteNodes(std::shared_ptr<Linke
 
 			if (node)
 			{
+				executedNodes++;
+
 				// Get the function name
 				std::string function_call = node->GetExpression();
 
 				// if it is a return function return the CompilerNode
 				if (function_call == "$ret")
 				{
-					return function_caller->Call(function_call, *node);
+					result = function_caller->Call(function_call, *node);
+					break;
 				}
 				else if (function_call == "$doNothing")
 				{
 					// Set the current node to the partner of the donothing node
 					if (node->GetJumpTo())
 					{
-						//std::find(nodeLists.begin(), nodeLists.end(), subroutineName)
-						//node = std::find(nodeLists.begin(), nodeLists.end(), subroutineName)->GetCurrentData();
-						findList(subroutineName)->SetCurrent(node->GetJumpTo());
-						node = findList(subroutineName)->GetCurrentData();
+						// Run the machine code of a hot while loop instead
+						std::shared_ptr<CompilerNode> jitResult;
+						if (RunJitLoop(findList(subroutineName), node, jitResult))
+						{
+							if (jitResult)
+							{
+								result = jitResult;
+								break;
+							}
+						}
+						else
+						{
+							//std::find(nodeLists.begin(), nodeLists.end(), subroutineName)
+							//node = std::find(nodeLists.begin(), nodeLists.end(), subroutineName)->GetCurrentData();
+							findList(subroutineName)->SetCurrent(node->GetJumpTo());
+							node = findList(subroutineName)->GetCurrentData();
+						}
 					}
 				}
 				else
@@ -159,21 +178,97 @@ std::shared_ptr<CompilerNode> VirtualMachine::ExecuteNodes(std::shared_ptr<Linke
 		} while (node != std::shared_ptr<CompilerNode>() && is_running);
 	}
 	
-	// Erase the LinkedList
+	// Erase the LinkedList, also after a return so a recursive caller finds its own list again
 	if (findPosition(subroutineName) >= 0)
 		nodeLists.erase(nodeLists.begin() + findPosition(subroutineName));
 	//nodeLists.erase(std::remove(nodeLists.begin()->first, nodeLists.end()->first, subroutineName));
 	
-	return nullptr;
+	return result;
 }
 
 std::shared_ptr<CompilerNode> VirtualMachine::CallFunction(CompilerNode node)
 {
+	if (IsOperation(node))
+	{
+		for (std::shared_ptr<CompilerNode> param : node.GetNodeparameters())
+		{
+			if (IsOperation(*param))
+				return CallOperations(node);
+		}
+	}
+
 	std::string function_call = node.GetExpression();
 	// call the compilernode function
 	return function_caller->Call(function_call, node);
 }
 
+// A + - * / with all of its operands, a + a + a is $add($add(a, a), a)
+bool VirtualMachine::IsOperation(CompilerNode& node)
+{
+	std::string expression = node.GetExpression();
+	bool unary = expression == "$uniMin" || expression == "$uniPlus";
+	if (!unary && expression != "$add" && expression != "$min" && expression != "$mul" && expression != "$div")
+		return false;
+
+	// The usual operation throws the exception for the wrong number of parameters
+	std::vector<std::shared_ptr<CompilerNode>> parameters = node.GetNodeparameters();
+	if (parameters.size() != (unary ? 1 : 2))
+		return false;
+
+	for (std::shared_ptr<CompilerNode> param : parameters)
+	{
+		if (param == nullptr)
+			return false;
+	}
+	return true;
+}
+
+// Runs a chain of operations from the deepest one up instead of one call inside the
+// other, a long expression is as deep as it is long. The operands are run in the
+// same order CheckParameters runs them, each operation gets only values
+std::shared_ptr<CompilerNode> VirtualMachine::CallOperations(CompilerNode node)
+{
+	struct Frame
+	{
+		CompilerNode node;
+		std::vector<std::shared_ptr<CompilerNode>> parameters;
+	};
+
+	std::vector<Frame> frames;
+	frames.push_back(Frame{ node, node.GetNodeparameters() });
+	frames.back().parameters.clear();
+
+	std::shared_ptr<CompilerNode> result;
+	while (true)
+	{
+		Frame& frame = frames.back();
+		size_t next = frame.parameters.size();
+		if (next < frame.node.GetNodeparameters().size())
+		{
+			std::shared_ptr<CompilerNode> param = frame.node.GetNodeparameter(next);
+			if (IsOperation(*param))
+			{
+				frames.push_back(Frame{ *param, std::vector<std::shared_ptr<CompilerNode>>() });
+				continue;
+			}
+
+			if (param->GetExpression() != "$value")
+				param = CallFunction(*param);
+			frame.parameters.push_back(param);
+			continue;
+		}
+
+		CompilerNode operation(frame.node);
+		operation.SetNodeParameters(frame.parameters);
+		result = function_caller->Call(operation.GetExpression(), operation);
+
+		frames.pop_back();
+		if (frames.empty())
+			return result;
+		frames.back().parameters.push_back(result);
+	}
+}
+
 std::vector<std::shared_ptr<CompilerNode>> VirtualMachine::CheckParameters(CompilerNode &compilerNode, int amount)
 {
 	if (compilerNode.GetNodeparameters().empty())
@@ -197,7 +292,7 @@ std::vector<std::shared_ptr<CompilerNode>> VirtualMachine::CheckParameters(Compi
 	return parameters;
 }
 
-std::shared_ptr<LinkedList> VirtualMachine::findList(std::string key)
+std::shared_ptr<LinkedList> VirtualMachine::findList(Atom key)
 {
 	for (int i = nodeLists.size() - 1; i >= 0; i--)
 	{
@@ -210,7 +305,7 @@ std::shared_ptr<LinkedList> VirtualMachine::findList(std::string key)
 	return nullptr;
 }
 
-int VirtualMachine::findPosition(std::string key)
+int VirtualMachine::findPosition(Atom key)
 {
 	for (int i = nodeLists.size() - 1; i >= 0; i--)
 	{
@@ -241,26 +336,22 @@ std::shared_ptr<CompilerNode> VirtualMachine::ExecuteFunction(CompilerNode compi
         throw FunctionNameExpectedException("Expected function name");
 
 	// Get the subroutine table and check if exists
-    Subroutine* sub = subroutineTable->GetSubroutine(functionNode->GetValue());
-    std::shared_ptr<Subroutine> t_subroutine = std::make_shared<Subroutine>();
-    if (sub != nullptr)
-        t_subroutine = std::make_shared<Subroutine>(*sub);
-    
+    Subroutine* t_subroutine = subroutineTable->GetSubroutine(functionNode->GetAtom());
 	if (t_subroutine == nullptr)
         throw SubroutineNotFoundException("Function " + functionNode->GetValue() + " does not exist");
 
-	// Set the currentSymbolTable
-	std::shared_ptr<SymbolTable> t_symboltable = std::make_shared<SymbolTable>(*t_subroutine->GetSymbolTable());
+	// Every call gets its own copy of the symboltable, a recursive call doesn't change the locals of its caller
+	SymbolTable t_symboltable(*t_subroutine->GetSymbolTable());
 
 	// Get parameter count and check if enough parameters are given
-	int parameterCount = t_symboltable->ParameterSize();
+	int parameterCount = t_symboltable.ParameterSize();
 	if (parameters.size() - 1 != parameterCount)
         //exceptions.push_back("Incorrect parameters");
         throw ParameterException((int)parameters.size() - 1, parameterCount, ParameterExceptionType::IncorrectParameters);
 
 	// Set the currentSymbolTable symbol values
 	int paramNum = 1;
-	std::vector<Symbol*> vSymbols = t_symboltable->GetSymbolVector();
+	std::vector<Symbol*> vSymbols = t_symboltable.GetSymbolVector();
 	for (Symbol* symbol : vSymbols)
 	{
 		std::shared_ptr<CompilerNode> param = parameters.at(paramNum);
@@ -272,14 +363,34 @@ std::shared_ptr<CompilerNode> VirtualMachine::ExecuteFunction(CompilerNode compi
 		paramNum++;
 	}
 
-	// Set the current subroutine and symboltable
-	currentSubroutine = t_subroutine.get();
-	currentSymbolTable = t_symboltable.get();
+	// A pure function called with the same arguments again gives the remembered result
+	MemoCache* memo = GetMemoCache(t_subroutine);
+	std::vector<uint64_t> memoKey;
+	std::string memoResult;
+	if (memo != nullptr)
+	{
+		memoKey = memo->GetKey(&t_symboltable);
+		if (memo->Find(memoKey, memoResult))
+			return std::make_shared<CompilerNode>("$value", memoResult, false);
+	}
+
+	// Set the current subroutine and symboltable, the ones of the caller come back after the call
+	Subroutine* callerSubroutine = currentSubroutine;
+	SymbolTable* callerSymbolTable = currentSymbolTable;
+	currentSubroutine = t_subroutine;
+	currentSymbolTable = &t_symboltable;
+
+	// Run the machine code of a hot function instead
+	std::shared_ptr<CompilerNode> result;
+	if (!RunJitFunction(currentSubroutine, result))
+		result = VirtualMachine::ExecuteNodes(std::make_shared<LinkedList>(*currentSubroutine->GetCompilerNodeCollection()));
 
-	SymbolTable* temp = new SymbolTable(*currentSymbolTable);
-	currentSymbolTable = temp;
+	currentSubroutine = callerSubroutine;
+	currentSymbolTable = callerSymbolTable;
 
-	return VirtualMachine::ExecuteNodes(std::make_shared<LinkedList>(*currentSubroutine->GetCompilerNodeCollection()));
+	if (memo != nullptr && result != nullptr && is_running)
+		memo->Store(memoKey, result->GetValue());
+	return result;
 }
 
 std::shared_ptr<CompilerNode> VirtualMachine::ExecuteReturn(CompilerNode compilerNode)
@@ -296,6 +407,171 @@ std::shared_ptr<CompilerNode> VirtualMachine::ExecuteReturn(CompilerNode compile
 
 #pragma endregion FunctionOperations
 
+#pragma region JitOperations
+
+void VirtualMachine::SetJitEnabled(bool enabled)
+{
+	jitEnabled = enabled;
+}
+
+void VirtualMachine::SetJitThreshold(int threshold)
+{
+	jitThreshold = threshold;
+}
+
+std::string VirtualMachine::GetJitLog()
+{
+	return jitLog;
+}
+
+bool VirtualMachine::RunJitFunction(Subroutine* subroutine, std::shared_ptr<CompilerNode> &result)
+{
+	if (!jitEnabled)
+		return false;
+
+	// Compile the function once it has been called often enough
+	JitCacheEntry& entry = jitFunctions[subroutine->atom];
+	if (!entry.tried && ++entry.count >= jitThreshold)
+	{
+		entry.tried = true;
+
+		std::shared_ptr<LinkedList> nodes = subroutine->GetCompilerNodeCollection();
+		JitCompiler compiler(currentSymbolTable, globalsSymboltable, numericMode);
+		entry.function = compiler.Compile(nodes->GetHead(), nodes->GetTail());
+		LogJit("function " + subroutine->name, entry.function, compiler.GetBailoutReason());
+	}
+
+	if (entry.function == nullptr)
+		return false;
+
+	JitExit exit = entry.function->Run(currentSymbolTable, globalsSymboltable, &is_running);
+	return HandleJitExit(entry.function.get(), exit, result);
+}
+
+bool VirtualMachine::RunJitLoop(std::shared_ptr<LinkedList> nodes, std::shared_ptr<CompilerNode> loopEnd, std::shared_ptr<CompilerNode> &result)
+{
+	if (!jitEnabled)
+		return false;
+
+	// Only the jump back to a while loop or to the start of a function without its tail calls is a loop
+	std::shared_ptr<CompilerNode> loopStart = loopEnd->GetJumpTo();
+	if (loopStart->GetExpression() != "$whileLoop" && loopStart->GetExpression() != "$whileCompare" && loopStart->GetExpression() != "$doNothing")
+		return false;
+
+	// Compile the loop once it has been repeated often enough
+	JitCacheEntry& entry = jitLoops[loopEnd.get()];
+	if (!entry.tried && ++entry.count >= jitThreshold)
+	{
+		entry.tried = true;
+
+		JitCompiler compiler(currentSymbolTable, globalsSymboltable, numericMode);
+		entry.function = compiler.Compile(FindListNode(nodes, loopStart), FindListNode(nodes, loopEnd));
+		std::string loopKind = loopStart->GetExpression() == "$doNothing" ? "tail call loop in " : "while loop in ";
+		LogJit(loopKind + currentSubroutine->name, entry.function, compiler.GetBailoutReason());
+	}
+
+	if (entry.function == nullptr)
+		return false;
+
+	JitExit exit = entry.function->Run(currentSymbolTable, globalsSymboltable, &is_running);
+	if (!HandleJitExit(entry.function.get(), exit, result))
+		return false;
+
+	// Continue after the loop
+	if (exit == JitExit::Finished)
+		nodes->SetCurrent(loopEnd, true);
+
+	return true;
+}
+
+bool VirtualMachine::HandleJitExit(JitFunction* function, JitExit exit, std::shared_ptr<CompilerNode> &result)
+{
+	switch (exit)
+	{
+	case JitExit::Returned:
+		result = std::make_shared<CompilerNode>(CompilerNode("$value", function->GetReturnValue(), false));
+		return true;
+	case JitExit::Finished:
+	case JitExit::Stopped:
+		return true;
+	case JitExit::Failed:
+		// Throw the exception the interpreter would have thrown
+		function->ThrowBuiltinError(numericMode);
+		switch (function->GetError())
+		{
+		case JitError::DivideByZero:
+			throw ZeroDivideException("Cannot divide by zero");
+		case JitError::DivisionByZero:
+			throw ZeroDivideException("Division by 0 exception occured.");
+		default:
+			throw InvalidInputException("Invalid Input");
+		}
+	default:
+		return false;
+	}
+}
+
+std::shared_ptr<ListNode> VirtualMachine::FindListNode(std::shared_ptr<LinkedList> nodes, std::shared_ptr<CompilerNode> node)
+{
+	for (std::shared_ptr<ListNode> listNode = nodes->GetHead(); listNode; listNode = listNode->GetNext())
+	{
+		if (listNode->GetData() == node)
+			return listNode;
+	}
+	return nullptr;
+}
+
+long long VirtualMachine::GetExecutedNodeCount()
+{
+	return executedNodes;
+}
+
+void VirtualMachine::SetMemoizeEnabled(bool enabled)
+{
+	memoizeEnabled = enabled;
+}
+
+void VirtualMachine::SetMemoCapacity(int capacity)
+{
+	memoCapacity = capacity;
+}
+
+std::string VirtualMachine::GetMemoLog()
+{
+	std::string log;
+	int hits = 0;
+	int misses = 0;
+	for (auto memo : memoCaches)
+	{
+		log += "Memoized " + memo.first->name + ": " + std::to_string(memo.second->GetHits()) + " hits, "
+			+ std::to_string(memo.second->GetMisses()) + " misses, " + std::to_string(memo.second->GetCapacity()) + " slots\n";
+		hits += memo.second->GetHits();
+		misses += memo.second->GetMisses();
+	}
+	return log + "Memoization: " + std::to_string(hits) + " hits, " + std::to_string(misses) + " misses\n";
+}
+
+MemoCache* VirtualMachine::GetMemoCache(Subroutine* subroutine)
+{
+	if (!memoizeEnabled || subroutine == nullptr || !subroutine->isPure)
+		return nullptr;
+
+	std::shared_ptr<MemoCache>& memo = memoCaches[subroutine];
+	if (memo == nullptr)
+		memo = std::make_shared<MemoCache>(subroutine->GetSymbolTable()->ParameterSize(), memoCapacity);
+	return memo.get();
+}
+
+void VirtualMachine::LogJit(std::string name, std::shared_ptr<JitFunction> function, std::string bailoutReason)
+{
+	if (function != nullptr)
+		jitLog += "Compiled " + name + " to " + std::to_string(function->CodeSize()) + " bytes\n";
+	else
+		jitLog += "Could not compile " + name + ": " + bailoutReason + "\n";
+}
+
+#pragma endregion JitOperations
+
 #pragma region VariableOperations
 std::shared_ptr<CompilerNode> VirtualMachine::ExecuteAssignment(CompilerNode compilerNode)
 {
@@ -317,18 +593,10 @@ std::shared_ptr<CompilerNode> VirtualMachine::ExecuteAssignment(CompilerNode com
 	if (param1->GetExpression() == "$identifier")
 	{
 		// Get the value of the node -> variable
-		std::string variableName = param1->GetValue();
+		Atom variableName = param1->GetAtom();
 		if (param2->GetExpression() != "$value")
-		{
-			Subroutine* t_subroutine = currentSubroutine;
-			SymbolTable* t_symboltable = currentSymbolTable;
-			
 			param2 = CallFunction(*param2);
 
-			currentSubroutine = t_subroutine;
-			currentSymbolTable = t_symboltable;
-		}
-
 		// Get the variable from symboltable
 		// first check subSymbolTable
 		Symbol* current_symbol = nullptr;
@@ -354,7 +622,7 @@ std::shared_ptr<CompilerNode> VirtualMachine::ExecuteGetVariable(CompilerNode co
 		throw ParameterException(1, ParameterExceptionType::NoParameters);
 
 	// Get the Node parameter
-	std::string parameter = compilerNode.GetValue();
+	Atom parameter = compilerNode.GetAtom();
 
 	// Get the variable from symboltable
 	// first check subSymbolTable
@@ -431,7 +699,7 @@ std::shared_ptr<CompilerNode> VirtualMachine::ExecuteWhile(CompilerNode compiler
 		// Condition is false, move linkedlist to donothing node
 		
 		//std::find(nodeLists.begin(), nodeLists.end(), currentSubroutine->name)->SetCurrent(compilerNode.GetJumpTo(), true);
-		findList(currentSubroutine->name)->SetCurrent(compilerNode.GetJumpTo(), true);
+		findList(currentSubroutine->atom)->SetCurrent(compilerNode.GetJumpTo(), true);
 		return nullptr;
 	}
 }
@@ -449,7 +717,7 @@ std::shared_ptr<CompilerNode> VirtualMachine::ExecuteFor(CompilerNode compilerNo
 
 	std::shared_ptr<CompilerNode> _assignment = parameters.at(0);
 	std::shared_ptr<CompilerNode> identifier = _assignment->GetNodeparameters().at(0);
-	if (currentSymbolTable->GetSymbol(identifier->GetValue()) != nullptr && currentSymbolTable->GetSymbol(identifier->GetValue())->IsSet())
+	if (currentSymbolTable->GetSymbol(identifier->GetAtom()) != nullptr && currentSymbolTable->GetSymbol(identifier->GetAtom())->IsSet())
 	{
 		std::shared_ptr<CompilerNode> expression = parameters.at(2);
 		if (expression->GetExpression() != "$value")
@@ -462,7 +730,7 @@ std::shared_ptr<CompilerNode> VirtualMachine::ExecuteFor(CompilerNode compilerNo
 		std::shared_ptr<CompilerNode> identifier = assignment->GetNodeparameters().at(0);
 		// If the symboltable doesn't contain the variable it's the first time in the for loop.
 		// Add the symbol to the table so it doesn't keep getting reset
-		Symbol* symbol = currentSymbolTable->GetSymbol(identifier->GetValue());
+		Symbol* symbol = currentSymbolTable->GetSymbol(identifier->GetAtom());
 		if (symbol == nullptr || !symbol->IsSet()) 
 		{
 			currentSymbolTable->AddSymbol(Symbol(identifier->GetValue(), MyTokenType::Float, SymbolKind::Local));
@@ -486,7 +754,7 @@ std::shared_ptr<CompilerNode> VirtualMachine::ExecuteFor(CompilerNode compilerNo
 	{
 		// Condition is false, move linkedlist to donothing node
 		//std::find(nodeLists.begin(), nodeLists.end(), currentSubroutine->name)->SetCurrent(compilerNode.GetJumpTo(), true);
-		findList(currentSubroutine->name)->SetCurrent(compilerNode.GetJumpTo(), true);
+		findList(currentSubroutine->atom)->SetCurrent(compilerNode.GetJumpTo(), true);
 		return nullptr;
 	}
 }
@@ -509,13 +777,345 @@ std::shared_ptr<CompilerNode> VirtualMachine::ExecuteIf(CompilerNode compilerNod
 	{
 		// Condition is false, move linkedlist to donothing node
 		//std::find(nodeLists.begin(), nodeLists.end(), currentSubroutine->name)->SetCurrent(compilerNode.GetJumpTo(), true);
-		findList(currentSubroutine->name)->SetCurrent(compilerNode.GetJumpTo(), true);
+		findList(currentSubroutine->atom)->SetCurrent(compilerNode.GetJumpTo(), true);
 		return nullptr;
 	}
 }
 
 #pragma endregion ConditionalOperations
 
+#pragma region FusedOperations
+
+// The fused operations skip the $value nodes between the steps but round every
+// intermediate result through toString like the unfused nodes do.
+
+std::shared_ptr<CompilerNode> VirtualMachine::ExecuteCompareBranch(CompilerNode compilerNode)
+{
+	if (!Compare(compilerNode))
+	{
+		// Condition is false, move linkedlist to donothing node
+		findList(currentSubroutine->atom)->SetCurrent(compilerNode.GetJumpTo(), true);
+	}
+	return nullptr;
+}
+
+std::shared_ptr<CompilerNode> VirtualMachine::ExecuteCompare(CompilerNode compilerNode)
+{
+	bool output = Compare(compilerNode);
+	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(output), false));
+}
+
+template <typename Policy>
+std::shared_ptr<CompilerNode> VirtualMachine::ExecuteIncrement(CompilerNode compilerNode)
+{
+	Symbol* symbol = GetVariableSymbol(compilerNode.GetAtom());
+	typename Policy::Value value = RoundValue(symbol->GetValue());
+	symbol->SetValue(RoundValue(value + 1));
+	return nullptr;
+}
+
+template <typename Policy>
+std::shared_ptr<CompilerNode> VirtualMachine::ExecuteDecrement(CompilerNode compilerNode)
+{
+	Symbol* symbol = GetVariableSymbol(compilerNode.GetAtom());
+	typename Policy::Value value = RoundValue(symbol->GetValue());
+	symbol->SetValue(RoundValue(value - 1));
+	return nullptr;
+}
+
+template <typename Policy>
+std::shared_ptr<CompilerNode> VirtualMachine::ExecuteAddConstant(CompilerNode compilerNode)
+{
+	if (compilerNode.GetNodeparameters().size() != 1)
+		throw ParameterException(1, compilerNode.GetNodeparameters().size(), ParameterExceptionType::IncorrectParameters);
+
+	typename Policy::Value constant = GetOperandValue(compilerNode.GetNodeparameters().at(0));
+	Symbol* symbol = GetVariableSymbol(compilerNode.GetAtom());
+	typename Policy::Value value = RoundValue(symbol->GetValue());
+	symbol->SetValue(RoundValue(value + constant));
+	return nullptr;
+}
+
+template <typename Policy>
+std::shared_ptr<CompilerNode> VirtualMachine::ExecuteSubtractConstant(CompilerNode compilerNode)
+{
+	if (compilerNode.GetNodeparameters().size() != 1)
+		throw ParameterException(1, compilerNode.GetNodeparameters().size(), ParameterExceptionType::IncorrectParameters);
+
+	typename Policy::Value constant = GetOperandValue(compilerNode.GetNodeparameters().at(0));
+	Symbol* symbol = GetVariableSymbol(compilerNode.GetAtom());
+	typename Policy::Value value = RoundValue(symbol->GetValue());
+	symbol->SetValue(RoundValue(value - constant));
+	return nullptr;
+}
+
+Symbol* VirtualMachine::GetVariableSymbol(Atom name)
+{
+	// first check subSymbolTable
+	Symbol* current_symbol = nullptr;
+	if (currentSymbolTable != nullptr)
+		current_symbol = currentSymbolTable->GetSymbol(name);
+
+	// if not in the subSymbolTable get from globals symboltable
+	if (current_symbol == nullptr)
+		current_symbol = globalsSymboltable->GetSymbol(name);
+
+	return current_symbol;
+}
+
+long double VirtualMachine::GetOperandValue(std::shared_ptr<CompilerNode> operand)
+{
+	if (operand->GetExpression() == "$getVariable")
+		return RoundValue(GetVariableSymbol(operand->GetAtom())->GetValue());
+
+	return atof(operand->GetValue().c_str());
+}
+
+// Same rounding as passing the value through a $value node
+long double VirtualMachine::RoundValue(long double value)
+{
+	return atof(toString(value).c_str());
+}
+
+bool VirtualMachine::Compare(CompilerNode &compilerNode)
+{
+	std::vector<std::shared_ptr<CompilerNode>> parameters = compilerNode.GetNodeparameters();
+	if (parameters.size() != 2)
+		throw ParameterException(2, parameters.size(), ParameterExceptionType::IncorrectParameters);
+
+	double num1 = GetOperandValue(parameters.at(0));
+	double num2 = GetOperandValue(parameters.at(1));
+
+	// The compare operation is stored in the value of the node
+	return CompareValues(compilerNode.GetValue(), num1, num2);
+}
+
+bool VirtualMachine::CompareValues(std::string operation, double num1, double num2)
+{
+	if (operation == "$less")
+		return num1 < num2;
+	if (operation == "$lessOrEq")
+		return num1 <= num2;
+	if (operation == "$greater")
+		return num1 > num2;
+	if (operation == "$greaterOrEq")
+		return num1 >= num2;
+	if (operation == "$equals")
+		return num1 == num2;
+	if (operation == "$notEquals")
+		return num1 != num2;
+
+	throw UnknownExpressionException("Unknown compare operation " + operation);
+}
+
+#pragma endregion FusedOperations
+
+#pragma region IntegerOperations
+
+// The integer operations give exactly the text the other operations give. A
+// whole number below 2^53 goes through a double unchanged, so it can skip the
+// long double strings. Anything else, like an overflow, goes to the usual
+// handler. The IntegerTypeInference proved the operands whole, gcd and fib don't
+// check that again.
+
+std::shared_ptr<CompilerNode> VirtualMachine::ExecuteIntegerGetVariable(CompilerNode compilerNode)
+{
+	Symbol* symbol = GetVariableSymbol(compilerNode.GetAtom());
+	if (symbol != nullptr && IsSmallInteger(symbol->GetValue()))
+		return std::make_shared<CompilerNode>(CompilerNode("$value", IntegerToString((long long)symbol->GetValue()), false));
+
+	return ExecuteGetVariable(compilerNode);
+}
+
+std::shared_ptr<CompilerNode> VirtualMachine::ExecuteIntegerOperation(CompilerNode compilerNode)
+{
+	std::string operation = compilerNode.GetExpression();
+	std::vector<std::shared_ptr<CompilerNode>> parameters = compilerNode.GetNodeparameters();
+	bool unary = operation == "$uniPlus" || operation == "$uniMin";
+
+	// The usual operation throws the exception for the wrong number of parameters
+	if (parameters.size() != (unary ? 1 : 2))
+		return function_caller->Call(operation, CompilerNode(operation, compilerNode.GetValue(), parameters, nullptr, false));
+
+	long double num1 = GetIntegerOperand(parameters.at(0));
+	long double num2 = unary ? 1 : GetIntegerOperand(parameters.at(1));
+
+	if ((operation == "$mod") && num2 == 0)
+		throw ZeroDivideException("Division by 0 exception occured.");
+
+	if (IsSmallInteger(num1) && IsSmallInteger(num2))
+	{
+		long long int1 = (long long)num1;
+		long long int2 = (long long)num2;
+		long long output = 0;
+
+		// A zero from a negative operand is -0 as a long double, that keeps its sign
+		bool exact = true;
+		if (operation == "$add" || operation == "$uniPlus")
+			output = int1 + int2;
+		else if (operation == "$min" || operation == "$uniMin")
+			output = int1 - int2;
+		else if (operation == "$mul")
+		{
+			exact = std::fabs(num1 * num2) < 9007199254740992.0L && ((int1 >= 0 && int2 >= 0) || (int1 != 0 && int2 != 0));
+			output = exact ? int1 * int2 : 0;
+		}
+		else
+		{
+			output = int1 % int2;
+			exact = output != 0 || int1 >= 0;
+		}
+
+		if (exact && IsSmallInteger(output))
+			return std::make_shared<CompilerNode>(CompilerNode("$value", IntegerToString(output), false));
+	}
+
+	// The operands are read back from their text unchanged, the usual handler computes in the precision of the run
+	std::vector<std::shared_ptr<CompilerNode>> values = { std::make_shared<CompilerNode>("$value", toString(num1), false) };
+	if (!unary)
+		values.push_back(std::make_shared<CompilerNode>("$value", toString(num2), false));
+	return function_caller->Call(operation, CompilerNode(operation, compilerNode.GetValue(), values, nullptr, false));
+}
+
+// The compares and the fused $compare, which keeps the operation in its value
+std::shared_ptr<CompilerNode> VirtualMachine::ExecuteIntegerCompare(CompilerNode compilerNode)
+{
+	std::string operation = compilerNode.GetExpression() == "$compare" ? compilerNode.GetValue() : compilerNode.GetExpression();
+	std::vector<std::shared_ptr<CompilerNode>> parameters = compilerNode.GetNodeparameters();
+	if (parameters.size() != 2)
+		return function_caller->Call(compilerNode.GetExpression(), CompilerNode(compilerNode.GetExpression(), compilerNode.GetValue(), parameters, nullptr, false));
+
+	double num1 = GetIntegerOperand(parameters.at(0));
+	double num2 = GetIntegerOperand(parameters.at(1));
+
+	static const std::string trueText = IntegerToString(1);
+	static const std::string falseText = IntegerToString(0);
+	return std::make_shared<CompilerNode>(CompilerNode("$value", CompareValues(operation, num1, num2) ? trueText : falseText, false));
+}
+
+std::shared_ptr<CompilerNode> VirtualMachine::ExecuteIntegerCompareBranch(CompilerNode compilerNode)
+{
+	std::vector<std::shared_ptr<CompilerNode>> parameters = compilerNode.GetNodeparameters();
+	if (parameters.size() != 2)
+		throw ParameterException(2, parameters.size(), ParameterExceptionType::IncorrectParameters);
+
+	double num1 = GetIntegerOperand(parameters.at(0));
+	double num2 = GetIntegerOperand(parameters.at(1));
+	if (!CompareValues(compilerNode.GetValue(), num1, num2))
+	{
+		// Condition is false, move linkedlist to donothing node
+		findList(currentSubroutine->atom)->SetCurrent(compilerNode.GetJumpTo(), true);
+	}
+	return nullptr;
+}
+
+// $increment, $decrement, $addConstant and $subtractConstant
+std::shared_ptr<CompilerNode> VirtualMachine::ExecuteIntegerIncrement(CompilerNode compilerNode)
+{
+	std::string operation = compilerNode.GetExpression();
+	std::vector<std::shared_ptr<CompilerNode>> parameters = compilerNode.GetNodeparameters();
+	Symbol* symbol = GetVariableSymbol(compilerNode.GetAtom());
+
+	long double constant = 1;
+	if (operation == "$addConstant" || operation == "$subtractConstant")
+		constant = parameters.size() == 1 ? GetIntegerOperand(parameters.at(0)) : 0.5;
+
+	if (symbol != nullptr && IsSmallInteger(symbol->GetValue()) && IsSmallInteger(constant))
+	{
+		long long value = (long long)symbol->GetValue();
+		long long step = (long long)constant;
+		long long output = operation == "$increment" || operation == "$addConstant" ? value + step : value - step;
+		if (IsSmallInteger(output))
+		{
+			symbol->SetValue(output);
+			return nullptr;
+		}
+	}
+
+	// The constant is a value or a variable, reading it again is the same
+	return function_caller->Call(operation, CompilerNode(operation, compilerNode.GetValue(), parameters, nullptr, false));
+}
+
+std::shared_ptr<CompilerNode> VirtualMachine::ExecuteIntegerGcd(CompilerNode compilerNode)
+{
+	std::vector<std::shared_ptr<CompilerNode>> parameters = compilerNode.GetNodeparameters();
+	if (parameters.size() != 2)
+		return ExecuteGcdOperation(compilerNode);
+
+	long double num1 = GetIntegerOperand(parameters.at(0));
+	long double num2 = GetIntegerOperand(parameters.at(1));
+	return Gcd(num1, num2, !IsSmallInteger(num1) || !IsSmallInteger(num2));
+}
+
+std::shared_ptr<CompilerNode> VirtualMachine::ExecuteIntegerFibonacci(CompilerNode compilerNode)
+{
+	std::vector<std::shared_ptr<CompilerNode>> parameters = compilerNode.GetNodeparameters();
+	if (parameters.size() != 1)
+		return ExecuteFibonacciOperation(compilerNode);
+
+	long double num1 = GetIntegerOperand(parameters.at(0));
+	return Fibonacci(num1, !IsSmallInteger(num1));
+}
+
+// The value the other operations read for an operand, atof(toString(value)) for a variable
+long double VirtualMachine::GetIntegerOperand(std::shared_ptr<CompilerNode> operand)
+{
+	if (operand->GetExpression() == "$getVariable")
+	{
+		Symbol* symbol = GetVariableSymbol(operand->GetAtom());
+		if (symbol != nullptr && IsSmallInteger(symbol->GetValue()))
+			return symbol->GetValue();
+	}
+
+	if (operand->GetExpression() != "$value")
+		operand = CallFunction(*operand);
+	return ParseNumber(operand->GetValue());
+}
+
+// atof, without the long double parse for "n.00000000000000"
+long double VirtualMachine::ParseNumber(const std::string& text)
+{
+	const char* character = text.c_str();
+	bool negative = *character == '-';
+	if (negative)
+		character++;
+
+	long long value = 0;
+	int digits = 0;
+	while (*character >= '0' && *character <= '9' && digits < 15)
+	{
+		value = value * 10 + (*character - '0');
+		character++;
+		digits++;
+	}
+
+	if (*character == '.')
+	{
+		character++;
+		while (*character == '0')
+			character++;
+	}
+
+	// -0 keeps its sign through atof
+	if (digits == 0 || *character != '\0' || (negative && value == 0))
+		return atof(text.c_str());
+	return negative ? -value : value;
+}
+
+// A whole number that a double holds exactly, -0 isn't one
+bool VirtualMachine::IsSmallInteger(long double value)
+{
+	return value > -9007199254740992.0L && value < 9007199254740992.0L && value == (long long)value && (value != 0 || !std::signbit(value));
+}
+
+// What toString gives for a whole number
+std::string VirtualMachine::IntegerToString(long long value)
+{
+	return std::to_string(value) + ".00000000000000";
+}
+
+#pragma endregion IntegerOperations
+
 #pragma region ConditionalStatements
 std::shared_ptr<CompilerNode> VirtualMachine::ExecuteLessCondition(CompilerNode compilerNode)
 {
@@ -654,6 +1254,7 @@ std::shared_ptr<CompilerNode> VirtualMachine::ExecuteAnd(CompilerNode compilerNo
 #pragma endregion ConditionalStatements
 
 #pragma region SimpleMath
+template <typename Policy>
 std::shared_ptr<CompilerNode> VirtualMachine::ExecuteAddOperation(CompilerNode compilerNode)
 {
 	// Get the Node parameters
@@ -668,14 +1269,15 @@ std::shared_ptr<CompilerNode> VirtualMachine::ExecuteAddOperation(CompilerNode c
 	const char* num1ss = num1s.c_str();
 	const char* num2ss = num2s.c_str();
 
-	long double num1 = strtod(num1ss, NULL);//atof(num1ss);
-	long double num2 = atof(num2ss);
-	long double output = num1 + num2;
+	typename Policy::Value num1 = strtod(num1ss, NULL);//atof(num1ss);
+	typename Policy::Value num2 = atof(num2ss);
+	typename Policy::Value output = num1 + num2;
 
 	// Create a new value compilernode to return
 	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(output), false));
 }
 
+template <typename Policy>
 std::shared_ptr<CompilerNode> VirtualMachine::ExecuteMinusOperation(CompilerNode compilerNode)
 {
 	// Get the Node parameters
@@ -684,14 +1286,15 @@ std::shared_ptr<CompilerNode> VirtualMachine::ExecuteMinusOperation(CompilerNode
 	std::shared_ptr<CompilerNode> param2 = parameters.at(1);
 
 	// Parse the parameters to a double for mathmatic operation
-	long double num1 = atof(param1->GetValue().c_str());
-	long double num2 = atof(param2->GetValue().c_str());
-	long double output = num1 - num2;
+	typename Policy::Value num1 = atof(param1->GetValue().c_str());
+	typename Policy::Value num2 = atof(param2->GetValue().c_str());
+	typename Policy::Value output = num1 - num2;
 
 	// Create a new value compilernode to return
 	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(output), false));
 }
 
+template <typename Policy>
 std::shared_ptr<CompilerNode> VirtualMachine::ExecuteMultiplyOperation(CompilerNode compilerNode)
 {
 	// Get the Node parameters
@@ -700,14 +1303,15 @@ std::shared_ptr<CompilerNode> VirtualMachine::ExecuteMultiplyOperation(CompilerN
 	std::shared_ptr<CompilerNode> param2 = parameters.at(1);
 
 	// Parse the parameters to a double for mathmatic operation
-	long double num1 = atof(param1->GetValue().c_str());
-	long double num2 = atof(param2->GetValue().c_str());
-	long double output = num1 * num2;
+	typename Policy::Value num1 = atof(param1->GetValue().c_str());
+	typename Policy::Value num2 = atof(param2->GetValue().c_str());
+	typename Policy::Value output = num1 * num2;
 
 	// Create a new value compilernode to return
 	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(output), false));
 }
 
+template <typename Policy>
 std::shared_ptr<CompilerNode> VirtualMachine::ExecuteDivideOperation(CompilerNode compilerNode)
 {
 	// Get the Node parameters
@@ -716,9 +1320,9 @@ std::shared_ptr<CompilerNode> VirtualMachine::ExecuteDivideOperation(CompilerNod
 	std::shared_ptr<CompilerNode> param2 = parameters.at(1);
 
 	// Parse the parameters to a double for mathmatic operation
-	long double num1 = atof(param1->GetValue().c_str());
-	long double num2 = atof(param2->GetValue().c_str());
-	long double output = num1 / num2;
+	typename Policy::Value num1 = atof(param1->GetValue().c_str());
+	typename Policy::Value num2 = atof(param2->GetValue().c_str());
+	typename Policy::Value output = num1 / num2;
 
 	// Check if num2 is not zero
 	if (num2 == 0)
@@ -728,6 +1332,7 @@ std::shared_ptr<CompilerNode> VirtualMachine::ExecuteDivideOperation(CompilerNod
 	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(output), false));
 }
 
+template <typename Policy>
 std::shared_ptr<CompilerNode> VirtualMachine::ExecuteUniMinOperation(CompilerNode compilerNode)
 {
 	// Get the Node parameters
@@ -735,13 +1340,14 @@ std::shared_ptr<CompilerNode> VirtualMachine::ExecuteUniMinOperation(CompilerNod
 	std::shared_ptr<CompilerNode> param1 = parameters.at(0);
 
 	// Parse the parameters to a double for mathmatic operation
-	long double num1 = atof(param1->GetValue().c_str());
-	long double output = num1 - 1;
+	typename Policy::Value num1 = atof(param1->GetValue().c_str());
+	typename Policy::Value output = num1 - 1;
 
 	// Create a new value compilernode to return
 	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(output), false));
 }
 
+template <typename Policy>
 std::shared_ptr<CompilerNode> VirtualMachine::ExecuteUniPlusOperation(CompilerNode compilerNode)
 {
 	// Get the Node parameters
@@ -749,8 +1355,8 @@ std::shared_ptr<CompilerNode> VirtualMachine::ExecuteUniPlusOperation(CompilerNo
 	std::shared_ptr<CompilerNode> param1 = parameters.at(0);
 
 	// Parse the parameters to a double for mathmatic operation
-	long double num1 = atof(param1->GetValue().c_str());
-	long double output = num1 + 1;
+	typename Policy::Value num1 = atof(param1->GetValue().c_str());
+	typename Policy::Value output = num1 + 1;
 
 	// Create a new value compilernode to return
 	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(output), false));
@@ -759,280 +1365,38 @@ std::shared_ptr<CompilerNode> VirtualMachine::ExecuteUniPlusOperation(CompilerNo
 #pragma endregion SimpleMath
 
 #pragma region ComplexMath
-std::shared_ptr<CompilerNode> VirtualMachine::ExecuteSqrOperation(CompilerNode compilerNode)
-{
-	// Get the Node parameters
-	std::vector<std::shared_ptr<CompilerNode> > parameters = CheckParameters(compilerNode, 1);
-	std::shared_ptr<CompilerNode> param1 = parameters.at(0);
-
-	// Parse the parameters to a double for mathmatic operation
-	long double num1 = atof(param1->GetValue().c_str());
-
-	long double output = std::pow(num1, 2);
-	// Create a new value compilernode to return
-	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(output), false));
-}
-
-std::shared_ptr<CompilerNode> VirtualMachine::ExecuteCbcOperation(CompilerNode compilerNode)
-{
-	// Get the Node parameters
-	std::vector<std::shared_ptr<CompilerNode> > parameters = CheckParameters(compilerNode, 1);
-	std::shared_ptr<CompilerNode> param1 = parameters.at(0);
-
-	// Parse the parameters to a double for mathmatic operation
-	long double num1 = atof(param1->GetValue().c_str());
-
-	long double output = std::pow(num1, 3);
-	// Create a new value compilernode to return
-	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(output), false));
-}
-
-std::shared_ptr<CompilerNode> VirtualMachine::ExecutePowOperation(CompilerNode compilerNode)
-{
-	// Get the Node parameters
-	std::vector<std::shared_ptr<CompilerNode> > parameters = CheckParameters(compilerNode, 2);
-	std::shared_ptr<CompilerNode> param1 = parameters.at(0);
-	std::shared_ptr<CompilerNode> param2 = parameters.at(1);
-
-	// Parse the parameters to a double for mathmatic operation
-	long double num1 = atof(param1->GetValue().c_str());
-	long double num2 = atof(param2->GetValue().c_str());
-
-	// TODO CHECKS
-
-	long double output = std::pow(num1, num2);
-	// Create a new value compilernode to return
-	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(output), false));
-}
-
-std::shared_ptr<CompilerNode> VirtualMachine::ExecuteSqrtOperation(CompilerNode compilerNode)
-{
-	// Get the Node parameters
-	std::vector<std::shared_ptr<CompilerNode> > parameters = CheckParameters(compilerNode, 1);
-	std::shared_ptr<CompilerNode> param1 = parameters.at(0);
-
-	// Parse the parameters to a double for mathmatic operation
-	long double num1 = atof(param1->GetValue().c_str());
-	if (num1 < 0)
-		throw InvalidInputException("InvalidInputException occured. Can't calculate square root of negative value.");
-
-	long double output = std::sqrt(num1);
-	// Create a new value compilernode to return
-	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(output), false));
-}
-
-std::shared_ptr<CompilerNode> VirtualMachine::ExecuteCbrtOperation(CompilerNode compilerNode)
-{
-	// Get the Node parameters
-	std::vector<std::shared_ptr<CompilerNode> > parameters = CheckParameters(compilerNode, 1);
-	std::shared_ptr<CompilerNode> param1 = parameters.at(0);
-
-	// Parse the parameters to a double for mathmatic operation
-	long double num1 = atof(param1->GetValue().c_str());
-
-	long double output = std::cbrt(num1);
-	// Create a new value compilernode to return
-	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(output), false));
-}
-
-
-std::shared_ptr<CompilerNode> VirtualMachine::ExecuteSinOperation(CompilerNode compilerNode)
-{
-	// Get the Node parameters
-	std::vector<std::shared_ptr<CompilerNode> > parameters = CheckParameters(compilerNode, 1);
-	std::shared_ptr<CompilerNode> param1 = parameters.at(0);
-
-	// Parse the parameters to a double for mathmatic operation
-	long double num1 = atof(param1->GetValue().c_str());
-	long double output = std::sin(num1 * (M_PI / 180));
-
-	// Create a new value compilernode to return
-	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(output), false));
-}
-
-std::shared_ptr<CompilerNode> VirtualMachine::ExecuteSinrOperation(CompilerNode compilerNode)
-{
-	// Get the Node parameters
-	std::vector<std::shared_ptr<CompilerNode> > parameters = CheckParameters(compilerNode, 1);
-	std::shared_ptr<CompilerNode> param1 = parameters.at(0);
-
-	// Parse the parameters to a double for mathmatic operation
-	long double num1 = atof(param1->GetValue().c_str());
-	long double output = std::sin(num1);
-
-	// Create a new value compilernode to return
-	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(output), false));
-}
-
-std::shared_ptr<CompilerNode> VirtualMachine::ExecuteCosOperation(CompilerNode compilerNode)
-{
-	// Get the Node parameters
-	std::vector<std::shared_ptr<CompilerNode> > parameters = CheckParameters(compilerNode, 1);
-	std::shared_ptr<CompilerNode> param1 = parameters.at(0);
-
-	// Parse the parameters to a double for mathmatic operation
-	long double num1 = atof(param1->GetValue().c_str());
-	long double output = std::cos(num1* (M_PI / 180));
-
-	// Create a new value compilernode to return
-	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(output), false));
-}
-
-std::shared_ptr<CompilerNode> VirtualMachine::ExecuteCosrOperation(CompilerNode compilerNode)
-{
-	// Get the Node parameters
-	std::vector<std::shared_ptr<CompilerNode> > parameters = CheckParameters(compilerNode, 1);
-	std::shared_ptr<CompilerNode> param1 = parameters.at(0);
-
-	// Parse the parameters to a double for mathmatic operation
-	long double num1 = atof(param1->GetValue().c_str());
-	long double output = std::cos(num1);
-
-	// Create a new value compilernode to return
-	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(output), false));
-}
-
-std::shared_ptr<CompilerNode> VirtualMachine::ExecuteTanOperation(CompilerNode compilerNode)
-{
-	// Get the Node parameters
-	std::vector<std::shared_ptr<CompilerNode> > parameters = CheckParameters(compilerNode, 1);
-	std::shared_ptr<CompilerNode> param1 = parameters.at(0);
-
-	// Parse the parameters to a double for mathmatic operation
-	long double num1 = atof(param1->GetValue().c_str());
-	long double output = std::tan(num1* (M_PI / 180));
-
-	// Create a new value compilernode to return
-	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(output), false));
-}
-
-std::shared_ptr<CompilerNode> VirtualMachine::ExecuteTanrOperation(CompilerNode compilerNode)
-{
-	// Get the Node parameters
-	std::vector<std::shared_ptr<CompilerNode> > parameters = CheckParameters(compilerNode, 1);
-	std::shared_ptr<CompilerNode> param1 = parameters.at(0);
-
-	// Parse the parameters to a double for mathmatic operation
-	long double num1 = atof(param1->GetValue().c_str());
-	long double output = std::tan(num1);
-
-	// Create a new value compilernode to return
-	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(output), false));
-}
-
-std::shared_ptr<CompilerNode> VirtualMachine::ExecuteDegreeOperation(CompilerNode compilerNode)
-{
-	// Get the Node parameters
-	std::vector<std::shared_ptr<CompilerNode> > parameters = CheckParameters(compilerNode, 1);
-	std::shared_ptr<CompilerNode> param1 = parameters.at(0);
 
-	// Parse the parameters to a double for mathmatic operation
-	long double num1 = atof(param1->GetValue().c_str());
-	long double output = num1 * (180 / M_PI);
-
-	// Create a new value compilernode to return
-	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(output), false));
-}
-
-std::shared_ptr<CompilerNode> VirtualMachine::ExecuteRadiantOperation(CompilerNode compilerNode)
-{
-	// Get the Node parameters
-	std::vector<std::shared_ptr<CompilerNode> > parameters = CheckParameters(compilerNode, 1);
-	std::shared_ptr<CompilerNode> param1 = parameters.at(0);
-
-	// Parse the parameters to a double for mathmatic operation
-	long double num1 = atof(param1->GetValue().c_str());
-	long double output = num1 * (M_PI / 180);
-	// Create a new value compilernode to return
-	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(output), false));
-}
-
-std::shared_ptr<CompilerNode> VirtualMachine::ExecutePercentOperation(CompilerNode compilerNode)
+// A builtin of BuiltinMath, the parser made the node with as many parameters as the handler takes
+template <typename Policy>
+std::shared_ptr<CompilerNode> VirtualMachine::ExecuteBuiltin(int index, CompilerNode& compilerNode)
 {
-	// Get the Node parameters
-	std::vector<std::shared_ptr<CompilerNode> > parameters = CheckParameters(compilerNode, 2);
-	std::shared_ptr<CompilerNode> param1 = parameters.at(0);
-	std::shared_ptr<CompilerNode> param2 = parameters.at(1);
+	const BuiltinEntry<typename Policy::Value>& builtin = BuiltinMath<typename Policy::Value>::table[index];
 
-	// Parse the parameters to a double for mathmatic operation
-	long double num1 = atof(param1->GetValue().c_str());
-	long double num2 = atof(param2->GetValue().c_str());
-	if (num2 == 0)
-		throw ZeroDivideException("Division by 0 exception occured.");
-	long double output = (num1 / num2) * 100;
-	// Create a new value compilernode to return
-	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(output), false));
-}
-
-std::shared_ptr<CompilerNode> VirtualMachine::ExecutePermillageOperation(CompilerNode compilerNode)
-{
-	// Get the Node parameters
-	std::vector<std::shared_ptr<CompilerNode> > parameters = CheckParameters(compilerNode, 2);
-	std::shared_ptr<CompilerNode> param1 = parameters.at(0);
-	std::shared_ptr<CompilerNode> param2 = parameters.at(1);
-
-	// Parse the parameters to a double for mathmatic operation
-	long double num1 = atof(param1->GetValue().c_str());
-	long double num2 = atof(param2->GetValue().c_str());
-	if (num2 == 0)
-		throw ZeroDivideException("Division by 0 exception occured.");
-	long double output = (num1 / num2) * 1000;
-	// Create a new value compilernode to return
-	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(output), false));
-}
-
-std::shared_ptr<CompilerNode> VirtualMachine::ExecuteCommonLogOperation(CompilerNode compilerNode)
-{
-	// Get the Node parameters
-	std::vector<std::shared_ptr<CompilerNode> > parameters = CheckParameters(compilerNode, 1);
-	std::shared_ptr<CompilerNode> param1 = parameters.at(0);
-
-	// Parse the parameters to a double for mathmatic operation	
-	long double num1 = atof(param1->GetValue().c_str());
-	
-	if (num1 <= 0)
-		throw InvalidInputException("Invalid Input");
-
-	long double output = std::log10(num1);
-	// Create a new value compilernode to return
-	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(output), false));
-}
-
-std::shared_ptr<CompilerNode> VirtualMachine::ExecuteBinaryLogOperation(CompilerNode compilerNode)
-{
-	// Get the Node parameters
-	std::vector<std::shared_ptr<CompilerNode> > parameters = CheckParameters(compilerNode, 1);
-	std::shared_ptr<CompilerNode> param1 = parameters.at(0);
-
-	// Parse the parameters to a double for mathmatic operation
-	long double num1 = atof(param1->GetValue().c_str());
-
-	if (num1 <= 0)
-		throw InvalidInputException("Invalid Input");
-
-	long double output = std::log2(num1);
-	// Create a new value compilernode to return
-	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(output), false));
-}
-
-std::shared_ptr<CompilerNode> VirtualMachine::ExecuteNaturalLogOperation(CompilerNode compilerNode)
-{
-	// Get the Node parameters
-	std::vector<std::shared_ptr<CompilerNode> > parameters = CheckParameters(compilerNode, 1);
-	std::shared_ptr<CompilerNode> param1 = parameters.at(0);
-
-	// Parse the parameters to a double for mathmatic operation
-	long double num1 = atof(param1->GetValue().c_str());
+	// Run the parameters in order and parse them for the handler
+	typename Policy::Value numbers[3];
+	for (int i = 0; i < builtin.arity; i++)
+	{
+		std::shared_ptr<CompilerNode> param = compilerNode.GetNodeparameter(i);
+		if (param->GetExpression() != "$value")
+			param = CallFunction(*param);
+		numbers[i] = atof(param->GetValue().c_str());
+	}
 
-	if (num1 <= 0)
-		throw InvalidInputException("Invalid Input");
+	typename Policy::Value output;
+	if (builtin.arity == 1)
+		output = builtin.handler.unary(numbers[0]);
+	else if (builtin.arity == 2)
+		output = builtin.handler.binary(numbers[0], numbers[1]);
+	else
+		output = builtin.handler.ternary(numbers[0], numbers[1], numbers[2]);
 
-	long double output = std::log(num1);
 	// Create a new value compilernode to return
 	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(output), false));
 }
 
-std::shared_ptr<CompilerNode> VirtualMachine::ExecuteLogOperation(CompilerNode compilerNode)
+// Only made by the StrengthReducer with fast math, the exponent is a whole number
+template <typename Policy>
+std::shared_ptr<CompilerNode> VirtualMachine::ExecutePowIntOperation(CompilerNode compilerNode)
 {
 	// Get the Node parameters
 	std::vector<std::shared_ptr<CompilerNode> > parameters = CheckParameters(compilerNode, 2);
@@ -1040,18 +1404,15 @@ std::shared_ptr<CompilerNode> VirtualMachine::ExecuteLogOperation(CompilerNode c
 	std::shared_ptr<CompilerNode> param2 = parameters.at(1);
 
 	// Parse the parameters to a double for mathmatic operation
-	long double num1 = atof(param1->GetValue().c_str());
-	long double num2 = atof(param2->GetValue().c_str());
-
-	if (num1 <= 0 || num2 <= 0 || num2 == 1)
-		throw InvalidInputException("Invalid Input");
+	typename Policy::Value num1 = atof(param1->GetValue().c_str());
+	typename Policy::Value num2 = atof(param2->GetValue().c_str());
 
-	long double output = std::log(num1) / std::log(num2);
+	typename Policy::Value output = Policy::IntegerPower(num1, num2);
 	// Create a new value compilernode to return
 	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(output), false));
 }
 
-std::shared_ptr<CompilerNode> VirtualMachine::ExecuteModuloOperation(CompilerNode compilerNode)
+std::shared_ptr<CompilerNode> VirtualMachine::ExecuteGcdOperation(CompilerNode compilerNode)
 {
 	// Get the Node parameters
 	std::vector<std::shared_ptr<CompilerNode> > parameters = CheckParameters(compilerNode, 2);
@@ -1061,30 +1422,15 @@ std::shared_ptr<CompilerNode> VirtualMachine::ExecuteModuloOperation(CompilerNod
 	// Parse the parameters to a double for mathmatic operation
 	long double num1 = atof(param1->GetValue().c_str());
 	long double num2 = atof(param2->GetValue().c_str());
-
-	if (num2 == 0)
-		throw ZeroDivideException("Division by 0 exception occured.");
-
-	long double output = std::fmod(num1, num2);
-	// Create a new value compilernode to return
-	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(output), false));
+	return Gcd(num1, num2, true);
 }
 
-std::shared_ptr<CompilerNode> VirtualMachine::ExecuteGcdOperation(CompilerNode compilerNode)
+std::shared_ptr<CompilerNode> VirtualMachine::Gcd(long double num1, long double num2, bool checkType)
 {
-	// Get the Node parameters
-	std::vector<std::shared_ptr<CompilerNode> > parameters = CheckParameters(compilerNode, 2);
-	std::shared_ptr<CompilerNode> param1 = parameters.at(0);
-	std::shared_ptr<CompilerNode> param2 = parameters.at(1);
-
-	// Parse the parameters to a double for mathmatic operation
-	long double num1 = atof(param1->GetValue().c_str());
-	long double num2 = atof(param2->GetValue().c_str());
-
 	long long int1 = num1;
 	long long int2 = num2;
 
-	if (num1 != int1 || num2 != int2)
+	if (checkType && (num1 != int1 || num2 != int2))
 		throw UnexpectedTypeException("An UnexpectedTypeException occured in function 'gcd'. Expected integer parameters.");
 
 	if (int1 < 0)
@@ -1092,33 +1438,22 @@ std::shared_ptr<CompilerNode> VirtualMachine::ExecuteGcdOperation(CompilerNode c
 	if (int2 < 0)
 		int2 *= -1;
 
+	// Euclid, with 1 when one of them is 0 like counting up to the smallest did
 	long long output = 1;
-
-	for (long long i = 1; i <= int1&&i <= int2; i++)
-		if (int1%i == 0 && int2%i == 0)
-			output = i;
+	if (int1 > 0 && int2 > 0)
+	{
+		while (int2 != 0)
+		{
+			long long rest = int1 % int2;
+			int1 = int2;
+			int2 = rest;
+		}
+		output = int1;
+	}
 	// Create a new value compilernode to return
 	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(output), false));
 }
 
-std::shared_ptr<CompilerNode> VirtualMachine::ExecuteDiscriminantOperation(CompilerNode compilerNode)
-{
-	// Get the Node parameters
-	std::vector<std::shared_ptr<CompilerNode> > parameters = CheckParameters(compilerNode, 3);
-	std::shared_ptr<CompilerNode> param1 = parameters.at(0);
-	std::shared_ptr<CompilerNode> param2 = parameters.at(1);
-	std::shared_ptr<CompilerNode> param3 = parameters.at(2);
-
-	// Parse the parameters to a double for mathmatic operation
-	long double numA = atof(param1->GetValue().c_str());
-	long double numB = atof(param2->GetValue().c_str());
-	long double numC = atof(param3->GetValue().c_str());
-
-	long double output = std::pow(numB, 2) - (4 * numA * numC);
-
-	// Create a new value compilernode to return
-	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(output), false));
-}
 std::shared_ptr<CompilerNode> VirtualMachine::ExecuteAbcOperation(CompilerNode compilerNode)
 {
 	// Get the Node parameters
@@ -1175,9 +1510,14 @@ std::shared_ptr<CompilerNode> VirtualMachine::ExecuteFibonacciOperation(Compiler
 
 	// Parse the parameters to a double for mathmatic operation
 	long double num1 = atof(param1->GetValue().c_str());
+	return Fibonacci(num1, true);
+}
+
+std::shared_ptr<CompilerNode> VirtualMachine::Fibonacci(long double num1, bool checkType)
+{
 	long long int1 = num1;
 
-	if (num1 != int1)
+	if (checkType && num1 != int1)
 		throw UnexpectedTypeException("An UnexpectedTypeException occured in function 'fib'. Expected integer parameter.");
 	if (int1 >= 93)
 		throw UnexpectedParameterException("An UnexpectedParameterException occured in function 'fib'. Result won't be precise for input '"+toString(int1)+"'.");
@@ -1201,142 +1541,71 @@ std::shared_ptr<CompilerNode> VirtualMachine::ExecuteFibonacciOperation(Compiler
 	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(output), false));
 }
 
-std::shared_ptr<CompilerNode> VirtualMachine::ExecutePythagoreanOperation(CompilerNode compilerNode)
-{
-	// Get the Node parameters
-	std::vector<std::shared_ptr<CompilerNode> > parameters = CheckParameters(compilerNode, 2);
-	std::shared_ptr<CompilerNode> param1 = parameters.at(0);
-	std::shared_ptr<CompilerNode> param2 = parameters.at(1);
-
-	// Parse the parameters to a double for mathmatic operation
-	long double num = atof(param1->GetValue().c_str());
-	long double numC = atof(param2->GetValue().c_str());
-
-	if (num <= 0 || numC <= 0 )
-		throw InvalidInputException("An InvalidInputException occured. Input for 'pyt' can't be negative.");
-
-	if (num > numC)
-		throw InvalidInputException("An InvalidInputException occured. Input 'c' can't be smaller than 'x'");
-
-	long double output = std::sqrt(pow(numC, 2) - pow(num, 2));
-	// Create a new value compilernode to return
-	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(output), false));
-}
+#pragma endregion ComplexMath
 
-std::shared_ptr<CompilerNode> VirtualMachine::ExecutePythagoreanHOperation(CompilerNode compilerNode)
+#pragma region MathConstants
+// PI
+std::shared_ptr<CompilerNode> VirtualMachine::ExecutePiConstant(CompilerNode compilerNode)
 {
-	// Get the Node parameters
-	std::vector<std::shared_ptr<CompilerNode> > parameters = CheckParameters(compilerNode, 2);
-	std::shared_ptr<CompilerNode> param1 = parameters.at(0);
-	std::shared_ptr<CompilerNode> param2 = parameters.at(1);
-
-	// Parse the parameters to a double for mathmatic operation
-	long double numA = atof(param1->GetValue().c_str());
-	long double numB = atof(param2->GetValue().c_str());
-
-	if (numA <= 0 || numB <= 0)
-		throw InvalidInputException("An InvalidInputException occured. Input for 'pyth' can't be negative.");
-
-	long double output = std::sqrt(pow(numA, 2) + pow(numB, 2));
-	// Create a new value compilernode to return
-	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(output), false));
+	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(M_PI), false));	
 }
-
-
-#pragma endregion ComplexMath
-
-#pragma region Physics
-
-std::shared_ptr<CompilerNode> VirtualMachine::ExecuteDistanceOperation(CompilerNode compilerNode){
-	// Get the Node parameters
-	std::vector<std::shared_ptr<CompilerNode> > parameters = CheckParameters(compilerNode, 2);
-	std::shared_ptr<CompilerNode> param1 = parameters.at(0);
-	std::shared_ptr<CompilerNode> param2 = parameters.at(1);
-
-	// Parse the parameters to a double for mathmatic operation
-	long double num1 = atof(param1->GetValue().c_str());
-	long double num2 = atof(param2->GetValue().c_str());
-	long double output = num1*num2;
-// Create a new value compilernode to return
-	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(output), false));
+// EULER
+std::shared_ptr<CompilerNode> VirtualMachine::ExecuteEConstant(CompilerNode compilerNode)
+{
+	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(M_E), false));
 }
+#pragma endregion MathConstants
 
-std::shared_ptr<CompilerNode> VirtualMachine::ExecuteVelocityOperation(CompilerNode compilerNode){
-	// Get the Node parameters
-	std::vector<std::shared_ptr<CompilerNode> > parameters = CheckParameters(compilerNode, 2);
-	std::shared_ptr<CompilerNode> param1 = parameters.at(0);
-	std::shared_ptr<CompilerNode> param2 = parameters.at(1);
+#pragma region NumericModes
 
-	// Parse the parameters to a double for mathmatic operation
-	long double num1 = atof(param1->GetValue().c_str());
-	long double num2 = atof(param2->GetValue().c_str());
-	if (num2 == 0)
-		throw ZeroDivideException("Division by 0 exception occured.");
-	long double output = num1 / num2;
-	// Create a new value compilernode to return
-	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(output), false));
+VirtualMachine::BuiltinOperation VirtualMachine::GetBuiltinOperation(NumericMode mode)
+{
+	if (mode == NumericMode::Double)
+		return &VirtualMachine::ExecuteBuiltin<DoublePolicy>;
+	return &VirtualMachine::ExecuteBuiltin<LongDoublePolicy>;
 }
 
-std::shared_ptr<CompilerNode> VirtualMachine::ExecuteTimeOperation(CompilerNode compilerNode){
-	// Get the Node parameters
-	std::vector<std::shared_ptr<CompilerNode> > parameters = CheckParameters(compilerNode, 2);
-	std::shared_ptr<CompilerNode> param1 = parameters.at(0);
-	std::shared_ptr<CompilerNode> param2 = parameters.at(1);
-
-	// Parse the parameters to a double for mathmatic operation
-	long double num1 = atof(param1->GetValue().c_str());
-	long double num2 = atof(param2->GetValue().c_str());
-	if (num2 == 0)
-		throw ZeroDivideException("Division by 0 exception occured.");
-	long double output = num1 / num2;
-	// Create a new value compilernode to return
-	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(output), false));
+std::map<std::string, VirtualMachine::Operation> VirtualMachine::GetMathOperations(NumericMode mode)
+{
+	if (mode == NumericMode::Double)
+		return MakeMathOperations<DoublePolicy>();
+	return MakeMathOperations<LongDoublePolicy>();
 }
 
-std::shared_ptr<CompilerNode> VirtualMachine::ExecuteAverageVelocityOperation(CompilerNode compilerNode){
-	// Get the Node parameters
-	std::vector<std::shared_ptr<CompilerNode> > parameters = CheckParameters(compilerNode, 2);
-	std::shared_ptr<CompilerNode> param1 = parameters.at(0);
-	std::shared_ptr<CompilerNode> param2 = parameters.at(1);
-
-	// Parse the parameters to a double for mathmatic operation
-	long double num1 = atof(param1->GetValue().c_str());
-	long double num2 = atof(param2->GetValue().c_str());
-	if (num2 == 0)
-		throw ZeroDivideException("Division by 0 exception occured.");
+template <typename Policy>
+std::map<std::string, VirtualMachine::Operation> VirtualMachine::MakeMathOperations()
+{
+	std::map<std::string, Operation> operations;
 
-	long double output = num1 / num2;
-	// Create a new value compilernode to return
-	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(output), false));
-}
+	// Fused operations
+	operations["$increment"] = &VirtualMachine::ExecuteIncrement<Policy>;
+	operations["$decrement"] = &VirtualMachine::ExecuteDecrement<Policy>;
+	operations["$addConstant"] = &VirtualMachine::ExecuteAddConstant<Policy>;
+	operations["$subtractConstant"] = &VirtualMachine::ExecuteSubtractConstant<Policy>;
 
-std::shared_ptr<CompilerNode> VirtualMachine::ExecuteAccelerationOperation(CompilerNode compilerNode){
-	// Get the Node parameters
-	std::vector<std::shared_ptr<CompilerNode> > parameters = CheckParameters(compilerNode, 2);
-	std::shared_ptr<CompilerNode> param1 = parameters.at(0);
-	std::shared_ptr<CompilerNode> param2 = parameters.at(1);
+	// Simple math operations
+	operations["$add"] = &VirtualMachine::ExecuteAddOperation<Policy>;
+	operations["$min"] = &VirtualMachine::ExecuteMinusOperation<Policy>;
+	operations["$mul"] = &VirtualMachine::ExecuteMultiplyOperation<Policy>;
+	operations["$div"] = &VirtualMachine::ExecuteDivideOperation<Policy>;
+	operations["$uniMin"] = &VirtualMachine::ExecuteUniMinOperation<Policy>;
+	operations["$uniPlus"] = &VirtualMachine::ExecuteUniPlusOperation<Policy>;
 
-	// Parse the parameters to a double for mathmatic operation
-	long double num1 = atof(param1->GetValue().c_str());
-	long double num2 = atof(param2->GetValue().c_str());
-	if (num2 == 0)
-		throw ZeroDivideException("Division by 0 exception occured.");
+	// Made by the StrengthReducer, the builtins run through ExecuteBuiltin
+	operations["$powInt"] = &VirtualMachine::ExecutePowIntOperation<Policy>;
 
-	long double output = num1 / num2;
-	// Create a new value compilernode to return
-	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(output), false));
+	return operations;
 }
-#pragma endregion Physics
 
-#pragma region MathConstants
-// PI
-std::shared_ptr<CompilerNode> VirtualMachine::ExecutePiConstant(CompilerNode compilerNode)
+void VirtualMachine::SetNumericMode(NumericMode mode)
 {
-	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(M_PI), false));	
+	numericMode = mode;
+	function_caller->SetNumericMode(mode);
 }
-// EULER
-std::shared_ptr<CompilerNode> VirtualMachine::ExecuteEConstant(CompilerNode compilerNode)
+
+NumericMode VirtualMachine::GetNumericMode()
 {
-	return std::make_shared<CompilerNode>(CompilerNode("$value", toString(M_E), false));
+	return numericMode;
 }
-#pragma endregion MathConstants
\ No newline at end of file
+
+#pragma endregion NumericModes
\ No newline at end of file
@@ -11,6 +11,10 @@
 #include "CompilerNode.h"
 #include "FunctionCaller.h"
 #include "LinkedList.h"
+#include "JitCompiler.h"
+#include "MemoCache.h"
+#include "NumericPolicy.h"
+#include "Builtins.h"
 
 #include "ParameterException.h"
 #include "MissingCompilerNodeException.h"
@@ -56,13 +60,34 @@ public:
 	// Condition operations
 	std::shared_ptr<CompilerNode> ExecuteIf(CompilerNode compilerNode);
 
+	// Fused operations
+	std::shared_ptr<CompilerNode> ExecuteCompareBranch(CompilerNode compilerNode);
+	std::shared_ptr<CompilerNode> ExecuteCompare(CompilerNode compilerNode);
+	template <typename Policy> std::shared_ptr<CompilerNode> ExecuteIncrement(CompilerNode compilerNode);
+	template <typename Policy> std::shared_ptr<CompilerNode> ExecuteDecrement(CompilerNode compilerNode);
+	template <typename Policy> std::shared_ptr<CompilerNode> ExecuteAddConstant(CompilerNode compilerNode);
+	template <typename Policy> std::shared_ptr<CompilerNode> ExecuteSubtractConstant(CompilerNode compilerNode);
+
+	// Integer operations, for the nodes the IntegerTypeInference marked as integral
+	std::shared_ptr<CompilerNode> ExecuteIntegerGetVariable(CompilerNode compilerNode);
+	std::shared_ptr<CompilerNode> ExecuteIntegerOperation(CompilerNode compilerNode);
+	std::shared_ptr<CompilerNode> ExecuteIntegerCompare(CompilerNode compilerNode);
+	std::shared_ptr<CompilerNode> ExecuteIntegerCompareBranch(CompilerNode compilerNode);
+	std::shared_ptr<CompilerNode> ExecuteIntegerIncrement(CompilerNode compilerNode);
+	std::shared_ptr<CompilerNode> ExecuteIntegerGcd(CompilerNode compilerNode);
+	std::shared_ptr<CompilerNode> ExecuteIntegerFibonacci(CompilerNode compilerNode);
+
+	// The math operations are templates on a NumericPolicy, GetMathOperations gives the handlers for one precision
+	typedef std::shared_ptr<CompilerNode>(VirtualMachine::*Operation)(CompilerNode);
+	static std::map<std::string, Operation> GetMathOperations(NumericMode mode);
+
 	// Simple math operations
-	std::shared_ptr<CompilerNode> ExecuteAddOperation(CompilerNode compilerNode);
-	std::shared_ptr<CompilerNode> ExecuteMinusOperation(CompilerNode compilerNode);
-	std::shared_ptr<CompilerNode> ExecuteMultiplyOperation(CompilerNode compilerNode);
-	std::shared_ptr<CompilerNode> ExecuteDivideOperation(CompilerNode compilerNode);
-	std::shared_ptr<CompilerNode> ExecuteUniPlusOperation(CompilerNode compilerNode);
-	std::shared_ptr<CompilerNode> ExecuteUniMinOperation(CompilerNode compilerNode);
+	template <typename Policy> std::shared_ptr<CompilerNode> ExecuteAddOperation(CompilerNode compilerNode);
+	template <typename Policy> std::shared_ptr<CompilerNode> ExecuteMinusOperation(CompilerNode compilerNode);
+	template <typename Policy> std::shared_ptr<CompilerNode> ExecuteMultiplyOperation(CompilerNode compilerNode);
+	template <typename Policy> std::shared_ptr<CompilerNode> ExecuteDivideOperation(CompilerNode compilerNode);
+	template <typename Policy> std::shared_ptr<CompilerNode> ExecuteUniPlusOperation(CompilerNode compilerNode);
+	template <typename Policy> std::shared_ptr<CompilerNode> ExecuteUniMinOperation(CompilerNode compilerNode);
 	
     // Condition add statements
     std::shared_ptr<CompilerNode> ExecuteAnd(CompilerNode compilerNode);
@@ -77,45 +102,38 @@ public:
 	std::shared_ptr<CompilerNode> ExecuteNotEqualCondition(CompilerNode compilerNode);
 
 	// Complexer math operations
-	std::shared_ptr<CompilerNode> ExecuteSqrOperation(CompilerNode compilerNode);
-	std::shared_ptr<CompilerNode> ExecuteCbcOperation(CompilerNode compilerNode);
-	std::shared_ptr<CompilerNode> ExecutePowOperation(CompilerNode compilerNode);
-	std::shared_ptr<CompilerNode> ExecuteSqrtOperation(CompilerNode compilerNode);
-	std::shared_ptr<CompilerNode> ExecuteCbrtOperation(CompilerNode compilerNode);
-
-	std::shared_ptr<CompilerNode> ExecuteSinOperation(CompilerNode compilerNode);
-	std::shared_ptr<CompilerNode> ExecuteSinrOperation(CompilerNode compilerNode);
-	std::shared_ptr<CompilerNode> ExecuteCosOperation(CompilerNode compilerNode);
-	std::shared_ptr<CompilerNode> ExecuteCosrOperation(CompilerNode compilerNode);
-	std::shared_ptr<CompilerNode> ExecuteTanOperation(CompilerNode compilerNode);
-	std::shared_ptr<CompilerNode> ExecuteTanrOperation(CompilerNode compilerNode);
-
-	std::shared_ptr<CompilerNode> ExecuteDegreeOperation(CompilerNode compilerNode);
-	std::shared_ptr<CompilerNode> ExecuteRadiantOperation(CompilerNode compilerNode);
-	std::shared_ptr<CompilerNode> ExecutePercentOperation(CompilerNode compilerNode);
-	std::shared_ptr<CompilerNode> ExecutePermillageOperation(CompilerNode compilerNode);
-	std::shared_ptr<CompilerNode> ExecuteCommonLogOperation(CompilerNode compilerNode);
-	std::shared_ptr<CompilerNode> ExecuteBinaryLogOperation(CompilerNode compilerNode);
-	std::shared_ptr<CompilerNode> ExecuteNaturalLogOperation(CompilerNode compilerNode);
-	std::shared_ptr<CompilerNode> ExecuteLogOperation(CompilerNode compilerNode);
-	std::shared_ptr<CompilerNode> ExecuteModuloOperation(CompilerNode compilerNode);
+	template <typename Policy> std::shared_ptr<CompilerNode> ExecutePowIntOperation(CompilerNode compilerNode);
+
+	// The builtins of BuiltinMath by their index, GetBuiltinOperation gives the one for a precision
+	typedef std::shared_ptr<CompilerNode>(VirtualMachine::*BuiltinOperation)(int, CompilerNode&);
+	static BuiltinOperation GetBuiltinOperation(NumericMode mode);
+	template <typename Policy> std::shared_ptr<CompilerNode> ExecuteBuiltin(int index, CompilerNode& compilerNode);
 
+	// The builtins BuiltinMath has no handler for
 	std::shared_ptr<CompilerNode> ExecuteGcdOperation(CompilerNode compilerNode);
-	std::shared_ptr<CompilerNode> ExecuteDiscriminantOperation(CompilerNode compilerNode);
 	std::shared_ptr<CompilerNode> ExecuteAbcOperation(CompilerNode compilerNode);
 	std::shared_ptr<CompilerNode> ExecuteFibonacciOperation(CompilerNode compilerNode);
-	std::shared_ptr<CompilerNode> ExecutePythagoreanOperation(CompilerNode compilerNode);
-	std::shared_ptr<CompilerNode> ExecutePythagoreanHOperation(CompilerNode compilerNode);
-
-	std::shared_ptr<CompilerNode> ExecuteDistanceOperation(CompilerNode compilerNode);
-	std::shared_ptr<CompilerNode> ExecuteVelocityOperation(CompilerNode compilerNode);
-	std::shared_ptr<CompilerNode> ExecuteTimeOperation(CompilerNode compilerNode);
-	std::shared_ptr<CompilerNode> ExecuteAverageVelocityOperation(CompilerNode compilerNode);
-	std::shared_ptr<CompilerNode> ExecuteAccelerationOperation(CompilerNode compilerNode);
-	
+
 	std::shared_ptr<CompilerNode> ExecutePiConstant(CompilerNode compilerNode);
 	std::shared_ptr<CompilerNode> ExecuteEConstant(CompilerNode compilerNode);
 
+	// The precision of the math operations, long double unless set
+	void SetNumericMode(NumericMode mode);
+	NumericMode GetNumericMode();
+
+	// JIT settings
+	void SetJitEnabled(bool enabled);
+	void SetJitThreshold(int threshold);
+	std::string GetJitLog();
+
+	// Memoization of pure functions, off unless asked for
+	void SetMemoizeEnabled(bool enabled);
+	void SetMemoCapacity(int capacity);
+	std::string GetMemoLog();
+
+	// The statements the interpreter dispatched, the machine code doesn't count
+	long long GetExecutedNodeCount();
+
 	void run();
 	void quit();
 	void finished();
@@ -133,6 +151,8 @@ private:
 
 	// Function call methods
 	std::shared_ptr<CompilerNode> CallFunction(CompilerNode node);
+	bool IsOperation(CompilerNode& node);
+	std::shared_ptr<CompilerNode> CallOperations(CompilerNode node);
 	std::unique_ptr<FunctionCaller> function_caller;
 
 	// Check and return parameters
@@ -140,15 +160,61 @@ private:
 
 	// Nodes 
 	std::shared_ptr<LinkedList> globalsList;
-	std::vector<std::pair<std::string, std::shared_ptr<LinkedList>>> nodeLists;
+	std::vector<std::pair<Atom, std::shared_ptr<LinkedList>>> nodeLists;
 	//std::vector<std::pair<std::string, LinkedList>> nodeLists;
 
-	std::shared_ptr<LinkedList> findList(std::string key);
-	int findPosition(std::string key);
+	std::shared_ptr<LinkedList> findList(Atom key);
+	int findPosition(Atom key);
 
 	bool is_running;
+	long long executedNodes = 0;
+	NumericMode numericMode = NumericMode::LongDouble;
+
+	template <typename Policy> static std::map<std::string, Operation> MakeMathOperations();
 
 	std::string toString(long double number);
+
+	// Helpers for the fused operations
+	Symbol* GetVariableSymbol(Atom name);
+	long double GetOperandValue(std::shared_ptr<CompilerNode> operand);
+	long double RoundValue(long double value);
+	bool Compare(CompilerNode &compilerNode);
+	static bool CompareValues(std::string operation, double num1, double num2);
+
+	// Helpers for the integer operations
+	long double GetIntegerOperand(std::shared_ptr<CompilerNode> operand);
+	static long double ParseNumber(const std::string& text);
+	static bool IsSmallInteger(long double value);
+	static std::string IntegerToString(long long value);
+	std::shared_ptr<CompilerNode> Gcd(long double num1, long double num2, bool checkType);
+	std::shared_ptr<CompilerNode> Fibonacci(long double num1, bool checkType);
+
+	// Hot functions and while loops are compiled to machine code
+	struct JitCacheEntry
+	{
+		int count = 0;
+		bool tried = false;
+		std::shared_ptr<JitFunction> function;
+	};
+
+	bool jitEnabled = true;
+	int jitThreshold = 100;
+	std::string jitLog;
+	std::map<Atom, JitCacheEntry> jitFunctions;
+	std::map<CompilerNode*, JitCacheEntry> jitLoops;
+
+	bool RunJitFunction(Subroutine* subroutine, std::shared_ptr<CompilerNode> &result);
+	bool RunJitLoop(std::shared_ptr<LinkedList> nodes, std::shared_ptr<CompilerNode> loopEnd, std::shared_ptr<CompilerNode> &result);
+	bool HandleJitExit(JitFunction* function, JitExit exit, std::shared_ptr<CompilerNode> &result);
+	std::shared_ptr<ListNode> FindListNode(std::shared_ptr<LinkedList> nodes, std::shared_ptr<CompilerNode> node);
+	void LogJit(std::string name, std::shared_ptr<JitFunction> function, std::string bailoutReason);
+
+	// The results of pure functions, one bounded cache per function
+	bool memoizeEnabled = false;
+	int memoCapacity = 4096;
+	std::map<Subroutine*, std::shared_ptr<MemoCache>> memoCaches;
+
+	MemoCache* GetMemoCache(Subroutine* subroutine);
 	
 signals:
 	void PrintException(QString);
@@ -1,10 +1,18 @@
 #include <QApplication>
 
+#include "CommandLine.h"
 #include "MainController.h"
 #include "MainWindow.h"
 
 int main(int argc, const char * argv[])
 {
+	// The editor and the command line find the same program cache of the user
+	QCoreApplication::setApplicationName("42IN13SAi");
+
+	// Files on the command line are run without the editor
+	if (argc > 1)
+		return CommandLine(argc, argv).Run();
+
 	QApplication app(argc, 0);
 	std::unique_ptr<MainController> mainController(new MainController());
 	app.exec();